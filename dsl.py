@@ -124,12 +124,44 @@ DSL_HEAT_MAP_LEGEND_LOCATION_RIGHT = 1
 DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM = 2
 DSL_HEAT_MAP_LEGEND_LOCATION_LEFT = 3
 
+DSL_HEAT_MAP_DECAY_MODE_NONE = 0
+DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL = 1
+DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW = 2
+
 DSL_CAPTURE_TYPE_OBJECT = 0
 DSL_CAPTURE_TYPE_FRAME = 1
 
 DSL_ODE_TRIGGER_LIMIT_NONE = 0
 DSL_ODE_TRIGGER_LIMIT_ONE = 1
 
+DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES = 256
+
+DSL_ODE_TRIGGER_TOP_K_KEY_AREA = 0
+DSL_ODE_TRIGGER_TOP_K_KEY_CONFIDENCE = 1
+DSL_ODE_TRIGGER_TOP_K_KEY_TRACKER_CONFIDENCE = 2
+DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y = 3
+DSL_ODE_TRIGGER_TOP_K_KEY_DWELL = 4
+
+DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST = 0
+DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST = 1
+
+DSL_ODE_TRIGGER_PRIORITY_NORMAL = 0
+DSL_ODE_TRIGGER_PRIORITY_LOW = 1
+
+DSL_ODE_TRIGGER_VELOCITY_METRIC_SCALE = 1000
+
+DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STARTED = 0
+DSL_PPH_ODE_LOAD_SHEDDING_EVENT_INCREASED = 1
+DSL_PPH_ODE_LOAD_SHEDDING_EVENT_DECREASED = 2
+DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STOPPED = 3
+
+DSL_ODE_ACTION_EXECUTION_MODE_SYNC = 0
+DSL_ODE_ACTION_EXECUTION_MODE_ASYNC = 1
+
+DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_OLDEST = 0
+DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_NEWEST = 1
+DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK = 2
+
 DSL_ODE_PRE_OCCURRENCE_CHECK = 0
 DSL_ODE_POST_OCCURRENCE_CHECK = 1
 
@@ -315,6 +347,13 @@ class dsl_ode_occurrence_info(Structure):
         ('accumulative_info', dsl_ode_occurrence_accumulative_info),
         ('criteria_info', dsl_ode_occurrence_criteria_info)]
 
+class dsl_ode_runtime_metrics(Structure):
+    _fields_ = [
+        ('evaluations', c_uint64),
+        ('occurrences', c_uint64),
+        ('total_time', c_uint64),
+        ('max_time', c_uint64)]
+
 ##
 ## Pointer Typedefs
 ##
@@ -327,6 +366,7 @@ DSL_LONG_P = POINTER(c_long)
 DSL_DOUBLE_P = POINTER(c_double)
 DSL_FLOAT_P = POINTER(c_float)
 DSL_RTSP_CONNECTION_DATA_P = POINTER(dsl_rtsp_connection_data)
+DSL_ODE_RUNTIME_METRICS_P = POINTER(dsl_ode_runtime_metrics)
 
 ##
 ## Callback Typedefs
@@ -356,6 +396,10 @@ DSL_ODE_ENABLED_STATE_CHANGE_LISTENER = \
 DSL_ODE_TRIGGER_LIMIT_EVENT_LISTENER = \
     CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 
+# dsl_pph_ode_load_shedding_listener_cb
+DSL_PPH_ODE_LOAD_SHEDDING_LISTENER = \
+    CFUNCTYPE(None, c_uint, c_uint, c_uint, c_void_p)
+
 # dsl_pph_meter_client_handler_cb
 DSL_PPH_METER_CLIENT_HANDLER = \
     CFUNCTYPE(c_bool, DSL_DOUBLE_P, DSL_DOUBLE_P, c_uint, c_void_p)
@@ -1267,6 +1311,79 @@ def dsl_ode_action_enabled_state_change_listener_remove(client_listener):
     result = _dsl.dsl_ode_action_enabled_state_change_listener_remove(c_client_listener)
     return int(result)
 
+##
+## dsl_ode_action_metrics_get()
+##
+_dsl.dsl_ode_action_metrics_get.argtypes = [c_wchar_p, DSL_ODE_RUNTIME_METRICS_P]
+_dsl.dsl_ode_action_metrics_get.restype = c_uint
+def dsl_ode_action_metrics_get(name):
+    global _dsl
+    metrics = dsl_ode_runtime_metrics()
+    result = _dsl.dsl_ode_action_metrics_get(name, DSL_ODE_RUNTIME_METRICS_P(metrics))
+    return int(result), metrics
+
+##
+## dsl_ode_action_metrics_clear()
+##
+_dsl.dsl_ode_action_metrics_clear.argtypes = [c_wchar_p]
+_dsl.dsl_ode_action_metrics_clear.restype = c_uint
+def dsl_ode_action_metrics_clear(name):
+    global _dsl
+    result = _dsl.dsl_ode_action_metrics_clear(name)
+    return int(result)
+
+##
+## dsl_ode_action_execution_mode_get()
+##
+_dsl.dsl_ode_action_execution_mode_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_action_execution_mode_get.restype = c_uint
+def dsl_ode_action_execution_mode_get(name):
+    global _dsl
+    mode = c_uint(0)
+    queue_size = c_uint(0)
+    overflow_policy = c_uint(0)
+    result = _dsl.dsl_ode_action_execution_mode_get(name, 
+        DSL_UINT_P(mode), DSL_UINT_P(queue_size), DSL_UINT_P(overflow_policy))
+    return int(result), mode.value, queue_size.value, overflow_policy.value
+
+##
+## dsl_ode_action_execution_mode_set()
+##
+_dsl.dsl_ode_action_execution_mode_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint, c_uint]
+_dsl.dsl_ode_action_execution_mode_set.restype = c_uint
+def dsl_ode_action_execution_mode_set(name, mode, queue_size, overflow_policy):
+    global _dsl
+    result = _dsl.dsl_ode_action_execution_mode_set(name, 
+        mode, queue_size, overflow_policy)
+    return int(result)
+
+##
+## dsl_ode_action_queue_counters_get()
+##
+_dsl.dsl_ode_action_queue_counters_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint64)]
+_dsl.dsl_ode_action_queue_counters_get.restype = c_uint
+def dsl_ode_action_queue_counters_get(name):
+    global _dsl
+    depth = c_uint(0)
+    peak_depth = c_uint(0)
+    drops = c_uint64(0)
+    result = _dsl.dsl_ode_action_queue_counters_get(name, 
+        DSL_UINT_P(depth), DSL_UINT_P(peak_depth), DSL_UINT64_P(drops))
+    return int(result), depth.value, peak_depth.value, drops.value
+
+##
+## dsl_ode_action_queue_counters_clear()
+##
+_dsl.dsl_ode_action_queue_counters_clear.argtypes = [c_wchar_p]
+_dsl.dsl_ode_action_queue_counters_clear.restype = c_uint
+def dsl_ode_action_queue_counters_clear(name):
+    global _dsl
+    result = _dsl.dsl_ode_action_queue_counters_clear(name)
+    return int(result)
+
 
 ##
 ## dsl_ode_action_delete()
@@ -1550,6 +1667,29 @@ def dsl_ode_trigger_cross_view_settings_set(name, enabled, color, line_width):
         enabled, color, line_width)
     return int(result) 
 
+##
+## dsl_ode_trigger_tracking_miss_tolerance_get()
+##
+_dsl.dsl_ode_trigger_tracking_miss_tolerance_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint)]
+_dsl.dsl_ode_trigger_tracking_miss_tolerance_get.restype = c_uint
+def dsl_ode_trigger_tracking_miss_tolerance_get(name):
+    global _dsl
+    miss_tolerance = c_uint(0)
+    result =_dsl.dsl_ode_trigger_tracking_miss_tolerance_get(name, 
+        DSL_UINT_P(miss_tolerance))
+    return int(result), miss_tolerance.value 
+
+##
+## dsl_ode_trigger_tracking_miss_tolerance_set()
+##
+_dsl.dsl_ode_trigger_tracking_miss_tolerance_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_trigger_tracking_miss_tolerance_set.restype = c_uint
+def dsl_ode_trigger_tracking_miss_tolerance_set(name, miss_tolerance):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_tracking_miss_tolerance_set(name, miss_tolerance)
+    return int(result) 
+
 ##
 ## dsl_ode_trigger_persistence_new()
 ##
@@ -1588,6 +1728,138 @@ def dsl_ode_trigger_persistence_range_set(name, minimum, maximum):
         minimum, maximum)
     return int(result)
 
+##
+## dsl_ode_trigger_dwell_new()
+##
+_dsl.dsl_ode_trigger_dwell_new.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_dwell_new.restype = c_uint
+def dsl_ode_trigger_dwell_new(name, source, class_id, limit, threshold):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_dwell_new(name, source, class_id, limit, threshold)
+    return int(result)
+
+##
+## dsl_ode_trigger_dwell_threshold_get()
+##
+_dsl.dsl_ode_trigger_dwell_threshold_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_dwell_threshold_get.restype = c_uint
+def dsl_ode_trigger_dwell_threshold_get(name):
+    global _dsl
+    threshold = c_uint(0)
+    result =_dsl.dsl_ode_trigger_dwell_threshold_get(name, DSL_UINT_P(threshold))
+    return int(result), threshold.value
+
+##
+## dsl_ode_trigger_dwell_threshold_set()
+##
+_dsl.dsl_ode_trigger_dwell_threshold_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_trigger_dwell_threshold_set.restype = c_uint
+def dsl_ode_trigger_dwell_threshold_set(name, threshold):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_dwell_threshold_set(name, threshold)
+    return int(result)
+
+##
+## dsl_ode_trigger_dwell_occupancy_get()
+##
+_dsl.dsl_ode_trigger_dwell_occupancy_get.argtypes = [c_wchar_p, c_wchar_p, 
+    POINTER(c_uint)]
+_dsl.dsl_ode_trigger_dwell_occupancy_get.restype = c_uint
+def dsl_ode_trigger_dwell_occupancy_get(name, area):
+    global _dsl
+    occupancy = c_uint(0)
+    result =_dsl.dsl_ode_trigger_dwell_occupancy_get(name, area, 
+        DSL_UINT_P(occupancy))
+    return int(result), occupancy.value
+
+##
+## dsl_ode_trigger_velocity_new()
+##
+_dsl.dsl_ode_trigger_velocity_new.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_double, c_double]
+_dsl.dsl_ode_trigger_velocity_new.restype = c_uint
+def dsl_ode_trigger_velocity_new(name, source, class_id, limit, minimum, maximum):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_velocity_new(name, source, class_id, limit, 
+        minimum, maximum)
+    return int(result)
+
+##
+## dsl_ode_trigger_velocity_speed_range_get()
+##
+_dsl.dsl_ode_trigger_velocity_speed_range_get.argtypes = [c_wchar_p, 
+    POINTER(c_double), POINTER(c_double)]
+_dsl.dsl_ode_trigger_velocity_speed_range_get.restype = c_uint
+def dsl_ode_trigger_velocity_speed_range_get(name):
+    global _dsl
+    minimum = c_double(0)
+    maximum = c_double(0)
+    result =_dsl.dsl_ode_trigger_velocity_speed_range_get(name, 
+        DSL_DOUBLE_P(minimum), DSL_DOUBLE_P(maximum))
+    return int(result), minimum.value, maximum.value
+
+##
+## dsl_ode_trigger_velocity_speed_range_set()
+##
+_dsl.dsl_ode_trigger_velocity_speed_range_set.argtypes = [c_wchar_p, 
+    c_double, c_double]
+_dsl.dsl_ode_trigger_velocity_speed_range_set.restype = c_uint
+def dsl_ode_trigger_velocity_speed_range_set(name, minimum, maximum):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_velocity_speed_range_set(name, 
+        minimum, maximum)
+    return int(result)
+
+##
+## dsl_ode_trigger_velocity_heading_range_get()
+##
+_dsl.dsl_ode_trigger_velocity_heading_range_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_trigger_velocity_heading_range_get.restype = c_uint
+def dsl_ode_trigger_velocity_heading_range_get(name):
+    global _dsl
+    minimum = c_uint(0)
+    maximum = c_uint(0)
+    result =_dsl.dsl_ode_trigger_velocity_heading_range_get(name, 
+        DSL_UINT_P(minimum), DSL_UINT_P(maximum))
+    return int(result), minimum.value, maximum.value
+
+##
+## dsl_ode_trigger_velocity_heading_range_set()
+##
+_dsl.dsl_ode_trigger_velocity_heading_range_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint]
+_dsl.dsl_ode_trigger_velocity_heading_range_set.restype = c_uint
+def dsl_ode_trigger_velocity_heading_range_set(name, minimum, maximum):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_velocity_heading_range_set(name, 
+        minimum, maximum)
+    return int(result)
+
+##
+## dsl_ode_trigger_velocity_homography_set()
+##
+_dsl.dsl_ode_trigger_velocity_homography_set.argtypes = [c_wchar_p, 
+    c_uint, POINTER(c_double)]
+_dsl.dsl_ode_trigger_velocity_homography_set.restype = c_uint
+def dsl_ode_trigger_velocity_homography_set(name, source_id, homography):
+    global _dsl
+    arr = (c_double * len(homography))(*homography)
+    result =_dsl.dsl_ode_trigger_velocity_homography_set(name, 
+        source_id, arr)
+    return int(result)
+
+##
+## dsl_ode_trigger_velocity_homography_remove()
+##
+_dsl.dsl_ode_trigger_velocity_homography_remove.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_trigger_velocity_homography_remove.restype = c_uint
+def dsl_ode_trigger_velocity_homography_remove(name, source_id):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_velocity_homography_remove(name, source_id)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_summation_new()
 ##
@@ -1598,6 +1870,60 @@ def dsl_ode_trigger_summation_new(name, source, class_id, limit):
     result =_dsl.dsl_ode_trigger_summation_new(name, source, class_id, limit)
     return int(result)
 
+##
+## dsl_ode_trigger_class_count_new()
+##
+_dsl.dsl_ode_trigger_class_count_new.argtypes = [c_wchar_p, c_wchar_p, 
+    POINTER(c_uint), c_uint, c_uint]
+_dsl.dsl_ode_trigger_class_count_new.restype = c_uint
+def dsl_ode_trigger_class_count_new(name, source, class_ids, limit):
+    global _dsl
+    arr = (c_uint * len(class_ids))(*class_ids)
+    result =_dsl.dsl_ode_trigger_class_count_new(name, source, 
+        arr, len(class_ids), limit)
+    return int(result)
+
+##
+## dsl_ode_trigger_class_count_class_ids_get()
+##
+_dsl.dsl_ode_trigger_class_count_class_ids_get.argtypes = [c_wchar_p, 
+    POINTER(POINTER(c_uint)), POINTER(c_uint)]
+_dsl.dsl_ode_trigger_class_count_class_ids_get.restype = c_uint
+def dsl_ode_trigger_class_count_class_ids_get(name):
+    global _dsl
+    class_ids = POINTER(c_uint)()
+    num_class_ids = c_uint(0)
+    result =_dsl.dsl_ode_trigger_class_count_class_ids_get(name, 
+        byref(class_ids), DSL_UINT_P(num_class_ids))
+    return int(result), [class_ids[i] for i in range(num_class_ids.value)]
+
+##
+## dsl_ode_trigger_class_count_class_ids_set()
+##
+_dsl.dsl_ode_trigger_class_count_class_ids_set.argtypes = [c_wchar_p, 
+    POINTER(c_uint), c_uint]
+_dsl.dsl_ode_trigger_class_count_class_ids_set.restype = c_uint
+def dsl_ode_trigger_class_count_class_ids_set(name, class_ids):
+    global _dsl
+    arr = (c_uint * len(class_ids))(*class_ids)
+    result =_dsl.dsl_ode_trigger_class_count_class_ids_set(name, 
+        arr, len(class_ids))
+    return int(result)
+
+##
+## dsl_ode_trigger_class_count_counts_get()
+##
+_dsl.dsl_ode_trigger_class_count_counts_get.argtypes = [c_wchar_p, 
+    c_uint, POINTER(POINTER(c_uint)), POINTER(c_uint)]
+_dsl.dsl_ode_trigger_class_count_counts_get.restype = c_uint
+def dsl_ode_trigger_class_count_counts_get(name, source_id):
+    global _dsl
+    counts = POINTER(c_uint)()
+    size = c_uint(0)
+    result =_dsl.dsl_ode_trigger_class_count_counts_get(name, 
+        source_id, byref(counts), DSL_UINT_P(size))
+    return int(result), [counts[i] for i in range(size.value)]
+
 ##
 ## dsl_ode_trigger_count_new()
 ##
@@ -1716,6 +2042,44 @@ def dsl_ode_trigger_largest_new(name, source, class_id, limit):
     result =_dsl.dsl_ode_trigger_largest_new(name, source, class_id, limit)
     return int(result)
 
+##
+## dsl_ode_trigger_top_k_new()
+##
+_dsl.dsl_ode_trigger_top_k_new.argtypes = [c_wchar_p, c_wchar_p, 
+    c_uint, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_top_k_new.restype = c_uint
+def dsl_ode_trigger_top_k_new(name, source, class_id, limit, k, key, order):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_top_k_new(name, source, class_id, limit, 
+        k, key, order)
+    return int(result)
+
+##
+## dsl_ode_trigger_top_k_settings_get()
+##
+_dsl.dsl_ode_trigger_top_k_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_trigger_top_k_settings_get.restype = c_uint
+def dsl_ode_trigger_top_k_settings_get(name):
+    global _dsl
+    k = c_uint(0)
+    key = c_uint(0)
+    order = c_uint(0)
+    result =_dsl.dsl_ode_trigger_top_k_settings_get(name, 
+        DSL_UINT_P(k), DSL_UINT_P(key), DSL_UINT_P(order))
+    return int(result), k.value, key.value, order.value
+
+##
+## dsl_ode_trigger_top_k_settings_set()
+##
+_dsl.dsl_ode_trigger_top_k_settings_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint, c_uint]
+_dsl.dsl_ode_trigger_top_k_settings_set.restype = c_uint
+def dsl_ode_trigger_top_k_settings_set(name, k, key, order):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_top_k_settings_set(name, k, key, order)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_latest_new()
 ##
@@ -1844,6 +2208,27 @@ def dsl_ode_trigger_enabled_state_change_listener_remove(client_listener):
     result = _dsl.dsl_ode_trigger_enabled_state_change_listener_remove(c_client_listener)
     return int(result)
 
+##
+## dsl_ode_trigger_metrics_get()
+##
+_dsl.dsl_ode_trigger_metrics_get.argtypes = [c_wchar_p, DSL_ODE_RUNTIME_METRICS_P]
+_dsl.dsl_ode_trigger_metrics_get.restype = c_uint
+def dsl_ode_trigger_metrics_get(name):
+    global _dsl
+    metrics = dsl_ode_runtime_metrics()
+    result = _dsl.dsl_ode_trigger_metrics_get(name, DSL_ODE_RUNTIME_METRICS_P(metrics))
+    return int(result), metrics
+
+##
+## dsl_ode_trigger_metrics_clear()
+##
+_dsl.dsl_ode_trigger_metrics_clear.argtypes = [c_wchar_p]
+_dsl.dsl_ode_trigger_metrics_clear.restype = c_uint
+def dsl_ode_trigger_metrics_clear(name):
+    global _dsl
+    result = _dsl.dsl_ode_trigger_metrics_clear(name)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_source_get()
 ##
@@ -2085,6 +2470,27 @@ def dsl_ode_trigger_interval_set(name, interval):
     result =_dsl.dsl_ode_trigger_interval_set(name, interval)
     return int(result)
 
+##
+## dsl_ode_trigger_priority_get()
+##
+_dsl.dsl_ode_trigger_priority_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_ode_trigger_priority_get.restype = c_uint
+def dsl_ode_trigger_priority_get(name):
+    global _dsl
+    priority = c_uint(0)
+    result =_dsl.dsl_ode_trigger_priority_get(name, DSL_UINT_P(priority))
+    return int(result), priority.value
+
+##
+## dsl_ode_trigger_priority_set()
+##
+_dsl.dsl_ode_trigger_priority_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_ode_trigger_priority_set.restype = c_uint
+def dsl_ode_trigger_priority_set(name, priority):
+    global _dsl
+    result =_dsl.dsl_ode_trigger_priority_set(name, priority)
+    return int(result)
+
 ##
 ## dsl_ode_trigger_action_add()
 ##
@@ -2306,6 +2712,72 @@ def dsl_ode_accumulator_action_remove_all(name):
     result =_dsl.dsl_ode_accumulator_action_remove_all(name)
     return int(result)
 
+##
+## dsl_ode_accumulator_windows_get()
+##
+_dsl.dsl_ode_accumulator_windows_get.argtypes = [c_wchar_p, 
+    POINTER(POINTER(c_uint)), POINTER(c_uint)]
+_dsl.dsl_ode_accumulator_windows_get.restype = c_uint
+def dsl_ode_accumulator_windows_get(name):
+    global _dsl
+    lengths = POINTER(c_uint)()
+    num_lengths = c_uint(0)
+    result =_dsl.dsl_ode_accumulator_windows_get(name, 
+        byref(lengths), DSL_UINT_P(num_lengths))
+    return int(result), [lengths[i] for i in range(num_lengths.value)]
+
+##
+## dsl_ode_accumulator_windows_set()
+##
+_dsl.dsl_ode_accumulator_windows_set.argtypes = [c_wchar_p, 
+    POINTER(c_uint), c_uint]
+_dsl.dsl_ode_accumulator_windows_set.restype = c_uint
+def dsl_ode_accumulator_windows_set(name, lengths):
+    global _dsl
+    arr = (c_uint * len(lengths))(*lengths)
+    result =_dsl.dsl_ode_accumulator_windows_set(name, arr, len(lengths))
+    return int(result)
+
+##
+## dsl_ode_accumulator_window_counts_get()
+##
+_dsl.dsl_ode_accumulator_window_counts_get.argtypes = [c_wchar_p, 
+    c_uint, c_int, POINTER(DSL_UINT64_P), POINTER(c_uint)]
+_dsl.dsl_ode_accumulator_window_counts_get.restype = c_uint
+def dsl_ode_accumulator_window_counts_get(name, source_id, class_id):
+    global _dsl
+    counts = POINTER(c_uint64)()
+    size = c_uint(0)
+    result =_dsl.dsl_ode_accumulator_window_counts_get(name, 
+        source_id, class_id, byref(counts), DSL_UINT_P(size))
+    return int(result), [counts[i] for i in range(size.value)]
+
+##
+## dsl_ode_accumulator_window_threshold_get()
+##
+_dsl.dsl_ode_accumulator_window_threshold_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_accumulator_window_threshold_get.restype = c_uint
+def dsl_ode_accumulator_window_threshold_get(name):
+    global _dsl
+    window = c_uint(0)
+    threshold = c_uint(0)
+    result =_dsl.dsl_ode_accumulator_window_threshold_get(name, 
+        DSL_UINT_P(window), DSL_UINT_P(threshold))
+    return int(result), window.value, threshold.value
+
+##
+## dsl_ode_accumulator_window_threshold_set()
+##
+_dsl.dsl_ode_accumulator_window_threshold_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint]
+_dsl.dsl_ode_accumulator_window_threshold_set.restype = c_uint
+def dsl_ode_accumulator_window_threshold_set(name, window, threshold):
+    global _dsl
+    result =_dsl.dsl_ode_accumulator_window_threshold_set(name, 
+        window, threshold)
+    return int(result)
+
 ##
 ## dsl_ode_accumulator_delete()
 ##
@@ -2387,6 +2859,31 @@ def dsl_ode_heat_mapper_legend_settings_set(name, enabled, location, width, heig
         enabled, location, width, height)
     return int(result)
 
+##
+## dsl_ode_heat_mapper_decay_settings_get()
+##
+_dsl.dsl_ode_heat_mapper_decay_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_decay_settings_get.restype = c_uint
+def dsl_ode_heat_mapper_decay_settings_get(name):
+    global _dsl 
+    mode = c_uint(0)
+    period = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_decay_settings_get(name, 
+        DSL_UINT_P(mode), DSL_UINT_P(period))
+    return int(result), mode.value, period.value 
+
+##
+## dsl_ode_heat_mapper_decay_settings_set()
+##
+_dsl.dsl_ode_heat_mapper_decay_settings_set.argtypes = [c_wchar_p, 
+    c_uint, c_uint]
+_dsl.dsl_ode_heat_mapper_decay_settings_set.restype = c_uint
+def dsl_ode_heat_mapper_decay_settings_set(name, mode, period):
+    global _dsl
+    result = _dsl.dsl_ode_heat_mapper_decay_settings_set(name, mode, period)
+    return int(result)
+
 ##
 ## dsl_ode_heat_mapper_color_palette_get()
 ##
@@ -2435,6 +2932,20 @@ def dsl_ode_heat_mapper_metrics_get(name):
     print (buffer[0])
     return int(result), buffer, size.value
 
+##
+## dsl_ode_heat_mapper_metrics_source_get()
+##
+_dsl.dsl_ode_heat_mapper_metrics_source_get.argtypes = [c_wchar_p, c_uint,
+    POINTER(DSL_UINT64_P), POINTER(c_uint)]
+_dsl.dsl_ode_heat_mapper_metrics_source_get.restype = c_uint
+def dsl_ode_heat_mapper_metrics_source_get(name, source_id):
+    global _dsl 
+    buffer = POINTER(c_uint64)()
+    size = c_uint(0)
+    result = _dsl.dsl_ode_heat_mapper_metrics_source_get(name, source_id,
+        byref(buffer), DSL_UINT_P(size))
+    return int(result), buffer, size.value
+
 ##
 ## dsl_ode_heat_mapper_metrics_print()
 ##
@@ -2592,6 +3103,153 @@ def dsl_pph_ode_display_meta_alloc_size_set(name, size):
     result =_dsl.dsl_pph_ode_display_meta_alloc_size_set(name, size)
     return int(result)
 
+##
+## dsl_pph_ode_worker_count_get()
+##
+_dsl.dsl_pph_ode_worker_count_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pph_ode_worker_count_get.restype = c_uint
+def dsl_pph_ode_worker_count_get(name):
+    global _dsl
+    count = c_uint(0)
+    result =_dsl.dsl_pph_ode_worker_count_get(name, DSL_UINT_P(count))
+    return int(result), count.value
+
+##
+## dsl_pph_ode_worker_count_set()
+##
+_dsl.dsl_pph_ode_worker_count_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pph_ode_worker_count_set.restype = c_uint
+def dsl_pph_ode_worker_count_set(name, count):
+    global _dsl
+    result =_dsl.dsl_pph_ode_worker_count_set(name, count)
+    return int(result)
+
+##
+## dsl_pph_ode_action_batching_enabled_get()
+##
+_dsl.dsl_pph_ode_action_batching_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pph_ode_action_batching_enabled_get.restype = c_uint
+def dsl_pph_ode_action_batching_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_pph_ode_action_batching_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pph_ode_action_batching_enabled_set()
+##
+_dsl.dsl_pph_ode_action_batching_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pph_ode_action_batching_enabled_set.restype = c_uint
+def dsl_pph_ode_action_batching_enabled_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_pph_ode_action_batching_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pph_ode_metrics_enabled_get()
+##
+_dsl.dsl_pph_ode_metrics_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pph_ode_metrics_enabled_get.restype = c_uint
+def dsl_pph_ode_metrics_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result =_dsl.dsl_pph_ode_metrics_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value
+
+##
+## dsl_pph_ode_metrics_enabled_set()
+##
+_dsl.dsl_pph_ode_metrics_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pph_ode_metrics_enabled_set.restype = c_uint
+def dsl_pph_ode_metrics_enabled_set(name, enabled):
+    global _dsl
+    result =_dsl.dsl_pph_ode_metrics_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pph_ode_metrics_get()
+##
+_dsl.dsl_pph_ode_metrics_get.argtypes = [c_wchar_p, DSL_ODE_RUNTIME_METRICS_P]
+_dsl.dsl_pph_ode_metrics_get.restype = c_uint
+def dsl_pph_ode_metrics_get(name):
+    global _dsl
+    metrics = dsl_ode_runtime_metrics()
+    result =_dsl.dsl_pph_ode_metrics_get(name, DSL_ODE_RUNTIME_METRICS_P(metrics))
+    return int(result), metrics
+
+##
+## dsl_pph_ode_metrics_clear()
+##
+_dsl.dsl_pph_ode_metrics_clear.argtypes = [c_wchar_p]
+_dsl.dsl_pph_ode_metrics_clear.restype = c_uint
+def dsl_pph_ode_metrics_clear(name):
+    global _dsl
+    result =_dsl.dsl_pph_ode_metrics_clear(name)
+    return int(result)
+
+##
+## dsl_pph_ode_metrics_print()
+##
+_dsl.dsl_pph_ode_metrics_print.argtypes = [c_wchar_p]
+_dsl.dsl_pph_ode_metrics_print.restype = c_uint
+def dsl_pph_ode_metrics_print(name):
+    global _dsl
+    result =_dsl.dsl_pph_ode_metrics_print(name)
+    return int(result)
+
+##
+## dsl_pph_ode_time_budget_get()
+##
+_dsl.dsl_pph_ode_time_budget_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_pph_ode_time_budget_get.restype = c_uint
+def dsl_pph_ode_time_budget_get(name):
+    global _dsl
+    budget = c_uint(0)
+    max_interval = c_uint(0)
+    result =_dsl.dsl_pph_ode_time_budget_get(name, 
+        DSL_UINT_P(budget), DSL_UINT_P(max_interval))
+    return int(result), budget.value, max_interval.value
+
+##
+## dsl_pph_ode_time_budget_set()
+##
+_dsl.dsl_pph_ode_time_budget_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_pph_ode_time_budget_set.restype = c_uint
+def dsl_pph_ode_time_budget_set(name, budget, max_interval):
+    global _dsl
+    result =_dsl.dsl_pph_ode_time_budget_set(name, budget, max_interval)
+    return int(result)
+
+##
+## dsl_pph_ode_load_shedding_listener_add()
+##
+_dsl.dsl_pph_ode_load_shedding_listener_add.argtypes = [c_wchar_p,
+    DSL_PPH_ODE_LOAD_SHEDDING_LISTENER, c_void_p]
+_dsl.dsl_pph_ode_load_shedding_listener_add.restype = c_uint
+def dsl_pph_ode_load_shedding_listener_add(name, client_listener, client_data):
+    global _dsl
+    c_client_listener = DSL_PPH_ODE_LOAD_SHEDDING_LISTENER(client_listener)
+    callbacks.append(c_client_listener)
+    c_client_data=cast(pointer(py_object(client_data)), c_void_p)
+    clientdata.append(c_client_data)
+    result = _dsl.dsl_pph_ode_load_shedding_listener_add(name,
+        c_client_listener, c_client_data)
+    return int(result)
+
+##
+## dsl_pph_ode_load_shedding_listener_remove()
+##
+_dsl.dsl_pph_ode_load_shedding_listener_remove.argtypes = [c_wchar_p,
+    DSL_PPH_ODE_LOAD_SHEDDING_LISTENER]
+_dsl.dsl_pph_ode_load_shedding_listener_remove.restype = c_uint
+def dsl_pph_ode_load_shedding_listener_remove(name, client_listener):
+    global _dsl
+    c_client_listener = DSL_PPH_ODE_LOAD_SHEDDING_LISTENER(client_listener)
+    result = _dsl.dsl_pph_ode_load_shedding_listener_remove(name, 
+        c_client_listener)
+    return int(result)
+
 ##
 ## dsl_pph_custom_new()
 ##
@@ -39,8 +39,11 @@ THE SOFTWARE.
 #include <sstream>
 #include <vector>
 #include <map>
+#include <set>
+#include <bitset>
 #include <list> 
 #include <memory> 
+#include <atomic>
 #include <math.h>
 #include <fstream>
 #include <thread>
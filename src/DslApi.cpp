@@ -1254,6 +1254,83 @@ DslReturnType dsl_ode_action_enabled_state_change_listener_remove(const wchar_t*
     return DSL::Services::GetServices()->OdeActionEnabledStateChangeListenerRemove(
         cstrName.c_str(), listener);
 }
+
+DslReturnType dsl_ode_action_metrics_get(const wchar_t* name, 
+    dsl_ode_runtime_metrics* metrics)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(metrics);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionMetricsGet(
+        cstrName.c_str(), metrics);
+}
+
+DslReturnType dsl_ode_action_metrics_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionMetricsClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_ode_action_execution_mode_get(const wchar_t* name,
+    uint* mode, uint* queue_size, uint* overflow_policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(mode);
+    RETURN_IF_PARAM_IS_NULL(queue_size);
+    RETURN_IF_PARAM_IS_NULL(overflow_policy);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionExecutionModeGet(
+        cstrName.c_str(), mode, queue_size, overflow_policy);
+}
+
+DslReturnType dsl_ode_action_execution_mode_set(const wchar_t* name,
+    uint mode, uint queue_size, uint overflow_policy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionExecutionModeSet(
+        cstrName.c_str(), mode, queue_size, overflow_policy);
+}
+
+DslReturnType dsl_ode_action_queue_counters_get(const wchar_t* name,
+    uint* depth, uint* peak_depth, uint64_t* drops)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(depth);
+    RETURN_IF_PARAM_IS_NULL(peak_depth);
+    RETURN_IF_PARAM_IS_NULL(drops);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionQueueCountersGet(
+        cstrName.c_str(), depth, peak_depth, drops);
+}
+
+DslReturnType dsl_ode_action_queue_counters_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeActionQueueCountersClear(
+        cstrName.c_str());
+}
     
 DslReturnType dsl_ode_action_delete(const wchar_t* name)
 {
@@ -1497,6 +1574,66 @@ DslReturnType dsl_ode_trigger_summation_new(const wchar_t* name,
         cstrSource.c_str(), class_id, limit);
 }
 
+DslReturnType dsl_ode_trigger_class_count_new(const wchar_t* name, 
+    const wchar_t* source, const uint* class_ids, uint num_class_ids, uint limit)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(class_ids);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerClassCountNew(cstrName.c_str(), 
+        cstrSource.c_str(), class_ids, num_class_ids, limit);
+}
+
+DslReturnType dsl_ode_trigger_class_count_class_ids_get(const wchar_t* name, 
+    const uint** class_ids, uint* num_class_ids)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(class_ids);
+    RETURN_IF_PARAM_IS_NULL(num_class_ids);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassCountClassIdsGet(
+        cstrName.c_str(), class_ids, num_class_ids);
+}
+
+DslReturnType dsl_ode_trigger_class_count_class_ids_set(const wchar_t* name, 
+    const uint* class_ids, uint num_class_ids)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(class_ids);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassCountClassIdsSet(
+        cstrName.c_str(), class_ids, num_class_ids);
+}
+
+DslReturnType dsl_ode_trigger_class_count_counts_get(const wchar_t* name, 
+    uint source_id, const uint** counts, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(counts);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerClassCountCountsGet(
+        cstrName.c_str(), source_id, counts, size);
+}
+
 DslReturnType dsl_ode_trigger_new_high_new(const wchar_t* name, 
     const wchar_t* source, uint class_id, uint limit, uint preset)
 {
@@ -1700,6 +1837,51 @@ DslReturnType dsl_ode_trigger_largest_new(const wchar_t* name,
         cstrName.c_str(), cstrSource.c_str(), class_id, limit);
 }
 
+DslReturnType dsl_ode_trigger_top_k_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, uint k, uint key, uint order)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerTopKNew(cstrName.c_str(), 
+        cstrSource.c_str(), class_id, limit, k, key, order);
+}
+
+DslReturnType dsl_ode_trigger_top_k_settings_get(const wchar_t* name, 
+    uint* k, uint* key, uint* order)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(k);
+    RETURN_IF_PARAM_IS_NULL(key);
+    RETURN_IF_PARAM_IS_NULL(order);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerTopKSettingsGet(
+        cstrName.c_str(), k, key, order);
+}
+
+DslReturnType dsl_ode_trigger_top_k_settings_set(const wchar_t* name, 
+    uint k, uint key, uint order)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerTopKSettingsSet(
+        cstrName.c_str(), k, key, order);
+}
+
 DslReturnType dsl_ode_trigger_cross_new(const wchar_t* name, 
     const wchar_t* source, uint class_id, uint limit, uint min_frame_count, 
     uint max_frame_count, uint test_method)
@@ -1762,6 +1944,160 @@ DslReturnType dsl_ode_trigger_persistence_range_set(const wchar_t* name,
         cstrName.c_str(), minimum, maximum);
 }
     
+DslReturnType dsl_ode_trigger_dwell_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, uint threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerDwellNew(
+        cstrName.c_str(), cstrSource.c_str(), class_id, limit, threshold);
+}
+
+DslReturnType dsl_ode_trigger_dwell_threshold_get(const wchar_t* name, 
+    uint* threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(threshold);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerDwellThresholdGet(
+        cstrName.c_str(), threshold);
+}
+    
+DslReturnType dsl_ode_trigger_dwell_threshold_set(const wchar_t* name, 
+    uint threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerDwellThresholdSet(
+        cstrName.c_str(), threshold);
+}
+
+DslReturnType dsl_ode_trigger_dwell_occupancy_get(const wchar_t* name, 
+    const wchar_t* area, uint* occupancy)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(area);
+    RETURN_IF_PARAM_IS_NULL(occupancy);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrArea(area);
+    std::string cstrArea(wstrArea.begin(), wstrArea.end());
+
+    return DSL::Services::GetServices()->OdeTriggerDwellOccupancyGet(
+        cstrName.c_str(), cstrArea.c_str(), occupancy);
+}
+    
+DslReturnType dsl_ode_trigger_velocity_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, double minimum, double maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    std::string cstrSource;
+    if (source)
+    {
+        std::wstring wstrSource(source);
+        cstrSource.assign(wstrSource.begin(), wstrSource.end());
+    }
+    return DSL::Services::GetServices()->OdeTriggerVelocityNew(
+        cstrName.c_str(), cstrSource.c_str(), class_id, limit, minimum, maximum);
+}
+
+DslReturnType dsl_ode_trigger_velocity_speed_range_get(const wchar_t* name, 
+    double* minimum, double* maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(minimum);
+    RETURN_IF_PARAM_IS_NULL(maximum);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerVelocitySpeedRangeGet(
+        cstrName.c_str(), minimum, maximum);
+}
+    
+DslReturnType dsl_ode_trigger_velocity_speed_range_set(const wchar_t* name, 
+    double minimum, double maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerVelocitySpeedRangeSet(
+        cstrName.c_str(), minimum, maximum);
+}
+
+DslReturnType dsl_ode_trigger_velocity_heading_range_get(const wchar_t* name, 
+    uint* minimum, uint* maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(minimum);
+    RETURN_IF_PARAM_IS_NULL(maximum);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerVelocityHeadingRangeGet(
+        cstrName.c_str(), minimum, maximum);
+}
+    
+DslReturnType dsl_ode_trigger_velocity_heading_range_set(const wchar_t* name, 
+    uint minimum, uint maximum)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerVelocityHeadingRangeSet(
+        cstrName.c_str(), minimum, maximum);
+}
+
+DslReturnType dsl_ode_trigger_velocity_homography_set(const wchar_t* name, 
+    uint source_id, const double* homography)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(homography);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerVelocityHomographySet(
+        cstrName.c_str(), source_id, homography);
+}
+
+DslReturnType dsl_ode_trigger_velocity_homography_remove(const wchar_t* name, 
+    uint source_id)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerVelocityHomographyRemove(
+        cstrName.c_str(), source_id);
+}
+    
 DslReturnType dsl_ode_trigger_latest_new(const wchar_t* name, 
     const wchar_t* source, uint class_id, uint limit)
 {
@@ -1865,6 +2201,31 @@ DslReturnType dsl_ode_trigger_cross_view_settings_set(const wchar_t* name,
         enabled, cstrColor.c_str(), line_width);
 }
     
+DslReturnType dsl_ode_trigger_tracking_miss_tolerance_get(const wchar_t* name, 
+    uint* miss_tolerance)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(miss_tolerance);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerTrackingMissToleranceGet(
+        cstrName.c_str(), miss_tolerance);
+}
+
+DslReturnType dsl_ode_trigger_tracking_miss_tolerance_set(const wchar_t* name, 
+    uint miss_tolerance)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerTrackingMissToleranceSet(
+        cstrName.c_str(), miss_tolerance);
+}
+    
 DslReturnType dsl_ode_trigger_reset(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -1966,6 +2327,30 @@ DslReturnType dsl_ode_trigger_enabled_state_change_listener_remove(const wchar_t
     return DSL::Services::GetServices()->OdeTriggerEnabledStateChangeListenerRemove(
         cstrName.c_str(), listener);
 }
+
+DslReturnType dsl_ode_trigger_metrics_get(const wchar_t* name, 
+    dsl_ode_runtime_metrics* metrics)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(metrics);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerMetricsGet(
+        cstrName.c_str(), metrics);
+}
+
+DslReturnType dsl_ode_trigger_metrics_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerMetricsClear(
+        cstrName.c_str());
+}
     
 DslReturnType dsl_ode_trigger_class_id_get(const wchar_t* name, uint* class_id)
 {
@@ -2284,6 +2669,27 @@ DslReturnType dsl_ode_trigger_interval_set(const wchar_t* name, uint interval)
     return DSL::Services::GetServices()->OdeTriggerIntervalSet(cstrName.c_str(), interval);
 }
 
+DslReturnType dsl_ode_trigger_priority_get(const wchar_t* name, uint* priority)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(priority);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerPriorityGet(cstrName.c_str(), priority);
+}
+
+DslReturnType dsl_ode_trigger_priority_set(const wchar_t* name, uint priority)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeTriggerPrioritySet(cstrName.c_str(), priority);
+}
+
 DslReturnType dsl_ode_trigger_action_add(const wchar_t* name, const wchar_t* action)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2630,6 +3036,76 @@ DslReturnType dsl_ode_accumulator_action_remove_all(const wchar_t* name)
     return DSL::Services::GetServices()->OdeAccumulatorActionRemoveAll(cstrName.c_str());
 }
 
+DslReturnType dsl_ode_accumulator_windows_get(const wchar_t* name, 
+    const uint** lengths, uint* num_lengths)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(lengths);
+    RETURN_IF_PARAM_IS_NULL(num_lengths);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->OdeAccumulatorWindowsGet(
+        cstrName.c_str(), lengths, num_lengths);
+}
+
+DslReturnType dsl_ode_accumulator_windows_set(const wchar_t* name, 
+    const uint* lengths, uint num_lengths)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    if (num_lengths)
+    {
+        RETURN_IF_PARAM_IS_NULL(lengths);
+    }
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->OdeAccumulatorWindowsSet(
+        cstrName.c_str(), lengths, num_lengths);
+}
+
+DslReturnType dsl_ode_accumulator_window_counts_get(const wchar_t* name, 
+    uint source_id, int class_id, const uint64_t** counts, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(counts);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->OdeAccumulatorWindowCountsGet(
+        cstrName.c_str(), source_id, class_id, counts, size);
+}
+
+DslReturnType dsl_ode_accumulator_window_threshold_get(const wchar_t* name, 
+    uint* window, uint* threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(window);
+    RETURN_IF_PARAM_IS_NULL(threshold);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->OdeAccumulatorWindowThresholdGet(
+        cstrName.c_str(), window, threshold);
+}
+
+DslReturnType dsl_ode_accumulator_window_threshold_set(const wchar_t* name, 
+    uint window, uint threshold)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    
+    return DSL::Services::GetServices()->OdeAccumulatorWindowThresholdSet(
+        cstrName.c_str(), window, threshold);
+}
+
 DslReturnType dsl_ode_accumulator_delete(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2745,6 +3221,32 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name,
         cstrName.c_str(), enabled, location, width, height);
 }
 
+DslReturnType dsl_ode_heat_mapper_decay_settings_get(const wchar_t* name, 
+    uint* mode, uint* period)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(mode);
+    RETURN_IF_PARAM_IS_NULL(period);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperDecaySettingsGet(
+        cstrName.c_str(), mode, period);
+}
+
+DslReturnType dsl_ode_heat_mapper_decay_settings_set(const wchar_t* name, 
+    uint mode, uint period)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperDecaySettingsSet(
+        cstrName.c_str(), mode, period);
+}
+
 DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -2769,6 +3271,20 @@ DslReturnType dsl_ode_heat_mapper_metrics_get(const wchar_t* name,
         cstrName.c_str(), buffer, size);
 }
 
+DslReturnType dsl_ode_heat_mapper_metrics_source_get(const wchar_t* name,
+    uint source_id, const uint64_t** buffer, uint* size)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(buffer);
+    RETURN_IF_PARAM_IS_NULL(size);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->OdeHeatMapperMetricsSourceGet(
+        cstrName.c_str(), source_id, buffer, size);
+}
+
 DslReturnType dsl_ode_heat_mapper_metrics_print(const wchar_t* name)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -3000,6 +3516,164 @@ DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint
         cstrName.c_str(), size);
 }
 
+DslReturnType dsl_pph_ode_worker_count_get(const wchar_t* name, uint* count)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(count);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeWorkerCountGet(
+        cstrName.c_str(), count);
+}
+
+DslReturnType dsl_pph_ode_worker_count_set(const wchar_t* name, uint count)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeWorkerCountSet(
+        cstrName.c_str(), count);
+}
+
+DslReturnType dsl_pph_ode_action_batching_enabled_get(const wchar_t* name, 
+    boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeActionBatchingEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_action_batching_enabled_set(const wchar_t* name, 
+    boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeActionBatchingEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_metrics_enabled_get(const wchar_t* name, boolean* enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(enabled);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeMetricsEnabledGet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_metrics_enabled_set(const wchar_t* name, boolean enabled)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeMetricsEnabledSet(
+        cstrName.c_str(), enabled);
+}
+
+DslReturnType dsl_pph_ode_metrics_get(const wchar_t* name, 
+    dsl_ode_runtime_metrics* metrics)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(metrics);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeMetricsGet(
+        cstrName.c_str(), metrics);
+}
+
+DslReturnType dsl_pph_ode_metrics_clear(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeMetricsClear(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_pph_ode_metrics_print(const wchar_t* name)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeMetricsPrint(
+        cstrName.c_str());
+}
+
+DslReturnType dsl_pph_ode_time_budget_get(const wchar_t* name, 
+    uint* budget, uint* max_interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(budget);
+    RETURN_IF_PARAM_IS_NULL(max_interval);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeTimeBudgetGet(
+        cstrName.c_str(), budget, max_interval);
+}
+
+DslReturnType dsl_pph_ode_time_budget_set(const wchar_t* name, 
+    uint budget, uint max_interval)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeTimeBudgetSet(
+        cstrName.c_str(), budget, max_interval);
+}
+
+DslReturnType dsl_pph_ode_load_shedding_listener_add(const wchar_t* name,
+    dsl_pph_ode_load_shedding_listener_cb listener, void* client_data)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeLoadSheddingListenerAdd(
+        cstrName.c_str(), listener, client_data);
+}
+
+DslReturnType dsl_pph_ode_load_shedding_listener_remove(const wchar_t* name,
+    dsl_pph_ode_load_shedding_listener_cb listener)
+{
+    RETURN_IF_PARAM_IS_NULL(name);
+    RETURN_IF_PARAM_IS_NULL(listener);
+
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->PphOdeLoadSheddingListenerRemove(
+        cstrName.c_str(), listener);
+}
+
 DslReturnType dsl_pph_enabled_get(const wchar_t* name, boolean* enabled)
 {
     RETURN_IF_PARAM_IS_NULL(name);
@@ -278,6 +278,8 @@ THE SOFTWARE.
 #define DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE                       0x000D0009
 #define DSL_RESULT_PPH_METER_INVALID_INTERVAL                       0x0004000A
 #define DSL_RESULT_PPH_PAD_TYPE_INVALID                             0x0004000B
+#define DSL_RESULT_PPH_CALLBACK_ADD_FAILED                          0x000D000C
+#define DSL_RESULT_PPH_CALLBACK_REMOVE_FAILED                       0x000D000D
 
 /**
  * ODE Trigger API Return Values
@@ -638,6 +640,18 @@ THE SOFTWARE.
 #define DSL_HEAT_MAP_LEGEND_LOCATION_RIGHT                          1
 #define DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM                         2
 #define DSL_HEAT_MAP_LEGEND_LOCATION_LEFT                           3
+
+/**
+ * @brief Heat-Map decay modes.
+ */
+#define DSL_HEAT_MAP_DECAY_MODE_NONE                                0
+#define DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL                         1
+#define DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW                      2
+
+/**
+ * @brief Maximum number of rolling windows for an ODE Accumulator.
+ */
+#define DSL_ODE_ACCUMULATOR_MAX_WINDOWS                             4
  
 /**
  * @brief On-Screen Heat-Map legend locations.
@@ -657,6 +671,26 @@ THE SOFTWARE.
 #define DSL_ODE_TRIGGER_LIMIT_NONE                                  0
 #define DSL_ODE_TRIGGER_LIMIT_ONE                                   1
 
+/**
+ * @brief Maximum number of class-ids, 0 through 255, for a Class Count Trigger
+ */
+#define DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES                     256
+
+/**
+ * @brief Object keys to rank the objects of a frame by for the Top-K Trigger
+ */
+#define DSL_ODE_TRIGGER_TOP_K_KEY_AREA                              0
+#define DSL_ODE_TRIGGER_TOP_K_KEY_CONFIDENCE                        1
+#define DSL_ODE_TRIGGER_TOP_K_KEY_TRACKER_CONFIDENCE                2
+#define DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y                          3
+#define DSL_ODE_TRIGGER_TOP_K_KEY_DWELL                             4
+
+/**
+ * @brief Top-K Trigger orders, i.e. which end of the key's range to select
+ */
+#define DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST                        0
+#define DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST                         1
+
 /**
  * @brief ODE Trigger limit state values - for Triggers with limits
  */
@@ -664,6 +698,41 @@ THE SOFTWARE.
 #define DSL_ODE_TRIGGER_LIMIT_EVENT_LIMIT_CHANGED                   1
 #define DSL_ODE_TRIGGER_LIMIT_EVENT_COUNT_RESET                     2
 
+/**
+ * @brief ODE Trigger load-shedding priorities. LOW priority Triggers are 
+ * decimated by their ODE Pad Probe Handler when over its time budget.
+ */
+#define DSL_ODE_TRIGGER_PRIORITY_NORMAL                             0
+#define DSL_ODE_TRIGGER_PRIORITY_LOW                                1
+
+/**
+ * @brief Scale of the speed set as the primary metric by the Velocity Trigger,
+ * i.e. the metric is the speed in thousandths of pixels (or world units) per 
+ * second. 
+ */
+#define DSL_ODE_TRIGGER_VELOCITY_METRIC_SCALE                       1000
+
+/**
+ * @brief ODE Pad Probe Handler load-shedding events
+ */
+#define DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STARTED                     0
+#define DSL_PPH_ODE_LOAD_SHEDDING_EVENT_INCREASED                   1
+#define DSL_PPH_ODE_LOAD_SHEDDING_EVENT_DECREASED                   2
+#define DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STOPPED                     3
+
+/**
+ * @brief ODE Action execution modes
+ */
+#define DSL_ODE_ACTION_EXECUTION_MODE_SYNC                          0
+#define DSL_ODE_ACTION_EXECUTION_MODE_ASYNC                         1
+
+/**
+ * @brief ODE Action async-queue overflow policies
+ */
+#define DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_OLDEST                   0
+#define DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_NEWEST                   1
+#define DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK                         2
+
 /**
  * @brief Unique class relational identifiers for Class A/B testing
  */
@@ -1286,6 +1355,41 @@ typedef struct _dsl_ode_occurrence_info
        
 } dsl_ode_occurrence_info;
 
+/**
+ * @struct dsl_ode_runtime_metrics
+ * @brief Runtime metrics accumulated by an ODE Trigger, ODE Action, or 
+ * ODE Pad Probe Handler while metrics are enabled for the Handler.
+ */
+typedef struct _dsl_ode_runtime_metrics
+{
+    /**
+     * @brief number of evaluations. For Triggers, the number of object checks
+     * plus frame post-processing checks. For Actions, the number of occurrences 
+     * handled. For Handlers, the number of frames processed.
+     */
+    uint64_t evaluations;
+    
+    /**
+     * @brief number of ODE occurrences. For Actions, the number of occurrences
+     * handled. For Handlers, the sum of all Trigger occurrences.
+     */
+    uint64_t occurrences;
+
+    /**
+     * @brief cumulative time spent in nanoseconds. Trigger time includes 
+     * the time spent in all of its Actions.
+     */
+    uint64_t total_time;
+    
+    /**
+     * @brief maximum time spent in nanoseconds. For Triggers, the longest 
+     * single frame. For Actions, the longest single occurrence. For Handlers, 
+     * the longest single batch.
+     */
+    uint64_t max_time;
+    
+} dsl_ode_runtime_metrics;
+
 //------------------------------------------------------------------------------------
 
 /**
@@ -1295,7 +1399,10 @@ typedef struct _dsl_ode_occurrence_info
  * @param[in] event_id unique ODE occurrence ID, numerically ordered by occurrence.
  * @param[in] trigger unique name of the ODE Event Trigger that triggered the occurrence.
  * @param[in] buffer pointer to the frame buffer of type GstBuffer.
- * @param[in] display_meta pointer to a NvDsDisplayMeta structure.
+ * @param[in] display_meta pointer to a NvDsDisplayMeta structure. The structure is
+ * always acquired and added to the frame on invocation, whether used or not. 
+ * Note: This parameter will be set to NULL if the Pad Probe Handler's display meta 
+ * is disabled or if the Action is executed asynchronously.
  * @param[in] frame_meta pointer to the NvDsFrameMeta structure that triggered the ODE event.
  * @param[in] object_meta pointer to the NvDsObjectMeta structure that triggered the ODE event.
  * Note: This parameter will be set to NULL for ODE occurrences detected in Post process frame. 
@@ -1365,6 +1472,20 @@ typedef boolean (*dsl_ode_post_process_frame_cb)(void* buffer,
  typedef void (*dsl_ode_trigger_limit_event_listener_cb)
     (uint event, uint limit, void* client_data);
 
+/**
+ * @brief Callback typedef for a client listener function. Once added to an
+ * ODE Pad Probe Handler, this function will be called on every change to the
+ * Handler's load-shedding state; STARTED, INCREASED, DECREASED, and STOPPED.
+ * @param[in] event one of the DSL_PPH_ODE_LOAD_SHEDDING_EVENT constants.
+ * @param[in] interval the new load-shedding interval in units of frames. LOW 
+ * priority Triggers process one in every interval frames, 0 = all frames are 
+ * skipped if shedding, or all frames are processed if STOPPED.
+ * @param[in] batch_time the current average batch processing time in microseconds.
+ * @param[in] client_data opaque pointer to client's user data.
+ */
+ typedef void (*dsl_pph_ode_load_shedding_listener_cb)
+    (uint event, uint interval, uint batch_time, void* client_data);
+
 /**
  * @brief callback typedef for a client to handle new Pipeline performance data
  * calcaulated by the Meter Pad Probe Handler, at an intervel specified by the client.
@@ -2396,6 +2517,73 @@ DslReturnType dsl_ode_action_enabled_state_change_listener_add(const wchar_t* na
  */
 DslReturnType dsl_ode_action_enabled_state_change_listener_remove(const wchar_t* name,
     dsl_ode_enabled_state_change_listener_cb listener);
+
+/**
+ * @brief Gets the current runtime metrics for the named ODE Action. Metrics are
+ * only recorded while the Action is invoked by an ODE Pad Probe Handler with 
+ * metrics enabled. See dsl_pph_ode_metrics_enabled_set.
+ * @param[in] name unique name of the ODE Action to query.
+ * @param[out] metrics current runtime metrics for the ODE Action.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_metrics_get(const wchar_t* name,
+    dsl_ode_runtime_metrics* metrics);
+
+/**
+ * @brief Clears the current runtime metrics for the named ODE Action.
+ * @param[in] name unique name of the ODE Action to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_metrics_clear(const wchar_t* name);
+
+/**
+ * @brief Gets the current execution mode settings for the named ODE Action.
+ * @param[in] name unique name of the ODE Action to query.
+ * @param[out] mode one of the DSL_ODE_ACTION_EXECUTION_MODE constants.
+ * Default = DSL_ODE_ACTION_EXECUTION_MODE_SYNC.
+ * @param[out] queue_size maximum number of occurrences queued for async execution.
+ * @param[out] overflow_policy one of the DSL_ODE_ACTION_QUEUE_OVERFLOW constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_execution_mode_get(const wchar_t* name,
+    uint* mode, uint* queue_size, uint* overflow_policy);
+
+/**
+ * @brief Sets the execution mode settings for the named ODE Action. In async
+ * mode, each occurrence is copied into a bounded queue and executed on a worker
+ * thread owned by the Action. Only the File, Print, Log, and Custom ODE Actions
+ * support async mode. Occurrences queued under the previous settings are 
+ * executed before the call returns.
+ * @param[in] name unique name of the ODE Action to update.
+ * @param[in] mode one of the DSL_ODE_ACTION_EXECUTION_MODE constants.
+ * @param[in] queue_size maximum number of occurrences queued for async execution.
+ * @param[in] overflow_policy one of the DSL_ODE_ACTION_QUEUE_OVERFLOW constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_execution_mode_set(const wchar_t* name,
+    uint mode, uint queue_size, uint overflow_policy);
+
+/**
+ * @brief Gets the current async-queue counters for the named ODE Action. 
+ * All counters are 0 while in sync mode, and are reset on each call to
+ * dsl_ode_action_execution_mode_set.
+ * @param[in] name unique name of the ODE Action to query.
+ * @param[out] depth current number of queued occurrences.
+ * @param[out] peak_depth maximum queue depth since set or last cleared.
+ * @param[out] drops number of occurrences dropped on queue overflow since 
+ * set or last cleared.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_queue_counters_get(const wchar_t* name,
+    uint* depth, uint* peak_depth, uint64_t* drops);
+
+/**
+ * @brief Clears the async-queue peak-depth and drop counters for the named 
+ * ODE Action.
+ * @param[in] name unique name of the ODE Action to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_ACTION_RESULT otherwise.
+ */
+DslReturnType dsl_ode_action_queue_counters_clear(const wchar_t* name);
     
 /**
  * @brief Deletes an ODE Action of any type
@@ -2651,6 +2839,45 @@ DslReturnType dsl_ode_trigger_smallest_new(const wchar_t* name,
 DslReturnType dsl_ode_trigger_largest_new(const wchar_t* name, 
     const wchar_t* source, uint class_id, uint limit);
 
+/**
+ * @brief Top-K trigger that checks for the occurrence of Objects within a frame
+ * and Triggers on the K Objects with the smallest or largest key value, one
+ * ODE occurrence per Object in rank order. 
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] k maximum number of Objects to trigger on per frame, at least 1.
+ * @param[in] key one of the DSL_ODE_TRIGGER_TOP_K_KEY constants.
+ * @param[in] order one of the DSL_ODE_TRIGGER_TOP_K_ORDER constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_top_k_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, uint k, uint key, uint order);
+
+/**
+ * @brief Gets the current K, key, and order settings in use by the 
+ * named Top-K Trigger
+ * @param[in] name unique name of the Top-K Trigger to query
+ * @param[out] k current maximum number of Objects to trigger on per frame.
+ * @param[out] key current DSL_ODE_TRIGGER_TOP_K_KEY in use.
+ * @param[out] order current DSL_ODE_TRIGGER_TOP_K_ORDER in use.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_top_k_settings_get(const wchar_t* name, 
+    uint* k, uint* key, uint* order);
+
+/**
+ * @brief Sets the K, key, and order settings to use for a named Top-K Trigger
+ * @param[in] name unique name of the Top-K Trigger to update
+ * @param[in] k new maximum number of Objects to trigger on per frame, at least 1.
+ * @param[in] key new DSL_ODE_TRIGGER_TOP_K_KEY to use.
+ * @param[in] order new DSL_ODE_TRIGGER_TOP_K_ORDER to use.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_top_k_settings_set(const wchar_t* name, 
+    uint k, uint key, uint order);
+
 /**
  * @brief Summation trigger that checks for and sums all objects detected within a frame
  * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
@@ -2662,6 +2889,59 @@ DslReturnType dsl_ode_trigger_largest_new(const wchar_t* name,
 DslReturnType dsl_ode_trigger_summation_new(const wchar_t* name, 
     const wchar_t* source, uint class_id, uint limit);
 
+/**
+ * @brief Class Count trigger that counts all objects detected within a frame,
+ * per class, for a set of class-ids in a single pass over the frame's objects.
+ * The Trigger generates one ODE occurrence per frame, like the Summation Trigger.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_ids array of class-ids to count, each less than
+ * DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES
+ * @param[in] num_class_ids number of class-ids in the class_ids array
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_count_new(const wchar_t* name, 
+    const wchar_t* source, const uint* class_ids, uint num_class_ids, uint limit);
+
+/**
+ * @brief Gets the current set of class-ids counted by the named Class Count Trigger.
+ * @param[in] name unique name of the Class Count Trigger to query
+ * @param[out] class_ids array of class-ids in ascending order. The array 
+ * remains valid until the next class-ids update.
+ * @param[out] num_class_ids number of class-ids in the class_ids array
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_count_class_ids_get(const wchar_t* name, 
+    const uint** class_ids, uint* num_class_ids);
+
+/**
+ * @brief Sets the set of class-ids to count for the named Class Count Trigger.
+ * All per-class counts are cleared on update.
+ * @param[in] name unique name of the Class Count Trigger to update
+ * @param[in] class_ids array of class-ids to count, each less than
+ * DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES
+ * @param[in] num_class_ids number of class-ids in the class_ids array
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_count_class_ids_set(const wchar_t* name, 
+    const uint* class_ids, uint num_class_ids);
+
+/**
+ * @brief Gets the per-class counts from the last frame processed for a given 
+ * source by the named Class Count Trigger. Safe to call from an ODE Action 
+ * invoked by the Trigger.
+ * @param[in] name unique name of the Class Count Trigger to query
+ * @param[in] source_id unique source id to query for
+ * @param[out] counts array of counts, one per class-id in the order returned by
+ * dsl_ode_trigger_class_count_class_ids_get. The array remains valid until the 
+ * next call to this service.
+ * @param[out] size number of counts in the counts array
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_class_count_counts_get(const wchar_t* name, 
+    uint source_id, const uint** counts, uint* size);
+
 
 /**
  * @brief New high-count trigger that checks for the occurrence of a new high count of objects within 
@@ -2820,6 +3100,148 @@ DslReturnType dsl_ode_trigger_persistence_range_get(const wchar_t* name,
 DslReturnType dsl_ode_trigger_persistence_range_set(const wchar_t* name, 
     uint minimum, uint maximum);
     
+/**
+ * @brief Dwell trigger that measures the time each Object tracked for a specified 
+ * source and object class_id remains inside each of the Trigger's ODE Areas. 
+ * An ODE occurrence is triggered once per Object visit to an Area when the time 
+ * inside the Area reaches the threshold. The Trigger maintains the current 
+ * occupancy - the number of tracked Objects inside - for each of its Areas.
+ * At least one ODE Area must be added to the Trigger.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] threshold the amount of time a unique object must remain inside an
+ * Area before triggering an ODE occurrence - in units of seconds. 0 = on entry.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dwell_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, uint threshold);
+
+/**
+ * @brief Gets the current dwell-time threshold in use by the named Dwell Trigger
+ * @param[in] name unique name of the Dwell Trigger to query
+ * @param[out] threshold the amount of time a unique object must remain inside an
+ * Area before triggering an ODE occurrence - in units of seconds. 
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dwell_threshold_get(const wchar_t* name, 
+    uint* threshold);
+
+/**
+ * @brief Sets the dwell-time threshold to use for the named Dwell Trigger
+ * @param[in] name unique name of the Dwell Trigger to update
+ * @param[in] threshold the amount of time a unique object must remain inside an
+ * Area before triggering an ODE occurrence - in units of seconds. 0 = on entry.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dwell_threshold_set(const wchar_t* name, 
+    uint threshold);
+
+/**
+ * @brief Gets the current occupancy - the number of tracked Objects inside - 
+ * of one of the named Dwell Trigger's ODE Areas, for all sources.
+ * @param[in] name unique name of the Dwell Trigger to query
+ * @param[in] area unique name of the ODE Area, a child of the Trigger, to query.
+ * @param[out] occupancy current number of tracked Objects inside the Area.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_dwell_occupancy_get(const wchar_t* name, 
+    const wchar_t* area, uint* occupancy);
+    
+/**
+ * @brief Velocity trigger that maintains a running estimate of the speed and 
+ * heading of each Object tracked for a specified source and object class_id.
+ * Each object with a speed >= minimum and <= maximum, and a heading within the
+ * Trigger's heading range, will trigger an ODE occurrence. Speed is measured 
+ * in pixels per second, or in world units per second for a source with a 
+ * homography set. The primary metric is set to the speed multiplied by 
+ * DSL_ODE_TRIGGER_VELOCITY_METRIC_SCALE.
+ * @param[in] name unique name for the ODE Trigger
+ * @param[in] source unique source name filter for the ODE Trigger, NULL = ANY_SOURCE
+ * @param[in] class_id class id filter for this ODE Trigger
+ * @param[in] limit limits the number of ODE occurrences, a value of 0 = NO limit
+ * @param[in] minimum the minimum speed of a unique object to trigger an 
+ * ODE occurrence. 0 = no minimum
+ * @param[in] maximum the maximum speed of a unique object to trigger an 
+ * ODE occurrence. 0 = no maximum
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_new(const wchar_t* name, 
+    const wchar_t* source, uint class_id, uint limit, double minimum, double maximum);
+
+/**
+ * @brief Gets the current minimum and maximum speed settings in use 
+ * by the named Velocity Trigger
+ * @param[in] name unique name of the Velocity Trigger to query
+ * @param[out] minimum the minimum speed of a unique object to trigger an 
+ * ODE occurrence. 0 = no minimum
+ * @param[out] maximum the maximum speed of a unique object to trigger an 
+ * ODE occurrence. 0 = no maximum
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_speed_range_get(const wchar_t* name, 
+    double* minimum, double* maximum);
+
+/**
+ * @brief Sets the minimum and maximum speed settings to use for a 
+ * named Velocity Trigger
+ * @param[in] name unique name of the Velocity Trigger to update
+ * @param[in] minimum the minimum speed of a unique object to trigger an 
+ * ODE occurrence. 0 = no minimum
+ * @param[in] maximum the maximum speed of a unique object to trigger an 
+ * ODE occurrence. 0 = no maximum
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_speed_range_set(const wchar_t* name, 
+    double minimum, double maximum);
+
+/**
+ * @brief Gets the current heading range in use by the named Velocity Trigger.
+ * Headings are in degrees, clockwise from the positive x-axis.
+ * @param[in] name unique name of the Velocity Trigger to query
+ * @param[out] minimum start of the heading range in degrees.
+ * @param[out] maximum end of the heading range in degrees.
+ * @return DSL_RESULT_SUCCESS on successful query, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_heading_range_get(const wchar_t* name, 
+    uint* minimum, uint* maximum);
+
+/**
+ * @brief Sets the heading range to use for the named Velocity Trigger. 
+ * Headings are in degrees, clockwise from the positive x-axis. The range
+ * wraps through 0 if minimum > maximum. Default = 0 to 360, any heading.
+ * @param[in] name unique name of the Velocity Trigger to update
+ * @param[in] minimum start of the heading range in degrees, <= 360.
+ * @param[in] maximum end of the heading range in degrees, <= 360.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_heading_range_set(const wchar_t* name, 
+    uint minimum, uint maximum);
+
+/**
+ * @brief Sets a homography for one source of the named Velocity Trigger,
+ * used to transform the pixel positions of the source's tracked objects 
+ * into world coordinates, e.g. meters on the ground plane, before the 
+ * velocity is estimated.
+ * @param[in] name unique name of the Velocity Trigger to update
+ * @param[in] source_id unique id of the source to set the homography for.
+ * @param[in] homography 3x3 homography matrix, as 9 values in row-major order.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_homography_set(const wchar_t* name, 
+    uint source_id, const double* homography);
+
+/**
+ * @brief Removes the homography for one source of the named Velocity Trigger.
+ * Speeds for the source are measured in pixels per second once removed.
+ * @param[in] name unique name of the Velocity Trigger to update
+ * @param[in] source_id unique id of the source to remove the homography for.
+ * @return DSL_RESULT_SUCCESS on successful update, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_velocity_homography_remove(const wchar_t* name, 
+    uint source_id);
+    
 /**
  * @brief Latest Trigger that checks for the persistence of Objects tracked 
  * and will trigger on the Object with the least time of persistence (latest)
@@ -2894,6 +3316,29 @@ DslReturnType dsl_ode_trigger_cross_view_settings_get(const wchar_t* name,
 DslReturnType dsl_ode_trigger_cross_view_settings_set(const wchar_t* name, 
     boolean enabled, const wchar_t* color, uint line_width);
     
+/**
+ * @brief Gets the current miss tolerance for the named tracking trigger, 
+ * one of Cross, Persistence, Latest, or Earliest.
+ * @param[in] name unique name for the ODE Trigger to query
+ * @param[out] miss_tolerance number of consecutive frames, for the object's 
+ * source, that a tracked object can go undetected before it is purged.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_tracking_miss_tolerance_get(const wchar_t* name, 
+    uint* miss_tolerance);
+    
+/**
+ * @brief Sets the miss tolerance for the named tracking trigger, 
+ * one of Cross, Persistence, Latest, or Earliest.
+ * @param[in] name unique name for the ODE Trigger to update
+ * @param[in] miss_tolerance number of consecutive frames, for the object's 
+ * source, that a tracked object can go undetected before it is purged.
+ * Default = 0, purge if not detected in the current frame.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_tracking_miss_tolerance_set(const wchar_t* name, 
+    uint miss_tolerance);
+    
 
 /**
  * @brief Resets the a named ODE Trigger, setting it's triggered count to 0
@@ -2979,6 +3424,42 @@ DslReturnType dsl_ode_trigger_enabled_state_change_listener_add(const wchar_t* n
 DslReturnType dsl_ode_trigger_enabled_state_change_listener_remove(const wchar_t* name,
     dsl_ode_enabled_state_change_listener_cb listener);
 
+/**
+ * @brief Gets the current runtime metrics for the named ODE Trigger. Metrics are
+ * only recorded while the Trigger is invoked by an ODE Pad Probe Handler with 
+ * metrics enabled. See dsl_pph_ode_metrics_enabled_set.
+ * @param[in] name unique name of the ODE Trigger to query.
+ * @param[out] metrics current runtime metrics for the ODE Trigger.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_metrics_get(const wchar_t* name,
+    dsl_ode_runtime_metrics* metrics);
+
+/**
+ * @brief Clears the current runtime metrics for the named ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_metrics_clear(const wchar_t* name);
+
+/**
+ * @brief Gets the current load-shedding priority for the named ODE Trigger.
+ * @param[in] name unique name of the ODE Trigger to query.
+ * @param[out] priority one of the DSL_ODE_TRIGGER_PRIORITY constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_priority_get(const wchar_t* name, uint* priority);
+
+/**
+ * @brief Sets the load-shedding priority for the named ODE Trigger. LOW 
+ * priority Triggers are decimated by their ODE Pad Probe Handler while
+ * the Handler is over its time budget. See dsl_pph_ode_time_budget_set.
+ * @param[in] name unique name of the ODE Trigger to update.
+ * @param[in] priority one of the DSL_ODE_TRIGGER_PRIORITY constants.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_TRIGGER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_trigger_priority_set(const wchar_t* name, uint priority);
+
 /**
  * @brief Gets the current source name filter for the ODE Trigger
  * A value of NULL indicates filter disabled.
@@ -3415,6 +3896,71 @@ DslReturnType dsl_ode_accumulator_action_remove_many(const wchar_t* name,
  */
 DslReturnType dsl_ode_accumulator_action_remove_all(const wchar_t* name);
 
+/**
+ * @brief Gets the current rolling window lengths for the named ODE Accumulator.
+ * @param[in] name unique name of the ODE Accumulator to query.
+ * @param[out] lengths array of window lengths in milliseconds.
+ * @param[out] num_lengths number of windows in use, 0 if disabled.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_windows_get(const wchar_t* name, 
+    const uint** lengths, uint* num_lengths);
+
+/**
+ * @brief Sets the rolling window lengths for the named ODE Accumulator. The
+ * Accumulator counts the ODE occurrences within each window, per source and
+ * per class, to a resolution of 1/16th of the window length. All current 
+ * window counts are cleared.
+ * @param[in] name unique name of the ODE Accumulator to update.
+ * @param[in] lengths array of window lengths in milliseconds.
+ * @param[in] num_lengths number of windows, 0 to disable, up to 
+ * DSL_ODE_ACCUMULATOR_MAX_WINDOWS.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_windows_set(const wchar_t* name, 
+    const uint* lengths, uint num_lengths);
+
+/**
+ * @brief Gets the current ODE occurrence counts, one per rolling window, 
+ * for a source and class from the named ODE Accumulator.
+ * @param[in] name unique name of the ODE Accumulator to query.
+ * @param[in] source_id unique id of the source to query.
+ * @param[in] class_id class id to query, DSL_ODE_ANY_CLASS for the total 
+ * over all classes.
+ * @param[out] counts array of occurrence counts, one per window.
+ * @param[out] size number of counts returned.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_window_counts_get(const wchar_t* name, 
+    uint source_id, int class_id, const uint64_t** counts, uint* size);
+
+/**
+ * @brief Gets the current window threshold for the named ODE Accumulator.
+ * @param[in] name unique name of the ODE Accumulator to query.
+ * @param[out] window index of the window tested against the threshold.
+ * @param[out] threshold minimum occurrences within the window, 0 = disabled.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_window_threshold_get(const wchar_t* name, 
+    uint* window, uint* threshold);
+
+/**
+ * @brief Sets the window threshold for the named ODE Accumulator. The 
+ * Accumulator's Actions are only invoked for a frame if the total occurrences 
+ * for the frame's source within the window meet the threshold.
+ * @param[in] name unique name of the ODE Accumulator to update.
+ * @param[in] window index of the window to test against the threshold.
+ * @param[in] threshold minimum occurrences within the window, 0 = disabled.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_ACCUMULATOR_RESULT otherwise.
+ */
+DslReturnType dsl_ode_accumulator_window_threshold_set(const wchar_t* name, 
+    uint window, uint threshold);
+
 /**
  * @brief Deletes a uniquely named ODE Accumulator. The call will fail if 
  * the ODE Accumulator is currently in use
@@ -3509,6 +4055,30 @@ DslReturnType dsl_ode_heat_mapper_legend_settings_get(const wchar_t* name,
 DslReturnType dsl_ode_heat_mapper_legend_settings_set(const wchar_t* name, 
     boolean enabled, uint location, uint width, uint height);
 
+/**
+ * @brief Gets the current decay settings for the named ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[out] mode current decay mode, one of DSL_HEAT_MAP_DECAY_MODE_*
+ * @param[out] period current half-life or window length in milliseconds.
+ * @return DSL_RESULT_SUCCESS on successful query, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_decay_settings_get(const wchar_t* name, 
+    uint* mode, uint* period);
+
+/**
+ * @brief Sets the decay settings for the named ODE Heat-Mapper. Decay is
+ * measured with the stream's timestamps. All current metrics are cleared.
+ * @param[in] name unique name of the ODE Heat-Mapper to update.
+ * @param[in] mode new decay mode, one of DSL_HEAT_MAP_DECAY_MODE_*
+ * @param[in] period half-life for DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL, or
+ * window length for DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW, in milliseconds.
+ * @return DSL_RESULT_SUCCESS on successful update, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_decay_settings_set(const wchar_t* name, 
+    uint mode, uint period);
+
 /**
  * @brief Calls on an ODE Heat-Mapper to clear its current heat-map metrics
  * returning the map to its initial all-zero state. 
@@ -3524,7 +4094,7 @@ DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name);
  * @param[out] buffer a linear buffer of metric map data. Each row or 
  * map data is serialized to a single buffer of size cols*rows. 
  * Each element in the buffer indicates the total number of occurrences
- * accumulated for the position in the map.
+ * accumulated for the position in the map, summed over all sources.
  * @param[out] size size of buffer - cols*rows.
  * @return DSL_RESULT_SUCCESS on success, 
  * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
@@ -3532,6 +4102,21 @@ DslReturnType dsl_ode_heat_mapper_metrics_clear(const wchar_t* name);
 DslReturnType dsl_ode_heat_mapper_metrics_get(const wchar_t* name,
     const uint64_t** buffer, uint* size);
 
+/**
+ * @brief Get the current heat-map metrics for a single source from an 
+ * ODE Heat-Mapper.
+ * @param[in] name unique name of the ODE Heat-Mapper to query.
+ * @param[in] source_id unique id of the source to get metrics for.
+ * @param[out] buffer a linear buffer of metric map data for the source,
+ * serialized as with dsl_ode_heat_mapper_metrics_get. The buffer will be all 
+ * zeros if the Heat-Mapper has not seen any occurrences for the source.
+ * @param[out] size size of buffer - cols*rows.
+ * @return DSL_RESULT_SUCCESS on success, 
+ * DSL_RESULT_ODE_HEAT_MAPPER_RESULT otherwise.
+ */
+DslReturnType dsl_ode_heat_mapper_metrics_source_get(const wchar_t* name,
+    uint source_id, const uint64_t** buffer, uint* size);
+
 /**
  * @brief Calls on an ODE Heat-Mapper to print its current heat-map metrics
  * to the console. 
@@ -3640,27 +4225,165 @@ DslReturnType dsl_pph_ode_trigger_remove_many(const wchar_t* name, const wchar_t
 DslReturnType dsl_pph_ode_trigger_remove_all(const wchar_t* name);
 
 /**
- * @brief Gets the current setting for the number of Display Meta structures that
- * are allocated for each frame. Each structure can hold up to 16 display elements
- * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * @brief Gets the current setting for the maximum number of Display Meta structures
+ * that can be allocated for each frame. Structures are allocated on demand and each
+ * can hold up to 16 display elements for each display type (lines, arrows, 
+ * rectangles, etc.). The default size is 16.
  * @param[in] name unique name of the ODE Handler to query.
- * @param[out] count current count of Display Meta structures allocated per frame
+ * @param[out] count current maximum count of Display Meta structures per frame
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_HANDLER_RESULT otherwise
  */
 DslReturnType dsl_pph_ode_display_meta_alloc_size_get(const wchar_t* name, uint* size);
 
 /**
- * @brief Sets the current setting for the number of Display Meta structures that
- * are allocated for each frame. Each structure can hold up to 16 display elements
- * for each display type (lines, arrows, rectangles, etc.). The default size is one.
- * Note: each allocation adds overhead to the processing of each frame. 
+ * @brief Sets the maximum number of Display Meta structures that can be allocated 
+ * for each frame. Structures are allocated on demand and each can hold up to 16 
+ * display elements for each display type (lines, arrows, rectangles, etc.). Only
+ * the structures used are added to the frame. The default size is 16.
  * @param[in] name unique name of the ODE Handler to update.
- * @param[in] size number of Display Meta structures allocated per frame
+ * @param[in] size maximum number of Display Meta structures per frame, 0 = disabled
  * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_ODE_HANDLER_RESULT otherwise
  */
 DslReturnType dsl_pph_ode_display_meta_alloc_size_set(const wchar_t* name, uint size);
 
+/**
+ * @brief Gets the current number of worker threads used by an ODE Handler to 
+ * process the frames of each batch in parallel. The default is 0 = disabled.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] count current worker count, 0 = disabled.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_worker_count_get(const wchar_t* name, uint* count);
+
+/**
+ * @brief Sets the number of worker threads used by an ODE Handler to process
+ * the frames of each batch in parallel. Frames are grouped by source, and all 
+ * Triggers bound to a single source are processed by one worker. All other 
+ * Triggers are processed serially once all workers have completed. Triggers 
+ * with an Action that can't be invoked concurrently are processed serially.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] count new worker count to use, 0 = disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_worker_count_set(const wchar_t* name, uint count);
+
+/**
+ * @brief Gets the current action batching enabled setting for the named 
+ * ODE Pad Probe Handler.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if action batching is enabled, false otherwise (default).
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_action_batching_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief Sets the action batching enabled setting for the named ODE Pad Probe 
+ * Handler. When enabled, the File, Print, Log, Message-Meta, and Custom ODE 
+ * Actions receive all occurrences for a frame in a single call, once all 
+ * Triggers have processed the frame, instead of one call per occurrence.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable action batching, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_action_batching_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
+/**
+ * @brief Gets the current runtime metrics enabled setting for the named 
+ * ODE Pad Probe Handler.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] enabled true if metrics are enabled, false otherwise (default).
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_metrics_enabled_get(const wchar_t* name, boolean* enabled);
+
+/**
+ * @brief Sets the runtime metrics enabled setting for the named ODE Pad Probe 
+ * Handler. When enabled, the Handler measures each batch, each of its ODE 
+ * Triggers, and each ODE Action invoked by its Triggers. The setting can be 
+ * updated at any time. No timing is performed while disabled.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] enabled set to true to enable metrics, false to disable.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_metrics_enabled_set(const wchar_t* name, boolean enabled);
+
+/**
+ * @brief Gets the current runtime metrics summary for the named ODE Pad Probe
+ * Handler, accumulated over all batches processed while metrics are enabled.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] metrics current runtime metrics for the ODE Handler.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_metrics_get(const wchar_t* name, 
+    dsl_ode_runtime_metrics* metrics);
+
+/**
+ * @brief Clears the current runtime metrics for the named ODE Pad Probe Handler
+ * and for all of its ODE Triggers.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_metrics_clear(const wchar_t* name);
+
+/**
+ * @brief Prints the runtime metrics summary for the named ODE Pad Probe Handler
+ * to the console, followed by the metrics of each of its ODE Triggers ordered
+ * by cumulative time, most expensive first.
+ * @param[in] name unique name of the ODE Handler to call on.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_metrics_print(const wchar_t* name);
+
+/**
+ * @brief Gets the current time budget settings for the named ODE Pad Probe Handler.
+ * @param[in] name unique name of the ODE Handler to query.
+ * @param[out] budget current per-batch time budget in microseconds, 0 = disabled.
+ * @param[out] max_interval maximum load-shedding interval in units of frames.
+ * 0 = LOW priority Triggers are skipped on all frames while shedding.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_time_budget_get(const wchar_t* name, 
+    uint* budget, uint* max_interval);
+
+/**
+ * @brief Sets the time budget settings for the named ODE Pad Probe Handler. 
+ * When the Handler's average batch time exceeds the budget, all LOW priority 
+ * Triggers are decimated by a load-shedding interval that doubles, up to the 
+ * maximum, while over budget. The interval is halved once the average batch 
+ * time falls below half the budget, until all frames are processed again.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] budget new per-batch time budget in microseconds, 0 = disable.
+ * @param[in] max_interval maximum load-shedding interval in units of frames, 
+ * must be 0 or greater than 1. 0 = skip LOW priority Triggers on all frames.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_time_budget_set(const wchar_t* name, 
+    uint budget, uint max_interval);
+
+/**
+ * @brief Adds a load-shedding listener callback function to the named
+ * ODE Pad Probe Handler.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] listener pointer to the client's function to add.
+ * @param[in] client_data opaque pointer to client data passed back to the 
+ * listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_load_shedding_listener_add(const wchar_t* name,
+    dsl_pph_ode_load_shedding_listener_cb listener, void* client_data);
+
+/**
+ * @brief Removes a load-shedding listener callback function previously added
+ * with a call to dsl_pph_ode_load_shedding_listener_add.
+ * @param[in] name unique name of the ODE Handler to update.
+ * @param[in] listener pointer to the client's function to remove.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PPH_RESULT otherwise
+ */
+DslReturnType dsl_pph_ode_load_shedding_listener_remove(const wchar_t* name,
+    dsl_pph_ode_load_shedding_listener_cb listener);
+
 /**
  * @brief creates a new, uniquely named Custom pad-probe-handler to process a buffer
  * @param[in] name unique component name for the new Custom Handler
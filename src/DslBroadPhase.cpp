@@ -0,0 +1,131 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+
+#include "Dsl.h"
+#include "DslBroadPhase.h"
+
+namespace DSL
+{
+    BroadPhase::BroadPhase()
+    {
+        LOG_FUNC();
+    }
+    
+    BroadPhase::~BroadPhase()
+    {
+        LOG_FUNC();
+    }
+
+    void BroadPhase::FindPairs(const std::vector<BroadPhaseBox>& boxes, 
+        double margin, std::vector<BroadPhasePair>& pairs)
+    {
+        // Don't log function entry/exit
+        
+        m_sweepList.clear();
+        for (uint i = 0; i < boxes.size(); i++)
+        {
+            m_sweepList.push_back({&boxes[i], i, 0});
+        }
+        sweep(margin, false, pairs);
+    }
+
+    void BroadPhase::FindPairs(const std::vector<BroadPhaseBox>& boxesA, 
+        const std::vector<BroadPhaseBox>& boxesB,
+        double margin, std::vector<BroadPhasePair>& pairs)
+    {
+        // Don't log function entry/exit
+        
+        m_sweepList.clear();
+        for (uint i = 0; i < boxesA.size(); i++)
+        {
+            m_sweepList.push_back({&boxesA[i], i, 0});
+        }
+        for (uint i = 0; i < boxesB.size(); i++)
+        {
+            m_sweepList.push_back({&boxesB[i], i, 1});
+        }
+        sweep(margin, true, pairs);
+    }
+    
+    void BroadPhase::sweep(double margin, bool crossSets, 
+        std::vector<BroadPhasePair>& pairs)
+    {
+        // Don't log function entry/exit
+        
+        pairs.clear();
+        m_activeList.clear();
+        
+        std::sort(m_sweepList.begin(), m_sweepList.end(),
+            [](const SweepEntry& a, const SweepEntry& b)
+            {
+                return a.pBox->left < b.pBox->left;
+            });
+            
+        for (const auto& entry: m_sweepList)
+        {
+            // remove all active entries that end - with margin - before the 
+            // start of the new entry. Compact the active list in place.
+            uint count(0);
+            for (const auto& active: m_activeList)
+            {
+                if (active.pBox->right + margin < entry.pBox->left)
+                {
+                    continue;
+                }
+                m_activeList[count++] = active;
+                
+                if (crossSets and active.set == entry.set)
+                {
+                    continue;
+                }
+                // x-axis overlap is implied by the sweep, check the y-axis
+                if (active.pBox->top > entry.pBox->bottom + margin or
+                    entry.pBox->top > active.pBox->bottom + margin)
+                {
+                    continue;
+                }
+                if (crossSets)
+                {
+                    pairs.push_back((active.set == 0)
+                        ? BroadPhasePair(active.index, entry.index)
+                        : BroadPhasePair(entry.index, active.index));
+                }
+                else
+                {
+                    pairs.push_back(BroadPhasePair(
+                        std::min(active.index, entry.index),
+                        std::max(active.index, entry.index)));
+                }
+            }
+            m_activeList.resize(count);
+            m_activeList.push_back(entry);
+        }
+        
+        // sort the candidates to match the order of a brute-force nested loop
+        std::sort(pairs.begin(), pairs.end());
+    }
+}
@@ -0,0 +1,138 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#ifndef _DSL_BROAD_PHASE_H
+#define _DSL_BROAD_PHASE_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief default minimum number of objects tested per frame before 
+     * an object-pair trigger switches from the brute-force O(n^2) path to 
+     * the sort-and-sweep broad-phase. Below this count, the cost of building 
+     * the broad-phase outweighs the number of exact tests it saves.
+     */
+    #define DSL_ODE_BROAD_PHASE_MIN_OBJECTS_DEFAULT 16
+
+    /**
+     * @struct BroadPhaseBox
+     * @brief axis-aligned bounding box of an object's test geometry.
+     */
+    struct BroadPhaseBox
+    {
+        double left;
+        double top;
+        double right;
+        double bottom;
+    };
+
+    /**
+     * @brief candidate pair of indices returned by the BroadPhase.
+     */
+    typedef std::pair<uint, uint> BroadPhasePair;
+    
+    /**
+     * @class BroadPhase
+     * @brief Implements a sort-and-sweep broad-phase used to reduce the set
+     * of object pairs that need to be tested exactly. A pair of boxes is 
+     * reported as a candidate if the gap between them, on both axes, is less 
+     * than or equal to a given margin. Pairs are always returned in ascending 
+     * (first, second) order so that callers can process candidates in the 
+     * same order as a brute-force nested loop. All working storage is 
+     * retained between calls to avoid per-frame allocations.
+     */
+    class BroadPhase
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the BroadPhase class
+         */
+        BroadPhase();
+        
+        /**
+         * @brief dtor for the BroadPhase class
+         */
+        ~BroadPhase();
+        
+        /**
+         * @brief Finds all candidate pairs (i,j), i < j, within a single set 
+         * of boxes.
+         * @param[in] boxes set of boxes to test against each other.
+         * @param[in] margin maximum gap between two boxes to be a candidate.
+         * @param[out] pairs sorted candidate pairs, cleared on entry.
+         */
+        void FindPairs(const std::vector<BroadPhaseBox>& boxes, 
+            double margin, std::vector<BroadPhasePair>& pairs);
+
+        /**
+         * @brief Finds all candidate pairs (a,b) between two sets of boxes,
+         * where a indexes boxesA and b indexes boxesB.
+         * @param[in] boxesA first set of boxes to test.
+         * @param[in] boxesB second set of boxes to test.
+         * @param[in] margin maximum gap between two boxes to be a candidate.
+         * @param[out] pairs sorted candidate pairs, cleared on entry.
+         */
+        void FindPairs(const std::vector<BroadPhaseBox>& boxesA, 
+            const std::vector<BroadPhaseBox>& boxesB,
+            double margin, std::vector<BroadPhasePair>& pairs);
+        
+    private:
+    
+        /**
+         * @brief entry in the sweep list; index into its set of boxes and 
+         * the set (0 or 1) the box belongs to.
+         */
+        struct SweepEntry
+        {
+            const BroadPhaseBox* pBox;
+            uint index;
+            uint set;
+        };
+        
+        /**
+         * @brief sorts m_sweepList and runs the sweep, adding pairs of 
+         * entries from different sets - or from the same set if crossSets 
+         * is false - to the output list.
+         */
+        void sweep(double margin, bool crossSets, 
+            std::vector<BroadPhasePair>& pairs);
+    
+        /**
+         * @brief all entries to sweep, sorted on the box's left edge.
+         */
+        std::vector<SweepEntry> m_sweepList;
+        
+        /**
+         * @brief entries currently overlapping the sweep position.
+         */
+        std::vector<SweepEntry> m_activeList;
+    };
+}
+
+#endif // _DSL_BROAD_PHASE_H
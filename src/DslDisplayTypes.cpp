@@ -147,7 +147,109 @@ namespace DSL
  
    // ********************************************************************
 
+    DisplayMetaData::DisplayMetaData()
+        : m_pBatchMeta(NULL)
+        , m_maxSize(0)
+    {
+        // Don't log function entry/exit
+    }
+
+    DisplayMetaData::DisplayMetaData(NvDsBatchMeta* pBatchMeta, uint maxSize)
+        : m_pBatchMeta(pBatchMeta)
+        , m_maxSize(maxSize)
+    {
+        // Don't log function entry/exit
+    }
+    
+    void DisplayMetaData::Reset(NvDsBatchMeta* pBatchMeta, uint maxSize)
+    {
+        // Don't log function entry/exit
+        
+        m_pBatchMeta = pBatchMeta;
+        m_maxSize = maxSize;
+        m_displayMetas.clear();
+    }
+    
+    bool DisplayMetaData::IsEnabled() const
+    {
+        // Don't log function entry/exit
+        
+        return (m_pBatchMeta and m_maxSize);
+    }
+    
+    uint DisplayMetaData::GetSize() const
+    {
+        // Don't log function entry/exit
+        
+        return m_displayMetas.size();
+    }
+    
+    NvDsDisplayMeta* DisplayMetaData::Acquire()
+    {
+        // Don't log function entry/exit
+        
+        if (m_displayMetas.size())
+        {
+            return m_displayMetas.front();
+        }
+        return acquireFromPool();
+    }
+    
+    NvDsDisplayMeta* DisplayMetaData::Acquire(guint NvDsDisplayMeta::*pNumElements,
+        uint numElements)
+    {
+        // Don't log function entry/exit
+        
+        if (numElements > MAX_ELEMENTS_IN_DISPLAY_META)
+        {
+            return NULL;
+        }
+        for (const auto& ivec: m_displayMetas)
+        {
+            if (ivec->*pNumElements + numElements <= MAX_ELEMENTS_IN_DISPLAY_META)
+            {
+                return ivec;
+            }
+        }
+        // all in use are full for this type of element - spill to a new one
+        return acquireFromPool();
+    }
+    
+    void DisplayMetaData::AddToFrame(NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        
+        for (const auto& ivec: m_displayMetas)
+        {
+            nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+        }
+        m_displayMetas.clear();
+    }
     
+    NvDsDisplayMeta* DisplayMetaData::acquireFromPool()
+    {
+        // Don't log function entry/exit
+        
+        if (!IsEnabled() or m_displayMetas.size() >= m_maxSize)
+        {
+            return NULL;
+        }
+        // Frames may be processed by multiple worker threads, lock the batch 
+        // meta while acquiring from its pool.
+        nvds_acquire_meta_lock(m_pBatchMeta);
+        NvDsDisplayMeta* pDisplayMeta = 
+            nvds_acquire_display_meta_from_pool(m_pBatchMeta);
+        nvds_release_meta_lock(m_pBatchMeta);
+        
+        if (pDisplayMeta)
+        {
+            m_displayMetas.push_back(pDisplayMeta);
+        }
+        return pDisplayMeta;
+    }
+
+    // ********************************************************************
+
     DisplayType::DisplayType(const char* name)
         : Base(name)
     {
@@ -173,7 +275,7 @@ namespace DSL
         g_mutex_unlock(&m_propertyMutex);        
     }
     
-    void DisplayType::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void DisplayType::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
         LOG_FUNC();
@@ -448,23 +550,16 @@ namespace DSL
             m_pFont->m_fontName.c_str(), m_pFont->font_size, m_pShadowColor);
     }
     
-    void RgbaText::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaText::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
-        // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        // by setting the PPH ODE display meta alloc size to 0. Both the
+        // shadow and the text must be added to the same meta structure.
+        NvDsDisplayMeta* pDisplayMeta = displayMetaData.Acquire(
+            &NvDsDisplayMeta::num_labels, (m_shadowEnabled) ? 2 : 1);
         if (!pDisplayMeta)
         {
             return;
@@ -526,23 +621,15 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaLine::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaLine::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        NvDsDisplayMeta* pDisplayMeta = 
+            displayMetaData.Acquire(&NvDsDisplayMeta::num_lines);
         if (!pDisplayMeta)
         {
             return;
@@ -571,23 +658,15 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaArrow::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaArrow::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_arrows < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        NvDsDisplayMeta* pDisplayMeta = 
+            displayMetaData.Acquire(&NvDsDisplayMeta::num_arrows);
         if (!pDisplayMeta)
         {
             return;
@@ -618,23 +697,15 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaRectangle::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaRectangle::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        // and ensure we have available space in the vector of meta structs.
-        NvDsDisplayMeta* pDisplayMeta(NULL);
-        for (const auto& ivec: displayMetaData)
-        {
-            if (ivec->num_rects < MAX_ELEMENTS_IN_DISPLAY_META)
-            {
-                pDisplayMeta = ivec;
-                break;
-            }
-        }
+        NvDsDisplayMeta* pDisplayMeta = 
+            displayMetaData.Acquire(&NvDsDisplayMeta::num_rects);
         if (!pDisplayMeta)
         {
             return;
@@ -673,7 +744,7 @@ namespace DSL
         g_free(coordinates);
     }
 
-    void RgbaPolygon::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaPolygon::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -686,16 +757,8 @@ namespace DSL
         {
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
+            NvDsDisplayMeta* pDisplayMeta = 
+                displayMetaData.Acquire(&NvDsDisplayMeta::num_lines);
             if (!pDisplayMeta)
             {
                 return;
@@ -737,7 +800,7 @@ namespace DSL
         g_free(coordinates);
     }
 
-    void RgbaMultiLine::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaMultiLine::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -750,16 +813,8 @@ namespace DSL
         {
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_lines < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
+            NvDsDisplayMeta* pDisplayMeta = 
+                displayMetaData.Acquire(&NvDsDisplayMeta::num_lines);
             if (!pDisplayMeta)
             {
                 return;
@@ -792,14 +847,16 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void RgbaCircle::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void RgbaCircle::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
 
         // check to see if we're adding meta data - client can disable
         // by setting the PPH ODE display meta alloc size to 0.
-        if (displayMetaData.empty())
+        NvDsDisplayMeta* pDisplayMeta = 
+            displayMetaData.Acquire(&NvDsDisplayMeta::num_circles);
+        if (!pDisplayMeta)
         {
             return;
         }
@@ -810,8 +867,7 @@ namespace DSL
         bg_color = *m_pBgColor;
         m_pBgColor->Unlock();
         
-        displayMetaData.at(0)->circle_params[
-            displayMetaData.at(0)->num_circles++] = *this;
+        pDisplayMeta->circle_params[pDisplayMeta->num_circles++] = *this;
     }
 
     // ********************************************************************
@@ -829,7 +885,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceDimensions::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceDimensions::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -854,7 +910,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceFrameRate::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceFrameRate::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -880,7 +936,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceNumber::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceNumber::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
@@ -904,7 +960,7 @@ namespace DSL
         LOG_FUNC();
     }
 
-    void SourceName::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void SourceName::AddMeta(DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta) 
     {
 //        LOG_FUNC();
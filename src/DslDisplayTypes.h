@@ -133,6 +133,104 @@ namespace DSL
 
     // ********************************************************************
 
+    /**
+     * @class DisplayMetaData
+     * @brief Display Meta allocator for a single frame. Display Meta structures
+     * are acquired from the batch-meta pool on first use, and an additional 
+     * structure is acquired - up to a maximum - each time those in use are 
+     * full for the type of element being added. Only the structures acquired 
+     * are added to the frame.
+     */
+    class DisplayMetaData
+    {
+    public:
+    
+        /**
+         * @brief ctor for a disabled DisplayMetaData - nothing will be acquired.
+         */
+        DisplayMetaData();
+
+        /**
+         * @brief ctor for the DisplayMetaData class
+         * @param[in] pBatchMeta batch meta to acquire the Display Meta from.
+         * @param[in] maxSize maximum number of Display Meta structures to 
+         * acquire for the frame, 0 = disabled.
+         */
+        DisplayMetaData(NvDsBatchMeta* pBatchMeta, uint maxSize);
+        
+        /**
+         * @brief Resets the DisplayMetaData for a new frame. 
+         * @param[in] pBatchMeta batch meta to acquire the Display Meta from.
+         * @param[in] maxSize maximum number of Display Meta structures to 
+         * acquire for the frame, 0 = disabled.
+         */
+        void Reset(NvDsBatchMeta* pBatchMeta, uint maxSize);
+        
+        /**
+         * @brief Determines if Display Meta can be acquired for the frame.
+         * @return true if enabled, false otherwise.
+         */
+        bool IsEnabled() const;
+        
+        /**
+         * @brief Gets the number of Display Meta structures acquired so far.
+         * @return current number of Display Meta structures.
+         */
+        uint GetSize() const;
+        
+        /**
+         * @brief Gets the first Display Meta structure for the frame, 
+         * acquiring it from the pool if not done so already.
+         * @return Display Meta structure, NULL if disabled.
+         */
+        NvDsDisplayMeta* Acquire();
+        
+        /**
+         * @brief Gets a Display Meta structure with space for a number of 
+         * elements of a given type, acquiring a new structure if all 
+         * structures in use are full.
+         * @param[in] pNumElements pointer to the Display Meta member that
+         * counts the elements of the type to add, e.g. num_lines.
+         * @param[in] numElements number of elements that will be added.
+         * @return Display Meta structure, NULL if disabled or the maximum 
+         * number of structures have been acquired and are full.
+         */
+        NvDsDisplayMeta* Acquire(guint NvDsDisplayMeta::*pNumElements, 
+            uint numElements = 1);
+        
+        /**
+         * @brief Adds all Display Meta structures acquired to a frame.
+         * @param[in] pFrameMeta frame meta to add the Display Meta to.
+         */
+        void AddToFrame(NvDsFrameMeta* pFrameMeta);
+        
+    private:
+    
+        /**
+         * @brief Acquires a new Display Meta structure from the pool.
+         * @return new Display Meta structure, NULL if the maximum number
+         * of structures have been acquired.
+         */
+        NvDsDisplayMeta* acquireFromPool();
+    
+        /**
+         * @brief batch meta to acquire the Display Meta from.
+         */
+        NvDsBatchMeta* m_pBatchMeta;
+        
+        /**
+         * @brief maximum number of Display Meta structures to acquire.
+         */
+        uint m_maxSize;
+        
+        /**
+         * @brief Display Meta structures acquired for the frame.
+         */
+        std::vector<NvDsDisplayMeta*> m_displayMetas;
+    };
+
+    // ********************************************************************
+
     class DisplayType : public Base
     {
     public: 
@@ -157,12 +255,12 @@ namespace DSL
         
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        virtual void AddMeta(std::vector<NvDsDisplayMeta*>& 
+        virtual void AddMeta(DisplayMetaData& 
             displayMetaData, NvDsFrameMeta* pFrameMeta);
             
     protected:
@@ -485,12 +583,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
         std::string m_text;
@@ -556,12 +654,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -596,12 +694,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -639,12 +737,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
             
     private:
@@ -712,12 +810,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -779,12 +877,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -819,12 +917,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -862,12 +960,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData.
-         * @param displayMetaData vector of allocated Display metadata to add
+         * @param displayMetaData Display Meta allocator for the frame to add
          * the meta to.
          * @param pFrameMeta frame meta for the frame the display meta
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -905,12 +1003,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -948,12 +1046,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -991,12 +1089,12 @@ namespace DSL
 
         /**
          * @brief Adds the Display Type's meta to the provided displayMetaData
-         * @param displayMetaData vector of allocated Display metadata to add 
+         * @param displayMetaData Display Meta allocator for the frame to add 
          * the meta to
          * @param pFrameMeta frame meta for the frame the display meta 
          * will be added to.
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        void AddMeta(DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
     private:
@@ -26,26 +26,69 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    static void geosNoticeHandler(const char* message, void* userdata)
+    {
+        LOG_WARN("GEOS notice: " << message);
+    }
+
+    static void geosErrorHandler(const char* message, void* userdata)
+    {
+        LOG_ERROR("GEOS error: " << message);
+    }
+
+    GeosContext::GeosContext()
+        : m_hContext(GEOS_init_r())
+    {
+        // Don't log function entry/exit
+        
+        if (!m_hContext)
+        {
+            LOG_ERROR("Exception when initializing GEOS Context Handle");
+            throw;
+        }
+        GEOSContext_setNoticeMessageHandler_r(m_hContext, geosNoticeHandler, NULL);
+        GEOSContext_setErrorMessageHandler_r(m_hContext, geosErrorHandler, NULL);
+    }
+
+    GeosContext::~GeosContext()
+    {
+        // Don't log function entry/exit
+        
+        GEOS_finish_r(m_hContext);
+    }
+
+    GEOSContextHandle_t GeosContext::Get()
+    {
+        // Don't log function entry/exit
+        
+        // one context per thread, finished on thread exit.
+        static thread_local GeosContext context;
+        
+        return context.m_hContext;
+    }
+    
+    //******************************************************************************
 
     GeosPoint::GeosPoint(uint x, uint y)
         : m_pGeosPoint(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(1, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 1, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence for GEOS Point");
             throw;
         }
-        if (!GEOSCoordSeq_setX(geosCoordSequence, 0, double(x)) or 
-            !GEOSCoordSeq_setY(geosCoordSequence, 0, double(y))) 
+        if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 0, double(x)) or 
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 0, double(y))) 
         {
             LOG_ERROR("Exception when setting GEOS Coordinate Sequence for GEOS Point");
             throw;
         }
         
-        m_pGeosPoint = GEOSGeom_createPoint(geosCoordSequence);
+        m_pGeosPoint = GEOSGeom_createPoint_r(hContext, geosCoordSequence);
         if (!m_pGeosPoint)
         {
             LOG_ERROR("Exception when setting GEOS Point");
@@ -56,19 +99,21 @@ namespace DSL
     GeosPoint::~GeosPoint()
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
         if (m_pGeosPoint)
         {
-            GEOSGeom_destroy(m_pGeosPoint);
+            GEOSGeom_destroy_r(hContext, m_pGeosPoint);
         }
     }
 
     uint GeosPoint::Distance(const GeosPoint& testPoint)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         double distance(0);
         
-        if (!GEOSDistance(m_pGeosPoint, testPoint.m_pGeosPoint, &distance))
+        if (!GEOSDistance_r(hContext, m_pGeosPoint, testPoint.m_pGeosPoint, &distance))
         {
             LOG_ERROR("Exception when calling GEOS Distance");
             throw;
@@ -82,17 +127,18 @@ namespace DSL
         : m_pGeosLine(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(2, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 2, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence");
             throw;
         }
-        if (!GEOSCoordSeq_setX(geosCoordSequence, 0, double(line.x1)) or 
-            !GEOSCoordSeq_setY(geosCoordSequence, 0, double(line.y1)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 1, double(line.x2)) or
-            !GEOSCoordSeq_setY(geosCoordSequence, 1, double(line.y2))) 
+        if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 0, double(line.x1)) or 
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 0, double(line.y1)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 1, double(line.x2)) or
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 1, double(line.y2))) 
         {
             LOG_ERROR("Exception when setting GEOS Coordinate Sequence");
             throw;
@@ -100,7 +146,7 @@ namespace DSL
         
         // once created, m_pGeosLine will own the memory of geosCoordSequence
         // and will free it when GEOSGeom_destroy is called
-        m_pGeosLine = GEOSGeom_createLineString(geosCoordSequence);
+        m_pGeosLine = GEOSGeom_createLineString_r(hContext, geosCoordSequence);
         if (!m_pGeosLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -112,17 +158,18 @@ namespace DSL
         : m_pGeosLine(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(2, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 2, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence");
             throw;
         }
-        if (!GEOSCoordSeq_setX(geosCoordSequence, 0, double(x1)) or 
-            !GEOSCoordSeq_setY(geosCoordSequence, 0, double(y1)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 1, double(x2)) or
-            !GEOSCoordSeq_setY(geosCoordSequence, 1, double(y2))) 
+        if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 0, double(x1)) or 
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 0, double(y1)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 1, double(x2)) or
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 1, double(y2))) 
         {
             LOG_ERROR("Exception when setting GEOS Coordinate Sequence");
             throw;
@@ -130,7 +177,7 @@ namespace DSL
         
         // once created, m_pGeosLine will own the memory of geosCoordSequence
         // and will free it when GEOSGeom_destroy is called
-        m_pGeosLine = GEOSGeom_createLineString(geosCoordSequence);
+        m_pGeosLine = GEOSGeom_createLineString_r(hContext, geosCoordSequence);
         if (!m_pGeosLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -141,18 +188,20 @@ namespace DSL
     GeosLine::~GeosLine()
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
         if (m_pGeosLine)
         {
-            GEOSGeom_destroy(m_pGeosLine);
+            GEOSGeom_destroy_r(hContext, m_pGeosLine);
         }
     }
 
     bool GeosLine::Intersects(const GeosLine& testLine)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        char result = GEOSIntersects(m_pGeosLine, testLine.m_pGeosLine);
+        char result = GEOSIntersects_r(hContext, m_pGeosLine, testLine.m_pGeosLine);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Line Strings cross");
@@ -164,9 +213,10 @@ namespace DSL
     uint GeosLine::Distance(const GeosPoint& testPoint)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         double distance(0);
         
-        if (!GEOSDistance(m_pGeosLine, testPoint.m_pGeosPoint, &distance))
+        if (!GEOSDistance_r(hContext, m_pGeosLine, testPoint.m_pGeosPoint, &distance))
         {
             LOG_ERROR("Exception when calling GEOS Distance");
             throw;
@@ -180,36 +230,41 @@ namespace DSL
         : m_pGeosRectangle(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(5, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 5, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence");
             throw;
         }
-        if (!GEOSCoordSeq_setX(geosCoordSequence, 0, double(rectangle.left)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 0, double(rectangle.top)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 1, double(rectangle.left + rectangle.width)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 1, double(rectangle.top)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 2, double(rectangle.left + rectangle.width)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 2, double(rectangle.top + rectangle.height)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 3, double(rectangle.left)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 3, double(rectangle.top + rectangle.height)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 4, double(rectangle.left)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 4, double(rectangle.top))) 
+        if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 0, double(rectangle.left)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 0, double(rectangle.top)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 1,
+                double(rectangle.left + rectangle.width)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 1, double(rectangle.top)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 2,
+                double(rectangle.left + rectangle.width)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 2,
+                double(rectangle.top + rectangle.height)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 3, double(rectangle.left)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 3,
+                double(rectangle.top + rectangle.height)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 4, double(rectangle.left)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 4, double(rectangle.top))) 
         {
             LOG_ERROR("Exception when setting GEOS Coordinate Sequence");
             throw;
         }
         
-        GEOSGeometry* outerRing = GEOSGeom_createLinearRing(geosCoordSequence);
+        GEOSGeometry* outerRing = GEOSGeom_createLinearRing_r(hContext, geosCoordSequence);
         if (!outerRing)
         {
             LOG_ERROR("Exception when creating GEOS outer ring");
             throw;
         }
 
-        m_pGeosRectangle = GEOSGeom_createPolygon(outerRing, NULL, 0);
+        m_pGeosRectangle = GEOSGeom_createPolygon_r(hContext, outerRing, NULL, 0);
         if (!m_pGeosRectangle)
         {
             LOG_ERROR("Exception when creating GEOS Polygon");
@@ -220,19 +275,21 @@ namespace DSL
     GeosRectangle::~GeosRectangle()
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
         if (m_pGeosRectangle)
         {
-            GEOSGeom_destroy(m_pGeosRectangle);
+            GEOSGeom_destroy_r(hContext, m_pGeosRectangle);
         }
     }
 
     uint GeosRectangle::Distance(const GeosRectangle& testRectangle)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         double distance(0);
         
-        if (!GEOSDistance(m_pGeosRectangle, testRectangle.m_pGeosRectangle, &distance))
+        if (!GEOSDistance_r(hContext, m_pGeosRectangle, testRectangle.m_pGeosRectangle, &distance))
         {
             LOG_ERROR("Exception when calling GEOS Distance");
             throw;
@@ -243,8 +300,9 @@ namespace DSL
     bool GeosRectangle::Overlaps(const GeosRectangle& testRectangle)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
 
-        char result = GEOSOverlaps(m_pGeosRectangle, testRectangle.m_pGeosRectangle);
+        char result = GEOSOverlaps_r(hContext, m_pGeosRectangle, testRectangle.m_pGeosRectangle);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Rectangles overlap");
@@ -257,13 +315,16 @@ namespace DSL
     // *****************************************************************************
 
     GeosPolygon::GeosPolygon(const dsl_polygon_params& polygon)
-        : m_pGeosPolygon(NULL)
+        : m_pGeosMultiLine(NULL)
+        , m_pGeosPolygon(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
         // first coordinate needs to be added to both the start and end of the sequence
         // therefore, we need num_coordinates+1
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(polygon.num_coordinates+1, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 
+            polygon.num_coordinates+1, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence");
@@ -271,9 +332,9 @@ namespace DSL
         }
         for (uint i = 0; i < polygon.num_coordinates+1; i++)
         {
-            if (!GEOSCoordSeq_setX(geosCoordSequence, i, 
+            if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, i, 
                     double(polygon.coordinates[(i)%polygon.num_coordinates].x)) or   
-                !GEOSCoordSeq_setY(geosCoordSequence, i, 
+                !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, i, 
                     double(polygon.coordinates[(i)%polygon.num_coordinates].y))) 
             {
                 LOG_ERROR("Exception when setting GEOS Coordinate Sequence");
@@ -282,8 +343,10 @@ namespace DSL
         }
 
         // First, create Line String to use for calculating a points distance
-        // to the boarder of the Polygon, inside and out.
-        m_pGeosMultiLine = GEOSGeom_createLineString(geosCoordSequence);
+        // to the boarder of the Polygon, inside and out. The Line String takes
+        // ownership of its coordinate sequence, so it's given a clone.
+        m_pGeosMultiLine = GEOSGeom_createLineString_r(hContext, 
+            GEOSCoordSeq_clone_r(hContext, geosCoordSequence));
         if (!m_pGeosMultiLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -292,7 +355,7 @@ namespace DSL
         
         // Next, create an outer ring from the coordinate sequence needed 
         // to create a Polygon geometry.
-        GEOSGeometry* outerRing = GEOSGeom_createLinearRing(geosCoordSequence);
+        GEOSGeometry* outerRing = GEOSGeom_createLinearRing_r(hContext, geosCoordSequence);
         if (!outerRing)
         {
             LOG_ERROR("Exception when creating GEOS outer ring");
@@ -301,7 +364,7 @@ namespace DSL
 
         // Finally, create the Polygon to use for checking if a point is
         // within the Polygond
-        m_pGeosPolygon = GEOSGeom_createPolygon(outerRing, NULL, 0);
+        m_pGeosPolygon = GEOSGeom_createPolygon_r(hContext, outerRing, NULL, 0);
         if (!m_pGeosPolygon)
         {
             LOG_ERROR("Exception when creating GEOS Polygon");
@@ -310,34 +373,42 @@ namespace DSL
     }
 
     GeosPolygon::GeosPolygon(const NvOSD_RectParams& rectangle)
-        : m_pGeosPolygon(NULL)
+        : m_pGeosMultiLine(NULL)
+        , m_pGeosPolygon(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(5, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 5, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence");
             throw;
         }
-        if (!GEOSCoordSeq_setX(geosCoordSequence, 0, double(rectangle.left)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 0, double(rectangle.top)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 1, double(rectangle.left + rectangle.width)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 1, double(rectangle.top)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 2, double(rectangle.left + rectangle.width)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 2, double(rectangle.top + rectangle.height)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 3, double(rectangle.left)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 3, double(rectangle.top + rectangle.height)) or
-            !GEOSCoordSeq_setX(geosCoordSequence, 4, double(rectangle.left)) or   
-            !GEOSCoordSeq_setY(geosCoordSequence, 4, double(rectangle.top))) 
+        if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 0, double(rectangle.left)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 0, double(rectangle.top)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 1,
+                double(rectangle.left + rectangle.width)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 1, double(rectangle.top)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 2,
+                double(rectangle.left + rectangle.width)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 2,
+                double(rectangle.top + rectangle.height)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 3, double(rectangle.left)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 3,
+                double(rectangle.top + rectangle.height)) or
+            !GEOSCoordSeq_setX_r(hContext, geosCoordSequence, 4, double(rectangle.left)) or   
+            !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, 4, double(rectangle.top))) 
         {
             LOG_ERROR("Exception when setting GEOS Coordinate Sequence");
             throw;
         }
         
         // First, create Line String to use for calculating a points distance
-        // to the boarder of the Polygon, inside and out.
-        m_pGeosMultiLine = GEOSGeom_createLineString(geosCoordSequence);
+        // to the boarder of the Polygon, inside and out. The Line String takes
+        // ownership of its coordinate sequence, so it's given a clone.
+        m_pGeosMultiLine = GEOSGeom_createLineString_r(hContext, 
+            GEOSCoordSeq_clone_r(hContext, geosCoordSequence));
         if (!m_pGeosMultiLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -346,7 +417,7 @@ namespace DSL
         
         // Next, create an outer ring from the coordinate sequence needed 
         // to create a Polygon geometry.
-        GEOSGeometry* outerRing = GEOSGeom_createLinearRing(geosCoordSequence);
+        GEOSGeometry* outerRing = GEOSGeom_createLinearRing_r(hContext, geosCoordSequence);
         if (!outerRing)
         {
             LOG_ERROR("Exception when creating GEOS outer ring");
@@ -355,7 +426,7 @@ namespace DSL
 
         // Finally, create the Polygon to use for checking if a point is
         // within the Polygond
-        m_pGeosPolygon = GEOSGeom_createPolygon(outerRing, NULL, 0);
+        m_pGeosPolygon = GEOSGeom_createPolygon_r(hContext, outerRing, NULL, 0);
         if (!m_pGeosPolygon)
         {
             LOG_ERROR("Exception when creating GEOS Polygon");
@@ -366,21 +437,27 @@ namespace DSL
     GeosPolygon::~GeosPolygon()
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
+        if (m_pGeosMultiLine)
+        {
+            GEOSGeom_destroy_r(hContext, m_pGeosMultiLine);
+        }
         if (m_pGeosPolygon)
         {
-            GEOSGeom_destroy(m_pGeosPolygon);
+            GEOSGeom_destroy_r(hContext, m_pGeosPolygon);
         }
     }
 
     uint GeosPolygon::Distance(const GeosPoint& testPoint)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         double distance(0);
         
         // Use the Mutli-Line object to calculate distance to the border, 
         // from inside and out.
-        if (!GEOSDistance(m_pGeosMultiLine, testPoint.m_pGeosPoint, &distance))
+        if (!GEOSDistance_r(hContext, m_pGeosMultiLine, testPoint.m_pGeosPoint, &distance))
         {
             LOG_ERROR("Exception when calling GEOS Distance");
             throw;
@@ -391,8 +468,9 @@ namespace DSL
     bool GeosPolygon::Overlaps(const GeosPolygon& testPolygon)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
 
-        char result = GEOSOverlaps(m_pGeosPolygon, testPolygon.m_pGeosPolygon);
+        char result = GEOSOverlaps_r(hContext, m_pGeosPolygon, testPolygon.m_pGeosPolygon);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Polygons intersect");
@@ -405,8 +483,9 @@ namespace DSL
     bool GeosPolygon::Contains(const GeosPolygon& testPolygon)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
 
-        char result = GEOSContains(m_pGeosPolygon, testPolygon.m_pGeosPolygon);
+        char result = GEOSContains_r(hContext, m_pGeosPolygon, testPolygon.m_pGeosPolygon);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Polygons intersect");
@@ -419,8 +498,9 @@ namespace DSL
     bool GeosPolygon::Contains(const GeosPoint& testPoint)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        char result = GEOSContains(m_pGeosPolygon, testPoint.m_pGeosPoint);
+        char result = GEOSContains_r(hContext, m_pGeosPolygon, testPoint.m_pGeosPoint);
         
         if (result == 2)
         {
@@ -436,8 +516,10 @@ namespace DSL
         : m_pGeosMultiLine(NULL)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create(multiLine.num_coordinates+1, 2);
+        GEOSCoordSequence* geosCoordSequence = GEOSCoordSeq_create_r(hContext, 
+            multiLine.num_coordinates, 2);
         if (!geosCoordSequence)
         {
             LOG_ERROR("Exception when creating GEOS Coordinate Sequence");
@@ -445,9 +527,9 @@ namespace DSL
         }
         for (uint i = 0; i < multiLine.num_coordinates; i++)
         {
-            if (!GEOSCoordSeq_setX(geosCoordSequence, i, 
+            if (!GEOSCoordSeq_setX_r(hContext, geosCoordSequence, i, 
                     double(multiLine.coordinates[i].x)) or   
-                !GEOSCoordSeq_setY(geosCoordSequence, i, 
+                !GEOSCoordSeq_setY_r(hContext, geosCoordSequence, i, 
                     double(multiLine.coordinates[i].y))) 
             {
                 LOG_ERROR("Exception when setting GEOS Coordinate Sequence");
@@ -457,7 +539,7 @@ namespace DSL
         
         // once created, m_pGeosMultiLine will own the memory of geosCoordSequence
         // and will free it when GEOSGeom_destroy is called
-        m_pGeosMultiLine = GEOSGeom_createLineString(geosCoordSequence);
+        m_pGeosMultiLine = GEOSGeom_createLineString_r(hContext, geosCoordSequence);
         if (!m_pGeosMultiLine)
         {
             LOG_ERROR("Exception when creating GEOS Line String");
@@ -468,18 +550,20 @@ namespace DSL
     GeosMultiLine::~GeosMultiLine()
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
         if (m_pGeosMultiLine)
         {
-            GEOSGeom_destroy(m_pGeosMultiLine);
+            GEOSGeom_destroy_r(hContext, m_pGeosMultiLine);
         }
     }
 
     bool GeosMultiLine::Crosses(const GeosLine& testLine)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        char result = GEOSIntersects(m_pGeosMultiLine, testLine.m_pGeosLine);
+        char result = GEOSIntersects_r(hContext, m_pGeosMultiLine, testLine.m_pGeosLine);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Multi-Line crosses Line");
@@ -491,8 +575,9 @@ namespace DSL
     bool GeosMultiLine::Crosses(const GeosPolygon& testPolygon)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        char result = GEOSIntersects(m_pGeosMultiLine, testPolygon.m_pGeosPolygon);
+        char result = GEOSIntersects_r(hContext, m_pGeosMultiLine, testPolygon.m_pGeosPolygon);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Multi-line crosses Polygon");
@@ -504,8 +589,9 @@ namespace DSL
     bool GeosMultiLine::Crosses(const GeosMultiLine& testMultLine)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         
-        char result = GEOSIntersects(m_pGeosMultiLine, testMultLine.m_pGeosMultiLine);
+        char result = GEOSIntersects_r(hContext, m_pGeosMultiLine, testMultLine.m_pGeosMultiLine);
         if (result == 2)
         {
             LOG_ERROR("Exception when testing if GEOS Multi-line crosses Multi-Line");
@@ -517,9 +603,234 @@ namespace DSL
     uint GeosMultiLine::Distance(const GeosPoint& testPoint)
     {
         // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        double distance(0);
+        
+        if (!GEOSDistance_r(hContext, m_pGeosMultiLine, testPoint.m_pGeosPoint, &distance))
+        {
+            LOG_ERROR("Exception when calling GEOS Distance");
+            throw;
+        }
+        return (uint)round(distance);
+    }
+
+    //******************************************************************************
+
+    GeosPreparedGeometry::GeosPreparedGeometry(const dsl_polygon_params& polygon)
+        : m_pGeosGeometry(NULL)
+        , m_pGeosBorder(NULL)
+        , m_pGeosPreparedGeometry(NULL)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        
+        GeosPolygon geosPolygon(polygon);
+        
+        m_pGeosGeometry = GEOSGeom_clone_r(hContext, geosPolygon.m_pGeosPolygon);
+        m_pGeosBorder = GEOSGeom_clone_r(hContext, geosPolygon.m_pGeosMultiLine);
+        if (!m_pGeosGeometry or !m_pGeosBorder)
+        {
+            LOG_ERROR("Exception when cloning GEOS Polygon");
+            throw;
+        }
+        prepare();
+    }
+
+    GeosPreparedGeometry::GeosPreparedGeometry(const NvOSD_LineParams& line)
+        : m_pGeosGeometry(NULL)
+        , m_pGeosBorder(NULL)
+        , m_pGeosPreparedGeometry(NULL)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        
+        GeosLine geosLine(line);
+        
+        m_pGeosGeometry = GEOSGeom_clone_r(hContext, geosLine.m_pGeosLine);
+        if (!m_pGeosGeometry)
+        {
+            LOG_ERROR("Exception when cloning GEOS Line String");
+            throw;
+        }
+        prepare();
+    }
+
+    GeosPreparedGeometry::GeosPreparedGeometry(const dsl_multi_line_params& multiLine)
+        : m_pGeosGeometry(NULL)
+        , m_pGeosBorder(NULL)
+        , m_pGeosPreparedGeometry(NULL)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        
+        GeosMultiLine geosMultiLine(multiLine);
+        
+        m_pGeosGeometry = GEOSGeom_clone_r(hContext, geosMultiLine.m_pGeosMultiLine);
+        if (!m_pGeosGeometry)
+        {
+            LOG_ERROR("Exception when cloning GEOS Line String");
+            throw;
+        }
+        prepare();
+    }
+    
+    GeosPreparedGeometry::~GeosPreparedGeometry()
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        
+        // The Prepared Geometry must be destroyed before the Geometry it refers to.
+        if (m_pGeosPreparedGeometry)
+        {
+            GEOSPreparedGeom_destroy_r(hContext, m_pGeosPreparedGeometry);
+        }
+        if (m_pGeosBorder)
+        {
+            GEOSGeom_destroy_r(hContext, m_pGeosBorder);
+        }
+        if (m_pGeosGeometry)
+        {
+            GEOSGeom_destroy_r(hContext, m_pGeosGeometry);
+        }
+        g_mutex_clear(&m_preparedMutex);
+    }
+    
+    void GeosPreparedGeometry::prepare()
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        
+        g_mutex_init(&m_preparedMutex);
+        
+        m_pGeosPreparedGeometry = GEOSPrepare_r(hContext, m_pGeosGeometry);
+        if (!m_pGeosPreparedGeometry)
+        {
+            LOG_ERROR("Exception when preparing GEOS Geometry");
+            throw;
+        }
+        
+        // The Prepared Geometry builds its point-locator and segment-intersection
+        // indices on first use. Warm them up now with a point and a diagonal line
+        // through the geometry's envelope - with both end-points outside of it - 
+        // so that the segment-intersection index is required to evaluate.
+        double xMin(0), yMin(0), xMax(0), yMax(0);
+        if (!GEOSGeom_getXMin_r(hContext, m_pGeosGeometry, &xMin) or
+            !GEOSGeom_getYMin_r(hContext, m_pGeosGeometry, &yMin) or
+            !GEOSGeom_getXMax_r(hContext, m_pGeosGeometry, &xMax) or
+            !GEOSGeom_getYMax_r(hContext, m_pGeosGeometry, &yMax))
+        {
+            LOG_ERROR("Exception when getting GEOS Geometry envelope");
+            throw;
+        }
+        GeosPoint warmUpPoint(round((xMin+xMax)/2), round((yMin+yMax)/2));
+        
+        dsl_coordinate warmUpCoordinates[2] = {
+            {uint(xMin) ? uint(xMin)-1 : 0, uint(yMin) ? uint(yMin)-1 : 0},
+            {uint(xMax)+1, uint(yMax)+1}};
+        dsl_multi_line_params warmUpParams = {warmUpCoordinates, 2};
+        GeosMultiLine warmUpLine(warmUpParams);
+        
+        if (GEOSPreparedContains_r(hContext, m_pGeosPreparedGeometry, 
+                warmUpPoint.m_pGeosPoint) == 2 or
+            GEOSPreparedIntersects_r(hContext, m_pGeosPreparedGeometry, 
+                warmUpLine.m_pGeosMultiLine) == 2)
+        {
+            LOG_ERROR("Exception when warming up GEOS Prepared Geometry");
+            throw;
+        }
+    }
+
+    bool GeosPreparedGeometry::Contains(const GeosPoint& testPoint)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_preparedMutex);
+        
+        char result = GEOSPreparedContains_r(hContext, 
+            m_pGeosPreparedGeometry, testPoint.m_pGeosPoint);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Geometry contains Point");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedGeometry::Contains(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_preparedMutex);
+        
+        char result = GEOSPreparedContains_r(hContext, 
+            m_pGeosPreparedGeometry, testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Geometry contains Polygon");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedGeometry::Within(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_preparedMutex);
+        
+        char result = GEOSPreparedWithin_r(hContext, 
+            m_pGeosPreparedGeometry, testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Geometry is within Polygon");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedGeometry::Overlaps(const GeosPolygon& testPolygon)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_preparedMutex);
+        
+        char result = GEOSPreparedOverlaps_r(hContext, 
+            m_pGeosPreparedGeometry, testPolygon.m_pGeosPolygon);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Prepared Geometry overlaps Polygon");
+            throw;
+        }
+        return bool(result);
+    }
+
+    bool GeosPreparedGeometry::Intersects(const GeosMultiLine& testMultiLine)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_preparedMutex);
+        
+        char result = GEOSPreparedIntersects_r(hContext, 
+            m_pGeosPreparedGeometry, testMultiLine.m_pGeosMultiLine);
+        if (result == 2)
+        {
+            LOG_ERROR("Exception when testing if GEOS Multi-Line intersects Prepared Geometry");
+            throw;
+        }
+        return bool(result);
+    }
+
+    uint GeosPreparedGeometry::Distance(const GeosPoint& testPoint)
+    {
+        // Don't log function entry/exit
+        GEOSContextHandle_t hContext(GeosContext::Get());
         double distance(0);
         
-        if (!GEOSDistance(m_pGeosMultiLine, testPoint.m_pGeosPoint, &distance))
+        // Distance is calculated with the (immutable) Geometry, not the Prepared 
+        // Geometry, and so can be called concurrently. For a Polygon, use the
+        // border Line String to calculate distance from inside and out.
+        if (!GEOSDistance_r(hContext, (m_pGeosBorder) ? m_pGeosBorder : m_pGeosGeometry, 
+            testPoint.m_pGeosPoint, &distance))
         {
             LOG_ERROR("Exception when calling GEOS Distance");
             throw;
@@ -30,6 +30,41 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    /**
+     * @class GeosContext
+     * @file DslGeosTypes.h
+     * @brief Provides a per-thread GEOS Context Handle for use with the
+     * reentrant (_r) GEOS API. The handle is created on first use by each
+     * calling thread and finished when the thread exits.
+     */
+    class GeosContext
+    {
+    public: 
+
+        /**
+         * @brief Gets the GEOS Context Handle for the calling thread.
+         * @return the calling thread's GEOS Context Handle.
+         */
+        static GEOSContextHandle_t Get();
+        
+    private:
+
+        /**
+         * @brief private ctor for the GeosContext class
+         */
+        GeosContext();
+
+        /**
+         * @brief private dtor for the GeosContext class
+         */
+        ~GeosContext();
+        
+        /**
+         * @brief GEOS Context Handle owned by this GeosContext.
+         */
+        GEOSContextHandle_t m_hContext;
+    };
+
     /**
      * @class GeosPoint 
      * @file DslGeosTypes.h
@@ -278,6 +313,119 @@ namespace DSL
         GEOSGeometry* m_pGeosMultiLine;
     };
 
+    /**
+     * @class GeosPreparedGeometry
+     * @file DslGeosTypes.h
+     * @brief Implements a GEOS Prepared Geometry for a fixed Polygon, Line, or
+     * Multi-Line. The geometry is built and prepared once - when the owning
+     * Area is created - so that repeated tests against it do not need to 
+     * reconstruct the geometry, and can use the Prepared Geometry's cached 
+     * spatial indices.
+     */
+    class GeosPreparedGeometry
+    {
+    public: 
+
+        /**
+         * @brief ctor 1 of 3 for the GeosPreparedGeometry class
+         * @param[in] polygon reference to a DSL Polygon Structure.
+         */
+        GeosPreparedGeometry(const dsl_polygon_params& polygon);
+
+        /**
+         * @brief ctor 2 of 3 for the GeosPreparedGeometry class
+         * @param[in] line reference to a Nvidia OSD Line Structure.
+         */
+        GeosPreparedGeometry(const NvOSD_LineParams& line);
+
+        /**
+         * @brief ctor 3 of 3 for the GeosPreparedGeometry class
+         * @param[in] multiLine reference to a DSL Multi-Line Structure.
+         */
+        GeosPreparedGeometry(const dsl_multi_line_params& multiLine);
+
+        /**
+         * @brief dtor for the GeosPreparedGeometry class
+         */
+        ~GeosPreparedGeometry();
+
+        /**
+         * @brief function to determine if the geometry contains a point
+         * @param[in] testPoint GEOS point to test
+         * @return true if the geometry contains the point, false otherwise
+         */
+        bool Contains(const GeosPoint& testPoint);
+
+        /**
+         * @brief function to determine if the geometry contains a polygon
+         * @param[in] testPolygon GEOS polygon to test
+         * @return true if the geometry contains the polygon, false otherwise
+         */
+        bool Contains(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if the geometry is within a polygon
+         * @param[in] testPolygon GEOS polygon to test
+         * @return true if the geometry is within the polygon, false otherwise
+         */
+        bool Within(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if the geometry overlaps a polygon
+         * @param[in] testPolygon GEOS polygon to test
+         * @return true if the geometry and polygon overlap, false otherwise
+         */
+        bool Overlaps(const GeosPolygon& testPolygon);
+
+        /**
+         * @brief function to determine if a GEOS Multi-Line intersects 
+         * with the geometry
+         * @param[in] testMultiLine GEOS Multi-Line to test for intersection
+         * @return true if the Multi-Line intersects, false otherwise
+         */
+        bool Intersects(const GeosMultiLine& testMultiLine);
+
+        /**
+         * @brief function to determine the distance from a Point to the
+         * geometry's line(s). For a Polygon, this is the distance to its
+         * border, from inside and out. 
+         * @param[in] testPoint GEOS point to calculate for distance. 
+         * @return the distance in pixels. 
+         */
+        uint Distance(const GeosPoint& testPoint);
+
+    private:
+    
+        /**
+         * @brief Prepares m_pGeosGeometry and warms up the Prepared Geometry's
+         * lazily built spatial indices, so the cost is not incurred on the
+         * first frame processed.
+         */
+        void prepare();
+    
+        /**
+         * @brief Actual GEOS Geometry, owned by this class.
+         */
+        GEOSGeometry* m_pGeosGeometry;
+        
+        /**
+         * @brief GEOS Line-String used for distance to border for a Polygon,
+         * NULL otherwise. Owned by this class.
+         */
+        GEOSGeometry* m_pGeosBorder;
+        
+        /**
+         * @brief Prepared Geometry for m_pGeosGeometry.
+         */
+        const GEOSPreparedGeometry* m_pGeosPreparedGeometry;
+        
+        /**
+         * @brief Mutex to guard the Prepared Geometry - which is not 
+         * thread safe - from concurrent use by Triggers, sharing the 
+         * owning Area, processing frames in parallel.
+         */
+        GMutex m_preparedMutex;
+    };
 
 }
 
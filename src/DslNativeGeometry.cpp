@@ -0,0 +1,354 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslNativeGeometry.h"
+
+namespace DSL
+{
+    NativeGeometry::NativeGeometry(const dsl_polygon_params& polygon)
+        : m_isPolygon(true)
+    {
+        // Don't log function entry/exit
+        
+        for (uint i = 0; i < polygon.num_coordinates; i++)
+        {
+            const dsl_coordinate& start = polygon.coordinates[i];
+            const dsl_coordinate& end = 
+                polygon.coordinates[(i+1)%polygon.num_coordinates];
+            addSegment(start.x, start.y, end.x, end.y);
+        }
+    }
+
+    NativeGeometry::NativeGeometry(const NvOSD_LineParams& line)
+        : m_isPolygon(false)
+    {
+        // Don't log function entry/exit
+        
+        addSegment(line.x1, line.y1, line.x2, line.y2);
+    }
+
+    NativeGeometry::NativeGeometry(const dsl_multi_line_params& multiLine)
+        : m_isPolygon(false)
+    {
+        // Don't log function entry/exit
+        
+        for (uint i = 0; i+1 < multiLine.num_coordinates; i++)
+        {
+            addSegment(multiLine.coordinates[i].x, multiLine.coordinates[i].y,
+                multiLine.coordinates[i+1].x, multiLine.coordinates[i+1].y);
+        }
+    }
+    
+    NativeGeometry::~NativeGeometry()
+    {
+        // Don't log function entry/exit
+    }
+
+    bool NativeGeometry::IsSupported(const dsl_polygon_params& polygon)
+    {
+        // Don't log function entry/exit
+        
+        uint numCoordinates(polygon.num_coordinates);
+        
+        if (numCoordinates < 3 or 
+            numCoordinates > DSL_NATIVE_GEOMETRY_MAX_VERTICES)
+        {
+            return false;
+        }
+        
+        // A Polygon is convex if it turns in the same direction at every
+        // vertex, and simple if those turns sum to exactly one revolution.
+        bool clockwise(false), counterClockwise(false);
+        double totalTurn(0);
+        
+        for (uint i = 0; i < numCoordinates; i++)
+        {
+            const dsl_coordinate& a = polygon.coordinates[i];
+            const dsl_coordinate& b = polygon.coordinates[(i+1)%numCoordinates];
+            const dsl_coordinate& c = polygon.coordinates[(i+2)%numCoordinates];
+            
+            double abx((double)b.x - a.x), aby((double)b.y - a.y);
+            double bcx((double)c.x - b.x), bcy((double)c.y - b.y);
+            
+            double cross(abx*bcy - aby*bcx);
+            
+            clockwise |= (cross < 0);
+            counterClockwise |= (cross > 0);
+            
+            totalTurn += atan2(cross, abx*bcx + aby*bcy);
+        }
+        return (clockwise != counterClockwise) and 
+            (fabs(fabs(totalTurn) - 2*M_PI) < 1e-6);
+    }
+
+    bool NativeGeometry::IsSupported(const dsl_multi_line_params& multiLine)
+    {
+        // Don't log function entry/exit
+        
+        return (multiLine.num_coordinates >= 2 and
+            multiLine.num_coordinates <= DSL_NATIVE_GEOMETRY_MAX_VERTICES);
+    }
+    
+    void NativeGeometry::addSegment(uint x1, uint y1, uint x2, uint y2)
+    {
+        // Don't log function entry/exit
+        
+        double dx((double)x2 - x1), dy((double)y2 - y1);
+        double lengthSq(dx*dx + dy*dy);
+        
+        m_x.push_back(x1);
+        m_y.push_back(y1);
+        m_dx.push_back(dx);
+        m_dy.push_back(dy);
+        m_invLengthSq.push_back((lengthSq > 0) ? 1/lengthSq : 0);
+    }
+
+    bool NativeGeometry::Contains(const dsl_coordinate& coordinate) const
+    {
+        // Don't log function entry/exit
+        
+        double x(coordinate.x), y(coordinate.y);
+        uint8_t result(0);
+        
+        Contains(&x, &y, 1, &result);
+        
+        return result;
+    }
+    
+    void NativeGeometry::Contains(const double* x, const double* y, uint count,
+        uint8_t* results) const
+    {
+        // Don't log function entry/exit
+        
+        // bit 0 is the crossing-number parity, bit 1 is set if on the border.
+        std::fill(results, results+count, 0);
+        
+        if (!m_isPolygon)
+        {
+            return;
+        }
+        for (uint s = 0; s < m_x.size(); s++)
+        {
+            const double x0(m_x[s]), y0(m_y[s]), dx(m_dx[s]), dy(m_dy[s]);
+            const double y1(y0 + dy), lengthSq(dx*dx + dy*dy);
+            
+            // branch-free inner loop over the points.
+            for (uint i = 0; i < count; i++)
+            {
+                const double px(x[i] - x0), py(y[i] - y0);
+                const double cross(dx*py - dy*px);
+                const double dot(dx*px + dy*py);
+                
+                // the segment straddles the point's horizontal ray, and the
+                // crossing is to the right of the point.
+                const bool crosses(((y0 > y[i]) != (y1 > y[i])) and 
+                    (cross*dy > 0));
+                const bool onBorder((cross == 0) and 
+                    (dot >= 0) and (dot <= lengthSq));
+                    
+                results[i] = (results[i] ^ crosses) | (onBorder << 1);
+            }
+        }
+        for (uint i = 0; i < count; i++)
+        {
+            results[i] = (results[i] == 1);
+        }
+    }
+
+    uint NativeGeometry::Distance(const dsl_coordinate& coordinate) const
+    {
+        // Don't log function entry/exit
+        
+        double x(coordinate.x), y(coordinate.y), distance(0);
+        
+        Distance(&x, &y, 1, &distance);
+        
+        return (uint)round(distance);
+    }
+
+    void NativeGeometry::Distance(const double* x, const double* y, uint count,
+        double* distances) const
+    {
+        // Don't log function entry/exit
+        
+        // squared distances are accumulated, and the root taken once at the end.
+        std::fill(distances, distances+count, 
+            std::numeric_limits<double>::max());
+        
+        for (uint s = 0; s < m_x.size(); s++)
+        {
+            const double x0(m_x[s]), y0(m_y[s]), dx(m_dx[s]), dy(m_dy[s]);
+            const double invLengthSq(m_invLengthSq[s]);
+            
+            for (uint i = 0; i < count; i++)
+            {
+                const double px(x[i] - x0), py(y[i] - y0);
+                
+                // projection of the point onto the segment, clamped to its ends.
+                const double t(std::min(std::max(
+                    (dx*px + dy*py)*invLengthSq, 0.0), 1.0));
+                const double ex(px - t*dx), ey(py - t*dy);
+                
+                distances[i] = std::min(distances[i], ex*ex + ey*ey);
+            }
+        }
+        for (uint i = 0; i < count; i++)
+        {
+            distances[i] = sqrt(distances[i]);
+        }
+    }
+
+    bool NativeGeometry::Overlaps(const NvOSD_RectParams& rectangle) const
+    {
+        // Don't log function entry/exit
+        
+        if (!m_isPolygon)
+        {
+            return false;
+        }
+        const double rx[4] = {rectangle.left, rectangle.left + rectangle.width,
+            rectangle.left + rectangle.width, rectangle.left};
+        const double ry[4] = {rectangle.top, rectangle.top, 
+            rectangle.top + rectangle.height, rectangle.top + rectangle.height};
+
+        // Separating axis test - the interiors of two convex polygons are 
+        // disjoint if their projections on any one axis at most touch.
+        auto isSeparatingAxis = [&](double ax, double ay)
+        {
+            double polygonMin(std::numeric_limits<double>::max());
+            double polygonMax(std::numeric_limits<double>::lowest());
+            double rectangleMin(std::numeric_limits<double>::max());
+            double rectangleMax(std::numeric_limits<double>::lowest());
+            
+            for (uint i = 0; i < m_x.size(); i++)
+            {
+                double projection(ax*m_x[i] + ay*m_y[i]);
+                polygonMin = std::min(polygonMin, projection);
+                polygonMax = std::max(polygonMax, projection);
+            }
+            for (uint i = 0; i < 4; i++)
+            {
+                double projection(ax*rx[i] + ay*ry[i]);
+                rectangleMin = std::min(rectangleMin, projection);
+                rectangleMax = std::max(rectangleMax, projection);
+            }
+            return (polygonMax <= rectangleMin or rectangleMax <= polygonMin);
+        };
+        
+        if (isSeparatingAxis(1, 0) or isSeparatingAxis(0, 1))
+        {
+            return false;
+        }
+        for (uint s = 0; s < m_x.size(); s++)
+        {
+            // skip zero-length segments, which have no normal.
+            if (m_invLengthSq[s] > 0 and isSeparatingAxis(-m_dy[s], m_dx[s]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool NativeGeometry::Intersects(const dsl_coordinate* coordinates, 
+        uint numCoordinates) const
+    {
+        // Don't log function entry/exit
+        
+        if (!numCoordinates)
+        {
+            return false;
+        }
+        // If the trace starts inside the Polygon. Otherwise, if any part of it
+        // is inside, one of its segments must intersect the border.
+        if (m_isPolygon and Contains(coordinates[0]))
+        {
+            return true;
+        }
+        if (numCoordinates == 1)
+        {
+            return intersectsSegment(coordinates[0].x, coordinates[0].y,
+                coordinates[0].x, coordinates[0].y);
+        }
+        for (uint i = 0; i+1 < numCoordinates; i++)
+        {
+            if (intersectsSegment(coordinates[i].x, coordinates[i].y,
+                coordinates[i+1].x, coordinates[i+1].y))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns true if c, known to be collinear with a->b, is within 
+     * the bounds of the segment a->b.
+     */
+    static inline bool isWithinSegment(double ax, double ay, double bx, double by,
+        double cx, double cy)
+    {
+        return (cx >= std::min(ax, bx) and cx <= std::max(ax, bx) and
+            cy >= std::min(ay, by) and cy <= std::max(ay, by));
+    }
+    
+    bool NativeGeometry::intersectsSegment(double x1, double y1, 
+        double x2, double y2) const
+    {
+        // Don't log function entry/exit
+        
+        const double tx(x2 - x1), ty(y2 - y1);
+        
+        for (uint s = 0; s < m_x.size(); s++)
+        {
+            const double x0(m_x[s]), y0(m_y[s]), dx(m_dx[s]), dy(m_dy[s]);
+            const double x3(x0 + dx), y3(y0 + dy);
+            
+            // orientations of the test segment's end-points relative to the 
+            // Geometry's segment, and vice versa. Exact for pixel coordinates.
+            const double o1(dx*(y1 - y0) - dy*(x1 - x0));
+            const double o2(dx*(y2 - y0) - dy*(x2 - x0));
+            const double o3(tx*(y0 - y1) - ty*(x0 - x1));
+            const double o4(tx*(y3 - y1) - ty*(x3 - x1));
+            
+            // proper intersection - each segment straddles the other
+            if (((o1 > 0 and o2 < 0) or (o1 < 0 and o2 > 0)) and
+                ((o3 > 0 and o4 < 0) or (o3 < 0 and o4 > 0)))
+            {
+                return true;
+            }
+            // touching - an end-point lies on the other segment.
+            if ((o1 == 0 and isWithinSegment(x0, y0, x3, y3, x1, y1)) or
+                (o2 == 0 and isWithinSegment(x0, y0, x3, y3, x2, y2)) or
+                (o3 == 0 and isWithinSegment(x1, y1, x2, y2, x0, y0)) or
+                (o4 == 0 and isWithinSegment(x1, y1, x2, y2, x3, y3)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
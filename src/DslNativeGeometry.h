@@ -0,0 +1,193 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_NATIVE_GEOMETRY_H
+#define _DSL_NATIVE_GEOMETRY_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief maximum number of vertices for a Polygon or Multi-Line to be 
+     * tested with the NativeGeometry kernels. Areas with more vertices - and
+     * all non-convex Polygons - fall back to GEOS.
+     */
+    #define DSL_NATIVE_GEOMETRY_MAX_VERTICES 8
+
+    /**
+     * @class NativeGeometry
+     * @file DslNativeGeometry.h
+     * @brief Implements native geometry kernels for the common ODE Area tests; 
+     * point-in-polygon, point-to-line distance, bbox overlap, and trace 
+     * intersection, for small convex Polygons and Lines/Multi-Lines. The 
+     * Geometry's segments are stored in structure-of-arrays form so that the 
+     * batch kernels - testing many points against the one Geometry - iterate 
+     * over contiguous data in their inner loops. All vertices are integer 
+     * pixel coordinates so the on-line and orientation tests are exact.
+     */
+    class NativeGeometry
+    {
+    public: 
+
+        /**
+         * @brief ctor 1 of 3 for the NativeGeometry class
+         * @param[in] polygon reference to a DSL Polygon Structure. The
+         * Polygon must be supported, see IsSupported().
+         */
+        NativeGeometry(const dsl_polygon_params& polygon);
+
+        /**
+         * @brief ctor 2 of 3 for the NativeGeometry class
+         * @param[in] line reference to a Nvidia OSD Line Structure.
+         */
+        NativeGeometry(const NvOSD_LineParams& line);
+
+        /**
+         * @brief ctor 3 of 3 for the NativeGeometry class
+         * @param[in] multiLine reference to a DSL Multi-Line Structure.
+         */
+        NativeGeometry(const dsl_multi_line_params& multiLine);
+
+        /**
+         * @brief dtor for the NativeGeometry class
+         */
+        ~NativeGeometry();
+        
+        /**
+         * @brief Determines if a Polygon can be tested natively. 
+         * @param[in] polygon reference to a DSL Polygon Structure.
+         * @return true if the polygon is simple, convex, and has no more than
+         * DSL_NATIVE_GEOMETRY_MAX_VERTICES vertices, false otherwise.
+         */
+        static bool IsSupported(const dsl_polygon_params& polygon);
+
+        /**
+         * @brief Determines if a Multi-Line can be tested natively. 
+         * @param[in] multiLine reference to a DSL Multi-Line Structure.
+         * @return true if the multi-line has no more than 
+         * DSL_NATIVE_GEOMETRY_MAX_VERTICES vertices, false otherwise.
+         */
+        static bool IsSupported(const dsl_multi_line_params& multiLine);
+
+        /**
+         * @brief Determines if the Polygon contains a point. As with GEOS,
+         * points on the Polygon's border are not contained.
+         * @param[in] coordinate x,y coordinate of the point to test.
+         * @return true if the polygon contains the point, false otherwise. 
+         * Always false for a Line or Multi-Line.
+         */
+        bool Contains(const dsl_coordinate& coordinate) const;
+
+        /**
+         * @brief Batch version of Contains, testing many points at once.
+         * @param[in] x array of x coordinates of the points to test.
+         * @param[in] y array of y coordinates of the points to test.
+         * @param[in] count number of points to test.
+         * @param[out] results array of count results, 1 if contained, 0 otherwise.
+         */
+        void Contains(const double* x, const double* y, uint count, 
+            uint8_t* results) const;
+
+        /**
+         * @brief Determines the distance from a point to the Geometry's 
+         * line(s). For a Polygon, this is the distance to its border, from 
+         * inside and out.
+         * @param[in] coordinate x,y coordinate of the point to test.
+         * @return the distance in pixels.
+         */
+        uint Distance(const dsl_coordinate& coordinate) const;
+
+        /**
+         * @brief Batch version of Distance, testing many points at once.
+         * @param[in] x array of x coordinates of the points to test.
+         * @param[in] y array of y coordinates of the points to test.
+         * @param[in] count number of points to test.
+         * @param[out] distances array of count (unrounded) distances in pixels.
+         */
+        void Distance(const double* x, const double* y, uint count, 
+            double* distances) const;
+        
+        /**
+         * @brief Determines if the interiors of the Polygon and a rectangle 
+         * intersect, i.e. the two overlap, or either contains the other. 
+         * @param[in] rectangle reference to a Nvidia OSD Rectangle Structure.
+         * @return true if the interiors intersect, false otherwise. Always
+         * false for a Line or Multi-Line.
+         */
+        bool Overlaps(const NvOSD_RectParams& rectangle) const;
+
+        /**
+         * @brief Determines if a trace - an array of coordinates - intersects, 
+         * including touches, the Geometry. For a Polygon, the trace intersects 
+         * if any part of it is inside or on the border.
+         * @param[in] coordinates array of dsl_coordinates.
+         * @param[in] numCoordinates size of the array.
+         * @return true if the trace intersects, false otherwise.
+         */
+        bool Intersects(const dsl_coordinate* coordinates, 
+            uint numCoordinates) const;
+        
+    private:
+    
+        /**
+         * @brief Adds a segment to the Geometry's segment arrays.
+         */
+        void addSegment(uint x1, uint y1, uint x2, uint y2);
+        
+        /**
+         * @brief Determines if a segment intersects, including touches, 
+         * any of the Geometry's segments.
+         */
+        bool intersectsSegment(double x1, double y1, 
+            double x2, double y2) const;
+    
+        /**
+         * @brief true if the Geometry is a (closed) Polygon.
+         */
+        bool m_isPolygon;
+    
+        /**
+         * @brief start coordinates for each segment.
+         */
+        std::vector<double> m_x;
+        std::vector<double> m_y;
+
+        /**
+         * @brief x and y extent (end - start) for each segment.
+         */
+        std::vector<double> m_dx;
+        std::vector<double> m_dy;
+        
+        /**
+         * @brief inverse of each segment's squared length, 0 for a 
+         * zero-length segment.
+         */
+        std::vector<double> m_invLengthSq;
+    };
+}
+
+#endif // _DSL_NATIVE_GEOMETRY_H
@@ -31,6 +31,12 @@ namespace DSL
 
     OdeAccumulator::OdeAccumulator(const char* name)
         : OdeBase(name)
+        , m_windowLengths{0}
+        , m_numWindows(0)
+        , m_thresholdWindow(0)
+        , m_windowThreshold(0)
+        , m_outCounts{0}
+        , m_nextActionIndex(0)
     {
         LOG_FUNC();
     }
@@ -43,16 +49,32 @@ namespace DSL
     }
 
     void OdeAccumulator::HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-        NvDsFrameMeta* pFrameMeta)
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
+        NvDsFrameMeta* pFrameMeta, uint occurrences)
     {
-        for (const auto &imap: m_pOdeActionsIndexed)
+        // Note: function is called from the system (callback) context
+        // Gaurd against child updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_numWindows)
+        {
+            double timeMs(getFrameTimeMs(pFrameMeta));
+            
+            WindowCounts& windowCounts = addOccurrences(pFrameMeta->source_id, 
+                DSL_ODE_ANY_CLASS, timeMs, occurrences);
+                
+            if (m_windowThreshold and 
+                windowCounts.counts[m_thresholdWindow] < m_windowThreshold)
+            {
+                return;
+            }
+        }
+        
+        for (const auto &pOdeAction: m_pOdeActionsList)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
             try
             {
-                pOdeAction->HandleOccurrence(pOdeTrigger, pBuffer, 
+                pOdeAction->InvokeOccurrence(pOdeTrigger, pBuffer, 
                     displayMetaData, pFrameMeta, NULL);
             }
             catch(...)
@@ -63,9 +85,124 @@ namespace DSL
         }
     }
 
+    void OdeAccumulator::HandleObjectOccurrence(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (m_numWindows)
+        {
+            addOccurrences(pFrameMeta->source_id, pObjectMeta->class_id,
+                getFrameTimeMs(pFrameMeta), 1);
+        }
+    }
+    
+    void OdeAccumulator::GetWindows(const uint** lengths, uint* numLengths)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *lengths = m_windowLengths;
+        *numLengths = m_numWindows;
+    }
+    
+    bool OdeAccumulator::SetWindows(const uint* lengths, uint numLengths)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (numLengths > DSL_ODE_ACCUMULATOR_MAX_WINDOWS)
+        {
+            LOG_ERROR("Number of windows = " << numLengths 
+                << " exceeds the maximum for OdeAccumulator '" << GetName() << "'");
+            return false;
+        }
+        for (uint i=0; i < numLengths; i++)
+        {
+            if (lengths[i] < DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS)
+            {
+                LOG_ERROR("Window length = " << lengths[i] 
+                    << " ms is too short for OdeAccumulator '" << GetName() << "'");
+                return false;
+            }
+        }
+        if (m_windowThreshold and m_thresholdWindow >= numLengths)
+        {
+            LOG_ERROR("Window threshold for OdeAccumulator '" << GetName() 
+                << "' requires at least " << m_thresholdWindow+1 << " windows");
+            return false;
+        }
+        for (uint i=0; i < DSL_ODE_ACCUMULATOR_MAX_WINDOWS; i++)
+        {
+            m_windowLengths[i] = (i < numLengths) ? lengths[i] : 0;
+        }
+        m_numWindows = numLengths;
+        
+        // Existing counts were bucketed with the previous lengths.
+        m_windowCounts.clear();
+        m_sourceTimes.clear();
+        
+        return true;
+    }
+    
+    void OdeAccumulator::GetWindowCounts(uint sourceId, int classId, 
+        const uint64_t** counts, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        for (uint i=0; i < m_numWindows; i++)
+        {
+            m_outCounts[i] = 0;
+        }
+        
+        auto ipos = m_windowCounts.find(packKey(sourceId, classId));
+        if (ipos != m_windowCounts.end())
+        {
+            // expire all buckets older than the most recent frame for the source.
+            advanceWindows(ipos->second, m_sourceTimes[sourceId].lastTimeMs);
+            
+            for (uint i=0; i < m_numWindows; i++)
+            {
+                m_outCounts[i] = ipos->second.counts[i];
+            }
+        }
+        *counts = m_outCounts;
+        *size = m_numWindows;
+    }
+    
+    void OdeAccumulator::GetWindowThreshold(uint* window, uint* threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *window = m_thresholdWindow;
+        *threshold = m_windowThreshold;
+    }
+    
+    bool OdeAccumulator::SetWindowThreshold(uint window, uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (threshold and window >= m_numWindows)
+        {
+            LOG_ERROR("Invalid window index = " << window 
+                << " for OdeAccumulator '" << GetName() << "' with " 
+                << m_numWindows << " windows");
+            return false;
+        }
+        m_thresholdWindow = window;
+        m_windowThreshold = threshold;
+        
+        return true;
+    }
+
     bool OdeAccumulator::AddAction(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (m_pOdeActions.find(pChild->GetName()) != m_pOdeActions.end())
         {
@@ -82,12 +219,15 @@ namespace DSL
         m_pOdeActions[pChild->GetName()] = pChild;
         m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
         
+        updateActionsList();
+        
         return true;
     }
 
     bool OdeAccumulator::RemoveAction(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         if (m_pOdeActions.find(pChild->GetName()) == m_pOdeActions.end())
         {
@@ -99,6 +239,8 @@ namespace DSL
         // Erase the child from both maps
         m_pOdeActions.erase(pChild->GetName());
         m_pOdeActionsIndexed.erase(pChild->GetIndex());
+        
+        updateActionsList();
 
         // Clear the parent relationship and index
         pChild->ClearParentName();
@@ -109,6 +251,7 @@ namespace DSL
     void OdeAccumulator::RemoveAllActions()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         for (auto &imap: m_pOdeActions)
         {
@@ -118,6 +261,96 @@ namespace DSL
         }
         m_pOdeActions.clear();
         m_pOdeActionsIndexed.clear();
+        m_pOdeActionsList.clear();
+    }
+
+    void OdeAccumulator::updateActionsList()
+    {
+        LOG_FUNC();
+        
+        m_pOdeActionsList.clear();
+        m_pOdeActionsList.reserve(m_pOdeActionsIndexed.size());
+        
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            m_pOdeActionsList.push_back(
+                std::dynamic_pointer_cast<OdeAction>(imap.second).get());
+        }
+    }
+    
+    double OdeAccumulator::getFrameTimeMs(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        SourceTime& sourceTime = m_sourceTimes[pFrameMeta->source_id];
+        
+        double timeMs(getStreamTimeMs(pFrameMeta) + sourceTime.timeOffsetMs);
+        
+        // If the stream's timestamps have been reset, offset all subsequent
+        // times so that the windows continue from where they left off.
+        if (timeMs < sourceTime.lastTimeMs)
+        {
+            sourceTime.timeOffsetMs += sourceTime.lastTimeMs - timeMs;
+            timeMs = sourceTime.lastTimeMs;
+        }
+        sourceTime.lastTimeMs = timeMs;
+        
+        return timeMs;
+    }
+    
+    OdeAccumulator::WindowCounts& OdeAccumulator::addOccurrences(uint sourceId, 
+        int classId, double timeMs, uint occurrences)
+    {
+        // No function log - avoid overhead.
+        
+        WindowCounts& windowCounts = m_windowCounts[packKey(sourceId, classId)];
+        
+        advanceWindows(windowCounts, timeMs);
+        
+        for (uint i=0; i < m_numWindows; i++)
+        {
+            windowCounts.buckets[i][windowCounts.lastBuckets[i] % 
+                DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS] += occurrences;
+            windowCounts.counts[i] += occurrences;
+        }
+        return windowCounts;
     }
     
+    void OdeAccumulator::advanceWindows(WindowCounts& windowCounts, double timeMs)
+    {
+        // No function log - avoid overhead.
+        
+        for (uint i=0; i < m_numWindows; i++)
+        {
+            uint64_t bucket(timeMs * DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS / 
+                m_windowLengths[i]);
+                
+            // Frame times are monotonic per source - nothing has expired.
+            if (bucket <= windowCounts.lastBuckets[i])
+            {
+                continue;
+            }
+            
+            // If the whole window has expired, clear all buckets at once.
+            if (bucket - windowCounts.lastBuckets[i] >= 
+                DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS)
+            {
+                std::fill_n(windowCounts.buckets[i], 
+                    DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS, 0);
+                windowCounts.counts[i] = 0;
+            }
+            // Else, expire the buckets between the last and current.
+            else
+            {
+                for (uint64_t j = windowCounts.lastBuckets[i]+1; j <= bucket; j++)
+                {
+                    uint64_t& expired = windowCounts.buckets[i]
+                        [j % DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS];
+                    windowCounts.counts[i] -= expired;
+                    expired = 0;
+                }
+            }
+            windowCounts.lastBuckets[i] = bucket;
+        }
+    }
 }
@@ -31,6 +31,9 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    // forward declaration for the typed Action list
+    class OdeAction;
+
     /**
      * @brief convenience macros for shared pointer abstraction
      */
@@ -38,6 +41,12 @@ namespace DSL
     #define DSL_ODE_ACCUMULATOR_NEW(name) \
         std::shared_ptr<OdeAccumulator>(new OdeAccumulator(name))
 
+    /**
+     * @brief number of ring buckets per rolling window. Window counts have a
+     * resolution of window-length / DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS.
+     */
+    #define DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS                  16
+
     // *****************************************************************************
 
     /**
@@ -53,16 +62,73 @@ namespace DSL
         ~OdeAccumulator();
 
         /**
-         * @brief Handles the ODE occurrence by calling the client handler
-         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @brief Handles the ODE occurrences for a frame by adding them to the 
+         * rolling windows for the frame's source, and then - if the threshold
+         * is met - by calling on all child ODE Actions.
          * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] displayMetaData Display Meta allocator for the frame.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
-         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
-         * NULL if Frame level absence, total, min, max, etc. events.
+         * @param[in] occurrences number of ODE occurrences for the current frame.
          */
         void HandleOccurrences(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
-            NvDsFrameMeta* pFrameMeta);
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, uint occurrences);
+        
+        /**
+         * @brief Handles a single object ODE occurrence by adding it to the 
+         * rolling windows for the object's source and class.
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta that triggered the event
+         */
+        void HandleObjectOccurrence(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Gets the current rolling window lengths.
+         * @param[out] lengths window lengths in milliseconds.
+         * @param[out] numLengths number of windows, 0 if disabled.
+         */
+        void GetWindows(const uint** lengths, uint* numLengths);
+        
+        /**
+         * @brief Sets the rolling window lengths. All current window counts 
+         * are cleared.
+         * @param[in] lengths window lengths in milliseconds.
+         * @param[in] numLengths number of windows, 0 to disable, up to 
+         * DSL_ODE_ACCUMULATOR_MAX_WINDOWS.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetWindows(const uint* lengths, uint numLengths);
+        
+        /**
+         * @brief Gets the current occurrence counts, one per rolling window,
+         * for a source and class.
+         * @param[in] sourceId unique id of the source to query.
+         * @param[in] classId class id to query, DSL_ODE_ANY_CLASS for the 
+         * total over all classes.
+         * @param[out] counts occurrence counts, one per window.
+         * @param[out] size number of counts returned.
+         */
+        void GetWindowCounts(uint sourceId, int classId, 
+            const uint64_t** counts, uint* size);
+        
+        /**
+         * @brief Gets the current window threshold for invoking child Actions.
+         * @param[out] window index of the window to test.
+         * @param[out] threshold minimum occurrences within the window, 0 = disabled.
+         */
+        void GetWindowThreshold(uint* window, uint* threshold);
+        
+        /**
+         * @brief Sets the window threshold for invoking child Actions. The
+         * Actions are only invoked for a frame if the total occurrences for 
+         * the frame's source within the window meet the threshold.
+         * @param[in] window index of the window to test.
+         * @param[in] threshold minimum occurrences within the window, 0 = disabled.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetWindowThreshold(uint window, uint threshold);
         
         /**
          * @brief Adds an ODE Action as a child to this OdeAccumulator
@@ -85,6 +151,134 @@ namespace DSL
 
     private:
     
+        /**
+         * @brief Rolling window counts for a single source and class. Each 
+         * window is a ring of buckets keyed by frame time, with a running sum
+         * so that both updates and queries are O(1).
+         */
+        struct WindowCounts
+        {
+            WindowCounts()
+                : buckets{{0}}
+                , lastBuckets{0}
+                , counts{0}
+            {};
+            
+            /**
+             * @brief ring of bucket counts for each window.
+             */
+            uint64_t buckets[DSL_ODE_ACCUMULATOR_MAX_WINDOWS]
+                [DSL_ODE_ACCUMULATOR_WINDOW_BUCKETS];
+            
+            /**
+             * @brief absolute bucket number of the newest bucket for each window.
+             */
+            uint64_t lastBuckets[DSL_ODE_ACCUMULATOR_MAX_WINDOWS];
+            
+            /**
+             * @brief running sum of all buckets for each window.
+             */
+            uint64_t counts[DSL_ODE_ACCUMULATOR_MAX_WINDOWS];
+        };
+        
+        /**
+         * @brief Frame time state for a single source.
+         */
+        struct SourceTime
+        {
+            SourceTime()
+                : lastTimeMs(0)
+                , timeOffsetMs(0)
+            {};
+            
+            /**
+             * @brief frame time of the most recent frame for the source.
+             */
+            double lastTimeMs;
+            
+            /**
+             * @brief offset added to the frame times to keep them monotonic
+             * if the stream's timestamps are reset.
+             */
+            double timeOffsetMs;
+        };
+    
+        /**
+         * @brief Rebuilds the flat m_pOdeActionsList from m_pOdeActionsIndexed.
+         */
+        void updateActionsList();
+        
+        /**
+         * @brief Gets the frame time for a frame, offset so that the times 
+         * for each source never go backwards.
+         * @param[in] pFrameMeta frame meta for the frame.
+         * @return monotonic frame time in milliseconds.
+         */
+        double getFrameTimeMs(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Adds occurrences to the rolling windows for a source and class.
+         * @param[in] sourceId unique id of the source.
+         * @param[in] classId class id, DSL_ODE_ANY_CLASS for the total.
+         * @param[in] timeMs frame time in milliseconds.
+         * @param[in] occurrences number of occurrences to add.
+         * @return reference to the updated window counts.
+         */
+        WindowCounts& addOccurrences(uint sourceId, int classId, 
+            double timeMs, uint occurrences);
+        
+        /**
+         * @brief Expires the buckets of all windows that are older than timeMs.
+         * @param[in] windowCounts window counts to update.
+         * @param[in] timeMs current frame time in milliseconds.
+         */
+        void advanceWindows(WindowCounts& windowCounts, double timeMs);
+        
+        /**
+         * @brief Packs a source_id-class_id combination into a single key.
+         */
+        static inline uint64_t packKey(uint sourceId, int classId)
+        {
+            return ((uint64_t)sourceId << 32) | (uint32_t)classId;
+        }
+        
+        /**
+         * @brief rolling window lengths in milliseconds.
+         */
+        uint m_windowLengths[DSL_ODE_ACCUMULATOR_MAX_WINDOWS];
+        
+        /**
+         * @brief number of rolling windows in use, 0 = disabled.
+         */
+        uint m_numWindows;
+        
+        /**
+         * @brief index of the window to test against m_windowThreshold.
+         */
+        uint m_thresholdWindow;
+        
+        /**
+         * @brief minimum occurrences within the threshold window to 
+         * invoke the child Actions, 0 = disabled.
+         */
+        uint m_windowThreshold;
+        
+        /**
+         * @brief rolling window counts keyed by packed source_id-class_id.
+         */
+        std::unordered_map<uint64_t, WindowCounts> m_windowCounts;
+        
+        /**
+         * @brief frame time state for each source. The most recent frame time
+         * is used to expire buckets when queried by the client.
+         */
+        std::map<uint, SourceTime> m_sourceTimes;
+        
+        /**
+         * @brief counts returned to the client on call to GetWindowCounts.
+         */
+        uint64_t m_outCounts[DSL_ODE_ACCUMULATOR_MAX_WINDOWS];
+    
         /**
          * @brief Index variable to incremment/assign on ODE Action add.
          */
@@ -99,6 +293,12 @@ namespace DSL
          * @brief Map of child ODE Actions indexed by their add-order for execution
          */
         std::map <uint, DSL_BASE_PTR> m_pOdeActionsIndexed;
+        
+        /**
+         * @brief Flat list of typed child ODE Action pointers in add-order, 
+         * iterated on every frame. Owned by the maps above.
+         */
+        std::vector<OdeAction*> m_pOdeActionsList;
 
     };
 
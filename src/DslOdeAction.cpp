@@ -31,8 +31,19 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    thread_local bool OdeAction::s_isBatching(false);
+    thread_local std::vector<OdeAction*> OdeAction::s_batchedActions;
+    thread_local std::vector<std::vector<OdeOccurrence>> OdeAction::s_batchedOccurrences;
+
     OdeAction::OdeAction(const char* name)
         : OdeBase(name)
+        , m_batchable(false)
+        , m_asyncCapable(false)
+        , m_reentrant(false)
+        , m_executionMode(DSL_ODE_ACTION_EXECUTION_MODE_SYNC)
+        , m_queueSize(0)
+        , m_overflowPolicy(DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_OLDEST)
+        , m_isAsync(false)
     {
         LOG_FUNC();
     }
@@ -42,6 +53,213 @@ namespace DSL
         LOG_FUNC();
     }
     
+    void OdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        // Don't log function entry/exit
+        for (uint i = 0; i < count; i++)
+        {
+            HandleOccurrence(pOccurrences[i].pOdeTrigger, pBuffer, 
+                displayMetaData, pFrameMeta, pOccurrences[i].pObjectMeta);
+        }
+    }
+    
+    void OdeAction::CaptureOccurrence(OdeOccurrence& occurrence, 
+        const DSL_BASE_PTR& pOdeTrigger, NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // Don't log function entry/exit
+        OdeTrigger* pTrigger = static_cast<OdeTrigger*>(pOdeTrigger.get());
+        
+        // The Trigger passes a non-owning reference to itself on each occurrence.
+        // Take ownership, as the occurrence may be delivered after it's removed.
+        occurrence.pOdeTrigger = pOdeTrigger->shared_from_this();
+        occurrence.pObjectMeta = pObjectMeta;
+        occurrence.eventId = pTrigger->s_eventCount;
+        occurrence.occurrences = pTrigger->m_occurrences;
+        
+        const gint64* pMiscInfo = (pObjectMeta)
+            ? pObjectMeta->misc_obj_info : pFrameMeta->misc_frame_info;
+        std::copy(pMiscInfo, pMiscInfo+MAX_USER_FIELDS, occurrence.miscInfo);
+        
+        // Called in the Trigger's processing context, so the snapshot is
+        // valid here - but not once the occurrence has been queued.
+        const OdeTriggerCriteria* pCriteria = pTrigger->GetCriteria();
+        
+        OdeOccurrenceCriteria& criteria = occurrence.criteria;
+        criteria.classId = pCriteria->classId;
+        criteria.inferId = pCriteria->inferId.load();
+        criteria.minConfidence = pCriteria->minConfidence;
+        criteria.minTrackerConfidence = pCriteria->minTrackerConfidence;
+        criteria.minWidth = pCriteria->minWidth;
+        criteria.minHeight = pCriteria->minHeight;
+        criteria.maxWidth = pCriteria->maxWidth;
+        criteria.maxHeight = pCriteria->maxHeight;
+        criteria.inferDoneOnly = pCriteria->inferDoneOnly;
+        criteria.minFrameCountN = pCriteria->minFrameCountN;
+        criteria.minFrameCountD = pCriteria->minFrameCountD;
+    }
+    
+    void OdeAction::queueOccurrence(const DSL_BASE_PTR& pOdeTrigger, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Don't log function entry/exit
+        
+        // Few batchable Actions are invoked per frame - linear search is best.
+        uint index(0);
+        while (index < s_batchedActions.size() and 
+            s_batchedActions[index] != this)
+        {
+            index++;
+        }
+        if (index == s_batchedActions.size())
+        {
+            s_batchedActions.push_back(this);
+            if (s_batchedOccurrences.size() < s_batchedActions.size())
+            {
+                s_batchedOccurrences.emplace_back();
+            }
+        }
+        s_batchedOccurrences[index].emplace_back();
+        CaptureOccurrence(s_batchedOccurrences[index].back(), 
+            pOdeTrigger, pFrameMeta, pObjectMeta);
+    }
+    
+    void OdeAction::BeginOccurrenceBatch()
+    {
+        // Don't log function entry/exit
+        
+        // Discard anything left over from a frame that ended with an exception
+        for (uint i = 0; i < s_batchedActions.size(); i++)
+        {
+            s_batchedOccurrences[i].clear();
+        }
+        s_batchedActions.clear();
+        s_isBatching = true;
+    }
+    
+    void OdeAction::EndOccurrenceBatch(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        s_isBatching = false;
+        
+        bool metered = OdeRuntimeMetrics::IsActive();
+        
+        for (uint i = 0; i < s_batchedActions.size(); i++)
+        {
+            OdeAction* pOdeAction = s_batchedActions[i];
+            std::vector<OdeOccurrence>& occurrences = s_batchedOccurrences[i];
+            
+            uint64_t start = (metered) ? OdeRuntimeMetrics::Now() : 0;
+            try
+            {
+                pOdeAction->HandleOccurrences(pBuffer, displayMetaData, 
+                    pFrameMeta, occurrences.data(), occurrences.size());
+            }
+            catch(...)
+            {
+                LOG_ERROR("ODE Action '" << pOdeAction->GetName() 
+                    << "' threw exception handling batched occurrences");
+            }
+            if (metered)
+            {
+                pOdeAction->m_runtimeMetrics.Record(occurrences.size(), 
+                    occurrences.size(), OdeRuntimeMetrics::Now() - start);
+            }
+            // Release the Trigger references, but keep the capacity
+            occurrences.clear();
+        }
+        s_batchedActions.clear();
+    }
+    
+    void OdeAction::GetExecutionMode(uint* mode, uint* queueSize, 
+        uint* overflowPolicy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *mode = m_executionMode;
+        *queueSize = m_queueSize;
+        *overflowPolicy = m_overflowPolicy;
+    }
+    
+    bool OdeAction::SetExecutionMode(uint mode, uint queueSize, 
+        uint overflowPolicy)
+    {
+        LOG_FUNC();
+        
+        // The previous Executor, if any, is destroyed on return - after the
+        // property mutex is released - as its worker may still need it.
+        DSL_ODE_ACTION_EXECUTOR_PTR pPrevExecutor;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            if (mode > DSL_ODE_ACTION_EXECUTION_MODE_ASYNC or 
+                overflowPolicy > DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK or
+                !queueSize)
+            {
+                LOG_ERROR("Invalid execution mode settings for ODE Action '"
+                    << GetName() << "'");
+                return false;
+            }
+            if (mode == DSL_ODE_ACTION_EXECUTION_MODE_ASYNC and !m_asyncCapable)
+            {
+                LOG_ERROR("ODE Action '" << GetName() 
+                    << "' does not support asynchronous execution");
+                return false;
+            }
+            DSL_ODE_ACTION_EXECUTOR_PTR pExecutor;
+            if (mode == DSL_ODE_ACTION_EXECUTION_MODE_ASYNC)
+            {
+                pExecutor = DSL_ODE_ACTION_EXECUTOR_NEW(this, 
+                    queueSize, overflowPolicy);
+            }
+            pPrevExecutor = std::atomic_exchange(&m_pExecutor, pExecutor);
+            m_isAsync = (mode == DSL_ODE_ACTION_EXECUTION_MODE_ASYNC);
+            
+            m_executionMode = mode;
+            m_queueSize = queueSize;
+            m_overflowPolicy = overflowPolicy;
+        }
+        return true;
+    }
+    
+    void OdeAction::GetQueueCounters(uint* depth, uint* peakDepth, 
+        uint64_t* drops)
+    {
+        LOG_FUNC();
+        
+        DSL_ODE_ACTION_EXECUTOR_PTR pExecutor = std::atomic_load(&m_pExecutor);
+        if (!pExecutor)
+        {
+            *depth = *peakDepth = 0;
+            *drops = 0;
+            return;
+        }
+        pExecutor->GetCounters(depth, peakDepth, drops);
+    }
+    
+    void OdeAction::ClearQueueCounters()
+    {
+        LOG_FUNC();
+        
+        DSL_ODE_ACTION_EXECUTOR_PTR pExecutor = std::atomic_load(&m_pExecutor);
+        if (pExecutor)
+        {
+            pExecutor->ClearCounters();
+        }
+    }
+    
+    void OdeAction::stopExecutor()
+    {
+        LOG_FUNC();
+        
+        m_isAsync = false;
+        std::atomic_store(&m_pExecutor, DSL_ODE_ACTION_EXECUTOR_PTR(nullptr));
+    }
+    
     std::string OdeAction::Ntp2Str(uint64_t ntp)
     {
         time_t secs = round(ntp/1000000000);
@@ -79,7 +297,7 @@ namespace DSL
     }
 
     void FormatBBoxOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -120,15 +338,20 @@ namespace DSL
         , m_clientData(clientData)
     {
         LOG_FUNC();
+        
+        m_batchable = true;
+        m_asyncCapable = true;
     }
 
     CustomOdeAction::~CustomOdeAction()
     {
         LOG_FUNC();
+        
+        stopExecutor();
     }
     
     void CustomOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -139,11 +362,11 @@ namespace DSL
         }
         try
         {
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            if (displayMetaData.size())
-            {
-                pDisplayMeta = displayMetaData.at(0);
-            }
+            // client callback may add any type of element to the display meta.
+            // There's no way to know if it will, so the first Display Meta is
+            // always acquired, and attached to the frame, when enabled.
+            NvDsDisplayMeta* pDisplayMeta = displayMetaData.Acquire();
+            
             DSL_ODE_TRIGGER_PTR pTrigger 
                 = std::dynamic_pointer_cast<OdeTrigger>(pBase);
             m_clientHandler(pTrigger->s_eventCount, pTrigger->m_wName.c_str(), 
@@ -156,6 +379,39 @@ namespace DSL
         }
     }
 
+    void CustomOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_enabled)
+        {
+            return;
+        }
+        try
+        {
+            // client callback may add any type of element to the display meta.
+            // There's no way to know if it will, so the first Display Meta is
+            // always acquired, and attached to the frame, when enabled.
+            NvDsDisplayMeta* pDisplayMeta = displayMetaData.Acquire();
+            
+            for (uint i = 0; i < count; i++)
+            {
+                OdeTrigger* pTrigger = 
+                    static_cast<OdeTrigger*>(pOccurrences[i].pOdeTrigger.get());
+                m_clientHandler(pOccurrences[i].eventId, pTrigger->m_wName.c_str(), 
+                    pBuffer, pDisplayMeta, pFrameMeta, pOccurrences[i].pObjectMeta, 
+                    m_clientData);
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Custom ODE Action '" << GetName() 
+                << "' threw exception calling client callback");
+        }
+    }
+
     // ********************************************************************
 
     // Initialize static Event Counter
@@ -352,7 +608,7 @@ namespace DSL
     }
 
     void CaptureOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -664,7 +920,7 @@ namespace DSL
     }
     
     void DisableHandlerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -684,6 +940,8 @@ namespace DSL
         , m_contentTypes(contentTypes)
     {
         LOG_FUNC();
+        
+        m_reentrant = true;
     }
 
     CustomizeLabelOdeAction::~CustomizeLabelOdeAction()
@@ -707,7 +965,7 @@ namespace DSL
     }
 
     void CustomizeLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-    GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+    GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
     NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -791,35 +1049,27 @@ namespace DSL
     }
 
     void DisplayOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and displayMetaData.IsEnabled())
         {
             DSL_ODE_TRIGGER_PTR pTrigger = 
                 std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
 
             // check to see if we're adding meta data - client can disable
             // by setting the PPH ODE display meta alloc size to 0.
-            // and ensure we have available space in the vector of meta structs.
-            NvDsDisplayMeta* pDisplayMeta(NULL);
-            for (const auto& ivec: displayMetaData)
-            {
-                if (ivec->num_labels < MAX_ELEMENTS_IN_DISPLAY_META)
-                {
-                    pDisplayMeta = ivec;
-                    break;
-                }
-            }
+            NvDsDisplayMeta* pDisplayMeta = 
+                displayMetaData.Acquire(&NvDsDisplayMeta::num_labels);
             if (!pDisplayMeta)
             {
                 return;
             }
             
             NvOSD_TextParams *pTextParams = 
-                &displayMetaData.at(0)->text_params[pDisplayMeta->num_labels++];
+                &pDisplayMeta->text_params[pDisplayMeta->num_labels++];
             pTextParams->display_text = (gchar*) g_malloc0(MAX_DISPLAY_LEN);
             
             std::string text(m_formatString.c_str());
@@ -883,8 +1133,6 @@ namespace DSL
             // Text background color
             pTextParams->set_bg_clr = m_hasBgColor;
             pTextParams->text_bg_clr = *m_pBgColor;
-            
-            nvds_add_display_meta_to_frame(pFrameMeta, displayMetaData.at(0));
         }
     }
     
@@ -905,7 +1153,7 @@ namespace DSL
     }
 
     void EmailOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1037,6 +1285,9 @@ namespace DSL
     {
         LOG_FUNC();
     
+        // All File Actions write each frame's occurrences under a single lock.
+        m_batchable = true;
+        m_asyncCapable = true;
         g_mutex_init(&m_ostreamMutex);
     }
 
@@ -1120,6 +1371,8 @@ namespace DSL
     {
         LOG_FUNC();
         
+        stopExecutor();
+        
         if (!m_ostream.is_open())
         {
             return;
@@ -1139,7 +1392,7 @@ namespace DSL
     }
 
     void FileTextOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1149,11 +1402,53 @@ namespace DSL
         {
             return;
         }
-        DSL_ODE_TRIGGER_PTR pTrigger = 
-            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        OdeOccurrence occurrence;
+        CaptureOccurrence(occurrence, pOdeTrigger, pFrameMeta, pObjectMeta);
+        
+        writeOccurrence(occurrence, pFrameMeta);
+
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+        }
+    }
+
+    void FileTextOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
+
+        if (!m_enabled)
+        {
+            return;
+        }
+        for (uint i = 0; i < count; i++)
+        {
+            writeOccurrence(pOccurrences[i], pFrameMeta);
+        }
+
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+        }
+    }
+
+    void FileTextOdeAction::writeOccurrence(const OdeOccurrence& occurrence, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        OdeTrigger* pTrigger = 
+            static_cast<OdeTrigger*>(occurrence.pOdeTrigger.get());
+        NvDsObjectMeta* pObjectMeta = occurrence.pObjectMeta;
         
         m_ostream << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        m_ostream << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        m_ostream << "  Unique ODE Id     : " << occurrence.eventId << "\n";
         m_ostream << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         m_ostream << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -1174,20 +1469,19 @@ namespace DSL
 
         if (pObjectMeta)
         {
-            m_ostream << "    Occurrences     : " << pTrigger->m_occurrences << "\n";
+            m_ostream << "    Occurrences     : " << occurrence.occurrences << "\n";
             m_ostream << "    Obj ClassId     : " << pObjectMeta->class_id << "\n";
             m_ostream << "    Infer Id        : " << pObjectMeta->unique_component_id << "\n";
             m_ostream << "    Tracking Id     : " << pObjectMeta->object_id << "\n";
             m_ostream << "    Label           : " << pObjectMeta->obj_label << "\n";
-            m_ostream << "    Persistence     : " << pObjectMeta->
-                misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] << "\n";
-            if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
+            m_ostream << "    Persistence     : " << occurrence.miscInfo[DSL_OBJECT_INFO_PERSISTENCE] << "\n";
+            if (occurrence.miscInfo[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_NONE)
             {
                 m_ostream << "    Direction In    : " << "No\n";
                 m_ostream << "    Direction Out   : " << "No\n";
             }
-            else if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
+            else if (occurrence.miscInfo[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_IN)
             {
                 m_ostream << "    Direction In    : " << "Yes\n";
@@ -1208,34 +1502,36 @@ namespace DSL
         }
         else
         {
-            if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+            if (occurrence.miscInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
                 DSL_FRAME_INFO_OCCURRENCES)
             {
                 m_ostream << "    Occurrences     : " 
-                    << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] << "\n";
+                    << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES] << "\n";
             }
-            else if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+            else if (occurrence.miscInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
                 DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
             {
                 m_ostream << "    Occurrences In  : " 
-                    << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
+                    << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
                 m_ostream << "    Occurrences Out : " 
-                    << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
+                    << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
             }
         }
 
+        const OdeOccurrenceCriteria& criteria = occurrence.criteria;
+        
         m_ostream << "  Criteria          : ------------------------" << "\n";
-        m_ostream << "    Class Id        : " << pTrigger->m_classId << "\n";
-        m_ostream << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        m_ostream << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        m_ostream << "    Min Frame Count : " << pTrigger->m_minFrameCountN
-            << " out of " << pTrigger->m_minFrameCountD << "\n";
-        m_ostream << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        m_ostream << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        m_ostream << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        m_ostream << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
-
-        if (pTrigger->m_inferDoneOnly)
+        m_ostream << "    Class Id        : " << criteria.classId << "\n";
+        m_ostream << "    Min Infer Conf  : " << criteria.minConfidence << "\n";
+        m_ostream << "    Min Track Conf  : " << criteria.minTrackerConfidence << "\n";
+        m_ostream << "    Min Frame Count : " << criteria.minFrameCountN
+            << " out of " << criteria.minFrameCountD << "\n";
+        m_ostream << "    Min Width       : " << lrint(criteria.minWidth) << "\n";
+        m_ostream << "    Min Height      : " << lrint(criteria.minHeight) << "\n";
+        m_ostream << "    Max Width       : " << lrint(criteria.maxWidth) << "\n";
+        m_ostream << "    Max Height      : " << lrint(criteria.maxHeight) << "\n";
+
+        if (criteria.inferDoneOnly)
         {
             m_ostream << "    Inference   : Yes\n\n";
         }
@@ -1243,13 +1539,6 @@ namespace DSL
         {
             m_ostream << "    Inference   : No\n\n";
         }
-        
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
     }
 
     FileCsvOdeAction::FileCsvOdeAction(const char* name,
@@ -1324,10 +1613,12 @@ namespace DSL
     FileCsvOdeAction::~FileCsvOdeAction()
     {
         LOG_FUNC();
+        
+        stopExecutor();
     }
 
     void FileCsvOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1337,11 +1628,53 @@ namespace DSL
         {
             return;
         }
-        DSL_ODE_TRIGGER_PTR pTrigger = 
-            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        OdeOccurrence occurrence;
+        CaptureOccurrence(occurrence, pOdeTrigger, pFrameMeta, pObjectMeta);
+        
+        writeOccurrence(occurrence, pFrameMeta);
+
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+        }
+    }
+
+    void FileCsvOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
+
+        if (!m_enabled)
+        {
+            return;
+        }
+        for (uint i = 0; i < count; i++)
+        {
+            writeOccurrence(pOccurrences[i], pFrameMeta);
+        }
+
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+        }
+    }
+
+    void FileCsvOdeAction::writeOccurrence(const OdeOccurrence& occurrence, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        OdeTrigger* pTrigger = 
+            static_cast<OdeTrigger*>(occurrence.pOdeTrigger.get());
+        NvDsObjectMeta* pObjectMeta = occurrence.pObjectMeta;
         
         m_ostream << pTrigger->GetName() << ",";
-        m_ostream << pTrigger->s_eventCount << ",";
+        m_ostream << occurrence.eventId << ",";
         m_ostream << pFrameMeta->ntp_timestamp << ",";
         if (pFrameMeta->bInferDone)
         {
@@ -1357,7 +1690,7 @@ namespace DSL
         m_ostream << pFrameMeta->frame_num << ",";
         m_ostream << pFrameMeta->source_frame_width << ",";
         m_ostream << pFrameMeta->source_frame_height << ",";
-        m_ostream << pTrigger->m_occurrences << ",";
+        m_ostream << occurrence.occurrences << ",";
 
         if (pObjectMeta)
         {
@@ -1367,15 +1700,14 @@ namespace DSL
             m_ostream << pObjectMeta->obj_label << ",";
             m_ostream << pObjectMeta->confidence << ",";
             m_ostream << pObjectMeta->tracker_confidence << ",";
-            m_ostream << pObjectMeta->
-                misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] + ",";
-            if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
+            m_ostream << occurrence.miscInfo[DSL_OBJECT_INFO_PERSISTENCE] + ",";
+            if (occurrence.miscInfo[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_NONE)
             {
                 m_ostream << "No,";
                 m_ostream << "No,";
             }
-            else if (pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_DIRECTION] == 
+            else if (occurrence.miscInfo[DSL_OBJECT_INFO_DIRECTION] == 
                 DSL_AREA_CROSS_DIRECTION_IN)
             {
                 m_ostream << "Yes,";
@@ -1398,15 +1730,17 @@ namespace DSL
             m_ostream << "0,0,0,0,0";
         }
 
-        m_ostream << pTrigger->m_classId << ",";
-        m_ostream << lrint(pTrigger->m_minWidth) << ",";
-        m_ostream << lrint(pTrigger->m_minHeight) << ",";
-        m_ostream << lrint(pTrigger->m_maxWidth) << ",";
-        m_ostream << lrint(pTrigger->m_maxHeight) << ",";
-        m_ostream << pTrigger->m_minConfidence << ",";
-        m_ostream << pTrigger->m_minTrackerConfidence << ",";
+        const OdeOccurrenceCriteria& criteria = occurrence.criteria;
+        
+        m_ostream << criteria.classId << ",";
+        m_ostream << lrint(criteria.minWidth) << ",";
+        m_ostream << lrint(criteria.minHeight) << ",";
+        m_ostream << lrint(criteria.maxWidth) << ",";
+        m_ostream << lrint(criteria.maxHeight) << ",";
+        m_ostream << criteria.minConfidence << ",";
+        m_ostream << criteria.minTrackerConfidence << ",";
 
-        if (pTrigger->m_inferDoneOnly)
+        if (criteria.inferDoneOnly)
         {
             m_ostream << "Yes\n";
         }
@@ -1414,13 +1748,6 @@ namespace DSL
         {
             m_ostream << "No\n";
         }
-        
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
-        }
     }
     
     FileMotcOdeAction::FileMotcOdeAction(const char* name,
@@ -1454,10 +1781,12 @@ namespace DSL
     FileMotcOdeAction::~FileMotcOdeAction()
     {
         LOG_FUNC();
+        
+        stopExecutor();
     }
 
     void FileMotcOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1467,18 +1796,37 @@ namespace DSL
         {
             return;
         }
-        DSL_ODE_TRIGGER_PTR pTrigger = 
-            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        writeOccurrence(pFrameMeta, pObjectMeta);
+        m_ostream << std::flush;
         
-        m_ostream << pFrameMeta->frame_num << ", ";
-        m_ostream << pObjectMeta->class_id << ", ";
-        m_ostream << pObjectMeta->rect_params.left << ", ";
-        m_ostream << pObjectMeta->rect_params.top << ", ";
-        m_ostream << pObjectMeta->rect_params.width << ", ";
-        m_ostream << pObjectMeta->rect_params.height << ", ";
-        m_ostream << pObjectMeta->tracker_confidence << ", ";
-        m_ostream << "-1, -1, -1" << std::endl;
-            
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
+        }
+    }
+
+    void FileMotcOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_ostreamMutex);
+
+        if (!m_enabled)
+        {
+            return;
+        }
+        for (uint i = 0; i < count; i++)
+        {
+            if (pOccurrences[i].pObjectMeta)
+            {
+                writeOccurrence(pFrameMeta, pOccurrences[i].pObjectMeta);
+            }
+        }
+        // Single flush for all lines written for the frame.
+        m_ostream << std::flush;
         
         // If we're force flushing the stream and the flush
         // handler is not currently added to the idle thread
@@ -1487,6 +1835,20 @@ namespace DSL
             m_flushThreadFunctionId = g_idle_add(FileActionFlush, this);
         }
     }
+
+    void FileMotcOdeAction::writeOccurrence(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // Don't log function entry/exit
+        m_ostream << pFrameMeta->frame_num << ", ";
+        m_ostream << pObjectMeta->class_id << ", ";
+        m_ostream << pObjectMeta->rect_params.left << ", ";
+        m_ostream << pObjectMeta->rect_params.top << ", ";
+        m_ostream << pObjectMeta->rect_params.width << ", ";
+        m_ostream << pObjectMeta->rect_params.height << ", ";
+        m_ostream << pObjectMeta->tracker_confidence << ", ";
+        m_ostream << "-1, -1, -1\n";
+    }
     
     
     // ********************************************************************
@@ -1506,12 +1868,12 @@ namespace DSL
     }
 
     void FillSurroundingsOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (m_enabled and pObjectMeta and displayMetaData.size())
+        if (m_enabled and pObjectMeta and displayMetaData.IsEnabled())
         {
             
             uint x1(roundf(pObjectMeta->rect_params.left));
@@ -1570,13 +1932,21 @@ namespace DSL
     }
 
     void FillFrameOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled)
         {
+            // check to see if we're adding meta data - client can disable
+            // by setting the PPH ODE display meta alloc size to 0.
+            NvDsDisplayMeta* pDisplayMeta = 
+                displayMetaData.Acquire(&NvDsDisplayMeta::num_rects);
+            if (!pDisplayMeta)
+            {
+                return;
+            }
             NvOSD_RectParams rectParams{0};
             rectParams.left = 0;
             rectParams.top = 0;
@@ -1586,7 +1956,7 @@ namespace DSL
             rectParams.has_bg_color = true;
             rectParams.bg_color = *m_pColor;
             
-            displayMetaData.at(0)->rect_params[displayMetaData.at(0)->num_rects++] = rectParams;
+            pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = rectParams;
         }
     }
 
@@ -1596,101 +1966,132 @@ namespace DSL
         : OdeAction(name)
     {
         LOG_FUNC();
+        
+        m_batchable = true;
+        m_asyncCapable = true;
     }
 
     LogOdeAction::~LogOdeAction()
     {
         LOG_FUNC();
+        
+        stopExecutor();
     }
 
     void LogOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
         if (m_enabled)
         {
-            DSL_ODE_TRIGGER_PTR pTrigger = 
-                std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
-            
-            LOG_INFO("Trigger Name        : " << pTrigger->GetName());
-            LOG_INFO("  Unique ODE Id     : " << pTrigger->s_eventCount);
-            LOG_INFO("  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp));
-            LOG_INFO("  Source Data       : ------------------------");
-            
-            if (pFrameMeta->bInferDone)
-            {
-                LOG_INFO("    Inference       : Yes");
-            }
-            else
-            {
-                LOG_INFO("    Inference       : No");
-            }
-            LOG_INFO("    Source Id       : " << pFrameMeta->source_id);
-            LOG_INFO("    Batch Id        : " << pFrameMeta->batch_id);
-            LOG_INFO("    Pad Index       : " << pFrameMeta->pad_index);
-            LOG_INFO("    Frame           : " << pFrameMeta->frame_num);
-            LOG_INFO("    Width           : " << pFrameMeta->source_frame_width);
-            LOG_INFO("    Heigh           : " << pFrameMeta->source_frame_height );
-            LOG_INFO("  Object Data       : ------------------------");
+            OdeOccurrence occurrence;
+            CaptureOccurrence(occurrence, pOdeTrigger, pFrameMeta, pObjectMeta);
             
-            if (pObjectMeta)
-            {
-                LOG_INFO("    Occurrences     : " << pTrigger->m_occurrences );
-                LOG_INFO("    Obj ClassId     : " << pObjectMeta->class_id);
-                LOG_INFO("    Infer Id        : " << pObjectMeta->unique_component_id);
-                LOG_INFO("    Tracking Id     : " << pObjectMeta->object_id);
-                LOG_INFO("    Label           : " << pObjectMeta->obj_label);
-                LOG_INFO("    Persistence     : " << pObjectMeta->
-                    misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE]);
-                LOG_INFO("    Direction       : " << pObjectMeta->
-                    misc_obj_info[DSL_OBJECT_INFO_DIRECTION]);
-                LOG_INFO("    Infer Conf      : " << pObjectMeta->confidence);
-                LOG_INFO("    Track Conf      : " << pObjectMeta->tracker_confidence);
-                LOG_INFO("    Left            : " << pObjectMeta->rect_params.left);
-                LOG_INFO("    Top             : " << pObjectMeta->rect_params.top);
-                LOG_INFO("    Width           : " << pObjectMeta->rect_params.width);
-                LOG_INFO("    Height          : " << pObjectMeta->rect_params.height);
-            }
-            else
+            logOccurrence(occurrence, pFrameMeta);
+        }
+    }
+
+    void LogOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        if (m_enabled)
+        {
+            for (uint i = 0; i < count; i++)
             {
-                if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
-                    DSL_FRAME_INFO_OCCURRENCES)
-                {
-                    LOG_INFO("    Occurrences         : " 
-                        << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES]);
-                }
-                else if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
-                    DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
-                {
-                    LOG_INFO("    Occurrences In      : " 
-                        << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN]);
-                    LOG_INFO("    Occurrences Out     : " 
-                        << pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT]);
-                }
+                logOccurrence(pOccurrences[i], pFrameMeta);
             }
-            LOG_INFO("  Criteria          : ------------------------");
-            LOG_INFO("    Class Id        : " << pTrigger->m_classId );
-            LOG_INFO("    Min Infer Id    : " << pTrigger->m_inferId );
-            LOG_INFO("    Min Infer Conf  : " << pTrigger->m_minConfidence);
-            LOG_INFO("    Min Track Conf  : " << pTrigger->m_minTrackerConfidence);
-            LOG_INFO("    Frame Count     : " << pTrigger->m_minFrameCountN
-                << " out of " << pTrigger->m_minFrameCountD);
-            LOG_INFO("    Min Width       : " << pTrigger->m_minWidth);
-            LOG_INFO("    Min Height      : " << pTrigger->m_minHeight);
-            LOG_INFO("    Max Width       : " << pTrigger->m_maxWidth);
-            LOG_INFO("    Max Height      : " << pTrigger->m_maxHeight);
-            
-            if (pTrigger->m_inferDoneOnly)
+        }
+    }
+
+    void LogOdeAction::logOccurrence(const OdeOccurrence& occurrence, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        OdeTrigger* pTrigger = 
+            static_cast<OdeTrigger*>(occurrence.pOdeTrigger.get());
+        NvDsObjectMeta* pObjectMeta = occurrence.pObjectMeta;
+        
+        LOG_INFO("Trigger Name        : " << pTrigger->GetName());
+        LOG_INFO("  Unique ODE Id     : " << occurrence.eventId);
+        LOG_INFO("  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp));
+        LOG_INFO("  Source Data       : ------------------------");
+        
+        if (pFrameMeta->bInferDone)
+        {
+            LOG_INFO("    Inference       : Yes");
+        }
+        else
+        {
+            LOG_INFO("    Inference       : No");
+        }
+        LOG_INFO("    Source Id       : " << pFrameMeta->source_id);
+        LOG_INFO("    Batch Id        : " << pFrameMeta->batch_id);
+        LOG_INFO("    Pad Index       : " << pFrameMeta->pad_index);
+        LOG_INFO("    Frame           : " << pFrameMeta->frame_num);
+        LOG_INFO("    Width           : " << pFrameMeta->source_frame_width);
+        LOG_INFO("    Heigh           : " << pFrameMeta->source_frame_height );
+        LOG_INFO("  Object Data       : ------------------------");
+        
+        if (pObjectMeta)
+        {
+            LOG_INFO("    Occurrences     : " << occurrence.occurrences );
+            LOG_INFO("    Obj ClassId     : " << pObjectMeta->class_id);
+            LOG_INFO("    Infer Id        : " << pObjectMeta->unique_component_id);
+            LOG_INFO("    Tracking Id     : " << pObjectMeta->object_id);
+            LOG_INFO("    Label           : " << pObjectMeta->obj_label);
+            LOG_INFO("    Persistence     : " << occurrence.miscInfo[DSL_OBJECT_INFO_PERSISTENCE]);
+            LOG_INFO("    Direction       : " << occurrence.miscInfo[DSL_OBJECT_INFO_DIRECTION]);
+            LOG_INFO("    Infer Conf      : " << pObjectMeta->confidence);
+            LOG_INFO("    Track Conf      : " << pObjectMeta->tracker_confidence);
+            LOG_INFO("    Left            : " << pObjectMeta->rect_params.left);
+            LOG_INFO("    Top             : " << pObjectMeta->rect_params.top);
+            LOG_INFO("    Width           : " << pObjectMeta->rect_params.width);
+            LOG_INFO("    Height          : " << pObjectMeta->rect_params.height);
+        }
+        else
+        {
+            if (occurrence.miscInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+                DSL_FRAME_INFO_OCCURRENCES)
             {
-                LOG_INFO("    Inference       : Yes");
+                LOG_INFO("    Occurrences         : " 
+                    << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES]);
             }
-            else
+            else if (occurrence.miscInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+                DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
             {
-                LOG_INFO("    Inference       : No");
+                LOG_INFO("    Occurrences In      : " 
+                    << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN]);
+                LOG_INFO("    Occurrences Out     : " 
+                    << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT]);
             }
         }
+        const OdeOccurrenceCriteria& criteria = occurrence.criteria;
+        
+        LOG_INFO("  Criteria          : ------------------------");
+        LOG_INFO("    Class Id        : " << criteria.classId );
+        LOG_INFO("    Min Infer Id    : " << criteria.inferId );
+        LOG_INFO("    Min Infer Conf  : " << criteria.minConfidence);
+        LOG_INFO("    Min Track Conf  : " << criteria.minTrackerConfidence);
+        LOG_INFO("    Frame Count     : " << criteria.minFrameCountN
+            << " out of " << criteria.minFrameCountD);
+        LOG_INFO("    Min Width       : " << criteria.minWidth);
+        LOG_INFO("    Min Height      : " << criteria.minHeight);
+        LOG_INFO("    Max Width       : " << criteria.maxWidth);
+        LOG_INFO("    Max Height      : " << criteria.maxHeight);
+        
+        if (criteria.inferDoneOnly)
+        {
+            LOG_INFO("    Inference       : Yes");
+        }
+        else
+        {
+            LOG_INFO("    Inference       : No");
+        }
     }
 
     // ********************************************************************
@@ -1728,6 +2129,8 @@ namespace DSL
         , m_metaType(NVDS_EVENT_MSG_META)
     {
         LOG_FUNC();
+        
+        m_batchable = true;
     }
 
     MessageMetaAddOdeAction::~MessageMetaAddOdeAction()
@@ -1736,35 +2139,36 @@ namespace DSL
     }
 
     void MessageMetaAddOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
         if (m_enabled)
         {
-            NvDsEventMsgMeta* pMsgMeta = 
-                (NvDsEventMsgMeta*)g_malloc0(sizeof(NvDsEventMsgMeta));
-         
-            pMsgMeta->sensorId = pFrameMeta->source_id;
+            NvDsBatchMeta *pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+            if (!pBatchMeta) 
+            { 
+                LOG_ERROR("Error occurred getting batch meta for ODE Action '" 
+                    << GetName() << "'");
+                return;
+            }
             const char* sourceName;
             Services::GetServices()->SourceNameGet(pFrameMeta->source_id, 
                 &sourceName);
-            pMsgMeta->sensorStr = g_strdup(sourceName);
-            pMsgMeta->frameId = pFrameMeta->frame_num;
-            pMsgMeta->ts = g_strdup(Ntp2Str(pFrameMeta->ntp_timestamp).c_str());
-
-            if (pObjectMeta)
-            {
-                pMsgMeta->objectId = g_strdup(pObjectMeta->obj_label);
-                pMsgMeta->confidence = pObjectMeta->confidence;
-                pMsgMeta->trackingId = pObjectMeta->object_id;
-                pMsgMeta->bbox.left = pObjectMeta->rect_params.left;
-                pMsgMeta->bbox.top = pObjectMeta->rect_params.top;
-                pMsgMeta->bbox.width = pObjectMeta->rect_params.width;
-                pMsgMeta->bbox.height = pObjectMeta->rect_params.height;
-            }
+                
+            addMessageMeta(pBatchMeta, pFrameMeta, pObjectMeta, sourceName);
+        }
+    }
+    
+    void MessageMetaAddOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
+        if (m_enabled)
+        {
             NvDsBatchMeta *pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
             if (!pBatchMeta) 
             { 
@@ -1772,23 +2176,59 @@ namespace DSL
                     << GetName() << "'");
                 return;
             }
-            NvDsUserMeta *pUserMeta = nvds_acquire_user_meta_from_pool(pBatchMeta);
-            if (!pUserMeta) 
-            { 
-                LOG_ERROR("Error occurred acquiring user meta for ODE Action '" 
-                    << GetName() << "'");
-                return;
+            // Source name is looked up once for all occurrences in the frame
+            const char* sourceName;
+            Services::GetServices()->SourceNameGet(pFrameMeta->source_id, 
+                &sourceName);
+                
+            for (uint i = 0; i < count; i++)
+            {
+                addMessageMeta(pBatchMeta, pFrameMeta, 
+                    pOccurrences[i].pObjectMeta, sourceName);
             }
-            pUserMeta->user_meta_data = (void *)pMsgMeta;
-            pUserMeta->base_meta.meta_type = (NvDsMetaType)m_metaType;
-            pUserMeta->base_meta.copy_func = 
-                (NvDsMetaCopyFunc)message_action_meta_copy;
-            pUserMeta->base_meta.release_func = 
-                (NvDsMetaReleaseFunc)message_action_meta_free;
-            nvds_add_user_meta_to_frame(pFrameMeta, pUserMeta);
         }
     }
     
+    void MessageMetaAddOdeAction::addMessageMeta(NvDsBatchMeta* pBatchMeta,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, 
+        const char* sourceName)
+    {
+        // Don't log function entry/exit
+        NvDsUserMeta *pUserMeta = nvds_acquire_user_meta_from_pool(pBatchMeta);
+        if (!pUserMeta) 
+        { 
+            LOG_ERROR("Error occurred acquiring user meta for ODE Action '" 
+                << GetName() << "'");
+            return;
+        }
+        NvDsEventMsgMeta* pMsgMeta = 
+            (NvDsEventMsgMeta*)g_malloc0(sizeof(NvDsEventMsgMeta));
+     
+        pMsgMeta->sensorId = pFrameMeta->source_id;
+        pMsgMeta->sensorStr = g_strdup(sourceName);
+        pMsgMeta->frameId = pFrameMeta->frame_num;
+        pMsgMeta->ts = g_strdup(Ntp2Str(pFrameMeta->ntp_timestamp).c_str());
+
+        if (pObjectMeta)
+        {
+            pMsgMeta->objectId = g_strdup(pObjectMeta->obj_label);
+            pMsgMeta->confidence = pObjectMeta->confidence;
+            pMsgMeta->trackingId = pObjectMeta->object_id;
+            pMsgMeta->bbox.left = pObjectMeta->rect_params.left;
+            pMsgMeta->bbox.top = pObjectMeta->rect_params.top;
+            pMsgMeta->bbox.width = pObjectMeta->rect_params.width;
+            pMsgMeta->bbox.height = pObjectMeta->rect_params.height;
+        }
+
+        pUserMeta->user_meta_data = (void *)pMsgMeta;
+        pUserMeta->base_meta.meta_type = (NvDsMetaType)m_metaType;
+        pUserMeta->base_meta.copy_func = 
+            (NvDsMetaCopyFunc)message_action_meta_copy;
+        pUserMeta->base_meta.release_func = 
+            (NvDsMetaReleaseFunc)message_action_meta_free;
+        nvds_add_user_meta_to_frame(pFrameMeta, pUserMeta);
+    }
+    
     uint MessageMetaAddOdeAction::GetMetaType()
     {
         LOG_FUNC();
@@ -1821,7 +2261,7 @@ namespace DSL
     }
     
     void MonitorOdeAction::HandleOccurrence(DSL_BASE_PTR pBase, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1897,7 +2337,8 @@ namespace DSL
             // Trigger criteria set for this ODE occurrence.
             info.criteria_info.class_id =  pTrigger->m_classId;
             info.criteria_info.inference_done_only = pTrigger->m_inferDoneOnly;
-            info.criteria_info.inference_component_id = pTrigger->m_inferId;
+            info.criteria_info.inference_component_id = 
+                pTrigger->GetCriteria()->inferId;
             info.criteria_info.min_inference_confidence = pTrigger->m_minConfidence;
             info.criteria_info.min_tracker_confidence = pTrigger->m_minTrackerConfidence;
             info.criteria_info.min_width = pTrigger->m_minWidth;
@@ -1935,7 +2376,7 @@ namespace DSL
     }
 
     void FormatLabelOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -1983,12 +2424,12 @@ namespace DSL
     }
     
     void AddDisplayMetaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        if (m_enabled and displayMetaData.size())
+        if (m_enabled and displayMetaData.IsEnabled())
         {
             for (const auto &ivec: m_pDisplayTypes)
             {
@@ -2012,7 +2453,7 @@ namespace DSL
     }
     
     void PauseOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2034,12 +2475,16 @@ namespace DSL
     {
         LOG_FUNC();
 
+        m_batchable = true;
+        m_asyncCapable = true;
         g_mutex_init(&m_ostreamMutex);
     }
 
     PrintOdeAction::~PrintOdeAction()
     {
         LOG_FUNC();
+        
+        stopExecutor();
 
         if (m_flushThreadFunctionId)
         {
@@ -2049,7 +2494,7 @@ namespace DSL
     }
 
     void PrintOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2058,11 +2503,52 @@ namespace DSL
         {
             return;
         }
-        DSL_ODE_TRIGGER_PTR pTrigger = 
-            std::dynamic_pointer_cast<OdeTrigger>(pOdeTrigger);
+        OdeOccurrence occurrence;
+        CaptureOccurrence(occurrence, pOdeTrigger, pFrameMeta, pObjectMeta);
+        
+        writeOccurrence(occurrence, pFrameMeta);
+
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(PrintActionFlush, this);
+        }
+    }
+
+    void PrintOdeAction::HandleOccurrences(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+        const OdeOccurrence* pOccurrences, uint count)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_enabled)
+        {
+            return;
+        }
+        for (uint i = 0; i < count; i++)
+        {
+            writeOccurrence(pOccurrences[i], pFrameMeta);
+        }
+
+        // If we're force flushing the stream and the flush
+        // handler is not currently added to the idle thread
+        if (m_forceFlush and !m_flushThreadFunctionId)
+        {
+            m_flushThreadFunctionId = g_idle_add(PrintActionFlush, this);
+        }
+    }
+
+    void PrintOdeAction::writeOccurrence(const OdeOccurrence& occurrence, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        OdeTrigger* pTrigger = 
+            static_cast<OdeTrigger*>(occurrence.pOdeTrigger.get());
+        NvDsObjectMeta* pObjectMeta = occurrence.pObjectMeta;
         
         std::cout << "Trigger Name        : " << pTrigger->GetName() << "\n";
-        std::cout << "  Unique ODE Id     : " << pTrigger->s_eventCount << "\n";
+        std::cout << "  Unique ODE Id     : " << occurrence.eventId << "\n";
         std::cout << "  NTP Timestamp     : " << Ntp2Str(pFrameMeta->ntp_timestamp) << "\n";
         std::cout << "  Source Data       : ------------------------" << "\n";
         if (pFrameMeta->bInferDone)
@@ -2089,10 +2575,8 @@ namespace DSL
             std::cout << "    Label           : " << pObjectMeta->obj_label << "\n";
             std::cout << "    Infer Conf      : " << pObjectMeta->confidence << "\n";
             std::cout << "    Track Conf      : " << pObjectMeta->tracker_confidence << "\n";
-            std::cout << "    Persistence     : " << pObjectMeta->
-                misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] << "\n";
-            std::cout << "    Direction       : " << pObjectMeta->
-                misc_obj_info[DSL_OBJECT_INFO_DIRECTION] << "\n";
+            std::cout << "    Persistence     : " << occurrence.miscInfo[DSL_OBJECT_INFO_PERSISTENCE] << "\n";
+            std::cout << "    Direction       : " << occurrence.miscInfo[DSL_OBJECT_INFO_DIRECTION] << "\n";
             std::cout << "    Left            : " << lrint(pObjectMeta->rect_params.left) << "\n";
             std::cout << "    Top             : " << lrint(pObjectMeta->rect_params.top) << "\n";
             std::cout << "    Width           : " << lrint(pObjectMeta->rect_params.width) << "\n";
@@ -2100,35 +2584,34 @@ namespace DSL
         }
         else
         {
-            if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+            if (occurrence.miscInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
                 DSL_FRAME_INFO_OCCURRENCES)
             {
-                std::cout << "    Occurrences     : " << pFrameMeta->
-                    misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] << "\n";
+                std::cout << "    Occurrences     : " << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES] << "\n";
             }
-            else if (pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] == 
+            else if (occurrence.miscInfo[DSL_FRAME_INFO_ACTIVE_INDEX] == 
                 DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN)
             {
-                std::cout << "    Occurrences In  : " << pFrameMeta->
-                    misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
-                std::cout << "    Occurrences Out : " << pFrameMeta->
-                    misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
+                std::cout << "    Occurrences In  : " << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_IN] << "\n";
+                std::cout << "    Occurrences Out : " << occurrence.miscInfo[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] << "\n";
             }
 
         }
 
+        const OdeOccurrenceCriteria& criteria = occurrence.criteria;
+        
         std::cout << "  Criteria          : ------------------------" << "\n";
-        std::cout << "    Class Id        : " << pTrigger->m_classId << "\n";
-        std::cout << "    Min Infer Conf  : " << pTrigger->m_minConfidence << "\n";
-        std::cout << "    Min Track Conf  : " << pTrigger->m_minTrackerConfidence << "\n";
-        std::cout << "    Min Frame Count : " << pTrigger->m_minFrameCountN
-            << " out of " << pTrigger->m_minFrameCountD << "\n";
-        std::cout << "    Min Width       : " << lrint(pTrigger->m_minWidth) << "\n";
-        std::cout << "    Min Height      : " << lrint(pTrigger->m_minHeight) << "\n";
-        std::cout << "    Max Width       : " << lrint(pTrigger->m_maxWidth) << "\n";
-        std::cout << "    Max Height      : " << lrint(pTrigger->m_maxHeight) << "\n";
-
-        if (pTrigger->m_inferDoneOnly)
+        std::cout << "    Class Id        : " << criteria.classId << "\n";
+        std::cout << "    Min Infer Conf  : " << criteria.minConfidence << "\n";
+        std::cout << "    Min Track Conf  : " << criteria.minTrackerConfidence << "\n";
+        std::cout << "    Min Frame Count : " << criteria.minFrameCountN
+            << " out of " << criteria.minFrameCountD << "\n";
+        std::cout << "    Min Width       : " << lrint(criteria.minWidth) << "\n";
+        std::cout << "    Min Height      : " << lrint(criteria.minHeight) << "\n";
+        std::cout << "    Max Width       : " << lrint(criteria.maxWidth) << "\n";
+        std::cout << "    Max Height      : " << lrint(criteria.maxHeight) << "\n";
+
+        if (criteria.inferDoneOnly)
         {
             std::cout << "    Inference       : Yes\n\n";
         }
@@ -2136,14 +2619,6 @@ namespace DSL
         {
             std::cout << "    Inference       : No\n\n";
         }
-
-        // If we're force flushing the stream and the flush
-        // handler is not currently added to the idle thread
-        if (m_forceFlush and !m_flushThreadFunctionId)
-        {
-            m_flushThreadFunctionId = g_idle_add(PrintActionFlush, this);
-        }
-        
     }
 
     bool PrintOdeAction::Flush()
@@ -2168,6 +2643,8 @@ namespace DSL
         : OdeAction(name)
     {
         LOG_FUNC();
+        
+        m_reentrant = true;
     }
 
     RedactOdeAction::~RedactOdeAction()
@@ -2177,7 +2654,7 @@ namespace DSL
     }
 
     void RedactOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2217,7 +2694,7 @@ namespace DSL
     }
     
     void AddSinkOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2246,7 +2723,7 @@ namespace DSL
     }
     
     void RemoveSinkOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2276,7 +2753,7 @@ namespace DSL
     }
     
     void AddSourceOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2306,7 +2783,7 @@ namespace DSL
     }
     
     void RemoveSourceOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2334,7 +2811,7 @@ namespace DSL
     }
     
     void ResetTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2363,7 +2840,7 @@ namespace DSL
     }
     
     void DisableTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2391,7 +2868,7 @@ namespace DSL
     }
     
     void EnableTriggerOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2419,7 +2896,7 @@ namespace DSL
     }
     
     void DisableActionOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2446,7 +2923,7 @@ namespace DSL
     }
     
     void EnableActionOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2475,7 +2952,7 @@ namespace DSL
     }
     
     void AddAreaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2505,7 +2982,7 @@ namespace DSL
     }
     
     void RemoveAreaOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2536,7 +3013,7 @@ namespace DSL
     }
     
     void RecordSinkStartOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2565,7 +3042,7 @@ namespace DSL
     }
     
     void RecordSinkStopOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2597,7 +3074,7 @@ namespace DSL
     }
     
     void RecordTapStartOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2626,7 +3103,7 @@ namespace DSL
     }
     
     void RecordTapStopOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -2655,7 +3132,7 @@ namespace DSL
     }
     
     void TilerShowSourceOdeAction::HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-        GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
@@ -28,6 +28,8 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslOdeBase.h"
+#include "DslOdeMetrics.h"
+#include "DslOdeActionExecutor.h"
 #include "DslSurfaceTransform.h"
 #include "DslDisplayTypes.h"
 #include "DslPlayerBintr.h"
@@ -43,6 +45,7 @@ namespace DSL
     #define DSL_OBJECT_INFO_PRIMARY_METRIC              0
     #define DSL_OBJECT_INFO_PERSISTENCE                 1
     #define DSL_OBJECT_INFO_DIRECTION                   2
+    #define DSL_OBJECT_INFO_HEADING                     3
     
     /**
      * @brief Constants for indexing "pFrameMeta->misc_frame_info" 
@@ -232,6 +235,8 @@ namespace DSL
         
         
         
+    // ********************************************************************
+
     // ********************************************************************
 
     class OdeAction : public OdeBase
@@ -250,18 +255,262 @@ namespace DSL
          * @brief Virtual function to handle the occurrence of an ODE by taking
          * a specific Action as implemented by the derived class
          * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
-         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event,
+         * may be non-owning. Use shared_from_this() to retain it beyond the call.
          * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
          * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         virtual void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta) = 0;
         
+        /**
+         * @brief Calls HandleOccurrence, recording the Action's runtime metrics 
+         * if metrics are active for the calling thread. Triggers and Accumulators 
+         * invoke their Actions through this function.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pBuffer pointer to the batched stream buffer that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        inline void InvokeOccurrence(const DSL_BASE_PTR& pOdeTrigger, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+        {
+            // Don't log function entry/exit
+            if (m_isAsync.load(std::memory_order_relaxed))
+            {
+                DSL_ODE_ACTION_EXECUTOR_PTR pExecutor = std::atomic_load(&m_pExecutor);
+                if (pExecutor)
+                {
+                    pExecutor->Queue(pOdeTrigger, pFrameMeta, pObjectMeta, 
+                        OdeRuntimeMetrics::IsActive());
+                    return;
+                }
+            }
+            if (m_batchable and s_isBatching)
+            {
+                queueOccurrence(pOdeTrigger, pFrameMeta, pObjectMeta);
+                return;
+            }
+            if (!OdeRuntimeMetrics::IsActive())
+            {
+                HandleOccurrence(pOdeTrigger, 
+                    pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
+                return;
+            }
+            uint64_t start = OdeRuntimeMetrics::Now();
+            
+            HandleOccurrence(pOdeTrigger, 
+                pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
+                
+            m_runtimeMetrics.Record(1, 1, OdeRuntimeMetrics::Now() - start);
+        }
+        
+        /**
+         * @brief Virtual function to handle all occurrences for a single frame
+         * in one call. The default implementation calls HandleOccurrence for 
+         * each. Only called for Actions that support batched delivery.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        virtual void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
+        
+        /**
+         * @brief Determines if this Action supports batched delivery of 
+         * occurrences with HandleOccurrences.
+         * @return true if batchable, false otherwise.
+         */
+        bool IsBatchable()
+        {
+            // Don't log function entry/exit
+            return m_batchable;
+        };
+        
+        /**
+         * @brief Determines if this Action supports asynchronous execution.
+         * @return true if async capable, false otherwise.
+         */
+        bool IsAsyncCapable()
+        {
+            // Don't log function entry/exit
+            return m_asyncCapable;
+        };
+        
+        /**
+         * @brief Determines if this Action can be invoked concurrently for the
+         * occurrences of different frames.
+         * @return true if reentrant, false otherwise.
+         */
+        bool IsReentrant()
+        {
+            // Don't log function entry/exit
+            return m_reentrant;
+        };
+        
+        /**
+         * @brief Gets the current execution mode settings for this Action.
+         * @param[out] mode one of the DSL_ODE_ACTION_EXECUTION_MODE constants.
+         * @param[out] queueSize maximum number of queued occurrences.
+         * @param[out] overflowPolicy one of the DSL_ODE_ACTION_QUEUE_OVERFLOW
+         * constants.
+         */
+        void GetExecutionMode(uint* mode, uint* queueSize, uint* overflowPolicy);
+        
+        /**
+         * @brief Sets the execution mode settings for this Action. Any 
+         * occurrences queued under the previous settings are executed first.
+         * @param[in] mode one of the DSL_ODE_ACTION_EXECUTION_MODE constants.
+         * @param[in] queueSize maximum number of queued occurrences, > 0.
+         * @param[in] overflowPolicy one of the DSL_ODE_ACTION_QUEUE_OVERFLOW
+         * constants.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetExecutionMode(uint mode, uint queueSize, uint overflowPolicy);
+        
+        /**
+         * @brief Gets the current async-queue counters for this Action.
+         * All counters are 0 while in synchronous mode.
+         * @param[out] depth current number of queued occurrences.
+         * @param[out] peakDepth maximum queue depth since last cleared.
+         * @param[out] drops number of occurrences dropped since last cleared.
+         */
+        void GetQueueCounters(uint* depth, uint* peakDepth, uint64_t* drops);
+        
+        /**
+         * @brief Clears the async-queue peak-depth and drop counters.
+         */
+        void ClearQueueCounters();
+        
+        /**
+         * @brief Captures the occurrence data, from the Trigger and Meta data, 
+         * that may change before a batched or queued occurrence is delivered.
+         * The occurrence record takes shared ownership of the Trigger.
+         * @param[out] occurrence occurrence record to fill in.
+         */
+        static void CaptureOccurrence(OdeOccurrence& occurrence, 
+            const DSL_BASE_PTR& pOdeTrigger, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Starts batching the occurrences for all batchable Actions 
+         * invoked by the calling thread until EndOccurrenceBatch is called.
+         */
+        static void BeginOccurrenceBatch();
+        
+        /**
+         * @brief Ends batching for the calling thread, delivering all queued 
+         * occurrences to each Action, in order of first occurrence, with a 
+         * single call to HandleOccurrences.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         */
+        static void EndOccurrenceBatch(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Gets the runtime metrics for this ODE Action.
+         * @return reference to the Action's runtime metrics.
+         */
+        OdeRuntimeMetrics& GetRuntimeMetrics()
+        {
+            // Don't log function entry/exit
+            return m_runtimeMetrics;
+        };
+        
     protected:
 
         std::string Ntp2Str(uint64_t ntp);
+        
+        /**
+         * @brief Executes all queued occurrences and stops the async Executor,
+         * if running. Must be called first by the dtor of each async capable
+         * Action, while the derived Action is still intact.
+         */
+        void stopExecutor();
+        
+        /**
+         * @brief runtime metrics for this ODE Action.
+         */
+        OdeRuntimeMetrics m_runtimeMetrics;
+        
+        /**
+         * @brief true if the derived Action implements HandleOccurrences, 
+         * false otherwise. Set by the derived class on construction.
+         */
+        bool m_batchable;
+
+        /**
+         * @brief true if the derived Action can be executed asynchronously,
+         * i.e. makes no changes to the buffer or its metadata. Set by the 
+         * derived class on construction.
+         */
+        bool m_asyncCapable;
+
+        /**
+         * @brief true if the derived Action can be invoked concurrently, by the
+         * workers of a parallel ODE Handler, for the occurrences of different 
+         * frames - i.e. only updates the occurrence's own Object meta. Set by 
+         * the derived class on construction.
+         */
+        bool m_reentrant;
+
+    private:
+    
+        /**
+         * @brief one of the DSL_ODE_ACTION_EXECUTION_MODE constants.
+         */
+        uint m_executionMode;
+        
+        /**
+         * @brief maximum number of queued occurrences for async execution.
+         */
+        uint m_queueSize;
+        
+        /**
+         * @brief one of the DSL_ODE_ACTION_QUEUE_OVERFLOW constants.
+         */
+        uint m_overflowPolicy;
+        
+        /**
+         * @brief true while in async mode. Checked before loading the Executor
+         * so that synchronous Actions pay no more than a relaxed load.
+         */
+        std::atomic<bool> m_isAsync;
+        
+        /**
+         * @brief async Executor while in async mode, accessed atomically.
+         */
+        DSL_ODE_ACTION_EXECUTOR_PTR m_pExecutor;
+    
+        /**
+         * @brief Adds an occurrence to the calling thread's current batch.
+         */
+        void queueOccurrence(const DSL_BASE_PTR& pOdeTrigger, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief true while occurrences are being batched by the calling thread.
+         */
+        static thread_local bool s_isBatching;
+        
+        /**
+         * @brief Actions with queued occurrences for the calling thread, 
+         * in order of first occurrence.
+         */
+        static thread_local std::vector<OdeAction*> s_batchedActions;
+        
+        /**
+         * @brief queued occurrences for the calling thread, one vector per
+         * Action in s_batchedActions. Vectors are reused from frame to frame.
+         */
+        static thread_local std::vector<std::vector<OdeOccurrence>> s_batchedOccurrences;
 
     };
 
@@ -302,7 +551,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -363,8 +612,19 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
         
     private:
     
@@ -415,7 +675,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
         /**
@@ -633,7 +893,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -686,7 +946,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -755,7 +1015,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -800,7 +1060,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -848,10 +1108,27 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
+
     private:
+
+        /**
+         * @brief Logs a single occurrence with LOG_INFO.
+         */
+        void logOccurrence(const OdeOccurrence& occurrence, 
+            NvDsFrameMeta* pFrameMeta);
     
     };
         
@@ -886,8 +1163,19 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
             
         /**
          * @brief Gets the current base_meta.meta_type identifier in use by 
@@ -905,6 +1193,12 @@ namespace DSL
         void SetMetaType(uint metaType);
 
     private:
+
+        /**
+         * @brief Adds NvDsEventMsgMeta for a single occurrence to the frame.
+         */
+        void addMessageMeta(NvDsBatchMeta* pBatchMeta, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta, const char* sourceName);
     
         /**
          * @brief defines the base_meta.meta_type id to use for
@@ -949,7 +1243,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -998,7 +1292,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1043,7 +1337,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1092,7 +1386,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -1136,7 +1430,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1190,7 +1484,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -1230,9 +1524,20 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
+
         /**
          * @brief Flushes the stdout buffer. ** To be called by the idle thread only **.
          * @return false to unschedule always - single flush operation.
@@ -1241,6 +1546,12 @@ namespace DSL
 
     private:
 
+        /**
+         * @brief Writes a single occurrence to stdout.
+         */
+        void writeOccurrence(const OdeOccurrence& occurrence, 
+            NvDsFrameMeta* pFrameMeta);
+
         /**
          * @brief flag to enable/disable forced stream buffer flushing
          */
@@ -1366,9 +1677,28 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-    
+
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
+
+    private:
+
+        /**
+         * @brief Writes a single occurrence to the output stream.
+         */
+        void writeOccurrence(const OdeOccurrence& occurrence, 
+            NvDsFrameMeta* pFrameMeta);
+
     };
 
     /**
@@ -1402,9 +1732,28 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-    
+
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
+
+    private:
+
+        /**
+         * @brief Writes a single occurrence to the output stream.
+         */
+        void writeOccurrence(const OdeOccurrence& occurrence, 
+            NvDsFrameMeta* pFrameMeta);
+
     };
 
     /**
@@ -1438,9 +1787,28 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
-    
+
+        /**
+         * @brief Handles all occurrences for a single frame in one call.
+         * @param[in] pBuffer pointer to the batched stream buffer for the frame.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @param[in] pOccurrences array of occurrence records in occurrence order.
+         * @param[in] count number of occurrence records in pOccurrences.
+         */
+        void HandleOccurrences(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta, 
+            const OdeOccurrence* pOccurrences, uint count);
+
+    private:
+
+        /**
+         * @brief Writes a single occurrence to the output stream.
+         */
+        void writeOccurrence(NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta);
+
     };
         
     // ********************************************************************
@@ -1474,7 +1842,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
@@ -1513,7 +1881,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1562,7 +1930,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1611,7 +1979,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1660,7 +2028,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1708,7 +2076,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pBaseTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1751,7 +2119,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1794,7 +2162,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pBaseTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1837,7 +2205,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1880,7 +2248,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1924,7 +2292,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -1972,7 +2340,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2022,7 +2390,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2081,7 +2449,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2127,7 +2495,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2186,7 +2554,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -2230,7 +2598,7 @@ namespace DSL
          * NULL if Frame level absence, total, min, max, etc. events.
          */
         void HandleOccurrence(DSL_BASE_PTR pOdeTrigger, 
-            GstBuffer* pBuffer, std::vector<NvDsDisplayMeta*>& displayMetaData,
+            GstBuffer* pBuffer, DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         
     private:
@@ -0,0 +1,358 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeActionExecutor.h"
+#include "DslOdeAction.h"
+#include "DslDisplayTypes.h"
+
+namespace DSL
+{
+    OdeActionExecutor::OdeActionExecutor(OdeAction* pOdeAction, 
+        uint queueSize, uint overflowPolicy)
+        : m_pOdeAction(pOdeAction)
+        , m_queueSize(queueSize)
+        , m_overflowPolicy(overflowPolicy)
+        , m_pSlots(new Slot[queueSize])
+        , m_queuePos(0)
+        , m_executePos(0)
+        , m_peakDepth(0)
+        , m_drops(0)
+        , m_workerWaiting(false)
+        , m_producersWaiting(0)
+        , m_stop(false)
+        , m_pWorkerThread(NULL)
+    {
+        LOG_FUNC();
+        
+        for (uint i=0; i < m_queueSize; i++)
+        {
+            m_pSlots[i].sequence = i;
+        }
+        g_mutex_init(&m_waitMutex);
+        g_cond_init(&m_queuedCond);
+        g_cond_init(&m_spaceCond);
+        
+        m_pWorkerThread = g_thread_new(m_pOdeAction->GetCStrName(), 
+            OdeActionExecutorThread, this);
+
+        LOG_INFO("OdeActionExecutor for ODE Action '" << m_pOdeAction->GetName()
+            << "' created with queue size = " << m_queueSize);
+    }
+    
+    OdeActionExecutor::~OdeActionExecutor()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+            m_stop = true;
+            g_cond_signal(&m_queuedCond);
+        }
+        g_thread_join(m_pWorkerThread);
+        
+        g_cond_clear(&m_spaceCond);
+        g_cond_clear(&m_queuedCond);
+        g_mutex_clear(&m_waitMutex);
+    }
+    
+    uint OdeActionExecutor::GetQueueSize()
+    {
+        LOG_FUNC();
+        
+        return m_queueSize;
+    }
+    
+    uint OdeActionExecutor::GetOverflowPolicy()
+    {
+        LOG_FUNC();
+        
+        return m_overflowPolicy;
+    }
+    
+    void OdeActionExecutor::Queue(const DSL_BASE_PTR& pOdeTrigger, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, bool metered)
+    {
+        // Don't log function entry/exit
+        
+        uint64_t pos;
+        Slot* pSlot;
+        
+        while (!(pSlot = claimSlot(pos)))
+        {
+            if (m_overflowPolicy == DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_NEWEST)
+            {
+                m_drops.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            if (m_overflowPolicy == DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_OLDEST)
+            {
+                // Compete with the worker for the oldest occurrence. 
+                uint64_t oldestPos;
+                Slot* pOldestSlot = claimQueuedSlot(oldestPos);
+                if (pOldestSlot)
+                {
+                    pOldestSlot->event.occurrence.pOdeTrigger = nullptr;
+                    releaseQueuedSlot(pOldestSlot, oldestPos);
+                    m_drops.fetch_add(1, std::memory_order_relaxed);
+                }
+                continue;
+            }
+            waitForSpace();
+        }
+        
+        OdeActionEvent& event = pSlot->event;
+        
+        OdeAction::CaptureOccurrence(event.occurrence, 
+            pOdeTrigger, pFrameMeta, pObjectMeta);
+        event.metered = metered;
+        
+        // Copy the Frame Meta, clearing all pointers to buffer-owned memory.
+        event.frameMeta = *pFrameMeta;
+        event.frameMeta.base_meta = {0};
+        event.frameMeta.obj_meta_list = NULL;
+        event.frameMeta.display_meta_list = NULL;
+        event.frameMeta.frame_user_meta_list = NULL;
+        
+        event.hasObjectMeta = (pObjectMeta != NULL);
+        if (pObjectMeta)
+        {
+            event.objectMeta = *pObjectMeta;
+            event.objectMeta.base_meta = {0};
+            event.objectMeta.parent = NULL;
+            event.objectMeta.text_params.display_text = NULL;
+            event.objectMeta.mask_params.data = NULL;
+            event.objectMeta.classifier_meta_list = NULL;
+            event.objectMeta.obj_user_meta_list = NULL;
+        }
+        pSlot->sequence.store(pos+1, std::memory_order_release);
+        
+        // Depth is approximate under concurrency - good enough for the peak.
+        int64_t depth = (int64_t)(pos+1 - 
+            m_executePos.load(std::memory_order_relaxed));
+        uint peakDepth = m_peakDepth.load(std::memory_order_relaxed);
+        while (depth > (int64_t)peakDepth and 
+            !m_peakDepth.compare_exchange_weak(peakDepth, (uint)depth, 
+                std::memory_order_relaxed))
+        {
+        }
+        
+        if (m_workerWaiting)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+            g_cond_signal(&m_queuedCond);
+        }
+    }
+    
+    void OdeActionExecutor::GetCounters(uint* depth, uint* peakDepth, 
+        uint64_t* drops)
+    {
+        LOG_FUNC();
+        
+        uint64_t executePos = m_executePos.load();
+        int64_t currentDepth = (int64_t)(m_queuePos.load() - executePos);
+        
+        *depth = (currentDepth > 0) ? (uint)currentDepth : 0;
+        *peakDepth = m_peakDepth.load();
+        *drops = m_drops.load();
+    }
+    
+    void OdeActionExecutor::ClearCounters()
+    {
+        LOG_FUNC();
+        
+        m_peakDepth = 0;
+        m_drops = 0;
+    }
+    
+    void OdeActionExecutor::HandleWorkerThread()
+    {
+        // Disabled - Display Meta can't be added once the buffer has moved on.
+        DisplayMetaData displayMetaData;
+        
+        while (true)
+        {
+            uint64_t pos;
+            Slot* pSlot = claimQueuedSlot(pos);
+            
+            if (pSlot)
+            {
+                // Execute in place to avoid copying the event
+                execute(pSlot->event, displayMetaData);
+                
+                // Release the Trigger reference before releasing the slot.
+                pSlot->event.occurrence.pOdeTrigger = nullptr;
+                releaseQueuedSlot(pSlot, pos);
+                
+                if (m_producersWaiting)
+                {
+                    LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+                    g_cond_broadcast(&m_spaceCond);
+                }
+                continue;
+            }
+            // Only stop once all queued occurrences have been executed
+            if (m_stop)
+            {
+                return;
+            }
+            waitForQueued();
+        }
+    }
+    
+    OdeActionExecutor::Slot* OdeActionExecutor::claimSlot(uint64_t& pos)
+    {
+        // Don't log function entry/exit
+        
+        pos = m_queuePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot* pSlot = &m_pSlots[pos % m_queueSize];
+            int64_t diff = (int64_t)(pSlot->sequence.load(
+                std::memory_order_acquire) - pos);
+                
+            if (diff == 0)
+            {
+                if (m_queuePos.compare_exchange_weak(pos, pos+1, 
+                    std::memory_order_relaxed))
+                {
+                    return pSlot;
+                }
+            }
+            else if (diff < 0)
+            {
+                // queue is full
+                return NULL;
+            }
+            else
+            {
+                pos = m_queuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    OdeActionExecutor::Slot* OdeActionExecutor::claimQueuedSlot(uint64_t& pos)
+    {
+        // Don't log function entry/exit
+        
+        pos = m_executePos.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Slot* pSlot = &m_pSlots[pos % m_queueSize];
+            int64_t diff = (int64_t)(pSlot->sequence.load(
+                std::memory_order_acquire) - (pos+1));
+                
+            if (diff == 0)
+            {
+                if (m_executePos.compare_exchange_weak(pos, pos+1, 
+                    std::memory_order_relaxed))
+                {
+                    return pSlot;
+                }
+            }
+            else if (diff < 0)
+            {
+                // queue is empty, or the oldest slot is not yet filled
+                return NULL;
+            }
+            else
+            {
+                pos = m_executePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    void OdeActionExecutor::releaseQueuedSlot(Slot* pSlot, uint64_t pos)
+    {
+        // Don't log function entry/exit
+        pSlot->sequence.store(pos + m_queueSize, std::memory_order_release);
+    }
+    
+    void OdeActionExecutor::waitForQueued()
+    {
+        // Don't log function entry/exit
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+        
+        m_workerWaiting = true;
+        
+        // The timeout bounds the wait should a wake-up be missed.
+        if (!m_stop and m_queuePos.load() == m_executePos.load())
+        {
+            g_cond_wait_until(&m_queuedCond, &m_waitMutex, 
+                g_get_monotonic_time() + 10*G_TIME_SPAN_MILLISECOND);
+        }
+        m_workerWaiting = false;
+    }
+    
+    void OdeActionExecutor::waitForSpace()
+    {
+        // Don't log function entry/exit
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+        
+        m_producersWaiting++;
+        
+        // The timeout bounds the wait should a wake-up be missed.
+        uint64_t executePos = m_executePos.load();
+        if (m_queuePos.load() - executePos >= m_queueSize)
+        {
+            g_cond_wait_until(&m_spaceCond, &m_waitMutex, 
+                g_get_monotonic_time() + G_TIME_SPAN_MILLISECOND);
+        }
+        m_producersWaiting--;
+    }
+    
+    void OdeActionExecutor::execute(OdeActionEvent& event, 
+        DisplayMetaData& displayMetaData)
+    {
+        // Don't log function entry/exit
+        
+        event.occurrence.pObjectMeta = 
+            (event.hasObjectMeta) ? &event.objectMeta : NULL;
+            
+        uint64_t start = (event.metered) ? OdeRuntimeMetrics::Now() : 0;
+        try
+        {
+            m_pOdeAction->HandleOccurrences(NULL, displayMetaData, 
+                &event.frameMeta, &event.occurrence, 1);
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << m_pOdeAction->GetName() 
+                << "' threw exception executing queued occurrence");
+        }
+        if (event.metered)
+        {
+            m_pOdeAction->GetRuntimeMetrics().Record(1, 1, 
+                OdeRuntimeMetrics::Now() - start);
+        }
+    }
+    
+    static gpointer OdeActionExecutorThread(gpointer pExecutor)
+    {
+        static_cast<OdeActionExecutor*>(pExecutor)->HandleWorkerThread();
+        
+        return NULL;
+    }
+}
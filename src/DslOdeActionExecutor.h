@@ -0,0 +1,354 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+
+#ifndef _DSL_ODE_ACTION_EXECUTOR_H
+#define _DSL_ODE_ACTION_EXECUTOR_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslBase.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_ODE_ACTION_EXECUTOR_PTR std::shared_ptr<OdeActionExecutor>
+    #define DSL_ODE_ACTION_EXECUTOR_NEW(pOdeAction, queueSize, overflowPolicy) \
+        std::shared_ptr<OdeActionExecutor>(new OdeActionExecutor( \
+            pOdeAction, queueSize, overflowPolicy))
+
+    // Forward declarations
+    class OdeAction;
+    class DisplayMetaData;
+    
+    /**
+     * @struct OdeOccurrenceCriteria
+     * @brief Copy of the Trigger's criteria at the time of an occurrence, 
+     * so that Actions never read the live Trigger state once the occurrence 
+     * has been queued.
+     */
+    struct OdeOccurrenceCriteria
+    {
+        uint classId;
+        int inferId;
+        float minConfidence;
+        float minTrackerConfidence;
+        uint minFrameCountN;
+        uint minFrameCountD;
+        float minWidth;
+        float minHeight;
+        float maxWidth;
+        float maxHeight;
+        bool inferDoneOnly;
+    };
+    
+    /**
+     * @struct OdeOccurrence
+     * @brief Record of a single ODE occurrence, captured at the time of the
+     * occurrence for batched or asynchronous delivery to an ODE Action.
+     */
+    struct OdeOccurrence
+    {
+        /**
+         * @brief shared pointer to ODE Trigger that triggered the event, owning
+         * the Trigger until the occurrence is delivered.
+         */
+        DSL_BASE_PTR pOdeTrigger;
+        
+        /**
+         * @brief pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         */
+        NvDsObjectMeta* pObjectMeta;
+        
+        /**
+         * @brief unique ODE event id at the time of occurrence.
+         */
+        uint64_t eventId;
+        
+        /**
+         * @brief Trigger's occurrence count at the time of occurrence.
+         */
+        uint64_t occurrences;
+        
+        /**
+         * @brief copy of the Object's misc_obj_info, or of the Frame's 
+         * misc_frame_info for Frame level events, at the time of occurrence.
+         */
+        gint64 miscInfo[MAX_USER_FIELDS];
+        
+        /**
+         * @brief copy of the Trigger's criteria at the time of occurrence.
+         */
+        OdeOccurrenceCriteria criteria;
+    };
+
+    /**
+     * @struct OdeActionEvent
+     * @brief Self-contained record of a single ODE occurrence queued for 
+     * asynchronous execution. The Frame and Object Meta are copied by value 
+     * with all pointers to buffer-owned memory cleared.
+     */
+    struct OdeActionEvent
+    {
+        /**
+         * @brief occurrence record. pObjectMeta is set to objectMeta, or NULL, 
+         * when the event is executed.
+         */
+        OdeOccurrence occurrence;
+        
+        /**
+         * @brief copy of the Frame Meta for the occurrence.
+         */
+        NvDsFrameMeta frameMeta;
+        
+        /**
+         * @brief copy of the Object Meta for the occurrence, if any.
+         */
+        NvDsObjectMeta objectMeta;
+        
+        /**
+         * @brief true if objectMeta is valid, false for Frame level events.
+         */
+        bool hasObjectMeta;
+        
+        /**
+         * @brief true if runtime metrics were active for the queuing thread.
+         */
+        bool metered;
+    };
+
+    /**
+     * @class OdeActionExecutor
+     * @brief Executes the occurrences for a single ODE Action on a dedicated
+     * worker thread. Occurrences are copied into a bounded, lock-free, 
+     * multi-producer queue by the streaming thread(s) and executed in
+     * queue order. The overflow policy determines what happens when full.
+     */
+    class OdeActionExecutor
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the OdeActionExecutor class
+         * @param[in] pOdeAction ODE Action to execute the occurrences for. 
+         * The Action must outlive the Executor.
+         * @param[in] queueSize maximum number of queued occurrences.
+         * @param[in] overflowPolicy one of the DSL_ODE_ACTION_QUEUE_OVERFLOW 
+         * constants.
+         */
+        OdeActionExecutor(OdeAction* pOdeAction, uint queueSize, 
+            uint overflowPolicy);
+        
+        /**
+         * @brief dtor for the OdeActionExecutor class - executes all queued
+         * occurrences and then stops and joins the worker thread.
+         */
+        ~OdeActionExecutor();
+        
+        /**
+         * @brief Gets the maximum number of queued occurrences.
+         * @return queue size set on construction.
+         */
+        uint GetQueueSize();
+        
+        /**
+         * @brief Gets the queue overflow policy.
+         * @return one of the DSL_ODE_ACTION_QUEUE_OVERFLOW constants.
+         */
+        uint GetOverflowPolicy();
+        
+        /**
+         * @brief Captures and queues a single occurrence for execution. 
+         * May be called by multiple threads concurrently.
+         * @param[in] pOdeTrigger shared pointer to ODE Trigger that triggered the event
+         * @param[in] pFrameMeta pointer to the Frame Meta data that triggered the event
+         * @param[in] pObjectMeta pointer to Object Meta if Object detection event, 
+         * NULL if Frame level absence, total, min, max, etc. events.
+         * @param[in] metered true to record the execution time with the 
+         * Action's runtime metrics.
+         */
+        void Queue(const DSL_BASE_PTR& pOdeTrigger, NvDsFrameMeta* pFrameMeta, 
+            NvDsObjectMeta* pObjectMeta, bool metered);
+        
+        /**
+         * @brief Gets the current queue counters.
+         * @param[out] depth current number of queued occurrences.
+         * @param[out] peakDepth maximum depth since created or last cleared.
+         * @param[out] drops number of occurrences dropped on overflow since 
+         * created or last cleared.
+         */
+        void GetCounters(uint* depth, uint* peakDepth, uint64_t* drops);
+        
+        /**
+         * @brief Clears the peak-depth and drop counters.
+         */
+        void ClearCounters();
+        
+        /**
+         * @brief Worker thread function, called by the worker on creation. 
+         * Returns once stopped and all queued occurrences have been executed.
+         */
+        void HandleWorkerThread();
+        
+    private:
+    
+        /**
+         * @struct Slot
+         * @brief A single queue slot. The sequence number synchronizes 
+         * ownership of the event between producers and the consumer.
+         */
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence;
+            OdeActionEvent event;
+        };
+        
+        /**
+         * @brief Claims the next free slot.
+         * @param[out] pos queue position of the claimed slot.
+         * @return claimed slot, NULL if the queue is full. 
+         */
+        Slot* claimSlot(uint64_t& pos);
+        
+        /**
+         * @brief Claims the oldest queued slot.
+         * @param[out] pos queue position of the claimed slot.
+         * @return claimed slot, NULL if the queue is empty. 
+         */
+        Slot* claimQueuedSlot(uint64_t& pos);
+        
+        /**
+         * @brief Releases a slot claimed with claimQueuedSlot for reuse.
+         * @param[in] pSlot slot to release.
+         * @param[in] pos queue position of the slot.
+         */
+        void releaseQueuedSlot(Slot* pSlot, uint64_t pos);
+        
+        /**
+         * @brief Waits for a producer to queue an occurrence, or for a timeout.
+         */
+        void waitForQueued();
+        
+        /**
+         * @brief Waits for the consumer to free a slot, or for a timeout.
+         */
+        void waitForSpace();
+        
+        /**
+         * @brief Executes a single queued event with the ODE Action.
+         * @param[in] event event to execute.
+         * @param[in] displayMetaData disabled Display Meta for the Action.
+         */
+        void execute(OdeActionEvent& event, DisplayMetaData& displayMetaData);
+        
+        /**
+         * @brief ODE Action to execute the occurrences for.
+         */
+        OdeAction* m_pOdeAction;
+        
+        /**
+         * @brief maximum number of queued occurrences.
+         */
+        uint m_queueSize;
+        
+        /**
+         * @brief one of the DSL_ODE_ACTION_QUEUE_OVERFLOW constants.
+         */
+        uint m_overflowPolicy;
+        
+        /**
+         * @brief fixed ring of queue slots.
+         */
+        std::unique_ptr<Slot[]> m_pSlots;
+        
+        /**
+         * @brief position of the next slot to be claimed by a producer.
+         */
+        alignas(64) std::atomic<uint64_t> m_queuePos;
+        
+        /**
+         * @brief position of the next slot to be claimed by the consumer,
+         * or by a producer dropping the oldest occurrence.
+         */
+        alignas(64) std::atomic<uint64_t> m_executePos;
+        
+        /**
+         * @brief maximum queue depth since created or last cleared.
+         */
+        std::atomic<uint> m_peakDepth;
+        
+        /**
+         * @brief number of occurrences dropped since created or last cleared.
+         */
+        std::atomic<uint64_t> m_drops;
+        
+        /**
+         * @brief true while the worker is waiting for an occurrence to be queued.
+         */
+        std::atomic<bool> m_workerWaiting;
+        
+        /**
+         * @brief number of producers waiting for a free slot.
+         */
+        std::atomic<uint> m_producersWaiting;
+        
+        /**
+         * @brief set on destruction to stop the worker once the queue is empty.
+         */
+        std::atomic<bool> m_stop;
+        
+        /**
+         * @brief mutex for the wait conditions below. Never held while
+         * queuing or executing.
+         */
+        GMutex m_waitMutex;
+        
+        /**
+         * @brief condition signaled to the worker when an occurrence is queued.
+         */
+        GCond m_queuedCond;
+        
+        /**
+         * @brief condition signaled to waiting producers when a slot is freed.
+         */
+        GCond m_spaceCond;
+        
+        /**
+         * @brief worker thread owned by this OdeActionExecutor.
+         */
+        GThread* m_pWorkerThread;
+    };
+    
+    /**
+     * @brief Worker thread function for the OdeActionExecutor.
+     * @param[in] pExecutor pointer to the OdeActionExecutor that owns the thread.
+     */
+    static gpointer OdeActionExecutorThread(gpointer pExecutor);
+}
+
+#endif // _DSL_ODE_ACTION_EXECUTOR_H
@@ -36,14 +36,18 @@ namespace DSL
         , m_bboxTestPoint(bboxTestPoint)
     {
         LOG_FUNC();
+        
+        g_mutex_init(&m_frameNumMutex);
     }
     
     OdeArea::~OdeArea()
     {
         LOG_FUNC();
+        
+        g_mutex_clear(&m_frameNumMutex);
     }
         
-    void OdeArea::AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
+    void OdeArea::AddMeta(DisplayMetaData& displayMetaData,  
         NvDsFrameMeta* pFrameMeta)
     {
         LOG_FUNC();
@@ -52,6 +56,7 @@ namespace DSL
         {
             return;
         }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_frameNumMutex);
         
         // If this is the first time seeing a frame for the reported Source Id.
         if (m_frameNumPerSource.find(pFrameMeta->source_id) == m_frameNumPerSource.end())
@@ -71,6 +76,98 @@ namespace DSL
         }
     }
 
+    bool OdeArea::DoesSegmentCrossLine(const dsl_coordinate& start, 
+        const dsl_coordinate& end, TrackedObjectCrossState& crossState, 
+        uint& direction)
+    {
+        // Do not log function entry
+        
+        direction = DSL_AREA_CROSS_DIRECTION_NONE;
+        
+        // If this is the first segment tested for the trace
+        if (crossState.side == DSL_AREA_POINT_LOCATION_ON_LINE)
+        {
+            crossState.side = GetPointLocation(start);
+        }
+        if (!crossState.intersected)
+        {
+            crossState.intersected = doesSegmentIntersectLine(start, end);
+            if (!crossState.intersected)
+            {
+                return false;
+            }
+        }
+        
+        // use the Area's line width and trace-endpoint to determine if the cross
+        // is sufficient to report, i.e. the line width is used as hysteresis.
+        // The end-point must also be on the other side - in case the object's 
+        // trace crosses the line more than once.
+        uint location = GetPointLocation(end);
+        if (location == DSL_AREA_POINT_LOCATION_ON_LINE or 
+            location == crossState.side)
+        {
+            return false;
+        }
+        direction = location;
+        return true;
+    }
+    
+    void OdeArea::addLineSegment(const dsl_coordinate& start, 
+        const dsl_coordinate& end)
+    {
+        m_lineSegments.push_back({start, end});
+    }
+    
+    /**
+     * @brief Returns the orientation of point c relative to the line a->b, 
+     * > 0 for counter-clockwise, < 0 for clockwise, and 0 for collinear.
+     */
+    static inline int64_t orientation(const dsl_coordinate& a, 
+        const dsl_coordinate& b, const dsl_coordinate& c)
+    {
+        return ((int64_t)b.x - a.x)*((int64_t)c.y - a.y) - 
+            ((int64_t)b.y - a.y)*((int64_t)c.x - a.x);
+    }
+    
+    /**
+     * @brief Returns true if point c, known to be collinear with a->b, is 
+     * within the bounds of the segment a->b.
+     */
+    static inline bool isWithinSegment(const dsl_coordinate& a, 
+        const dsl_coordinate& b, const dsl_coordinate& c)
+    {
+        return (c.x >= std::min(a.x, b.x) and c.x <= std::max(a.x, b.x) and
+            c.y >= std::min(a.y, b.y) and c.y <= std::max(a.y, b.y));
+    }
+    
+    bool OdeArea::doesSegmentIntersectLine(const dsl_coordinate& start, 
+        const dsl_coordinate& end)
+    {
+        for (const auto& lineSegment: m_lineSegments)
+        {
+            int64_t o1 = orientation(lineSegment.start, lineSegment.end, start);
+            int64_t o2 = orientation(lineSegment.start, lineSegment.end, end);
+            int64_t o3 = orientation(start, end, lineSegment.start);
+            int64_t o4 = orientation(start, end, lineSegment.end);
+            
+            // proper intersection - each segment straddles the other
+            if (((o1 > 0 and o2 < 0) or (o1 < 0 and o2 > 0)) and
+                ((o3 > 0 and o4 < 0) or (o3 < 0 and o4 > 0)))
+            {
+                return true;
+            }
+            // touching - an end-point lies on the other segment.
+            if ((o1 == 0 and isWithinSegment(lineSegment.start, lineSegment.end, start)) or
+                (o2 == 0 and isWithinSegment(lineSegment.start, lineSegment.end, end)) or
+                (o3 == 0 and isWithinSegment(start, end, lineSegment.start)) or
+                (o4 == 0 and isWithinSegment(start, end, lineSegment.end)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    
     void OdeArea::getCoordinate(const NvOSD_RectParams& bbox, 
         dsl_coordinate& coordinate)
     {
@@ -127,6 +224,22 @@ namespace DSL
         , m_pPolygon(pPolygon)
     {
         LOG_FUNC();
+        
+        // Small convex Polygons are tested natively, all others with GEOS.
+        if (NativeGeometry::IsSupported(*m_pPolygon))
+        {
+            m_pNativePolygon.reset(new NativeGeometry(*m_pPolygon));
+        }
+        else
+        {
+            m_pGeosPolygon.reset(new GeosPreparedGeometry(*m_pPolygon));
+        }
+
+        for (uint i = 0; i < m_pPolygon->num_coordinates; i++)
+        {
+            addLineSegment(m_pPolygon->coordinates[i], 
+                m_pPolygon->coordinates[(i+1)%m_pPolygon->num_coordinates]);
+        }
     }
     
     OdePolygonArea::~OdePolygonArea()
@@ -134,69 +247,72 @@ namespace DSL
         LOG_FUNC();
     }
     
-    bool OdePolygonArea::IsBboxInside(const NvOSD_RectParams& bbox)
+    uint OdePolygonArea::distance(const dsl_coordinate& coordinate)
     {
         // Do not log function entry
         
-        GeosPolygon testPolygon(bbox);
+        if (m_pNativePolygon)
+        {
+            return m_pNativePolygon->Distance(coordinate);
+        }
+        GeosPoint testPoint(coordinate.x, coordinate.y);
+        return m_pGeosPolygon->Distance(testPoint);
+    }
+    
+    bool OdePolygonArea::contains(const dsl_coordinate& coordinate)
+    {
+        // Do not log function entry
+        
+        if (m_pNativePolygon)
+        {
+            return m_pNativePolygon->Contains(coordinate);
+        }
+        GeosPoint testPoint(coordinate.x, coordinate.y);
+        return m_pGeosPolygon->Contains(testPoint);
+    }
+    
+    bool OdePolygonArea::IsBboxInside(const NvOSD_RectParams& bbox)
+    {
+        // Do not log function entry
         
         if (m_bboxTestPoint == DSL_BBOX_POINT_ANY)
         {
-            return (((GeosPolygon)*m_pPolygon).Overlaps(testPolygon) or
-                ((GeosPolygon)*m_pPolygon).Contains(testPolygon) or
-                testPolygon.Contains((GeosPolygon)*m_pPolygon));
+            if (m_pNativePolygon)
+            {
+                return m_pNativePolygon->Overlaps(bbox);
+            }
+            GeosPolygon testPolygon(bbox);
+        
+            return (m_pGeosPolygon->Overlaps(testPolygon) or
+                m_pGeosPolygon->Contains(testPolygon) or
+                m_pGeosPolygon->Within(testPolygon));
         }        
         dsl_coordinate coordinate;
         getCoordinate(bbox, coordinate);
         
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint);
+        return contains(coordinate);
     }
 
     bool OdePolygonArea::IsPointInside(const dsl_coordinate& coordinate)
     {
         // Do not log function entry
 
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-
-        for (uint i = 0; i < m_pPolygon->num_coordinates-1; i++)
+        if (distance(coordinate) <= (m_pPolygon->border_width/2))
         {
-            GeosLine lineSegment(
-                m_pPolygon->coordinates[i].x, 
-                m_pPolygon->coordinates[i].y, 
-                m_pPolygon->coordinates[(i+1)].x, 
-                m_pPolygon->coordinates[(i+1)].y);
-            
-            if (lineSegment.Distance(testPoint) <= 
-                (m_pPolygon->border_width/2))
-            {
-                return false;
-            }
-            return ((GeosPolygon)*m_pPolygon).Contains(testPoint);          
+            return false;
         }
+        return contains(coordinate);
     }
     
     uint OdePolygonArea::GetPointLocation(const dsl_coordinate& coordinate)
     {
         // Do not log function entry
         
-        GeosPoint testPoint(coordinate.x, coordinate.y);
-
-        for (uint i = 0; i < m_pPolygon->num_coordinates-1; i++)
+        if (distance(coordinate) <= (m_pPolygon->border_width/2))
         {
-            GeosLine lineSegment(
-                m_pPolygon->coordinates[i].x, 
-                m_pPolygon->coordinates[i].y, 
-                m_pPolygon->coordinates[(i+1)].x, 
-                m_pPolygon->coordinates[(i+1)].y);
-            
-            if (lineSegment.Distance(testPoint) <= 
-                (m_pPolygon->border_width/2))
-            {
-                return DSL_AREA_POINT_LOCATION_ON_LINE;
-            }
+            return DSL_AREA_POINT_LOCATION_ON_LINE;
         }
-        return ((GeosPolygon)*m_pPolygon).Contains(testPoint)
+        return contains(coordinate)
             ? DSL_AREA_POINT_LOCATION_INSIDE
             : DSL_AREA_POINT_LOCATION_OUTSIDE;
     }
@@ -205,23 +321,7 @@ namespace DSL
     {
         // Do not log function entry
 
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        for (uint i = 0; i < m_pPolygon->num_coordinates-1; i++)
-        {
-            GeosLine lineSegment(
-                m_pPolygon->coordinates[i].x, 
-                m_pPolygon->coordinates[i].y, 
-                m_pPolygon->coordinates[(i+1)].x, 
-                m_pPolygon->coordinates[(i+1)].y);
-            
-            if (lineSegment.Distance(point) <= 
-                (m_pPolygon->border_width/2))
-            {
-                return true;
-            }
-        }
-        return false;
+        return (distance(coordinate) <= (m_pPolygon->border_width/2));
     }
     
     bool OdePolygonArea::DoesTraceCrossLine(dsl_coordinate* coordinates, 
@@ -229,27 +329,31 @@ namespace DSL
     {
         // Do not log function entry
         
-        // covert the trace vector to line-parameters for testing
-        dsl_multi_line_params lineParms = {coordinates, numCoordinates};
-        
         direction = DSL_AREA_CROSS_DIRECTION_NONE;
 
-        // create a Geos object from the line-parameters to check 
-        // for cross with this Area's line.
-        GeosMultiLine multiLine(lineParms);
+        if (m_pNativePolygon)
+        {
+            if (!m_pNativePolygon->Intersects(coordinates, numCoordinates))
+            { 
+                return false;
+            }
+        }
+        else
+        {
+            // covert the trace vector to line-parameters and create a Geos 
+            // object to check for cross with this Area's geometry.
+            dsl_multi_line_params lineParms = {coordinates, numCoordinates};
+            GeosMultiLine multiLine(lineParms);
         
-        if (!multiLine.Crosses(*m_pPolygon))
-        { 
-            return false;
+            if (!m_pGeosPolygon->Intersects(multiLine))
+            { 
+                return false;
+            }
         }
         
         // use the Area's line width and trace-endpoint to determine if the cross
         // is sufficient to report, i.e. the line width is used as hysteresis.
-        GeosPoint endPoint(
-            coordinates[numCoordinates-1].x, 
-            coordinates[numCoordinates-1].y);
-        
-        bool crossed(((GeosPolygon)*m_pPolygon).Distance(endPoint) > 
+        bool crossed(distance(coordinates[numCoordinates-1]) > 
             (m_pPolygon->border_width/2));
 
         if (crossed)
@@ -299,8 +403,11 @@ namespace DSL
         DSL_RGBA_LINE_PTR pLine, bool show, uint bboxTestPoint)
         : OdeArea(name, pLine, show, bboxTestPoint)
         , m_pLine(pLine)
+        , m_nativeLine(*pLine)
     {
         LOG_FUNC();
+        
+        addLineSegment({m_pLine->x1, m_pLine->y1}, {m_pLine->x2, m_pLine->y2});
     }
     
     OdeLineArea::~OdeLineArea()
@@ -337,9 +444,7 @@ namespace DSL
     {
         // Do not log function entry
 
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        if (((GeosLine)*m_pLine).Distance(point) <= 
+        if (m_nativeLine.Distance(coordinate) <= 
             (m_pLine->line_width/2))
         {
             return DSL_AREA_POINT_LOCATION_ON_LINE;
@@ -357,9 +462,7 @@ namespace DSL
     {
         // Do not log function entry
 
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        return (((GeosLine)*m_pLine).Distance(point) <= 
+        return (m_nativeLine.Distance(coordinate) <= 
             (m_pLine->line_width/2));
     }
     
@@ -368,28 +471,16 @@ namespace DSL
     {
         // Do not log function entry
         
-        // covert the trace vector to line-parameters for testing
-        dsl_multi_line_params lineParms = {coordinates, 
-            numCoordinates};
-
         direction = DSL_AREA_CROSS_DIRECTION_NONE;
-        
-        // create a Geos object from the line-parameters to check 
-        // for cross with this Area's line.
-        GeosMultiLine multiLine(lineParms);
-        
-        if (!multiLine.Crosses(*m_pLine))
+
+        if (!m_nativeLine.Intersects(coordinates, numCoordinates))
         { 
             return false;
         }
 
         // use the Area's line width and trace-endpoint to determine if the cross
         // is sufficient to report, i.e. the line width is used as hysteresis.
-        GeosPoint endPoint(
-            coordinates[numCoordinates-1].x, 
-            coordinates[numCoordinates-1].y);
-        
-        bool crossed(((GeosLine)*m_pLine).Distance(endPoint) > 
+        bool crossed(m_nativeLine.Distance(coordinates[numCoordinates-1]) > 
             (m_pLine->line_width/2));
             
         if (crossed)
@@ -413,6 +504,22 @@ namespace DSL
         , m_pMultiLine(pMultiLine)
     {
         LOG_FUNC();
+        
+        // Multi-Lines with few vertices are tested natively, all others with GEOS.
+        if (NativeGeometry::IsSupported(*m_pMultiLine))
+        {
+            m_pNativeMultiLine.reset(new NativeGeometry(*m_pMultiLine));
+        }
+        else
+        {
+            m_pGeosMultiLine.reset(new GeosPreparedGeometry(*m_pMultiLine));
+        }
+
+        for (uint i = 0; i < m_pMultiLine->num_coordinates-1; i++)
+        {
+            addLineSegment(m_pMultiLine->coordinates[i], 
+                m_pMultiLine->coordinates[i+1]);
+        }
     }
     
     OdeMultiLineArea::~OdeMultiLineArea()
@@ -420,6 +527,18 @@ namespace DSL
         LOG_FUNC();
     }
     
+    uint OdeMultiLineArea::distance(const dsl_coordinate& coordinate)
+    {
+        // Do not log function entry
+        
+        if (m_pNativeMultiLine)
+        {
+            return m_pNativeMultiLine->Distance(coordinate);
+        }
+        GeosPoint point(coordinate.x, coordinate.y);
+        return m_pGeosMultiLine->Distance(point);
+    }
+    
     bool OdeMultiLineArea::IsBboxInside(const NvOSD_RectParams& bbox)
     {
         // Do not log function entry
@@ -453,9 +572,8 @@ namespace DSL
         // Do not log function entry
 
         uint inside(0), outside(0);
-        GeosPoint point(coordinate.x, coordinate.y);
 
-        if (((GeosMultiLine)*m_pMultiLine).Distance(point) <= 
+        if (distance(coordinate) <= 
             (m_pMultiLine->line_width/2))
         {
             return false;
@@ -485,9 +603,8 @@ namespace DSL
         // Do not log function entry
 
         uint inside(0), outside(0);
-        GeosPoint point(coordinate.x, coordinate.y);
 
-        if (((GeosMultiLine)*m_pMultiLine).Distance(point) <= 
+        if (distance(coordinate) <= 
             (m_pMultiLine->line_width/2))
         {
             return DSL_AREA_POINT_LOCATION_ON_LINE;
@@ -516,9 +633,7 @@ namespace DSL
     
     bool OdeMultiLineArea::IsPointOnLine(const dsl_coordinate& coordinate)
     {
-        GeosPoint point(coordinate.x, coordinate.y);
-        
-        return (((GeosMultiLine)*m_pMultiLine).Distance(point) <= 
+        return (distance(coordinate) <= 
             (m_pMultiLine->line_width/2));
     }
     
@@ -527,28 +642,31 @@ namespace DSL
     {
         // Do not log function entry
         
-        // covert the trace vector to line-parameters for testing
-        dsl_multi_line_params lineParms = {coordinates, 
-            numCoordinates};
-
         direction = DSL_AREA_CROSS_DIRECTION_NONE;
+
+        if (m_pNativeMultiLine)
+        {
+            if (!m_pNativeMultiLine->Intersects(coordinates, numCoordinates))
+            { 
+                return false;
+            }
+        }
+        else
+        {
+            // covert the trace vector to line-parameters and create a Geos 
+            // object to check for cross with this Area's geometry.
+            dsl_multi_line_params lineParms = {coordinates, numCoordinates};
+            GeosMultiLine multiLine(lineParms);
         
-        // create a Geos object from the line-parameters to check 
-        // for cross with this Area's line.
-        GeosMultiLine multiLine(lineParms);
-        
-        if (!multiLine.Crosses(*m_pMultiLine))
-        { 
-            return false;
+            if (!m_pGeosMultiLine->Intersects(multiLine))
+            { 
+                return false;
+            }
         }
         
         // use the Area's line width and trace-endpoint to determine if the cross
         // is sufficient to report, i.e. the line width is used as hysteresis.
-        GeosPoint endPoint(
-            coordinates[numCoordinates-1].x, 
-            coordinates[numCoordinates-1].y);
-        
-        bool crossed(((GeosMultiLine)*m_pMultiLine).Distance(endPoint) > 
+        bool crossed(distance(coordinates[numCoordinates-1]) > 
             (m_pMultiLine->line_width/2));
             
         if (crossed)
@@ -30,6 +30,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslDisplayTypes.h"
 #include "DslGeosTypes.h"
+#include "DslNativeGeometry.h"
 #include "DslOdeTrackedObject.h"
 
 namespace DSL
@@ -82,11 +83,11 @@ namespace DSL
         /**
          * @brief Adds metadata for the RGBA rectangle to pDisplayMeta to overlay 
          * the Area for show
-         * @param[in] displayMetaData vector of pointers to allocated Display Meta 
-         * structures to add the Area's underliying Display Type to.
+         * @param[in] displayMetaData Display Meta allocator for the frame to add
+         * the Area's underliying Display Type to.
          * @param[in] pFrameMeta the Frame metadata for the current Frame
          */
-        void AddMeta(std::vector<NvDsDisplayMeta*>& displayMetaData,  
+        void AddMeta(DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -132,6 +133,24 @@ namespace DSL
         virtual bool DoesTraceCrossLine(dsl_coordinate* coordinates, uint numCoordinates,
             uint& direction) = 0;
         
+        /**
+         * @brief Incrementally checks if a tracked object's trace crosses the 
+         * Area's line(s), by testing only the trace's newest segment against 
+         * the Area's cached line segments. The location of the start of the
+         * trace and whether any segment has intersected are kept in crossState.
+         * @param[in] start start coordinate of the newest trace segment.
+         * @param[in] end end coordinate of the newest trace segment.
+         * @param[in,out] crossState cross state for the trace. If the side is
+         * not yet known, it is set to the location of the start coordinate.
+         * @param[out] direction one of the DSL_AREA_CROSS_DIRECTION_* constants 
+         * defining the direction of the cross, including DSL_AREA_CROSS_DIRECTION_NONE.
+         * @return true if the trace has fully crossed the Area's line(s) 
+         * including line-width, false otherwise.
+         */
+        bool DoesSegmentCrossLine(const dsl_coordinate& start, 
+            const dsl_coordinate& end, TrackedObjectCrossState& crossState, 
+            uint& direction);
+        
         /**
          * @brief Gets the bbox test-point for the defined for this area
          * @return one of the DSL_BBOX_POINT_* constants defining the test point.
@@ -148,6 +167,41 @@ namespace DSL
          */
         void getCoordinate(const NvOSD_RectParams& bbox, 
             dsl_coordinate& coordinate);
+            
+        /**
+         * @brief Adds a line segment to the Area's cached line segments. 
+         * Called by the derived class ctors.
+         * @param[in] start start coordinate of the line segment.
+         * @param[in] end end coordinate of the line segment.
+         */
+        void addLineSegment(const dsl_coordinate& start, 
+            const dsl_coordinate& end);
+        
+        /**
+         * @brief Tests if a line segment intersects - including touches - any
+         * of the Area's cached line segments.
+         * @param[in] start start coordinate of the segment to test.
+         * @param[in] end end coordinate of the segment to test.
+         * @return true if the segments intersect, false otherwise.
+         */
+        bool doesSegmentIntersectLine(const dsl_coordinate& start, 
+            const dsl_coordinate& end);
+            
+        /**
+         * @struct LineSegment
+         * @brief a single line segment of the Area's Display Type.
+         */
+        struct LineSegment
+        {
+            dsl_coordinate start;
+            dsl_coordinate end;
+        };
+        
+        /**
+         * @brief line segments of the Area's Display Type - including the 
+         * closing segment for a Polygon - cached for incremental cross tests.
+         */
+        std::vector<LineSegment> m_lineSegments;
     
         /**
          * @brief Display type used to define the Area's location, dimensions, and color
@@ -171,6 +225,12 @@ namespace DSL
          * once-per-frame-per-source
          */
         std::map<uint, uint64_t> m_frameNumPerSource;
+        
+        /**
+         * @brief Mutex to guard m_frameNumPerSource from concurrent access by 
+         * Triggers (sharing this Area) processing different sources in parallel.
+         */
+        GMutex m_frameNumMutex;
 
     };
     
@@ -244,6 +304,33 @@ namespace DSL
          */
         DSL_RGBA_POLYGON_PTR m_pPolygon;
         
+    private:
+    
+        /**
+         * @brief Returns the distance from a point to the Polygon's border
+         * using the Native or GEOS geometry.
+         */
+        uint distance(const dsl_coordinate& coordinate);
+        
+        /**
+         * @brief Returns true if the Polygon contains a point using the 
+         * Native or GEOS geometry.
+         */
+        bool contains(const dsl_coordinate& coordinate);
+        
+        /**
+         * @brief Native Geometry for the Area's Polygon, built once on Area 
+         * creation if the Polygon is supported, NULL otherwise. 
+         */
+        std::unique_ptr<NativeGeometry> m_pNativePolygon;
+        
+        /**
+         * @brief GEOS Prepared Geometry for the Area's Polygon, built once
+         * on Area creation if the Polygon is not supported natively, 
+         * NULL otherwise.
+         */
+        std::unique_ptr<GeosPreparedGeometry> m_pGeosPolygon;
+        
     };
 
 
@@ -360,6 +447,12 @@ namespace DSL
          */
         DSL_RGBA_LINE_PTR m_pLine;
 
+        /**
+         * @brief Native Geometry for the Area's Line, built once on Area 
+         * creation.
+         */
+        NativeGeometry m_nativeLine;
+
         /**
          * @brief one of DSL_BBOX_EDGE values defining which edge
          * of the bounding box to test for lines crossing
@@ -443,6 +536,27 @@ namespace DSL
          * of the bounding box to test for lines crossing
          */
         uint m_bboxTestEdge;
+
+    private:
+    
+        /**
+         * @brief Returns the distance from a point to the Multi-Line using 
+         * the Native or GEOS geometry.
+         */
+        uint distance(const dsl_coordinate& coordinate);
+        
+        /**
+         * @brief Native Geometry for the Area's Multi-Line, built once on Area 
+         * creation if the Multi-Line is supported, NULL otherwise.
+         */
+        std::unique_ptr<NativeGeometry> m_pNativeMultiLine;
+
+        /**
+         * @brief GEOS Prepared Geometry for the Area's Multi-Line, built once
+         * on Area creation if the Multi-Line is not supported natively,
+         * NULL otherwise.
+         */
+        std::unique_ptr<GeosPreparedGeometry> m_pGeosMultiLine;
     };
 }
 
@@ -147,6 +147,27 @@ namespace DSL
         };
         
     protected:
+    
+        /**
+         * @brief Gets the time of a frame in milliseconds, from the stream's 
+         * timestamps if available, or the monotonic clock otherwise.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @return frame time in units of milliseconds.
+         */
+        static double getStreamTimeMs(NvDsFrameMeta* pFrameMeta)
+        {
+            // Don't log function entry/exit
+            
+            if (GST_CLOCK_TIME_IS_VALID(pFrameMeta->buf_pts))
+            {
+                return (double)pFrameMeta->buf_pts / GST_MSECOND;
+            }
+            if (pFrameMeta->ntp_timestamp)
+            {
+                return (double)pFrameMeta->ntp_timestamp / GST_MSECOND;
+            }
+            return (double)g_get_monotonic_time() / 1000;
+        };
 
         /**
          * @brief Mutex to ensure mutual exlusion for propery get/sets
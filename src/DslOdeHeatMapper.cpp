@@ -26,6 +26,12 @@ THE SOFTWARE.
 
 #define DATE_BUFF_LENGTH 40
 
+// Number of half-lives after which exponentially scaled counts are rebased.
+#define DSL_HEAT_MAP_MAX_HALF_LIVES 64
+
+// Number of times per decay period that all cell colors are re-quantized.
+#define DSL_HEAT_MAP_REQUANTIZE_PER_PERIOD 10
+
 namespace DSL
 {
     OdeHeatMapper::OdeHeatMapper(const char* name, uint cols, uint rows,
@@ -33,12 +39,10 @@ namespace DSL
         : OdeBase(name)
         , m_cols(cols)
         , m_rows(rows)
-        , m_gridRectWidth(0)
-        , m_gridRectHeight(0)
         , m_bboxTestPoint(bboxTestPoint)
         , m_pColorPalette(pColorPalette)
-        , m_heatMap(rows, std::vector<uint64_t> (cols, 0))
-        , m_mostOccurrences(0)
+        , m_decayMode(DSL_HEAT_MAP_DECAY_MODE_NONE)
+        , m_decayPeriod(0)
         , m_legendEnabled(false)
         , m_legendLocation(0)
         , m_legendLeft(0)
@@ -49,6 +53,8 @@ namespace DSL
         LOG_FUNC();
         
         m_outBuffer = std::unique_ptr<uint64_t[]>(new uint64_t[cols*rows]);
+        
+        updatePaletteColors();
     }
 
     OdeHeatMapper::~OdeHeatMapper()
@@ -70,6 +76,8 @@ namespace DSL
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
             m_pColorPalette = pColorPalette;
+            
+            updatePaletteColors();
         }
         // need to recalculated legend settings.
         return SetLegendSettings(m_legendEnabled, m_legendLocation,
@@ -96,6 +104,8 @@ namespace DSL
         // disable untill all params are checked.
         m_legendEnabled = false;
         
+        invalidateDisplay();
+        
         // If client is disabling - done
         if (!enabled)
         {
@@ -140,17 +150,49 @@ namespace DSL
         return true;
     }            
 
-    void OdeHeatMapper::HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
-        NvDsObjectMeta* pObjectMeta)
+    void OdeHeatMapper::GetDecaySettings(uint* mode, uint* period)
     {
+        LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *mode = m_decayMode;
+        *period = m_decayPeriod;
+    }
 
-        // one-time initialization of the grid rectangle dimensions
-        if (!m_gridRectWidth)
+    bool OdeHeatMapper::SetDecaySettings(uint mode, uint period)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (mode > DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW)
         {
-            m_gridRectWidth = pFrameMeta->source_frame_width/m_cols;
-            m_gridRectHeight = pFrameMeta->source_frame_height/m_rows;
+            LOG_ERROR("Invalid decay mode = " << mode 
+                << " for Heat-Mapper '" << GetName() << "'");
+            return false;
         }
+        if (mode != DSL_HEAT_MAP_DECAY_MODE_NONE and !period)
+        {
+            LOG_ERROR("Decay period must be greater than 0 for Heat-Mapper '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_decayMode = mode;
+        m_decayPeriod = period;
+        
+        // Existing metrics were accumulated under the previous settings.
+        m_sourceHeatMaps.clear();
+        
+        return true;
+    }
+
+    void OdeHeatMapper::HandleOccurrence(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        SourceHeatMap& heatMap = getSourceHeatMap(pFrameMeta);
+        
+        double timeMs = getFrameTimeMs(heatMap, pFrameMeta);
         
         // get the x,y map coordinates based on the bbox and test-point.
         dsl_coordinate mapCoordinate;
@@ -158,89 +200,81 @@ namespace DSL
 
         // determine the column and row that maps to the x, y coordinates
         // coordinates are 1-based, so subtract 1 pixel to keep within map.
-        uint colPosition((mapCoordinate.x-1)/m_gridRectWidth);
-        uint rowPosition((mapCoordinate.y-1)/m_gridRectHeight);
+        uint colPosition(std::min((std::max(mapCoordinate.x, 1U)-1) /
+            heatMap.gridRectWidth, m_cols-1));
+        uint rowPosition(std::min((std::max(mapCoordinate.y, 1U)-1) /
+            heatMap.gridRectHeight, m_rows-1));
+        uint index(rowPosition*m_cols + colPosition);
 
-        // increment the running count of occurrences at this poisition
-        m_heatMap[rowPosition][colPosition] += 1;
+        if (m_decayMode == DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL)
+        {
+            // Rather than decaying every cell on every frame, new occurrences
+            // are scaled up relative to the reference time. All cells decay 
+            // at the same rate so the scaled most-occurrences remains valid.
+            double halfLives((timeMs - heatMap.referenceTimeMs) / m_decayPeriod);
+            
+            // Rebase the scaled units before they can grow too large.
+            if (halfLives > DSL_HEAT_MAP_MAX_HALF_LIVES)
+            {
+                double scale(std::exp2(-halfLives));
+                for (auto& cell: heatMap.cells)
+                {
+                    cell *= scale;
+                }
+                heatMap.mostOccurrences *= scale;
+                heatMap.referenceTimeMs = timeMs;
+                halfLives = 0;
+            }
+            heatMap.cells[index] += std::exp2(halfLives);
+        }
+        else if (m_decayMode == DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW)
+        {
+            advanceWindow(heatMap, timeMs);
+            rollCell(heatMap, index);
+            heatMap.cells[index] += 1;
+        }
+        else
+        {
+            // increment the running count of occurrences at this poisition
+            heatMap.cells[index] += 1;
+        }
+        
+        // the cell's color is re-quantized on next display
+        heatMap.dirtyCells.push_back(index);
         
         // if the new total for this position is now the greatest  
-        if (m_heatMap[rowPosition][colPosition] > m_mostOccurrences)
+        double value(getCellValue(heatMap, index, timeMs));
+        if (value > heatMap.mostOccurrences)
         {
-            m_mostOccurrences = m_heatMap[rowPosition][colPosition];
+            heatMap.mostOccurrences = value;
         }
     }
   
-    void OdeHeatMapper::AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData)
+    void OdeHeatMapper::AddDisplayMeta(DisplayMetaData& displayMetaData,
+        NvDsFrameMeta* pFrameMeta)
     {
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
+        SourceHeatMap& heatMap = getSourceHeatMap(pFrameMeta);
+        
+        double timeMs = getFrameTimeMs(heatMap, pFrameMeta);
+        
+        if (m_decayMode == DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW)
+        {
+            advanceWindow(heatMap, timeMs);
+        }
+        updateCellRects(heatMap, timeMs);
+        
         // Add legend first, just in case we run out of display-meta
         if (m_legendEnabled)
         {
-            // If the legend is added to a vertical axis
-            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
-                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+            if (heatMap.legendRects.empty())
             {
-                for (uint j=0; j < m_pColorPalette->GetSize(); j++)
-                {
-                    m_pColorPalette->SetIndex(j);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth + j*m_gridRectWidth*m_legendWidth, 
-                        m_legendTop*m_gridRectHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
-            }
-            // Else the legend is added to a horizontal axis
-            else
-            {
-                for (uint i=0; i < m_pColorPalette->GetSize(); i++)
-                {
-                    m_pColorPalette->SetIndex(i);
-
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW("", 
-                        m_legendLeft*m_gridRectWidth, 
-                        m_legendTop*m_gridRectHeight + i*m_gridRectHeight*m_legendHeight, 
-                        m_gridRectWidth*m_legendWidth, 
-                        m_gridRectHeight*m_legendHeight, 
-                        false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
-            }    
-        }
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
-        {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
-            {
-                // if we have at least one occurrence at the current iteration
-                if (m_heatMap[i][j])
-                {
-                    // Callculate the index into the color palette of size 10 as 
-                    // a ratio of occurrences for the current position vs. the 
-                    // position with the most occurrences. 
-                    
-                    // multiply the occurrence for the current position by 10 and 
-                    // divide by the most occurrences rouded up or down.
-                    m_pColorPalette->SetIndex(
-                        std::round((double)m_heatMap[i][j]*(m_pColorPalette->GetSize()-1) / 
-                            (double)(m_mostOccurrences)));
-                    
-                    DSL_RGBA_RECTANGLE_PTR pRectangle = DSL_RGBA_RECTANGLE_NEW(
-                        "", j*m_gridRectWidth, i*m_gridRectHeight, m_gridRectWidth, 
-                        m_gridRectHeight, false, m_pColorPalette, true, m_pColorPalette);
-                        
-                    pRectangle->AddMeta(displayMetaData, NULL);
-                }
+                updateLegendRects(heatMap);
             }
+            addRects(heatMap.legendRects, displayMetaData);
         }
+        addRects(heatMap.cellRects, displayMetaData);
     }
 
     void OdeHeatMapper::ClearMetrics()
@@ -248,17 +282,7 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        // Iterate through all rows
-        for (uint i=0; i < m_rows; i++)
-        {
-            // and for each row, iterate through all columns.
-            for (uint j=0; j < m_cols; j++)
-            {
-                // clear data by resetting to 0
-                m_heatMap[i][j] = 0;
-            }
-        }
-        m_mostOccurrences = 0;
+        m_sourceHeatMaps.clear();
     }
 
     void OdeHeatMapper::GetMetrics(const uint64_t** buffer, uint* size)
@@ -266,13 +290,24 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        int i=0;
-        for (auto const& ivec: m_heatMap)
+        fillOutBuffer();
+        
+        *buffer = m_outBuffer.get();
+        *size = m_cols * m_rows;
+    }
+
+    void OdeHeatMapper::GetSourceMetrics(uint sourceId, 
+        const uint64_t** buffer, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        std::fill(m_outBuffer.get(), m_outBuffer.get() + m_cols*m_rows, 0);
+        
+        auto ipos = m_sourceHeatMaps.find(sourceId);
+        if (ipos != m_sourceHeatMaps.end())
         {
-            for (auto const& jvec: ivec)
-            {
-                m_outBuffer[i++] = jvec;
-            }
+            addToOutBuffer(ipos->second);
         }
         *buffer = m_outBuffer.get();
         *size = m_cols * m_rows;
@@ -283,16 +318,19 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = fillOutBuffer();
+        
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
         
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << m_outBuffer[i*m_cols + j];
             }
             std::cout << ss.str();
             std::cout << std::endl;
@@ -304,16 +342,19 @@ namespace DSL
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = fillOutBuffer();
+        
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
 
-        for (auto const& ivec: m_heatMap)
+        for (uint i=0; i < m_rows; i++)
         {
             std::stringstream ss;
-            for (auto const& jvec: ivec)
+            for (uint j=0; j < m_cols; j++)
             {
-                ss << std::setw(charwidth) << std::setfill(' ') << jvec;
+                ss << std::setw(charwidth) << std::setfill(' ') 
+                    << m_outBuffer[i*m_cols + j];
             }
             LOG_INFO(ss.str());
         }
@@ -344,8 +385,10 @@ namespace DSL
             return false;
         }
 
-        uint charwidth = (m_mostOccurrences)
-            ? floor(log10(m_mostOccurrences)) + 2
+        uint64_t mostOccurrences = fillOutBuffer();
+        
+        uint charwidth = (mostOccurrences)
+            ? floor(log10(mostOccurrences)) + 2
             : 2;
     
         if ( format == DSL_EVENT_FILE_FORMAT_TEXT)
@@ -363,22 +406,23 @@ namespace DSL
             ostream << " File opened: " << dateTimeStr.c_str() << "\n";
             ostream << "-------------------------------------------------------------------" << "\n";
             
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << std::setw(charwidth) << std::setfill(' ') << jvec;
+                    ostream << std::setw(charwidth) << std::setfill(' ') 
+                        << m_outBuffer[i*m_cols + j];
                 }
                 ostream << std::endl;
             }
         }
         else
         {
-            for (auto const& ivec: m_heatMap)
+            for (uint i=0; i < m_rows; i++)
             {
-                for (auto const& jvec: ivec)
+                for (uint j=0; j < m_cols; j++)
                 {
-                    ostream << jvec << ",";
+                    ostream << m_outBuffer[i*m_cols + j] << ",";
                 }
                 ostream << std::endl;
             }
@@ -388,6 +432,376 @@ namespace DSL
         return true;
     }
 
+    OdeHeatMapper::SourceHeatMap& OdeHeatMapper::getSourceHeatMap(
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        
+        auto ipos = m_sourceHeatMaps.find(pFrameMeta->source_id);
+        if (ipos != m_sourceHeatMaps.end())
+        {
+            return ipos->second;
+        }
+        
+        // one-time initialization of the grid rectangle dimensions for 
+        // this source. 
+        SourceHeatMap& heatMap = m_sourceHeatMaps.emplace(pFrameMeta->source_id,
+            SourceHeatMap(m_rows, m_cols, 
+                std::max(pFrameMeta->source_frame_width/m_cols, 1U),
+                std::max(pFrameMeta->source_frame_height/m_rows, 1U))).first->second;
+                
+        if (m_decayMode == DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW)
+        {
+            heatMap.previousCells.assign(m_rows*m_cols, 0);
+            heatMap.cellEpochs.assign(m_rows*m_cols, 0);
+        }
+        return heatMap;
+    }
+    
+    double OdeHeatMapper::getFrameTimeMs(SourceHeatMap& heatMap, 
+        NvDsFrameMeta* pFrameMeta)
+    {
+        // Don't log function entry/exit
+        
+        double timeMs(getStreamTimeMs(pFrameMeta) + heatMap.timeOffsetMs);
+        
+        // If the stream's timestamps have been reset, offset all subsequent
+        // times so that decay continues from where it left off.
+        if (timeMs < heatMap.lastTimeMs)
+        {
+            heatMap.timeOffsetMs += heatMap.lastTimeMs - timeMs;
+            timeMs = heatMap.lastTimeMs;
+        }
+        heatMap.lastTimeMs = timeMs;
+        
+        return timeMs;
+    }
+    
+    void OdeHeatMapper::advanceWindow(SourceHeatMap& heatMap, double timeMs)
+    {
+        // Don't log function entry/exit
+        
+        uint64_t epoch(timeMs / m_decayPeriod);
+        
+        if (epoch == heatMap.epoch)
+        {
+            return;
+        }
+        heatMap.epoch = epoch;
+        
+        // Occurrences only ever expire at window boundaries, so the most
+        // occurrences is recalculated once per window, and then updated
+        // incrementally until the next.
+        heatMap.mostOccurrences = 0;
+        for (uint i=0; i < heatMap.cells.size(); i++)
+        {
+            double value(getCellValue(heatMap, i, timeMs));
+            if (value > heatMap.mostOccurrences)
+            {
+                heatMap.mostOccurrences = value;
+            }
+        }
+    }
+    
+    void OdeHeatMapper::rollCell(SourceHeatMap& heatMap, uint index)
+    {
+        // Don't log function entry/exit
+        
+        if (heatMap.cellEpochs[index] == heatMap.epoch)
+        {
+            return;
+        }
+        heatMap.previousCells[index] = 
+            (heatMap.cellEpochs[index] + 1 == heatMap.epoch)
+            ? heatMap.cells[index]
+            : 0;
+        heatMap.cells[index] = 0;
+        heatMap.cellEpochs[index] = heatMap.epoch;
+    }
+    
+    double OdeHeatMapper::getCellValue(SourceHeatMap& heatMap, 
+        uint index, double timeMs)
+    {
+        // Don't log function entry/exit
+        
+        if (m_decayMode != DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW)
+        {
+            return heatMap.cells[index];
+        }
+        rollCell(heatMap, index);
+        
+        // Approximate the sliding window by weighting the previous window's
+        // count by the portion of it still within the sliding window.
+        double elapsed((timeMs - (double)heatMap.epoch*m_decayPeriod) / 
+            m_decayPeriod);
+        
+        return heatMap.cells[index] + 
+            heatMap.previousCells[index]*(1.0 - std::min(std::max(elapsed, 0.0), 1.0));
+    }
+    
+    double OdeHeatMapper::getScale(const SourceHeatMap& heatMap, double timeMs)
+    {
+        // Don't log function entry/exit
+        
+        if (m_decayMode != DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL)
+        {
+            return 1.0;
+        }
+        return std::exp2(-(timeMs - heatMap.referenceTimeMs) / m_decayPeriod);
+    }
+    
+    void OdeHeatMapper::addToOutBuffer(SourceHeatMap& heatMap)
+    {
+        // Don't log function entry/exit
+        
+        // Metrics are decayed to the time of the last frame for the source.
+        double timeMs(heatMap.lastTimeMs);
+        
+        if (m_decayMode == DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW)
+        {
+            advanceWindow(heatMap, timeMs);
+        }
+        double scale(getScale(heatMap, timeMs));
+        
+        for (uint i=0; i < m_cols*m_rows; i++)
+        {
+            m_outBuffer[i] += std::llround(getCellValue(heatMap, i, timeMs)*scale);
+        }
+    }
+    
+    uint64_t OdeHeatMapper::fillOutBuffer()
+    {
+        // Don't log function entry/exit
+        
+        std::fill(m_outBuffer.get(), m_outBuffer.get() + m_cols*m_rows, 0);
+        
+        for (auto& imap: m_sourceHeatMaps)
+        {
+            addToOutBuffer(imap.second);
+        }
+        return *std::max_element(m_outBuffer.get(), 
+            m_outBuffer.get() + m_cols*m_rows);
+    }
+
+    void OdeHeatMapper::updatePaletteColors()
+    {
+        // Don't log function entry/exit
+        
+        m_paletteColors.clear();
+        for (uint i=0; i < m_pColorPalette->GetSize(); i++)
+        {
+            m_pColorPalette->SetIndex(i);
+            
+            m_pColorPalette->Lock();
+            m_paletteColors.push_back(*m_pColorPalette);
+            m_pColorPalette->Unlock();
+        }
+        invalidateDisplay();
+    }
+    
+    void OdeHeatMapper::invalidateDisplay()
+    {
+        // Don't log function entry/exit
+        
+        for (auto& imap: m_sourceHeatMaps)
+        {
+            imap.second.legendRects.clear();
+            imap.second.displayValid = false;
+        }
+    }
+    
+    void OdeHeatMapper::updateCellRects(SourceHeatMap& heatMap, double timeMs)
+    {
+        // Don't log function entry/exit
+        
+        // All color indices are ratios of the most occurrences, so all must 
+        // be re-quantized when it changes. With decay, cells also fade below
+        // one occurrence over time, so all are re-quantized periodically.
+        bool quantizeAll = (!heatMap.displayValid or 
+            heatMap.displayMostOccurrences != heatMap.mostOccurrences or
+            (m_decayMode != DSL_HEAT_MAP_DECAY_MODE_NONE and 
+                (timeMs - heatMap.displayTimeMs)*DSL_HEAT_MAP_REQUANTIZE_PER_PERIOD 
+                    >= m_decayPeriod));
+                
+        if (!quantizeAll and heatMap.dirtyCells.empty())
+        {
+            return;
+        }
+        
+        double scale(getScale(heatMap, timeMs));
+        bool changed(false);
+        
+        if (quantizeAll)
+        {
+            for (uint i=0; i < heatMap.colorIndices.size(); i++)
+            {
+                changed |= quantizeCell(heatMap, i, timeMs, scale);
+            }
+            changed |= !heatMap.displayValid;
+            
+            heatMap.displayMostOccurrences = heatMap.mostOccurrences;
+            heatMap.displayTimeMs = timeMs;
+            heatMap.displayValid = true;
+        }
+        else
+        {
+            for (auto const& index: heatMap.dirtyCells)
+            {
+                changed |= quantizeCell(heatMap, index, timeMs, scale);
+            }
+        }
+        heatMap.dirtyCells.clear();
+        
+        if (changed)
+        {
+            mergeCellRects(heatMap);
+        }
+    }
+    
+    bool OdeHeatMapper::quantizeCell(SourceHeatMap& heatMap, uint index, 
+        double timeMs, double scale)
+    {
+        // Don't log function entry/exit
+        
+        uint16_t colorIndex(DSL_HEAT_MAP_NO_COLOR_INDEX);
+        double value(getCellValue(heatMap, index, timeMs));
+        
+        // if we have at least one occurrence for the cell
+        if (heatMap.mostOccurrences > 0 and std::llround(value*scale))
+        {
+            // Callculate the index into the color palette as a ratio of 
+            // occurrences for the cell vs. the cell with the most occurrences. 
+            // Both are in the same scaled units so no need to convert.
+            colorIndex = std::min<uint>(
+                std::round(value*(m_paletteColors.size()-1) / 
+                    heatMap.mostOccurrences), 
+                m_paletteColors.size()-1);
+        }
+        if (colorIndex == heatMap.colorIndices[index])
+        {
+            return false;
+        }
+        heatMap.colorIndices[index] = colorIndex;
+        return true;
+    }
+    
+    void OdeHeatMapper::mergeCellRects(SourceHeatMap& heatMap)
+    {
+        // Don't log function entry/exit
+        
+        heatMap.cellRects.clear();
+        
+        // For each column, the rectangle - if any - that started with a run
+        // at that column in the previous row, and the last column of that run.
+        std::vector<int> openRects(m_cols, -1);
+        std::vector<uint> openRectEnds(m_cols, 0);
+        
+        for (uint i=0; i < m_rows; i++)
+        {
+            uint j(0);
+            while (j < m_cols)
+            {
+                uint16_t colorIndex(heatMap.colorIndices[i*m_cols + j]);
+                
+                // find the end of the horizontal run of the same color.
+                uint start(j);
+                while (j < m_cols and 
+                    heatMap.colorIndices[i*m_cols + j] == colorIndex)
+                {
+                    j++;
+                }
+                if (colorIndex == DSL_HEAT_MAP_NO_COLOR_INDEX)
+                {
+                    openRects[start] = -1;
+                    continue;
+                }
+                
+                // If the identical run was in the previous row, extend it down.
+                int openRect(openRects[start]);
+                if (openRect >= 0 and openRectEnds[start] == j and
+                    heatMap.colorIndices[(i-1)*m_cols + start] == colorIndex and
+                    heatMap.cellRects[openRect].top + 
+                        heatMap.cellRects[openRect].height == 
+                            i*heatMap.gridRectHeight)
+                {
+                    heatMap.cellRects[openRect].height += heatMap.gridRectHeight;
+                    continue;
+                }
+                
+                NvOSD_RectParams rect = {0};
+                rect.left = start*heatMap.gridRectWidth;
+                rect.top = i*heatMap.gridRectHeight;
+                rect.width = (j-start)*heatMap.gridRectWidth;
+                rect.height = heatMap.gridRectHeight;
+                rect.border_color = m_paletteColors[colorIndex];
+                rect.has_bg_color = true;
+                rect.bg_color = m_paletteColors[colorIndex];
+                
+                openRects[start] = heatMap.cellRects.size();
+                openRectEnds[start] = j;
+                heatMap.cellRects.push_back(rect);
+            }
+        }
+    }
+    
+    void OdeHeatMapper::updateLegendRects(SourceHeatMap& heatMap)
+    {
+        // Don't log function entry/exit
+        
+        heatMap.legendRects.clear();
+        
+        for (uint i=0; i < m_paletteColors.size(); i++)
+        {
+            NvOSD_RectParams rect = {0};
+            
+            // If the legend is added to a vertical axis
+            if (m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_TOP or
+                m_legendLocation == DSL_HEAT_MAP_LEGEND_LOCATION_BOTTOM)
+            {
+                rect.left = m_legendLeft*heatMap.gridRectWidth + 
+                    i*heatMap.gridRectWidth*m_legendWidth;
+                rect.top = m_legendTop*heatMap.gridRectHeight;
+            }
+            // Else the legend is added to a horizontal axis
+            else
+            {
+                rect.left = m_legendLeft*heatMap.gridRectWidth;
+                rect.top = m_legendTop*heatMap.gridRectHeight + 
+                    i*heatMap.gridRectHeight*m_legendHeight;
+            }
+            rect.width = heatMap.gridRectWidth*m_legendWidth;
+            rect.height = heatMap.gridRectHeight*m_legendHeight;
+            rect.border_color = m_paletteColors[i];
+            rect.has_bg_color = true;
+            rect.bg_color = m_paletteColors[i];
+            
+            heatMap.legendRects.push_back(rect);
+        }
+    }
+    
+    void OdeHeatMapper::addRects(const std::vector<NvOSD_RectParams>& rects,
+        DisplayMetaData& displayMetaData)
+    {
+        // Don't log function entry/exit
+        
+        uint i(0);
+        while (i < rects.size())
+        {
+            NvDsDisplayMeta* pDisplayMeta = 
+                displayMetaData.Acquire(&NvDsDisplayMeta::num_rects);
+            if (!pDisplayMeta)
+            {
+                return;
+            }
+            // fill the display meta before acquiring the next
+            while (i < rects.size() and 
+                pDisplayMeta->num_rects < MAX_ELEMENTS_IN_DISPLAY_META)
+            {
+                pDisplayMeta->rect_params[pDisplayMeta->num_rects++] = rects[i++];
+            }
+        }
+    }
+
     void OdeHeatMapper::getCoordinate(NvDsObjectMeta* pObjectMeta, 
         dsl_coordinate& mapCoordinate)
     {
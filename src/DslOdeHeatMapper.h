@@ -40,6 +40,11 @@ namespace DSL
         std::shared_ptr<OdeHeatMapper>(new OdeHeatMapper(name, \
             rows, cols, bboxTestPoint, pColorPalette))
     
+    /**
+     * @brief color index for a heat-map cell that is not displayed.
+     */
+    #define DSL_HEAT_MAP_NO_COLOR_INDEX                         UINT16_MAX
+    
     // ********************************************************************
 
     class OdeHeatMapper : public OdeBase
@@ -96,6 +101,24 @@ namespace DSL
         bool SetLegendSettings(bool enabled, uint location, 
             uint width, uint height);
         
+        /**
+         * @brief Gets the current Decay Settings for the OdeHeatMapper.
+         * @param[out] mode one of the DSL_HEAT_MAP_DECAY_MODE_* constants.
+         * @param[out] period half-life (exponential) or window length (sliding
+         * window) in units of milliseconds.
+         */
+        void GetDecaySettings(uint* mode, uint* period);
+
+        /**
+         * @brief Sets the Decay Settings for the OdeHeatMapper. All current
+         * metrics are cleared on successful update.
+         * @param[in] mode one of the DSL_HEAT_MAP_DECAY_MODE_* constants.
+         * @param[in] period half-life (exponential) or window length (sliding
+         * window) in units of milliseconds. Ignored for DSL_HEAT_MAP_DECAY_MODE_NONE.
+         * @return true on successful update, false otherwise
+         */
+        bool SetDecaySettings(uint mode, uint period);
+        
         /**
          * @brief Handles the ODE occurrence by updating the heat-map with new 
          * the bounding box center point provided by pObjectMeta,  
@@ -106,36 +129,49 @@ namespace DSL
 
         /**
          * @brief and adds the heat-map's display-metadata to displayMetaData for
-         * downstream display.
-         * @param[in] displayMetaData Vector of metadata structures to add the 
-         * heat-map's display-metadata to.
+         * downstream display. Only the heat-map for the frame's source is added.
+         * @param[in] displayMetaData Display Meta allocator for the frame to add
+         * the heat-map's display-metadata to.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the current frame
          */
-        void AddDisplayMeta(std::vector<NvDsDisplayMeta*>& displayMetaData);
+        void AddDisplayMeta(DisplayMetaData& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
         
         /**
-         * @brief Resets the OdeHeatMapper which clears the 2D m_heatMap vector.
+         * @brief Resets the OdeHeatMapper which clears the heat-maps for all sources.
          */
         void ClearMetrics();
         
         /**
-         * @brief Gets the 2D m_heatMap vector as a linear buffer.
+         * @brief Gets the heat-map metrics, summed over all sources, as a 
+         * linear row-major buffer.
          * @param[out] buffer pointer to the returned buffer
          * @param[out] size of the return buffer m_cols*m_rows
          */
         void GetMetrics(const uint64_t** buffer, uint* size); 
 
         /**
-         * @brief Prints the 2D m_heatMap vector to the console.
+         * @brief Gets the heat-map metrics for a single source as a linear
+         * row-major buffer. The buffer will be all zeros if no occurrences have 
+         * been handled for the source.
+         * @param[in] sourceId unique id of the source to query.
+         * @param[out] buffer pointer to the returned buffer
+         * @param[out] size of the return buffer m_cols*m_rows
+         */
+        void GetSourceMetrics(uint sourceId, const uint64_t** buffer, uint* size); 
+
+        /**
+         * @brief Prints the heat-map metrics, summed over all sources, to the console.
          */
         void PrintMetrics(); 
         
         /**
-         * @brief Logs the 2D m_heatMap vector at level = INFO.
+         * @brief Logs the heat-map metrics, summed over all sources, at level = INFO.
          */
         void LogMetrics(); 
         
         /**
-         * @brief Writes the 2D m_heatMap vector to a file.
+         * @brief Writes the heat-map metrics, summed over all sources, to a file.
          * @param[in] relative or absolute path to the file to write to.
          * @param[in] mode file open/write mode, one of DSL_EVENT_FILE_MODE_* options
          * @param[in] format one of the DSL_EVENT_FILE_FORMAT_* options
@@ -144,6 +180,240 @@ namespace DSL
         
     private:
     
+        /**
+         * @brief Heat-map for a single source. Cells are stored in one 
+         * contiguous row-major buffer of size rows*cols.
+         */
+        struct SourceHeatMap
+        {
+            SourceHeatMap(uint rows, uint cols, uint gridRectWidth, 
+                uint gridRectHeight)
+                : gridRectWidth(gridRectWidth)
+                , gridRectHeight(gridRectHeight)
+                , cells(rows*cols, 0)
+                , mostOccurrences(0)
+                , referenceTimeMs(0)
+                , lastTimeMs(0)
+                , timeOffsetMs(0)
+                , epoch(0)
+                , colorIndices(rows*cols, DSL_HEAT_MAP_NO_COLOR_INDEX)
+                , displayMostOccurrences(0)
+                , displayTimeMs(0)
+                , displayValid(false)
+            {};
+            
+            /**
+             * @brief width of the grid rectangles in pixels.
+             */
+            uint gridRectWidth;
+
+            /**
+             * @brief height of the grid rectangles in pixels.
+             */
+            uint gridRectHeight;
+            
+            /**
+             * @brief row-major occurrence counts. For exponential decay, the
+             * counts are scaled relative to referenceTimeMs. For sliding 
+             * window decay, the counts for the current window (epoch).
+             */
+            std::vector<double> cells;
+            
+            /**
+             * @brief row-major counts for the previous window - sliding 
+             * window decay only.
+             */
+            std::vector<double> previousCells;
+            
+            /**
+             * @brief row-major window (epoch) each cell was last updated in - 
+             * sliding window decay only.
+             */
+            std::vector<uint64_t> cellEpochs;
+            
+            /**
+             * @brief the most occurrences in any one map location, in the 
+             * same (scaled) units as cells.
+             */
+            double mostOccurrences;
+            
+            /**
+             * @brief frame time at which the exponential decay scale is 1.0.
+             */
+            double referenceTimeMs;
+            
+            /**
+             * @brief frame time of the most recent frame for this source.
+             */
+            double lastTimeMs;
+            
+            /**
+             * @brief offset added to the frame times to keep them monotonic
+             * if the stream's timestamps are reset.
+             */
+            double timeOffsetMs;
+            
+            /**
+             * @brief current window for sliding window decay.
+             */
+            uint64_t epoch;
+            
+            /**
+             * @brief row-major cached color-palette index for each cell,
+             * DSL_HEAT_MAP_NO_COLOR_INDEX if the cell is not displayed.
+             */
+            std::vector<uint16_t> colorIndices;
+            
+            /**
+             * @brief row-major indices of the cells updated since the 
+             * color indices were last quantized.
+             */
+            std::vector<uint> dirtyCells;
+            
+            /**
+             * @brief cached rectangles for the displayed cells, with adjacent
+             * cells of the same color merged into a single rectangle.
+             */
+            std::vector<NvOSD_RectParams> cellRects;
+            
+            /**
+             * @brief cached rectangles for the legend, empty if not built.
+             */
+            std::vector<NvOSD_RectParams> legendRects;
+            
+            /**
+             * @brief most occurrences the color indices were quantized with.
+             */
+            double displayMostOccurrences;
+            
+            /**
+             * @brief frame time all color indices were last quantized at.
+             */
+            double displayTimeMs;
+            
+            /**
+             * @brief true once all color indices have been quantized.
+             */
+            bool displayValid;
+        };
+    
+        /**
+         * @brief Gets the heat-map for the frame's source, creating it
+         * on first use.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the current frame
+         * @return reference to the source's heat-map.
+         */
+        SourceHeatMap& getSourceHeatMap(NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Gets the time of a frame in milliseconds, from the stream's 
+         * timestamps if available, or the monotonic clock otherwise. The time
+         * is kept monotonic per source across stream timestamp resets.
+         * @param[in] heatMap heat-map for the frame's source.
+         * @param[in] pFrameMeta pointer to the Frame Meta data for the frame.
+         * @return frame time in units of milliseconds.
+         */
+        double getFrameTimeMs(SourceHeatMap& heatMap, NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief Advances a sliding window heat-map to the window for timeMs, 
+         * recalculating the most occurrences once per window.
+         * @param[in] heatMap source heat-map to update.
+         * @param[in] timeMs current frame time in milliseconds.
+         */
+        void advanceWindow(SourceHeatMap& heatMap, double timeMs);
+
+        /**
+         * @brief Lazily rolls a single sliding window cell to the heat-map's
+         * current window.
+         * @param[in] heatMap source heat-map to update.
+         * @param[in] index row-major index of the cell to roll.
+         */
+        void rollCell(SourceHeatMap& heatMap, uint index);
+        
+        /**
+         * @brief Gets the decayed value of a single cell in the heat-map's 
+         * (scaled) units.
+         * @param[in] heatMap source heat-map to read.
+         * @param[in] index row-major index of the cell to read.
+         * @param[in] timeMs time in milliseconds to read the value at.
+         * @return decayed cell value.
+         */
+        double getCellValue(SourceHeatMap& heatMap, uint index, double timeMs);
+        
+        /**
+         * @brief Gets the factor to convert a heat-map's scaled units to 
+         * occurrences at a given time.
+         * @param[in] heatMap source heat-map to read.
+         * @param[in] timeMs time in milliseconds to get the scale for.
+         * @return 1.0 unless decay mode is exponential.
+         */
+        double getScale(const SourceHeatMap& heatMap, double timeMs);
+        
+        /**
+         * @brief Adds a source heat-map's decayed counts to m_outBuffer.
+         * @param[in] heatMap source heat-map to add.
+         */
+        void addToOutBuffer(SourceHeatMap& heatMap);
+        
+        /**
+         * @brief Fills m_outBuffer with the metrics summed over all sources.
+         * @return the most occurrences in any one location of m_outBuffer.
+         */
+        uint64_t fillOutBuffer();
+        
+        /**
+         * @brief Updates the cached color for each entry in the Color Palette.
+         */
+        void updatePaletteColors();
+        
+        /**
+         * @brief Invalidates the cached display rectangles for all sources.
+         */
+        void invalidateDisplay();
+        
+        /**
+         * @brief Re-quantizes the color indices for all dirty cells - or all 
+         * cells if the scale has changed - and rebuilds the cached cell 
+         * rectangles if any color index has changed.
+         * @param[in] heatMap source heat-map to update.
+         * @param[in] timeMs current frame time in milliseconds.
+         */
+        void updateCellRects(SourceHeatMap& heatMap, double timeMs);
+        
+        /**
+         * @brief Quantizes a single cell's value to a color-palette index.
+         * @param[in] heatMap source heat-map to update.
+         * @param[in] index row-major index of the cell to quantize.
+         * @param[in] timeMs current frame time in milliseconds.
+         * @param[in] scale factor to convert the cell value to occurrences.
+         * @return true if the cell's color index has changed.
+         */
+        bool quantizeCell(SourceHeatMap& heatMap, uint index, 
+            double timeMs, double scale);
+        
+        /**
+         * @brief Rebuilds the cached cell rectangles, merging each horizontal 
+         * run of same-colored cells, and then each run with the identical
+         * run in the row above.
+         * @param[in] heatMap source heat-map to update.
+         */
+        void mergeCellRects(SourceHeatMap& heatMap);
+        
+        /**
+         * @brief Builds the cached legend rectangles for a source heat-map.
+         * @param[in] heatMap source heat-map to update.
+         */
+        void updateLegendRects(SourceHeatMap& heatMap);
+        
+        /**
+         * @brief Adds a set of cached rectangles to the frame's display-metadata.
+         * @param[in] rects cached rectangles to add.
+         * @param[in] displayMetaData Display Meta allocator for the frame.
+         */
+        void addRects(const std::vector<NvOSD_RectParams>& rects,
+            DisplayMetaData& displayMetaData);
+        
         /**
          * @brief returs x,y coordinates from an Object's bbox coordinates
          * and size as determined by the bboxTextPoint
@@ -165,16 +435,6 @@ namespace DSL
          */
         uint m_rows;
         
-        /**
-         * @brief width of the grid rectangles in pixels.
-         */
-        uint m_gridRectWidth;
-
-        /**
-         * @brief height of the grid rectangles in pixels.
-         */
-        uint m_gridRectHeight;
-        
         /**
          * @brief one of DSL_BBOX_POINT values defining which point of a
          * object's bounding box to use as map coordinates.
@@ -188,20 +448,30 @@ namespace DSL
         DSL_RGBA_COLOR_PALETTE_PTR m_pColorPalette;
         
         /**
-         * @brief two dimensional vector sized cols x rows
+         * @brief cached color for each entry in the Color Palette.
          */
-        std::vector<std::vector<uint64_t>> m_heatMap;
+        std::vector<NvOSD_ColorParams> m_paletteColors;
         
         /**
-         * @brief a linear array of heat-map metrics updated on
-         * on call to get metrics and returned to the caller.
+         * @brief map of heat-maps, one per source, keyed by source id.
          */
-        std::unique_ptr<uint64_t[]> m_outBuffer;
+        std::map<uint, SourceHeatMap> m_sourceHeatMaps;
+        
+        /**
+         * @brief one of the DSL_HEAT_MAP_DECAY_MODE_* constants.
+         */
+        uint m_decayMode;
+        
+        /**
+         * @brief half-life or window length in milliseconds.
+         */
+        uint m_decayPeriod;
         
         /**
-         * @brief the most occurrences in any one map location..
+         * @brief a linear array of heat-map metrics updated on
+         * on call to get metrics and returned to the caller.
          */
-        uint64_t m_mostOccurrences;
+        std::unique_ptr<uint64_t[]> m_outBuffer;
         
         /**
          * @brief true if Legend display is enabled, false otherwise.
@@ -0,0 +1,88 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslOdeMetrics.h"
+
+namespace DSL
+{
+    thread_local bool OdeRuntimeMetrics::s_isActive(false);
+    
+    OdeRuntimeMetrics::OdeRuntimeMetrics()
+        : m_evaluations(0)
+        , m_occurrences(0)
+        , m_totalTime(0)
+        , m_maxTime(0)
+        , m_frameEvaluations(0)
+        , m_frameOccurrences(0)
+        , m_frameTime(0)
+    {
+        LOG_FUNC();
+    }
+    
+    void OdeRuntimeMetrics::Record(uint64_t evaluations, 
+        uint64_t occurrences, uint64_t elapsed)
+    {
+        // Don't log function entry/exit
+        m_evaluations.fetch_add(evaluations, std::memory_order_relaxed);
+        m_occurrences.fetch_add(occurrences, std::memory_order_relaxed);
+        m_totalTime.fetch_add(elapsed, std::memory_order_relaxed);
+        
+        uint64_t maxTime = m_maxTime.load(std::memory_order_relaxed);
+        while (elapsed > maxTime and 
+            !m_maxTime.compare_exchange_weak(maxTime, elapsed, 
+                std::memory_order_relaxed));
+    }
+    
+    void OdeRuntimeMetrics::RecordFrame()
+    {
+        // Don't log function entry/exit
+        Record(m_frameEvaluations, m_frameOccurrences, m_frameTime);
+        
+        m_frameEvaluations = 0;
+        m_frameOccurrences = 0;
+        m_frameTime = 0;
+    }
+    
+    void OdeRuntimeMetrics::Get(dsl_ode_runtime_metrics* pMetrics) const
+    {
+        LOG_FUNC();
+        
+        pMetrics->evaluations = m_evaluations.load(std::memory_order_relaxed);
+        pMetrics->occurrences = m_occurrences.load(std::memory_order_relaxed);
+        pMetrics->total_time = m_totalTime.load(std::memory_order_relaxed);
+        pMetrics->max_time = m_maxTime.load(std::memory_order_relaxed);
+    }
+    
+    void OdeRuntimeMetrics::Clear()
+    {
+        LOG_FUNC();
+        
+        m_evaluations.store(0, std::memory_order_relaxed);
+        m_occurrences.store(0, std::memory_order_relaxed);
+        m_totalTime.store(0, std::memory_order_relaxed);
+        m_maxTime.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,168 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_ODE_METRICS_H
+#define _DSL_ODE_METRICS_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @class OdeRuntimeMetrics
+     * @brief Implements a set of cumulative runtime metrics for an ODE Trigger,
+     * ODE Action, or ODE Pad Probe Handler. The counters are updated with relaxed
+     * atomic operations and may be recorded from multiple threads. Metrics are 
+     * only recorded while active for the calling thread, i.e. while an ODE Pad
+     * Probe Handler with metrics enabled is processing a frame.
+     */
+    class OdeRuntimeMetrics
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the OdeRuntimeMetrics class
+         */
+        OdeRuntimeMetrics();
+
+        /**
+         * @brief Gets the current monotonic time.
+         * @return current monotonic time in nanoseconds.
+         */
+        static inline uint64_t Now()
+        {
+            // Don't log function entry/exit
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+        
+        /**
+         * @brief Determines if metrics are currently active for the calling thread.
+         * @return true if active, false otherwise.
+         */
+        static inline bool IsActive()
+        {
+            // Don't log function entry/exit
+            return s_isActive;
+        }
+        
+        /**
+         * @brief Sets the metrics active state for the calling thread.
+         * @param[in] active true to activate, false to deactivate.
+         */
+        static inline void SetActive(bool active)
+        {
+            // Don't log function entry/exit
+            s_isActive = active;
+        }
+        
+        /**
+         * @brief Records a single measurement.
+         * @param[in] evaluations number of evaluations to add.
+         * @param[in] occurrences number of occurrences to add.
+         * @param[in] elapsed elapsed time in nanoseconds to add, also checked 
+         * against the current maximum.
+         */
+        void Record(uint64_t evaluations, uint64_t occurrences, uint64_t elapsed);
+        
+        /**
+         * @brief Adds to the current frame accumulation. Must only be called by
+         * one thread at a time, i.e. by the thread processing the frame.
+         * @param[in] evaluations number of evaluations to add.
+         * @param[in] occurrences number of occurrences to add.
+         * @param[in] elapsed elapsed time in nanoseconds to add.
+         */
+        inline void AddToFrame(uint evaluations, uint occurrences, uint64_t elapsed)
+        {
+            // Don't log function entry/exit
+            m_frameEvaluations += evaluations;
+            m_frameOccurrences += occurrences;
+            m_frameTime += elapsed;
+        }
+        
+        /**
+         * @brief Records the current frame accumulation as a single measurement
+         * and resets the accumulation for the next frame.
+         */
+        void RecordFrame();
+        
+        /**
+         * @brief Gets the current metrics.
+         * @param[out] pMetrics structure to fill with the current metrics.
+         */
+        void Get(dsl_ode_runtime_metrics* pMetrics) const;
+        
+        /**
+         * @brief Clears all metrics.
+         */
+        void Clear();
+        
+    private:
+    
+        /**
+         * @brief cumulative number of evaluations.
+         */
+        std::atomic<uint64_t> m_evaluations;
+
+        /**
+         * @brief cumulative number of occurrences.
+         */
+        std::atomic<uint64_t> m_occurrences;
+        
+        /**
+         * @brief cumulative time in nanoseconds.
+         */
+        std::atomic<uint64_t> m_totalTime;
+        
+        /**
+         * @brief maximum time in nanoseconds for a single measurement.
+         */
+        std::atomic<uint64_t> m_maxTime;
+        
+        /**
+         * @brief number of evaluations accumulated for the current frame.
+         */
+        uint m_frameEvaluations;
+        
+        /**
+         * @brief number of occurrences accumulated for the current frame.
+         */
+        uint m_frameOccurrences;
+        
+        /**
+         * @brief time in nanoseconds accumulated for the current frame.
+         */
+        uint64_t m_frameTime;
+        
+        /**
+         * @brief true while metrics are active for the current thread.
+         */
+        static thread_local bool s_isActive;
+    };
+
+}
+
+#endif // _DSL_ODE_METRICS_H
@@ -27,32 +27,74 @@ THE SOFTWARE.
 
 namespace DSL
 {
-    TrackedObject::TrackedObject(uint64_t trackingId, uint64_t frameNumber,
-        const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
-        uint maxHistory)
-        : trackingId(trackingId)
-        , m_maxHistory(maxHistory)
-        , preEventFrameCount(1)
+    TrackedObject::TrackedObject()
+        : trackingId(0)
+        , frameNumber(0)
+        , preEventFrameCount(0)
         , onEventFrameCount(0)
+        , m_creationTimeMs(0)
+        , m_lastTimeMs(0)
+        , m_maxHistory(0)
+        , m_bboxCount(0)
+        , m_traceSize(0)
+        , m_prevTraceSize(0)
+        , m_motionState{0, 0, 0, 0, 0, 0}
+        , m_pList(NULL)
+        , m_pPrevInList(NULL)
+        , m_pNextInList(NULL)
+    {
+        // No function log - avoid overhead.
+    }
+    
+    TrackedObject::TrackedObject(uint64_t trackingId, uint64_t frameNumber,
+        double frameTimeMs, const NvBbox_Coords* pCoordinates, 
+        DSL_RGBA_COLOR_PTR pColor, uint maxHistory)
+        : TrackedObject()
+    {
+        // No function log - avoid overhead.
+        
+        Init(trackingId, frameNumber, frameTimeMs, pCoordinates, pColor, maxHistory);
+    }
+    
+    void TrackedObject::Init(uint64_t trackingId, uint64_t frameNumber,
+        double frameTimeMs, const NvBbox_Coords* pCoordinates, 
+        DSL_RGBA_COLOR_PTR pColor, uint maxHistory)
     {
         // No function log - avoid overhead.
         
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
+        this->trackingId = trackingId;
+        preEventFrameCount = 1;
+        onEventFrameCount = 0;
+        
+        // resize only - the ring buffer's capacity is reused when pooled
+        m_maxHistory = maxHistory;
+        m_bboxHistory.resize(std::max(maxHistory, 1u));
+        m_bboxCount = 0;
+        m_traceSize = 0;
+        m_prevTraceSize = 0;
+        m_crossStates.clear();
+        m_areaStates.clear();
+        m_motionState = {0, 0, 0, 0, 0, 0};
         
-        timeval creationTime;
-        gettimeofday(&creationTime, NULL);
-        m_creationTimeMs = creationTime.tv_sec*1000.0 + creationTime.tv_usec/1000.0;
+        m_creationTimeMs = frameTimeMs;
         
-        Update(frameNumber, pCoordinates);
+        Update(frameNumber, frameTimeMs, pCoordinates);
         
+        // The color is created once and then copied into on reuse.
+        if (!m_pColor)
+        {
+            m_pColor = std::shared_ptr<RgbaColor>(new RgbaColor());
+        }
         if (pColor)
         {
-            m_pColor = std::shared_ptr<RgbaColor>(new RgbaColor(*pColor));
+            m_pColor->red = pColor->red;
+            m_pColor->green = pColor->green;
+            m_pColor->blue = pColor->blue;
+            m_pColor->alpha = pColor->alpha;
         }
         else
         {
-            m_pColor = std::shared_ptr<RgbaColor>(new RgbaColor());
+            m_pColor->red = m_pColor->green = m_pColor->blue = m_pColor->alpha = 0.0;
         }
     }
     
@@ -61,103 +103,206 @@ namespace DSL
         LOG_FUNC();
         
         m_maxHistory = maxHistory;
+        
+        uint capacity = std::max(maxHistory, 1u);
+        if (capacity == m_bboxHistory.size())
+        {
+            return;
+        }
+        
+        // Number of bboxes in use - the previous and current traces share a bbox.
+        uint inUse = (m_prevTraceSize) 
+            ? m_prevTraceSize + m_traceSize - 1 
+            : m_traceSize;
+            
+        // If reducing below the number in use, drop the oldest - from the 
+        // previous trace first.
+        if (inUse > capacity)
+        {
+            uint excess = inUse - capacity;
+            if (m_prevTraceSize > excess + 1)
+            {
+                m_prevTraceSize -= excess;
+            }
+            else
+            {
+                excess -= (m_prevTraceSize) ? m_prevTraceSize - 1 : 0;
+                m_prevTraceSize = 0;
+                m_traceSize -= excess;
+            }
+            inUse = capacity;
+        }
+        
+        // Copy the bboxes in use to their positions in the new ring buffer.
+        std::vector<NvBbox_Coords> bboxHistory(capacity);
+        for (uint64_t position = m_bboxCount - inUse; 
+            position < m_bboxCount; position++)
+        {
+            bboxHistory[position % capacity] = bboxAt(position);
+        }
+        m_bboxHistory.swap(bboxHistory);
     }
     
     void TrackedObject::Update(uint64_t currentFrameNumber, 
-        const NvBbox_Coords* pCoordinates)
+        double currentFrameTimeMs, const NvBbox_Coords* pCoordinates)
     {
         // No function log - avoid overhead.
         
         // update the tracked object's frame number - the filter used for purging.
         frameNumber = currentFrameNumber;
+        m_lastTimeMs = currentFrameTimeMs;
         
-        // Copy only the rectangle coordinates of the Object's RectParams
-        std::shared_ptr pBboxCoords = 
-            std::shared_ptr<NvBbox_Coords>(new NvBbox_Coords);
-            
-        *pBboxCoords = *pCoordinates;
-
-        // If maintaining bbox trace-point history
-        if (m_maxHistory)
+        // move to the end of the expiry list - now the most recently updated.
+        if (m_pList and m_pList->pLast != this)
+        {
+            TrackedObjectList* pList = m_pList;
+            unlink();
+            linkLast(pList);
+        }
+        
+        // If not maintaining bbox trace-point history
+        if (!m_maxHistory)
         {
-            // if there's a previous trace, purge from this deque first.
-            if (m_pPrevBboxTrace)
+            return;
+        }
+        
+        // if there's a previous trace, purge from it first.
+        if (m_prevTraceSize)
+        {
+            if (m_prevTraceSize + m_traceSize >= m_maxHistory)
             {
-                // while there are elements to purge..
-                while (m_pPrevBboxTrace and 
-                    (m_pPrevBboxTrace->size() + m_pBboxTrace->size() >= m_maxHistory))
-                {
-                   m_pPrevBboxTrace->pop_front();
-                   
-                   // If we've emptied the previous trace deque then remove it.
-                   if (m_pPrevBboxTrace->empty())
-                   {
-                       m_pPrevBboxTrace = nullptr;
-                   }
-                }
+                uint excess = m_prevTraceSize + m_traceSize - m_maxHistory + 1;
                 
+                // If we've emptied the previous trace then remove it.
+                m_prevTraceSize = (excess >= m_prevTraceSize) 
+                    ? 0 : m_prevTraceSize - excess;
             }
-            else
-            {
-                while (m_pBboxTrace->size() >= m_maxHistory)
-                {
-                   m_pBboxTrace->pop_front();
-                }
-            }            
-            m_pBboxTrace->push_back(pBboxCoords);
         }
-    }
-
-    double TrackedObject::GetDurationMs()
-    {
-        timeval currentTime;
-        gettimeofday(&currentTime, NULL);
+        else if (m_traceSize >= m_maxHistory)
+        {
+            m_traceSize = m_maxHistory - 1;
+        }
         
-        return (currentTime.tv_sec*1000.0 + currentTime.tv_usec/1000.0) -
-            m_creationTimeMs;
+        // Copy only the rectangle coordinates into the next slot - the oldest 
+        // slot is always free as the number in use is now < capacity.
+        m_bboxHistory[m_bboxCount % m_bboxHistory.size()] = *pCoordinates;
+        m_bboxCount++;
+        m_traceSize++;
     }
 
     dsl_coordinate TrackedObject::GetFirstCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
-        getCoordinate(m_pBboxTrace->front(), testPoint, traceCoordinate);
+        if (m_traceSize)
+        {
+            getCoordinate(bboxAt(m_bboxCount - m_traceSize), 
+                testPoint, traceCoordinate);
+        }
         return traceCoordinate;
     }
     
     dsl_coordinate TrackedObject::GetLastCoordinate(uint testPoint)
     {
         dsl_coordinate traceCoordinate{0};
-        getCoordinate(m_pBboxTrace->back(), testPoint, traceCoordinate);
+        if (m_traceSize)
+        {
+            getCoordinate(bboxAt(m_bboxCount - 1), testPoint, traceCoordinate);
+        }
         return traceCoordinate;
     }
     
-    DSL_RGBA_MULTI_LINE_PTR TrackedObject::GetTrace(
-        uint testPoint, uint method, uint lineWidth)
+    void TrackedObject::GetLastSegment(uint testPoint, 
+        dsl_coordinate& start, dsl_coordinate& end)
+    {
+        end = GetLastCoordinate(testPoint);
+        start = end;
+        
+        if (m_traceSize > 1)
+        {
+            getCoordinate(bboxAt(m_bboxCount - 2), testPoint, start);
+        }
+    }
+    
+    TrackedObjectCrossState& TrackedObject::GetCrossState(const OdeArea* pArea)
+    {
+        for (auto& crossState: m_crossStates)
+        {
+            if (crossState.pArea == pArea)
+            {
+                return crossState;
+            }
+        }
+        m_crossStates.push_back({pArea, DSL_AREA_POINT_LOCATION_ON_LINE, false});
+        return m_crossStates.back();
+    }
+    
+    const TrackedObjectMotionState& TrackedObject::UpdateMotion(double x, double y,
+        double timeMs, double smoothing)
     {
         // No function log - avoid overhead.
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
-        std::vector<dsl_coordinate> traceCoordinates;
-
-        dsl_coordinate traceCoordinate{0};
-            
-        if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
+        // Restart the estimate if the timestamps have gone backwards.
+        if (m_motionState.updates and timeMs < m_motionState.timeMs)
         {
-            getCoordinate(m_pBboxTrace->front(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
-            
-            getCoordinate(m_pBboxTrace->back(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
+            m_motionState.updates = 0;
         }
-
-        else
+        // Only the newest position is used, i.e. constant work per update 
+        // regardless of the length of the track.
+        if (m_motionState.updates and timeMs > m_motionState.timeMs)
         {
-            for (const auto& ideque: *m_pBboxTrace)
+            double seconds = (timeMs - m_motionState.timeMs)/1000;
+            double velocityX = (x - m_motionState.x)/seconds;
+            double velocityY = (y - m_motionState.y)/seconds;
+            
+            // The first velocity is used as is to start the average.
+            if (m_motionState.updates == 1)
+            {
+                m_motionState.velocityX = velocityX;
+                m_motionState.velocityY = velocityY;
+            }
+            else
             {
-                getCoordinate(ideque, testPoint, traceCoordinate);
-                traceCoordinates.push_back(traceCoordinate);
+                m_motionState.velocityX += 
+                    smoothing*(velocityX - m_motionState.velocityX);
+                m_motionState.velocityY += 
+                    smoothing*(velocityY - m_motionState.velocityY);
             }
+            m_motionState.updates++;
+        }
+        else if (!m_motionState.updates)
+        {
+            m_motionState.updates = 1;
+        }
+        // Note: a second position with the same timestamp replaces the first.
+        m_motionState.x = x;
+        m_motionState.y = y;
+        m_motionState.timeMs = timeMs;
+        
+        return m_motionState;
+    }
+    
+    void TrackedObject::GetTraceCoordinates(uint testPoint, uint method, 
+        std::vector<dsl_coordinate>& coordinates)
+    {
+        // No function log - avoid overhead.
+        
+        coordinates.clear();
+        
+        if (m_traceSize)
+        {
+            getTraceCoordinates(m_bboxCount - m_traceSize, m_traceSize,
+                testPoint, method, coordinates);
         }
+    }
+    
+    DSL_RGBA_MULTI_LINE_PTR TrackedObject::GetTrace(
+        uint testPoint, uint method, uint lineWidth)
+    {
+        // No function log - avoid overhead.
+        
+        std::vector<dsl_coordinate> traceCoordinates;
+        GetTraceCoordinates(testPoint, method, traceCoordinates);
+        
         return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
             traceCoordinates.size(), lineWidth, m_pColor);
     }
@@ -167,92 +312,146 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        if (m_pPrevBboxTrace == nullptr)
+        if (!m_prevTraceSize)
         {
             return nullptr;
         }
         
-        // Create the trace - i.e. a vector of pre-sized blank coordinates
+        // The last bbox of the previous trace is the first of the current.
         std::vector<dsl_coordinate> traceCoordinates;
+        getTraceCoordinates(m_bboxCount - m_traceSize + 1 - m_prevTraceSize,
+            m_prevTraceSize, testPoint, method, traceCoordinates);
+        
+        return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
+            traceCoordinates.size(), lineWidth, m_pColor);
+    }
+
+    void TrackedObject::HandleOccurrence()
+    {
+        // The current trace becomes the previous trace, and its last point 
+        // becomes the first point of the new current trace to ensure a 
+        // continuous line (line segment between previous-trace-end and 
+        // current-trace-start) 
+        if (m_traceSize)
+        {
+            m_prevTraceSize = m_traceSize;
+            m_traceSize = 1;
+        }
+        m_crossStates.clear();
 
+        preEventFrameCount = 1;
+        onEventFrameCount = 0;
+    }
+    
+    void TrackedObject::linkLast(TrackedObjectList* pList)
+    {
+        m_pList = pList;
+        m_pPrevInList = pList->pLast;
+        m_pNextInList = NULL;
+        
+        if (pList->pLast)
+        {
+            pList->pLast->m_pNextInList = this;
+        }
+        else
+        {
+            pList->pFirst = this;
+        }
+        pList->pLast = this;
+    }
+    
+    void TrackedObject::unlink()
+    {
+        if (!m_pList)
+        {
+            return;
+        }
+        if (m_pPrevInList)
+        {
+            m_pPrevInList->m_pNextInList = m_pNextInList;
+        }
+        else
+        {
+            m_pList->pFirst = m_pNextInList;
+        }
+        if (m_pNextInList)
+        {
+            m_pNextInList->m_pPrevInList = m_pPrevInList;
+        }
+        else
+        {
+            m_pList->pLast = m_pPrevInList;
+        }
+        m_pList = NULL;
+        m_pPrevInList = m_pNextInList = NULL;
+    }
+    
+    void TrackedObject::getTraceCoordinates(uint64_t firstPosition, uint size,
+        uint testPoint, uint method, std::vector<dsl_coordinate>& coordinates)
+    {
         dsl_coordinate traceCoordinate{0};
             
         if (method == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
         {
-            getCoordinate(m_pPrevBboxTrace->front(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
+            getCoordinate(bboxAt(firstPosition), testPoint, traceCoordinate);
+            coordinates.push_back(traceCoordinate);
             
-            getCoordinate(m_pPrevBboxTrace->back(), testPoint, traceCoordinate);
-            traceCoordinates.push_back(traceCoordinate);
+            getCoordinate(bboxAt(firstPosition + size - 1), 
+                testPoint, traceCoordinate);
+            coordinates.push_back(traceCoordinate);
         }
-
         else
         {
-            traceCoordinates.reserve(m_pPrevBboxTrace->size());
-            for (const auto& ideque: *m_pPrevBboxTrace)
+            coordinates.reserve(size);
+            for (uint64_t position = firstPosition; 
+                position < firstPosition + size; position++)
             {
-                getCoordinate(ideque, testPoint, traceCoordinate);
-                traceCoordinates.push_back(traceCoordinate);
+                getCoordinate(bboxAt(position), testPoint, traceCoordinate);
+                coordinates.push_back(traceCoordinate);
             }
         }
-        return DSL_RGBA_MULTI_LINE_NEW("", traceCoordinates.data(), 
-            traceCoordinates.size(), lineWidth, m_pColor);
-    }
-
-    void TrackedObject::HandleOccurrence()
-    {
-        m_pPrevBboxTrace = m_pBboxTrace;
-        m_pBboxTrace = std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>>(
-            new std::deque<std::shared_ptr<NvBbox_Coords>>);
-
-        // Add last point of previous trace as first point to current trace to ensure
-        // a continuous line (line segment between previous-trace-end and current-trace-start) 
-        m_pBboxTrace->push_back(m_pPrevBboxTrace->back());
-
-        preEventFrameCount = 1;
-        onEventFrameCount = 0;
     }
     
-    void TrackedObject::getCoordinate(std::shared_ptr<NvBbox_Coords> pBbox, 
+    void TrackedObject::getCoordinate(const NvBbox_Coords& bbox, 
         uint testPoint, dsl_coordinate& traceCoordinate)
     {
         switch (testPoint)
         {
         case DSL_BBOX_POINT_CENTER :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         case DSL_BBOX_POINT_NORTH_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_NORTH :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_NORTH_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top);
             break;
         case DSL_BBOX_POINT_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         case DSL_BBOX_POINT_SOUTH_EAST :
-            traceCoordinate.x = round(pBbox->left + pBbox->width);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left + bbox.width);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_SOUTH :
-            traceCoordinate.x = round(pBbox->left + pBbox->width/2);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left + bbox.width/2);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_SOUTH_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top + pBbox->height);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top + bbox.height);
             break;
         case DSL_BBOX_POINT_WEST :
-            traceCoordinate.x = round(pBbox->left);
-            traceCoordinate.y = round(pBbox->top + pBbox->height/2);
+            traceCoordinate.x = round(bbox.left);
+            traceCoordinate.y = round(bbox.top + bbox.height/2);
             break;
         default:
             LOG_ERROR("Invalid DSL_BBOX_POINT = '" << testPoint 
@@ -263,8 +462,14 @@ namespace DSL
     
     //********************************************************************************
     
-    TrackedObjects::TrackedObjects(uint maxHistory)
+    TrackedObjects::TrackedObjects(uint maxHistory, uint missTolerance)
         : m_maxHistory(maxHistory)
+        , m_missTolerance(missTolerance)
+        , m_clockSourceId(0)
+        , m_clockFrameNumber(0)
+        , m_clockTimeMs(-1)
+        , m_removeListener(NULL)
+        , m_removeListenerClientData(NULL)
     {
         LOG_FUNC();
     }
@@ -273,128 +478,85 @@ namespace DSL
     {
         // No function log - avoid overhead.
 
-        // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            return false;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
-        {
-            return false;
-        }
-        
-        // else, the object is currently being tracked.
-        return true;
+        return GetObject(sourceId, trackingId) != nullptr;
     }
     
-    std::shared_ptr<TrackedObject> TrackedObjects::GetObject(
-        uint sourceId, uint64_t trackingId)
+    TrackedObject* TrackedObjects::GetObject(uint sourceId, uint64_t trackingId)
     {
         // No function log - avoid overhead.
 
         // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
-        {
-            return nullptr;
-        }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
+        SourceTable* pTable = getTable(sourceId);
+        if (!pTable)
         {
             return nullptr;
         }
+        int index = findSlot(*pTable, trackingId);
         
-        // else, the object is currently being tracked.
-        return pTrackedObjects->at(trackingId);
+        return (index < 0) ? nullptr : pTable->slots[index];
     }
     
-    std::shared_ptr<TrackedObject> TrackedObjects::Track(NvDsFrameMeta* pFrameMeta, 
+    TrackedObject* TrackedObjects::Track(NvDsFrameMeta* pFrameMeta, 
         NvDsObjectMeta* pObjectMeta, DSL_RGBA_COLOR_PTR pColor)
     {
         // No function log - avoid overhead.
 
         // if this is the first occurrence of any object for this source
-        if (m_trackedObjectsPerSource.find(pFrameMeta->source_id) == 
-            m_trackedObjectsPerSource.end())
+        if (pFrameMeta->source_id >= m_sourceTables.size())
         {
             LOG_DEBUG("First object detected with id = " << pObjectMeta->object_id 
                 << " for source = " << pFrameMeta->source_id);
-            
-            // create a new tracked object for this tracking Id and source
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
-                    pObjectMeta->object_id, pFrameMeta->frame_num, 
-                    (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
-                
-            // create a map of tracked objects for this source    
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                std::shared_ptr<TrackedObjectsT>(new TrackedObjectsT());
-                
-            // insert the new tracked object into the new map    
-            pTrackedObjects->insert(std::pair<uint64_t, 
-                std::shared_ptr<TrackedObject>>(pObjectMeta->object_id, 
-                    pTrackedObject));
                 
-            // add the map of tracked objects for this source to the map of 
-            // all tracked objects.
-            m_trackedObjectsPerSource[pFrameMeta->source_id] = pTrackedObjects;
-            
-            return pTrackedObject;
+            m_sourceTables.resize(pFrameMeta->source_id + 1, 
+                SourceTable{{}, 0, {NULL, NULL}});
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[pFrameMeta->source_id];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(pObjectMeta->object_id) == pTrackedObjects->end())
+        SourceTable& table = m_sourceTables[pFrameMeta->source_id];
+        
+        if (findSlot(table, pObjectMeta->object_id) >= 0)
         {
-            LOG_DEBUG("New object detected with id = " << pObjectMeta->object_id 
-                << " for source = " << pFrameMeta->source_id);
-            
-            // create a new tracked object for this tracking Id and source
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                std::shared_ptr<TrackedObject>(new TrackedObject(
-                    pObjectMeta->object_id, pFrameMeta->frame_num,
-                    (NvBbox_Coords*)&pObjectMeta->rect_params, 
-                    pColor, m_maxHistory));
+            LOG_ERROR("Object with id = " << pObjectMeta->object_id 
+                << " for source = " << pFrameMeta->source_id 
+                << " is already being tracked");
+            return nullptr;
+        }
+        
+        LOG_DEBUG("New object detected with id = " << pObjectMeta->object_id 
+            << " for source = " << pFrameMeta->source_id);
 
-            // insert the new tracked object into the new map    
-            pTrackedObjects->insert(std::pair<uint64_t, 
-                std::shared_ptr<TrackedObject>>(pObjectMeta->object_id, 
-                    pTrackedObject));
-            
-            return pTrackedObject;
+        // reuse a pooled object if available, else grow the pool.
+        TrackedObject* pTrackedObject(NULL);
+        if (m_freeObjects.size())
+        {
+            pTrackedObject = m_freeObjects.back();
+            m_freeObjects.pop_back();
         }
+        else
+        {
+            m_objectPool.emplace_back();
+            pTrackedObject = &m_objectPool.back();
+        }
+        pTrackedObject->Init(pObjectMeta->object_id, pFrameMeta->frame_num, 
+            GetFrameTimeMs(pFrameMeta), (NvBbox_Coords*)&pObjectMeta->rect_params, 
+            pColor, m_maxHistory);
+            
+        insert(table, pTrackedObject);
+        pTrackedObject->linkLast(&table.expiryList);
         
-        LOG_ERROR("Object with id = " << pObjectMeta->object_id 
-            << " for source = " << pFrameMeta->source_id 
-            << " is already being tracked");
-        return nullptr;
+        return pTrackedObject;
     }
 
     void TrackedObjects::DeleteObject(uint sourceId, uint64_t trackingId)
     {
         // If the sourceId does not exist, then not tracked.
-        if (m_trackedObjectsPerSource.find(sourceId) == 
-            m_trackedObjectsPerSource.end())
+        SourceTable* pTable = getTable(sourceId);
+        if (!pTable)
         {
             LOG_ERROR("Source = " << sourceId 
                 << " is not being tracked");
             return;
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[sourceId];
-            
-        // else, if this is the first occurrence of a specific object for this source
-        if (pTrackedObjects->find(trackingId) == pTrackedObjects->end())
+        int index = findSlot(*pTable, trackingId);
+        if (index < 0)
         {
             LOG_ERROR("Object with id = " << trackingId 
                 << " for source = " << sourceId 
@@ -403,40 +565,40 @@ namespace DSL
         }
         
         // else, the object is currently being tracked.
-        pTrackedObjects->erase(trackingId);
+        eraseSlot(*pTable, index);
     }    
 
-    void TrackedObjects::Purge(uint64_t currentFrameNumber)
+    void TrackedObjects::Purge(uint sourceId, uint64_t currentFrameNumber)
     {
         // No function log - avoid overhead.
 
-        for (const auto &trackedObjects: m_trackedObjectsPerSource)
+        SourceTable* pTable = getTable(sourceId);
+        if (!pTable)
         {
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                trackedObjects.second;
-
-            auto trackedObject = pTrackedObjects->cbegin();
-            while (trackedObject != pTrackedObjects->cend())
+            return;
+        }
+        
+        // The expiry list is ordered by last update, so stop at the first
+        // object that is still within the miss tolerance.
+        while (TrackedObject* pTrackedObject = pTable->expiryList.pFirst)
+        {
+            if (pTrackedObject->frameNumber <= currentFrameNumber and
+                currentFrameNumber - pTrackedObject->frameNumber <= m_missTolerance)
             {
-                if (trackedObject->second->frameNumber != currentFrameNumber)
-                {
-                    LOG_DEBUG("Purging tracked object with id = " 
-                        << trackedObject->first << " for source = " 
-                        << trackedObjects.first);
-                        
-                    // use the return value to update the iterator, as erase invalidates it
-                    trackedObject = pTrackedObjects->erase(trackedObject);
-                }
-                else {
-                    trackedObject++;
-                }            
+                break;
             }
+            LOG_DEBUG("Purging tracked object with id = " 
+                << pTrackedObject->trackingId << " for source = " << sourceId);
+                
+            eraseSlot(*pTable, findSlot(*pTable, pTrackedObject->trackingId));
         }
     }
     
     void TrackedObjects::Clear()
     {
-        m_trackedObjectsPerSource.clear();
+        m_sourceTables.clear();
+        m_freeObjects.clear();
+        m_objectPool.clear();
     }
     
     double TrackedObjects::GetCreationTime(NvDsFrameMeta* pFrameMeta, 
@@ -444,33 +606,153 @@ namespace DSL
     {
         // No function log - avoid overhead.
         
-        if (!IsTracked(pFrameMeta->source_id, pObjectMeta->object_id))
+        TrackedObject* pTrackedObject = 
+            GetObject(pFrameMeta->source_id, pObjectMeta->object_id);
+            
+        if (!pTrackedObject)
         {
             LOG_ERROR("Object with id = " << pObjectMeta->object_id 
                 << " for source = " << pFrameMeta->source_id 
                 << " is NOT being tracked");
             return 0;
         }
-        std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-            m_trackedObjectsPerSource[pFrameMeta->source_id];
-            
-        return pTrackedObjects->at(pObjectMeta->object_id)->GetDurationMs();
+        return pTrackedObject->GetDurationMs();
+    }
+    
+    double TrackedObjects::GetFrameTimeMs(NvDsFrameMeta* pFrameMeta)
+    {
+        // No function log - avoid overhead.
+        
+        // The stream's timestamps are used when available so that durations
+        // are immune to clock adjustments, and deterministic when processing
+        // recorded files faster (or slower) than real time.
+        if (GST_CLOCK_TIME_IS_VALID(pFrameMeta->buf_pts))
+        {
+            return (double)pFrameMeta->buf_pts / GST_MSECOND;
+        }
+        if (pFrameMeta->ntp_timestamp)
+        {
+            return (double)pFrameMeta->ntp_timestamp / GST_MSECOND;
+        }
+        
+        // Else, read the monotonic clock once for all objects in the frame.
+        if (m_clockTimeMs < 0 or m_clockSourceId != pFrameMeta->source_id or
+            m_clockFrameNumber != pFrameMeta->frame_num)
+        {
+            m_clockSourceId = pFrameMeta->source_id;
+            m_clockFrameNumber = pFrameMeta->frame_num;
+            m_clockTimeMs = (double)g_get_monotonic_time() / 1000;
+        }
+        return m_clockTimeMs;
     }
 
     void TrackedObjects::SetMaxHistory(uint maxHistory)
     {
         LOG_FUNC();
         
-        for (const auto &trackedObjects: m_trackedObjectsPerSource)
+        m_maxHistory = maxHistory;
+        
+        for (const auto& table: m_sourceTables)
         {
-            std::shared_ptr<TrackedObjectsT> pTrackedObjects = 
-                trackedObjects.second;
-                
-            for (const auto &trackedObject: *pTrackedObjects)
+            for (const auto& pTrackedObject: table.slots)
+            {
+                if (pTrackedObject)
+                {
+                    pTrackedObject->SetMaxHistory(maxHistory);
+                }
+            }
+        }
+    }
+    
+    TrackedObjects::SourceTable* TrackedObjects::getTable(uint sourceId)
+    {
+        if (sourceId >= m_sourceTables.size() or 
+            !m_sourceTables[sourceId].size)
+        {
+            return NULL;
+        }
+        return &m_sourceTables[sourceId];
+    }
+    
+    int TrackedObjects::findSlot(SourceTable& table, uint64_t trackingId)
+    {
+        if (table.slots.empty())
+        {
+            return -1;
+        }
+        uint mask = table.slots.size() - 1;
+        uint index = hashKey(trackingId) & mask;
+        
+        // load factor <= 1/2 guarantees an empty slot ends the probe.
+        while (table.slots[index])
+        {
+            if (table.slots[index]->trackingId == trackingId)
+            {
+                return index;
+            }
+            index = (index + 1) & mask;
+        }
+        return -1;
+    }
+    
+    void TrackedObjects::insert(SourceTable& table, TrackedObject* pTrackedObject)
+    {
+        if ((table.size + 1)*2 > table.slots.size())
+        {
+            // Grow and re-insert all - only until the steady state is reached.
+            std::vector<TrackedObject*> slots(table.slots.empty()
+                ? DSL_TRACKED_OBJECTS_INITIAL_TABLE_SIZE 
+                : table.slots.size()*2, NULL);
+            slots.swap(table.slots);
+            table.size = 0;
+            
+            for (const auto& pExisting: slots)
+            {
+                if (pExisting)
+                {
+                    insert(table, pExisting);
+                }
+            }
+        }
+        uint mask = table.slots.size() - 1;
+        uint index = hashKey(pTrackedObject->trackingId) & mask;
+        
+        while (table.slots[index])
+        {
+            index = (index + 1) & mask;
+        }
+        table.slots[index] = pTrackedObject;
+        table.size++;
+    }
+    
+    void TrackedObjects::eraseSlot(SourceTable& table, uint index)
+    {
+        if (m_removeListener)
+        {
+            m_removeListener(table.slots[index], m_removeListenerClientData);
+        }
+        table.slots[index]->unlink();
+        m_freeObjects.push_back(table.slots[index]);
+        
+        uint mask = table.slots.size() - 1;
+        uint hole = index;
+        uint next = (hole + 1) & mask;
+        
+        // Back-shift each following entry of the probe sequence that can 
+        // legally move into the hole - i.e. whose home slot is not between 
+        // the hole and its current slot.
+        while (table.slots[next])
+        {
+            uint home = hashKey(table.slots[next]->trackingId) & mask;
+            if (((next - home) & mask) >= ((next - hole) & mask))
             {
-                trackedObject.second->SetMaxHistory(maxHistory);
+                table.slots[hole] = table.slots[next];
+                hole = next;
             }
+            next = (next + 1) & mask;
         }
+        table.slots[hole] = NULL;
+        table.size--;
     }
     
 }    
\ No newline at end of file
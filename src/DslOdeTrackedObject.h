@@ -32,26 +32,163 @@ THE SOFTWARE.
 
 namespace DSL
 {
+    /**
+     * @brief initial number of slots in each per-source Tracked Object table, 
+     * must be a power of 2.
+     */
+    #define DSL_TRACKED_OBJECTS_INITIAL_TABLE_SIZE  32
+
+    class TrackedObject;
+    class OdeArea;
+    
+    /**
+     * @struct TrackedObjectCrossState
+     * @brief per-Area state used to detect a line cross incrementally, 
+     * one segment of the tracked object's trace at a time.
+     */
+    struct TrackedObjectCrossState
+    {
+        /**
+         * @brief the Area the state is maintained for.
+         */
+        const OdeArea* pArea;
+        
+        /**
+         * @brief location of the start of the trace - one of 
+         * DSL_AREA_POINT_LOCATION_INSIDE or DSL_AREA_POINT_LOCATION_OUTSIDE, 
+         * or DSL_AREA_POINT_LOCATION_ON_LINE if not yet known.
+         */
+        uint side;
+        
+        /**
+         * @brief true if a segment of the trace has intersected the Area's 
+         * line(s) since the start of the trace.
+         */
+        bool intersected;
+    };
+    
+    /**
+     * @struct TrackedObjectAreaState
+     * @brief per-Area state used to measure the time a tracked object dwells
+     * inside an Area incrementally, one frame at a time.
+     */
+    struct TrackedObjectAreaState
+    {
+        /**
+         * @brief frame timestamp the object last entered the Area, in units
+         * of ms, see TrackedObjects::GetFrameTimeMs().
+         */
+        double entryTimeMs;
+        
+        /**
+         * @brief true if the object was inside the Area when last updated.
+         */
+        bool inside;
+        
+        /**
+         * @brief true if an occurrence has been triggered for the object's
+         * current visit to the Area.
+         */
+        bool occurred;
+    };
+    
+    /**
+     * @struct TrackedObjectMotionState
+     * @brief running estimate of a tracked object's velocity, updated 
+     * incrementally with one new position at a time.
+     */
+    struct TrackedObjectMotionState
+    {
+        /**
+         * @brief position of the object when last updated, in pixels or in 
+         * world units if transformed by a homography.
+         */
+        double x;
+        double y;
+        
+        /**
+         * @brief frame timestamp of the last update, in units of ms, see 
+         * TrackedObjects::GetFrameTimeMs().
+         */
+        double timeMs;
+        
+        /**
+         * @brief smoothed velocity estimate, in position units per second.
+         */
+        double velocityX;
+        double velocityY;
+        
+        /**
+         * @brief number of updates since the estimate was started, 0 if the
+         * position is unknown. The velocity is valid once > 1.
+         */
+        uint updates;
+    };
+    
+    /**
+     * @brief callback typedef for an internal listener to be notified of each
+     * tracked object that is about to be purged or deleted.
+     */
+    typedef void (*dsl_tracked_object_remove_listener_cb)(
+        TrackedObject* pTrackedObject, void* client_data);
+    
+    /**
+     * @struct TrackedObjectList
+     * @brief intrusive list of the tracked objects for a single source, ordered
+     * by the frame number each was last updated with - least recent first.
+     */
+    struct TrackedObjectList
+    {
+        TrackedObject* pFirst;
+        TrackedObject* pLast;
+    };
+
     /**
      * @class TrackedObject
      * @file DslOdeTrackedObject.h
      * @brief Implements a Tracked Object with a history of bbox coordinates.
+     * The history is held in a fixed-capacity ring buffer sized by maxHistory
+     * so that updating the object makes no heap allocations.
      */
     class TrackedObject
     {
     public:
 
+        /**
+         * @brief Default ctor for the TrackedObject class, used to create
+         * pooled objects that are initialized with Init() when tracked. 
+         */
+        TrackedObject();
+        
         /**
          * @brief Ctor for the TrackedObject class
          * @param[in] unique trackingId for the tracked object
          * @param[in] frameNumber the object was first detected
+         * @param[in] frameTimeMs timestamp of the frame the object was first
+         * detected, see TrackedObjects::GetFrameTimeMs().
          * @param[in] pCoordinates bounding box coordinates from the object's meta 
          * when first detected
          * @param[in] pColor shared pointer to an RGBA Color Type to
          * set a unique color for the tracked object. 
          * @param[in] maxHistory maximum number of bbox coordinates to track
          */
-        TrackedObject(uint64_t trackingId, uint64_t frameNumber,
+        TrackedObject(uint64_t trackingId, uint64_t frameNumber, 
+            double frameTimeMs, const NvBbox_Coords* pCoordinates, 
+            DSL_RGBA_COLOR_PTR pColor, uint maxHistory);
+            
+        /**
+         * @brief (Re)initializes the tracked object for a newly detected object.
+         * The bbox history buffer is reused if it has sufficient capacity.
+         * @param[in] unique trackingId for the tracked object
+         * @param[in] frameNumber the object was first detected
+         * @param[in] frameTimeMs timestamp of the frame the object was first
+         * detected, see TrackedObjects::GetFrameTimeMs().
+         * @param[in] pCoordinates bounding box coordinates from the object's meta 
+         * when first detected
+         * @param[in] pColor RGBA Color to copy for the tracked object, or nullptr.
+         * @param[in] maxHistory maximum number of bbox coordinates to track
+         */
+        void Init(uint64_t trackingId, uint64_t frameNumber, double frameTimeMs,
             const NvBbox_Coords* pCoordinates, DSL_RGBA_COLOR_PTR pColor, 
             uint maxHistory);
             
@@ -64,23 +201,34 @@ namespace DSL
         /**
          * @brief function to update the tracked-object's last frame number and 
          * push a new set of positional bbox coordinates on to the tracked 
-         * object's m_bboxTrace queue.
+         * object's bbox history. The object is moved to the end of its 
+         * source's expiry list, if in one.
          * @param[in] currentFrameNumber new frame number to save
+         * @param[in] currentFrameTimeMs timestamp of the current frame, see 
+         * TrackedObjects::GetFrameTimeMs().
          * @param[in] pCoordinates new bounding box coordinates to push.
          */
-        void Update(uint64_t currentFrameNumber, const NvBbox_Coords* pCoordinates);
+        void Update(uint64_t currentFrameNumber, double currentFrameTimeMs,
+            const NvBbox_Coords* pCoordinates);
         
         /**
-         * @brief calculates the duration of time the object has been tracked.
-         * @return the duration in units of ms
-         */
-        double GetDurationMs();
+         * @brief calculates the duration of time the object has been tracked,
+         * from the timestamp of the frame it was first detected in to the
+         * timestamp of the frame it was last updated with.
+         * @return the duration in units of ms, 0 if the timestamps have 
+         * gone backwards, e.g. on seek. 
+         */
+        double GetDurationMs()
+        {
+            return (m_lastTimeMs > m_creationTimeMs) 
+                ? m_lastTimeMs - m_creationTimeMs : 0;
+        };
         
         /**
          * @brief Gets the current size of the bounding box trace.
          * @return current size of the bbox trace.
          */
-        size_t BboxTraceSize(){return m_pBboxTrace->size();};
+        size_t BboxTraceSize(){return m_traceSize;};
         
         /**
          * @brief Gets the coordinates for a specific test-point for the 
@@ -98,6 +246,78 @@ namespace DSL
          */
         dsl_coordinate GetLastCoordinate(uint testPoint);
         
+        /**
+         * @brief Gets the coordinates for a specific test-point for the newest
+         * segment - the last two bounding boxes - in the current trace. Both
+         * coordinates are the same if the trace has only one bounding box. 
+         * @param[in] testPoint to generate the coordinates with
+         * @param[out] start coordinates for the second to last bounding box.
+         * @param[out] end coordinates for the last bounding box.
+         */
+        void GetLastSegment(uint testPoint, 
+            dsl_coordinate& start, dsl_coordinate& end);
+        
+        /**
+         * @brief Gets the incremental cross state of the current trace for 
+         * a given Area, adding a new state - with unknown side - if not found.
+         * All states are cleared on HandleOccurrence.
+         * @param[in] pArea Area to get the cross state for.
+         * @return reference to the cross state, valid until the next call.
+         */
+        TrackedObjectCrossState& GetCrossState(const OdeArea* pArea);
+        
+        /**
+         * @brief Gets the dwell state of the tracked object for an Area by 
+         * the Area's index in its owner's Area list, adding new states - 
+         * outside - as required. States are only cleared on Init.
+         * @param[in] areaIndex index of the Area to get the state for.
+         * @return reference to the area state, valid until the next call.
+         */
+        TrackedObjectAreaState& GetAreaState(uint areaIndex)
+        {
+            if (areaIndex >= m_areaStates.size())
+            {
+                m_areaStates.resize(areaIndex + 1, {0, false, false});
+            }
+            return m_areaStates[areaIndex];
+        };
+        
+        /**
+         * @brief Updates the running velocity estimate of the tracked object with
+         * a new position, as an exponential moving average of the velocity 
+         * between consecutive positions. The estimate is restarted if the 
+         * timestamps have gone backwards, e.g. on seek. 
+         * @param[in] x new x position, in pixels or world units.
+         * @param[in] y new y position, in pixels or world units.
+         * @param[in] timeMs timestamp of the frame the position is from, see
+         * TrackedObjects::GetFrameTimeMs().
+         * @param[in] smoothing weight of the new velocity in the estimate, 
+         * in the range (0, 1]. 1 = no smoothing.
+         * @return reference to the updated motion state.
+         */
+        const TrackedObjectMotionState& UpdateMotion(double x, double y, 
+            double timeMs, double smoothing);
+        
+        /**
+         * @brief Gets all dwell states of the tracked object, indexed by Area.
+         * @return reference to the vector of area states.
+         */
+        const std::vector<TrackedObjectAreaState>& GetAreaStates()
+        {
+            return m_areaStates;
+        };
+        
+        /**
+         * @brief Fills a caller owned vector with the coordinates defining the 
+         * TrackedObject's trace for a specfic test-point on the object's bounding 
+         * box. The vector is cleared first, but its capacity is reused.
+         * @param[in] testPoint test-point to generate the trace with.
+         * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
+         * @param[out] coordinates vector to fill with the trace coordinates.
+         */
+        void GetTraceCoordinates(uint testPoint, uint method, 
+            std::vector<dsl_coordinate>& coordinates);
+            
         /**
          * @brief Returns a vector of coordinates defining the TrackedObject's
          * trace for a specfic test-point on the object's bounding box
@@ -113,7 +333,7 @@ namespace DSL
          * @brief used to query if the tracked object has a previous Trace
          * from a previous line cross event.
          */
-        bool HasPreviousTrace(){return m_pPrevBboxTrace != nullptr;};
+        bool HasPreviousTrace(){return m_prevTraceSize != 0;};
 
         /**
          * @brief Returns a vector of coordinates defining the TrackedObject's
@@ -128,8 +348,8 @@ namespace DSL
             
         /**
          * @brief Handles an ODE Occurrence for this tracked object. The current
-         * m_pBboxTrace is moved to the m_pPreviousBboxTrace and a new/empty
-         * m_pBboxTrace is created.
+         * trace becomes the previous trace and a new trace is started with 
+         * the last bbox of the previous trace. All cross states are cleared.
          */
         void HandleOccurrence();
 
@@ -155,43 +375,126 @@ namespace DSL
         uint onEventFrameCount;
     
     private:
+    
+        friend class TrackedObjects;
+        
+        /**
+         * @brief Appends the tracked object to the end of an expiry list.
+         * @param[in] pList list to append to.
+         */
+        void linkLast(TrackedObjectList* pList);
+        
+        /**
+         * @brief Removes the tracked object from its expiry list, if in one.
+         */
+        void unlink();
+
+        /**
+         * @brief Gets the bbox at an absolute history position.
+         * @param[in] position position in the range of [0, m_bboxCount).
+         * @return reference to the bbox in the ring buffer.
+         */
+        const NvBbox_Coords& bboxAt(uint64_t position)
+        {
+            return m_bboxHistory[position % m_bboxHistory.size()];
+        }
+        
+        /**
+         * @brief Fills a vector with the trace coordinates for a span of the
+         * bbox history.
+         * @param[in] firstPosition absolute history position of the first bbox.
+         * @param[in] size number of bboxes in the span, must be > 0.
+         * @param[in] testPoint test-point to generate the trace with.
+         * @param[in] method one of the DSL_OBJECT_TRACE_TEST_METHOD_* constants
+         * @param[out] coordinates vector to fill with the trace coordinates.
+         */
+        void getTraceCoordinates(uint64_t firstPosition, uint size,
+            uint testPoint, uint method, std::vector<dsl_coordinate>& coordinates);
 
         /**
          * @brief Get an x,y coordinate from a Bbox based on this Trigger's
          * client specified test-point
-         * @param[in] pBbox to optain the coordinate from
+         * @param[in] bbox to optain the coordinate from
          * @param[in] testPoint one of the DSL_BBOX_POINT_* constants
          * @param[out] traceCoordinate x,y coordinate value.
          */
-        void getCoordinate(std::shared_ptr<NvBbox_Coords> pBbox, 
+        void getCoordinate(const NvBbox_Coords& bbox, 
             uint testPoint, dsl_coordinate& traceCoordinate);
         
         /**
-         * @brief time of creation for this Tracked Object, used to test 
-         * for object persistence.
+         * @brief frame timestamp at creation for this Tracked Object, used 
+         * to test for object persistence.
          */
         double m_creationTimeMs;
         
+        /**
+         * @brief frame timestamp of the last update for this Tracked Object.
+         */
+        double m_lastTimeMs;
+        
         /**
          * @brief maximum number of bbox coordinates to maintain/trace.
          */
         uint m_maxHistory;
         
         /**
-         * @brief a max sized queue of Rectangle Params.
+         * @brief ring buffer of bbox coordinates, capacity = max(m_maxHistory, 1).
+         */
+        std::vector<NvBbox_Coords> m_bboxHistory;
+        
+        /**
+         * @brief total number of bboxes pushed, i.e. the absolute history 
+         * position one past the newest bbox.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pBboxTrace;
+        uint64_t m_bboxCount;
         
         /**
-         * @brief a max sized queue of Rectangle Params.
+         * @brief number of bboxes in the current trace - the newest in history.
          */
-        std::shared_ptr<std::deque<std::shared_ptr<NvBbox_Coords>>> m_pPrevBboxTrace;
+        uint m_traceSize;
+        
+        /**
+         * @brief number of bboxes in the previous trace, 0 if none. The last 
+         * bbox of the previous trace is shared with the first of the current.
+         */
+        uint m_prevTraceSize;
         
         /**
          * @brief used to identify the tracked object with an RGBA color.
          */
         DSL_RGBA_COLOR_PTR m_pColor;
         
+        /**
+         * @brief cross state of the current trace for each Area tested,
+         * cleared - but with capacity kept - on Init and HandleOccurrence.
+         */
+        std::vector<TrackedObjectCrossState> m_crossStates;
+        
+        /**
+         * @brief dwell state for each Area tested, indexed by Area, cleared 
+         * - but with capacity kept - on Init.
+         */
+        std::vector<TrackedObjectAreaState> m_areaStates;
+        
+        /**
+         * @brief running velocity estimate, restarted on Init.
+         */
+        TrackedObjectMotionState m_motionState;
+        
+        /**
+         * @brief expiry list the tracked object is in, NULL if none.
+         */
+        TrackedObjectList* m_pList;
+        
+        /**
+         * @brief previous (less recently updated) object in the expiry list.
+         */
+        TrackedObject* m_pPrevInList;
+        
+        /**
+         * @brief next (more recently updated) object in the expiry list.
+         */
+        TrackedObject* m_pNextInList;
     };
     
     //*******************************************************************************
@@ -199,7 +502,13 @@ namespace DSL
     /**
      * @class TrackedObjects
      * @file DslOdeTrackedObject.h
-     * @brief Manages a map of tracked objects.
+     * @brief Manages the tracked objects for all sources. Each source has an
+     * open-addressing (linear probing) table keyed by tracking id that refers 
+     * to TrackedObjects allocated from a pool, so that tracking makes no heap
+     * allocations once the pool and tables have grown to the steady state.
+     * Each source also keeps its tracked objects in an expiry list ordered by
+     * last update so that purging only visits the objects that have expired.
+     * Not thread safe - guarded by the owner.
      */
     class TrackedObjects
     {
@@ -207,8 +516,10 @@ namespace DSL
         /**
          * @brief Ctor TrackedObjects class
          * @param[in] maxHistory maximum number of bbox coordinates to track
+         * @param[in] missTolerance number of consecutive frames a tracked object
+         * can go undetected - for its source - before it is purged.
          */
-        TrackedObjects(uint maxHistory);
+        TrackedObjects(uint maxHistory, uint missTolerance = 0);
         
         /**
          * @brief determines if an object is currently tracked for a given source.
@@ -225,19 +536,20 @@ namespace DSL
          * the frame that holds the Object Meta
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
          * @param[in] pColor RGBA color to assign to the new Tracked object.
-         * @return a shared pointer to the newly tracked object, null_ptr otherwise.
+         * @return a pointer to the newly tracked object, nullptr otherwise. 
+         * The pointer is valid until the object is deleted or purged. 
          */
-        std::shared_ptr<TrackedObject> Track(NvDsFrameMeta* pFrameMeta, 
+        TrackedObject* Track(NvDsFrameMeta* pFrameMeta, 
             NvDsObjectMeta* pObjectMeta, DSL_RGBA_COLOR_PTR pColor);
         
         /**
          * @brief Gets the Tracked Object for a specified source and tranking Id
          * @param[in] sourceId source to filter on
          * @param[in] trackingId unique tracking id of the object to query
-         * @return a shared pointer if found, null_ptr otherwise.
+         * @return a pointer if found, nullptr otherwise. The pointer is valid
+         * until the object is deleted or purged. 
          */
-        std::shared_ptr<TrackedObject> GetObject(uint sourceId, 
-            uint64_t trackingId);
+        TrackedObject* GetObject(uint sourceId, uint64_t trackingId);
         
         /**
          * @brief Deletes a Tracked Object by source Id and tracking Id
@@ -247,10 +559,14 @@ namespace DSL
         void DeleteObject(uint sourceId, uint64_t trackingId);
         
         /**
-         * @brief Purges all tracked objects that are not in the current frame
-         * @param currentFrameNumber current frame number to use as a purge filter.
+         * @brief Purges all tracked objects for a given source that have not
+         * been updated within the last missTolerance frames of that source. 
+         * Objects last updated with a frame number greater than the current 
+         * - i.e. the source has been restarted - are purged as well.
+         * @param[in] sourceId source to purge the tracked objects for.
+         * @param[in] currentFrameNumber current frame number for the source.
          */
-        void Purge(uint64_t currentFrameNumber);
+        void Purge(uint sourceId, uint64_t currentFrameNumber);
         
         /**
          * @brief Clears/deletes all tracked objects
@@ -258,10 +574,11 @@ namespace DSL
         void Clear();
         
         /**
-         * @brief Query to determine if the container is empty
+         * @brief Query to determine if the container is empty, i.e. if no object
+         * has been tracked for any source since creation or the last Clear.
          * @return true if empty of tracked objects, false otherwise
          */
-        bool IsEmpty(){return m_trackedObjectsPerSource.empty();};
+        bool IsEmpty(){return m_sourceTables.empty();};
         
         /**
          * @brief gets the time of tracked object creation
@@ -273,28 +590,164 @@ namespace DSL
         double GetCreationTime(NvDsFrameMeta* pFrameMeta, 
             NvDsObjectMeta* pObjectMeta);
         
+        /**
+         * @brief Gets the timestamp for a frame, used to calculate tracked 
+         * object durations. The frame's buffer PTS is used if valid, then 
+         * its NTP timestamp if set. Otherwise, the monotonic clock is read 
+         * once per source/frame and the cached value is returned for all 
+         * objects in the same frame. 
+         * @param[in] pFrameMeta frame meta to get the timestamp for.
+         * @return the frame timestamp in units of ms.
+         */
+        double GetFrameTimeMs(NvDsFrameMeta* pFrameMeta);
+        
         /**
          * @brief Sets the max history for all objects tracked
          * @param maxHistory new max history setting.
          */
         void SetMaxHistory(uint maxHistory);
         
+        /**
+         * @brief Gets the current miss tolerance for all objects tracked
+         * @return current miss tolerance in units of frames.
+         */
+        uint GetMissTolerance(){return m_missTolerance;};
+        
+        /**
+         * @brief Sets the miss tolerance for all objects tracked
+         * @param[in] missTolerance new miss tolerance in units of frames.
+         */
+        void SetMissTolerance(uint missTolerance){m_missTolerance = missTolerance;};
+        
+        /**
+         * @brief Sets the (one at most) listener to notify of each tracked 
+         * object that is about to be purged or deleted. Not called on Clear.
+         * @param[in] listener listener function to call, or NULL to unset.
+         * @param[in] clientData opaque pointer to client data to pass back.
+         */
+        void SetRemoveListener(dsl_tracked_object_remove_listener_cb listener,
+            void* clientData)
+        {
+            m_removeListener = listener;
+            m_removeListenerClientData = clientData;
+        };
+        
     private:
     
+        /**
+         * @struct SourceTable
+         * @brief open-addressing table of tracked objects for a single source.
+         */
+        struct SourceTable
+        {
+            /**
+             * @brief table slots, NULL if empty. Size is always 0 or a power of 2.
+             */
+            std::vector<TrackedObject*> slots;
+            
+            /**
+             * @brief number of slots in use.
+             */
+            uint size;
+            
+            /**
+             * @brief all tracked objects in the table, least recently 
+             * updated first.
+             */
+            TrackedObjectList expiryList;
+        };
+        
+        /**
+         * @brief Mixes all bits of a tracking id into the table index.
+         */
+        static inline uint64_t hashKey(uint64_t key)
+        {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            return key;
+        }
+        
+        /**
+         * @brief Gets the table for a source, if one exists.
+         * @param[in] sourceId source to get the table for.
+         * @return pointer to the table, or NULL if the source is not tracked.
+         */
+        SourceTable* getTable(uint sourceId);
+        
+        /**
+         * @brief Finds the slot index for a tracking id in a table.
+         * @param[in] table table to search.
+         * @param[in] trackingId unique tracking id of the object to find.
+         * @return slot index if found, -1 otherwise.
+         */
+        int findSlot(SourceTable& table, uint64_t trackingId);
+        
+        /**
+         * @brief Inserts a tracked object into a table, growing the table
+         * as required to keep the load factor at or below 1/2.
+         * @param[in] table table to insert into.
+         * @param[in] pTrackedObject tracked object to insert.
+         */
+        void insert(SourceTable& table, TrackedObject* pTrackedObject);
+        
+        /**
+         * @brief Removes the tracked object at a given slot index, back-shifting
+         * the probe sequence, unlinks it from the expiry list, and returns the
+         * object to the pool.
+         * @param[in] table table to remove from.
+         * @param[in] index slot index of the tracked object to remove.
+         */
+        void eraseSlot(SourceTable& table, uint index);
+        
         /**
          * @brief maximum number of bbox coordinates to maintain/trace
          */
         uint m_maxHistory;
         
         /**
-         * @brief map of tracked objects - Key = unique Tracking Id
+         * @brief number of consecutive frames an object can go undetected 
+         * before it is purged.
          */
-        typedef std::map <uint64_t, std::shared_ptr<TrackedObject>> TrackedObjectsT;
-
+        uint m_missTolerance;
+        
+        /**
+         * @brief source Id and frame number for the cached monotonic clock 
+         * value, used when a frame has no valid PTS or NTP timestamp.
+         */
+        uint m_clockSourceId;
+        uint64_t m_clockFrameNumber;
+        
+        /**
+         * @brief cached monotonic clock value in ms, < 0 if not yet read.
+         */
+        double m_clockTimeMs;
+        
+        /**
+         * @brief listener to notify of each tracked object removed, NULL if none.
+         */
+        dsl_tracked_object_remove_listener_cb m_removeListener;
+        
+        /**
+         * @brief client data to pass back to the remove listener.
+         */
+        void* m_removeListenerClientData;
+        
+        /**
+         * @brief tables of tracked objects indexed by source Id, deque so that
+         * the expiry lists have stable addresses as new sources are added. 
+         */
+        std::deque<SourceTable> m_sourceTables;
+        
+        /**
+         * @brief pool of all tracked objects, deque for stable addresses.
+         */
+        std::deque<TrackedObject> m_objectPool;
+        
         /**
-         * @brief map of tracked objects per source - Key = source Id
+         * @brief tracked objects in the pool that are free for reuse.
          */
-        std::map <uint, std::shared_ptr<TrackedObjectsT>> m_trackedObjectsPerSource;
+        std::vector<TrackedObject*> m_freeObjects;
     };    
 }
 
@@ -33,7 +33,7 @@ namespace DSL
 {
 
     // Initialize static Event Counter
-    uint64_t OdeTrigger::s_eventCount = 0;
+    std::atomic<uint64_t> OdeTrigger::s_eventCount(0);
 
     OdeTrigger::OdeTrigger(const char* name, const char* source, 
         uint classId, uint limit)
@@ -60,13 +60,31 @@ namespace DSL
         , m_resetTimerId(0)
         , m_interval(0)
         , m_intervalCounter(0)
+        , m_priority(DSL_ODE_TRIGGER_PRIORITY_NORMAL)
+        , m_shedInterval(0)
         , m_skipFrame(false)
         , m_nextAreaIndex(0)
         , m_nextActionIndex(0)
+        , m_pOdeAccumulator(NULL)
+        , m_pOdeHeatMapper(NULL)
+        , m_pCriteria(NULL)
+        , m_pFrameCriteria(NULL)
+        , m_frameInProgress(false)
+        , m_criteriaRetired(false)
     {
         LOG_FUNC();
 
         g_mutex_init(&m_resetTimerMutex);
+        g_mutex_init(&m_criteriaListenersMutex);
+        
+        // Non-owning reference to this Trigger, passed on each occurrence
+        m_pSelf = DSL_BASE_PTR(DSL_BASE_PTR(), this);
+        
+        // Forward all enabled state changes to the criteria change listeners.
+        AddEnabledStateChangeListener(TriggerEnabledStateChangeHandler, this);
+        
+        // Publish the initial criteria snapshot
+        updateCriteria();
     }
 
     OdeTrigger::~OdeTrigger()
@@ -86,18 +104,23 @@ namespace DSL
             g_source_remove(m_resetTimerId);
         }
         g_mutex_clear(&m_resetTimerMutex);
+        g_mutex_clear(&m_criteriaListenersMutex);
+        
+        delete m_pCriteria.load();
     }
 
     uint OdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
         // Filter on skip-frame interval
-        if (!m_enabled or m_skipFrame)
+        if (!pCriteria->enabled or m_skipFrame)
         {
             return 0;
         }
@@ -112,18 +135,14 @@ namespace DSL
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
                 m_occurrencesAccumulated;
                 
-            DSL_ODE_ACCUMULATOR_PTR pOdeAccumulator = 
-                std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
-                
-            pOdeAccumulator->HandleOccurrences(shared_from_this(),
-                pBuffer, displayMetaData, pFrameMeta);
+            m_pOdeAccumulator->HandleOccurrences(m_pSelf,
+                pBuffer, displayMetaData, pFrameMeta, m_occurrences);
         }
         
         // If the client has added a heat-mapper
         if (m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+            m_pOdeHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
         }
         
         return m_occurrences;
@@ -149,6 +168,11 @@ namespace DSL
         m_pOdeActions[pChild->GetName()] = pChild;
         m_pOdeActionsIndexed[m_nextActionIndex] = pChild;
         
+        updateActionsList();
+        
+        // The parent Handler re-partitions on change of Actions.
+        NotifyCriteriaChangeListeners();
+        
         return true;
     }
 
@@ -168,6 +192,9 @@ namespace DSL
         m_pOdeActions.erase(pChild->GetName());
         m_pOdeActionsIndexed.erase(pChild->GetIndex());
         
+        updateActionsList();
+        NotifyCriteriaChangeListeners();
+        
         // Clear the parent relationship and index
         pChild->ClearParentName();
         pChild->SetIndex(0);
@@ -187,6 +214,8 @@ namespace DSL
         }
         m_pOdeActions.clear();
         m_pOdeActionsIndexed.clear();
+        m_pOdeActionsList.clear();
+        NotifyCriteriaChangeListeners();
     }
     
     bool OdeTrigger::AddArea(DSL_BASE_PTR pChild)
@@ -208,6 +237,9 @@ namespace DSL
         m_pOdeAreas[pChild->GetName()] = pChild;
         m_pOdeAreasIndexed[m_nextAreaIndex] = pChild;
         
+        updateAreasList();
+        updateCriteria();
+        
         return true;
     }
 
@@ -226,6 +258,9 @@ namespace DSL
         // Erase the child from both maps
         m_pOdeAreas.erase(pChild->GetName());
         m_pOdeAreasIndexed.erase(pChild->GetIndex());
+        
+        updateAreasList();
+        updateCriteria();
 
         // Clear the parent relationship and index
         pChild->ClearParentName();
@@ -247,6 +282,41 @@ namespace DSL
         }
         m_pOdeAreas.clear();
         m_pOdeAreasIndexed.clear();
+        m_pOdeAreasList.clear();
+        
+        updateCriteria();
+    }
+
+    void OdeTrigger::updateActionsList()
+    {
+        LOG_FUNC();
+        
+        // Rebuild the flat, add-ordered list of typed Action pointers iterated
+        // by the streaming thread. Ownership remains with the maps above.
+        m_pOdeActionsList.clear();
+        m_pOdeActionsList.reserve(m_pOdeActionsIndexed.size());
+        
+        for (const auto &imap: m_pOdeActionsIndexed)
+        {
+            m_pOdeActionsList.push_back(
+                std::dynamic_pointer_cast<OdeAction>(imap.second).get());
+        }
+    }
+
+    void OdeTrigger::updateAreasList()
+    {
+        LOG_FUNC();
+        
+        // Rebuild the flat, add-ordered list of typed Area pointers iterated
+        // by the streaming thread. Ownership remains with the maps above.
+        m_pOdeAreasList.clear();
+        m_pOdeAreasList.reserve(m_pOdeAreasIndexed.size());
+        
+        for (const auto &imap: m_pOdeAreasIndexed)
+        {
+            m_pOdeAreasList.push_back(
+                std::dynamic_pointer_cast<OdeArea>(imap.second).get());
+        }
     }
 
     bool OdeTrigger::AddAccumulator(DSL_BASE_PTR pAccumulator)
@@ -261,6 +331,9 @@ namespace DSL
             return false;
         }
         m_pAccumulator = pAccumulator;
+        m_pOdeAccumulator = 
+            std::dynamic_pointer_cast<OdeAccumulator>(pAccumulator).get();
+        NotifyCriteriaChangeListeners();
         return true;
     }
     
@@ -276,6 +349,8 @@ namespace DSL
             return false;
         }
         m_pAccumulator = NULL;
+        m_pOdeAccumulator = NULL;
+        NotifyCriteriaChangeListeners();
         return true;
     }
         
@@ -291,6 +366,9 @@ namespace DSL
             return false;
         }
         m_pHeatMapper = pHeatMapper;
+        m_pOdeHeatMapper = 
+            std::dynamic_pointer_cast<OdeHeatMapper>(pHeatMapper).get();
+        NotifyCriteriaChangeListeners();
         return true;
     }
     
@@ -306,6 +384,8 @@ namespace DSL
             return false;
         }
         m_pHeatMapper = NULL;
+        m_pOdeHeatMapper = NULL;
+        NotifyCriteriaChangeListeners();
         return true;
     }
         
@@ -368,6 +448,11 @@ namespace DSL
             HandleResetTimeout();
     }
 
+    static void TriggerEnabledStateChangeHandler(boolean enabled, void* pTrigger)
+    {
+        static_cast<OdeTrigger*>(pTrigger)->HandleEnabledStateChange();
+    }
+
     int OdeTrigger::HandleResetTimeout()
     {
         LOG_FUNC();
@@ -460,6 +545,212 @@ namespace DSL
 
         return true;
     }        
+
+    bool OdeTrigger::AddCriteriaChangeListener(
+        dsl_ode_trigger_criteria_change_listener_cb listener, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_criteriaListenersMutex);
+
+        if (m_criteriaChangeListeners.find(listener) != 
+            m_criteriaChangeListeners.end())
+        {   
+            LOG_ERROR("Criteria change listener is not unique");
+            return false;
+        }
+        m_criteriaChangeListeners[listener] = clientData;
+
+        return true;
+    }
+    
+    bool OdeTrigger::RemoveCriteriaChangeListener(
+        dsl_ode_trigger_criteria_change_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_criteriaListenersMutex);
+
+        if (m_criteriaChangeListeners.find(listener) == 
+            m_criteriaChangeListeners.end())
+        {   
+            LOG_ERROR("Criteria change listener was not found");
+            return false;
+        }
+        m_criteriaChangeListeners.erase(listener);
+
+        return true;
+    }
+    
+    void OdeTrigger::NotifyCriteriaChangeListeners()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_criteriaListenersMutex);
+        
+        // iterate through the map of criteria-change-listeners calling each
+        for(auto const& imap: m_criteriaChangeListeners)
+        {
+            try
+            {
+                imap.first(imap.second);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Exception calling Criteria-Change-Listener");
+            }
+        }
+    }
+    
+    bool OdeTrigger::GetRoutingCriteria(int* sourceId, std::vector<uint>& classIds)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_enabled)
+        {
+            return false;
+        }
+        
+        // a "one-time-get" of the source Id from the source name. If the Source
+        // can't be found (yet), route as any source and let the Trigger filter.
+        if (m_source.size() and m_sourceId == -1)
+        {
+            Services::GetServices()->SourceIdGet(m_source.c_str(), &m_sourceId);
+        }
+        *sourceId = (m_source.size()) ? m_sourceId : -1;
+        
+        classIds.push_back(m_classId);
+        return true;
+    }
+    
+    bool OdeTrigger::IsSourcePartitionable()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!m_source.size() or m_pAccumulator or m_pHeatMapper)
+        {
+            return false;
+        }
+        // Actions may be shared with the Triggers of other sources, and must
+        // be invoked in batch order unless safe to invoke concurrently.
+        for (const auto &pOdeAction: m_pOdeActionsList)
+        {
+            if (!pOdeAction->IsReentrant())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    void OdeTrigger::HandleEnabledStateChange()
+    {
+        LOG_FUNC();
+        // internal do not lock m_propertyMutex
+        
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
+    }
+    
+    void OdeTrigger::updateCriteria()
+    {
+        LOG_FUNC();
+        // internal do not lock m_propertyMutex
+        
+        OdeTriggerCriteria* pCriteria = new OdeTriggerCriteria();
+        copyCriteria(pCriteria);
+        
+        // Publish the new snapshot. The exchange and the check of the frame in
+        // progress are sequentially consistent with pinCriteria, so either the 
+        // frame in progress is seen here, or the frame pins the new snapshot.
+        const OdeTriggerCriteria* pRetiredCriteria = m_pCriteria.exchange(pCriteria);
+        if (!pRetiredCriteria)
+        {
+            return;
+        }
+        m_pRetiredCriteria.emplace_back(pRetiredCriteria);
+        
+        // Readers of the previous snapshot may still be in progress, so it's
+        // retired until the next ReclaimCriteria. Otherwise free all now.
+        if (m_frameInProgress.load())
+        {
+            m_criteriaRetired = true;
+        }
+        else
+        {
+            m_pRetiredCriteria.clear();
+            m_criteriaRetired = false;
+        }
+    }
+    
+    void OdeTrigger::copyCriteria(OdeTriggerCriteria* pCriteria)
+    {
+        LOG_FUNC();
+        
+        pCriteria->enabled = m_enabled;
+        pCriteria->source = m_source;
+        pCriteria->sourceId = m_sourceId;
+        pCriteria->infer = m_infer;
+        pCriteria->inferId = m_inferId;
+        pCriteria->classId = m_classId;
+        pCriteria->classIdB = m_classId;
+        pCriteria->limit = m_limit;
+        pCriteria->minConfidence = m_minConfidence;
+        pCriteria->minTrackerConfidence = m_minTrackerConfidence;
+        pCriteria->minWidth = m_minWidth;
+        pCriteria->minHeight = m_minHeight;
+        pCriteria->maxWidth = m_maxWidth;
+        pCriteria->maxHeight = m_maxHeight;
+        pCriteria->inferDoneOnly = m_inferDoneOnly;
+        pCriteria->minFrameCountN = m_minFrameCountN;
+        pCriteria->minFrameCountD = m_minFrameCountD;
+        pCriteria->interval = m_interval;
+        pCriteria->priority = m_priority;
+        
+        for (const auto &imap: m_pOdeAreasIndexed)
+        {
+            pCriteria->pOdeAreas.push_back(imap.second);
+        }
+        pCriteria->pOdeAreasList = m_pOdeAreasList;
+    }
+    
+    void OdeTrigger::ReclaimCriteria()
+    {
+        // Note: function is called from the system (callback) context
+        // Do not log function entry - called on every frame
+        
+        // The last frame's snapshot may be retired - unpin it before freeing.
+        m_pFrameCriteria = NULL;
+        
+        if (!m_criteriaRetired.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_pRetiredCriteria.clear();
+        m_criteriaRetired = false;
+    }
+    
+    const OdeTriggerCriteria* OdeTrigger::pinCriteria()
+    {
+        // Do not log function entry - called on every frame
+        
+        // Flag the frame in progress before loading the current snapshot. 
+        // See updateCriteria.
+        m_frameInProgress.store(true);
+        m_pFrameCriteria = m_pCriteria.load();
+        
+        return m_pFrameCriteria;
+    }
+    
+    void OdeTrigger::ReleaseCriteria()
+    {
+        // Note: function is called from the system (callback) context
+        // Do not log function entry - called on every frame
+        
+        m_pFrameCriteria = NULL;
+        m_frameInProgress.store(false, std::memory_order_release);
+    }
         
     uint OdeTrigger::GetClassId()
     {
@@ -474,6 +765,9 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_classId = classId;
+        
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
     }
 
     uint OdeTrigger::GetLimit()
@@ -491,6 +785,8 @@ namespace DSL
         
         m_limit = limit;
         
+        updateCriteria();
+        
         // iterate through the map of limit-event-listeners calling each
         for(auto const& imap: m_limitEventListeners)
         {
@@ -523,13 +819,23 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_source.assign(source);
+        
+        // force a new one-time-get of the source Id on next use
+        m_sourceId = -1;
+        
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
     }
 
     void OdeTrigger::_setSourceId(int id)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_sourceId = id;
+        
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
     }
     
     const char* OdeTrigger::GetInfer()
@@ -549,13 +855,21 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_infer.assign(infer);
+        
+        // force a new one-time-get of the infer Id on next use
+        m_inferId = -1;
+        
+        updateCriteria();
     }
 
     void OdeTrigger::_setInferId(int id)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_inferId = id;
+        
+        updateCriteria();
     }
     
     float OdeTrigger::GetMinConfidence()
@@ -571,6 +885,8 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_minConfidence = minConfidence;
+        
+        updateCriteria();
     }
     
     float OdeTrigger::GetMinTrackerConfidence()
@@ -586,6 +902,8 @@ namespace DSL
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_minTrackerConfidence = minConfidence;
+        
+        updateCriteria();
     }
     
     void OdeTrigger::GetMinDimensions(float* minWidth, float* minHeight)
@@ -603,6 +921,8 @@ namespace DSL
         
         m_minWidth = minWidth;
         m_minHeight = minHeight;
+        
+        updateCriteria();
     }
     
     void OdeTrigger::GetMaxDimensions(float* maxWidth, float* maxHeight)
@@ -620,6 +940,8 @@ namespace DSL
         
         m_maxWidth = maxWidth;
         m_maxHeight = maxHeight;
+        
+        updateCriteria();
     }
     
     bool OdeTrigger::GetInferDoneOnlySetting()
@@ -632,8 +954,11 @@ namespace DSL
     void OdeTrigger::SetInferDoneOnlySetting(bool inferDoneOnly)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
         m_inferDoneOnly = inferDoneOnly;
+        
+        updateCriteria();
     }
     
     void OdeTrigger::GetMinFrameCount(uint* minFrameCountN, uint* minFrameCountD)
@@ -651,6 +976,8 @@ namespace DSL
         
         m_minFrameCountN = minFrameCountN;
         m_minFrameCountD = minFrameCountD;
+        
+        updateCriteria();
     }
 
     uint OdeTrigger::GetInterval()
@@ -668,22 +995,72 @@ namespace DSL
         
         m_interval = interval;
         m_intervalCounter = 0;
+        
+        updateCriteria();
+    }
+    
+    uint OdeTrigger::GetPriority()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_priority;
+    }
+    
+    void OdeTrigger::SetPriority(uint priority)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_priority = priority;
+        
+        // The parent Handler reapplies its load-shedding on criteria change.
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
+    }
+    
+    bool OdeTrigger::shedFrame(uint sourceId)
+    {
+        // Don't log function entry/exit
+        uint shedInterval = m_shedInterval.load(std::memory_order_relaxed);
+        
+        if (!shedInterval)
+        {
+            if (m_shedCounters.size())
+            {
+                m_shedCounters.clear();
+            }
+            return false;
+        }
+        if (shedInterval == DSL_ODE_TRIGGER_SHED_INTERVAL_ALL)
+        {
+            return true;
+        }
+        // Count per source, otherwise the fixed batch order would shed the 
+        // same sources on every batch.
+        uint& shedCounter = m_shedCounters[sourceId];
+        shedCounter = (shedCounter + 1) % shedInterval; 
+        return (shedCounter != 0);
     }
     
-    bool OdeTrigger::CheckForSourceId(int sourceId)
+    bool OdeTrigger::CheckForSourceId(const OdeTriggerCriteria* pCriteria, 
+        int sourceId)
     {
         LOG_FUNC();
 
         // Filter on Source id if set
-        if (m_source.size())
+        if (pCriteria->source.size())
         {
-            // a "one-time-get" of the source Id from the source name
-            if (m_sourceId == -1)
+            // a "one-time-get" of the source Id from the source name, 
+            // cached with the criteria snapshot.
+            if (pCriteria->sourceId == -1)
             {
-                
-                Services::GetServices()->SourceIdGet(m_source.c_str(), &m_sourceId);
+                int criteriaSourceId(-1);
+                Services::GetServices()->SourceIdGet(pCriteria->source.c_str(), 
+                    &criteriaSourceId);
+                pCriteria->sourceId = criteriaSourceId;
             }
-            if (m_sourceId != sourceId)
+            if (pCriteria->sourceId != sourceId)
             {
                 return false;
             }
@@ -691,19 +1068,24 @@ namespace DSL
         return true;
     }
 
-    bool OdeTrigger::CheckForInferId(int inferId)
+    bool OdeTrigger::CheckForInferId(const OdeTriggerCriteria* pCriteria, 
+        int inferId)
     {
         LOG_FUNC();
 
         // Filter on Source id if set
-        if (m_infer.size())
+        if (pCriteria->infer.size())
         {
-            // a "one-time-get" of the inference component Id from the name
-            if (m_inferId == -1)
+            // a "one-time-get" of the inference component Id from the name,
+            // cached with the criteria snapshot.
+            if (pCriteria->inferId == -1)
             {
-                Services::GetServices()->InferIdGet(m_infer.c_str(), &m_inferId);
+                int criteriaInferId(-1);
+                Services::GetServices()->InferIdGet(pCriteria->infer.c_str(), 
+                    &criteriaInferId);
+                pCriteria->inferId = criteriaInferId;
             }
-            if (m_inferId != inferId)
+            if (pCriteria->inferId != inferId)
             {
                 return false;
             }
@@ -712,105 +1094,127 @@ namespace DSL
     }
 
     void OdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         // Reset the occurrences from the last frame, even if disabled  
         m_occurrences = 0;
 
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
+        // Pin the current criteria snapshot for all processing of this frame.
+        const OdeTriggerCriteria* pCriteria = pinCriteria();
+
+        if (!pCriteria->enabled)
+        {
+            return;
+        }
+        // No frame-level processing for the frames of other sources, so that
+        // results are the same whether processed serially or per source.
+        if (!CheckForSourceId(pCriteria, pFrameMeta->source_id))
         {
+            m_skipFrame = true;
             return;
         }
 
         // Call on each of the Trigger's Areas to (optionally) display their Rectangle
-        for (const auto &imap: m_pOdeAreasIndexed)
+        for (const auto &pOdeArea: pCriteria->pOdeAreasList)
         {
-            DSL_ODE_AREA_PTR pOdeArea = 
-                std::dynamic_pointer_cast<OdeArea>(imap.second);
             
             pOdeArea->AddMeta(displayMetaData, pFrameMeta);
         }
-        if (m_interval)
+        if (pCriteria->interval)
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
+            m_intervalCounter = (m_intervalCounter + 1) % pCriteria->interval; 
             if (m_intervalCounter != 0)
             {
                 m_skipFrame = true;
                 return;
             }
         }
-        m_skipFrame = false;
+        // Frames within the process interval may be shed under load.
+        m_skipFrame = shedFrame(pFrameMeta->source_id);
     }
 
-    bool OdeTrigger::CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
-        NvDsObjectMeta* pObjectMeta)
+    bool OdeTrigger::CheckForMinCriteria(const OdeTriggerCriteria* pCriteria,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
+        return CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta, 
+            pCriteria->classId);
+    }
+
+    bool OdeTrigger::CheckForMinCriteria(const OdeTriggerCriteria* pCriteria,
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, uint classId)
+    {
+        // Note: the criteria snapshot is read without locking the property mutex.
+        
         // Filter on enable and skip-frame interval
-        if (!m_enabled or m_skipFrame)
+        if (!pCriteria->enabled or m_skipFrame)
         {
             return false;
         }
         
         // Ensure enabled, and that the limit has not been exceeded
-        if (m_limit and m_triggered >= m_limit) 
+        if (pCriteria->limit and 
+            m_triggered.load(std::memory_order_relaxed) >= pCriteria->limit) 
         {
             return false;
         }
         // Filter on unique source-id and unique-inference-component-id
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForInferId(pObjectMeta->unique_component_id))
+        if (!CheckForSourceId(pCriteria, pFrameMeta->source_id) or 
+            !CheckForInferId(pCriteria, pObjectMeta->unique_component_id))
         {
             return false;
         }
         // Filter on Class id if set
-        if ((m_classId != DSL_ODE_ANY_CLASS) and 
-            (m_classId != pObjectMeta->class_id))
+        if ((classId != DSL_ODE_ANY_CLASS) and 
+            (classId != pObjectMeta->class_id))
         {
             return false;
         }
         // Ensure that the minimum Inference confidence has been reached
         if (pObjectMeta->confidence > 0 and 
-            pObjectMeta->confidence < m_minConfidence)
+            pObjectMeta->confidence < pCriteria->minConfidence)
         {
             return false;
         }
         // Ensure that the minimum Tracker confidence has been reached
         if (pObjectMeta->tracker_confidence > 0 and 
-            pObjectMeta->tracker_confidence < m_minTrackerConfidence)
+            pObjectMeta->tracker_confidence < pCriteria->minTrackerConfidence)
         {
             return false;
         }
         // If defined, check for minimum dimensions
-        if ((m_minWidth > 0 and pObjectMeta->rect_params.width < m_minWidth) or
-            (m_minHeight > 0 and pObjectMeta->rect_params.height < m_minHeight))
+        if ((pCriteria->minWidth > 0 and 
+                pObjectMeta->rect_params.width < pCriteria->minWidth) or
+            (pCriteria->minHeight > 0 and 
+                pObjectMeta->rect_params.height < pCriteria->minHeight))
         {
             return false;
         }
         // If defined, check for maximum dimensions
-        if ((m_maxWidth > 0 and pObjectMeta->rect_params.width > m_maxWidth) or
-            (m_maxHeight > 0 and pObjectMeta->rect_params.height > m_maxHeight))
+        if ((pCriteria->maxWidth > 0 and 
+                pObjectMeta->rect_params.width > pCriteria->maxWidth) or
+            (pCriteria->maxHeight > 0 and 
+                pObjectMeta->rect_params.height > pCriteria->maxHeight))
         {
             return false;
         }
         // If define, check if Inference was done on the frame or not
-        if (m_inferDoneOnly and !pFrameMeta->bInferDone)
+        if (pCriteria->inferDoneOnly and !pFrameMeta->bInferDone)
         {
             return false;
         }
         return true;
     }
 
-    bool OdeTrigger::CheckForInside(NvDsObjectMeta* pObjectMeta)
+    bool OdeTrigger::CheckForInside(const OdeTriggerCriteria* pCriteria,
+        NvDsObjectMeta* pObjectMeta)
     {
         // If areas are defined, check condition
 
-        if (m_pOdeAreasIndexed.size())
+        if (pCriteria->pOdeAreasList.size())
         {
-            for (const auto &imap: m_pOdeAreasIndexed)
+            for (const auto &pOdeArea: pCriteria->pOdeAreasList)
             {
-                DSL_ODE_AREA_PTR pOdeArea = 
-                    std::dynamic_pointer_cast<OdeArea>(imap.second);
                 if (pOdeArea->IsBboxInside(pObjectMeta->rect_params))
                 {
                     return !pOdeArea->IsType(typeid(OdeExclusionArea));
@@ -836,57 +1240,69 @@ namespace DSL
     }
     
     void AlwaysOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
+        // Pin the current criteria snapshot for all processing of this frame.
+        const OdeTriggerCriteria* pCriteria = pinCriteria();
+        
+        if (!pCriteria->enabled or 
+            !CheckForSourceId(pCriteria, pFrameMeta->source_id) or 
             m_when != DSL_ODE_PRE_OCCURRENCE_CHECK)
         {
             return;
         }
-        if (m_interval)
+        if (pCriteria->interval)
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
+            m_intervalCounter = (m_intervalCounter + 1) % pCriteria->interval; 
             if (m_intervalCounter != 0)
             {
                 return;
             }
         }
-        for (const auto &imap: m_pOdeActionsIndexed)
+        if (shedFrame(pFrameMeta->source_id))
+        {
+            return;
+        }
+        for (const auto &pOdeAction: m_pOdeActionsList)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->InvokeOccurrence(m_pSelf, 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
     }
 
     uint AlwaysOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id) or 
+        if (!pCriteria->enabled or 
+            !CheckForSourceId(pCriteria, pFrameMeta->source_id) or 
             m_when != DSL_ODE_POST_OCCURRENCE_CHECK)
         {
             return 0;
         }
-        if (m_interval)
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (pCriteria->interval)
         {
-            m_intervalCounter = (m_intervalCounter + 1) % m_interval; 
+            m_intervalCounter = (m_intervalCounter + 1) % pCriteria->interval; 
             if (m_intervalCounter != 0)
             {
                 return 0;
             }
         }
-        for (const auto &imap: m_pOdeActionsIndexed)
+        if (shedFrame(pFrameMeta->source_id))
+        {
+            return 0;
+        }
+        for (const auto &pOdeAction: m_pOdeActionsList)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->InvokeOccurrence(m_pSelf, 
                 pBuffer, displayMetaData, pFrameMeta, NULL);
         }
         return 1;
@@ -907,21 +1323,22 @@ namespace DSL
     }
     
     bool OccurrenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         IncrementAndCheckTriggerCount();
         m_occurrences++;
         
@@ -934,17 +1351,18 @@ namespace DSL
 
         if (m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                pFrameMeta, pObjectMeta);
+            m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+        }
+        if (m_pAccumulator)
+        {
+            m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
         }
 
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &pOdeAction: m_pOdeActionsList)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
             try
             {
-                pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+                pOdeAction->InvokeOccurrence(m_pSelf, pBuffer, 
                     displayMetaData, pFrameMeta, pObjectMeta);
             }
             catch(...)
@@ -971,31 +1389,33 @@ namespace DSL
     }
     
     bool AbsenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
         // Important **** we need to check for Criteria even if the Absence Trigger is disabled. 
         // This is case another Trigger enables This trigger, and it checks for the number of 
         // occurrences in the PostProcessFrame() . If the m_occurrences is not updated the Trigger 
         // will report Absence incorrectly
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         m_occurrences++;
 
         return true;
     }
     
     uint AbsenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1004,7 +1424,12 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or (m_limit and m_triggered >= m_limit) or m_occurrences) 
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            // Objects aren't checked on skipped or shed frames, so absence 
+            // can't be determined.
+            if (!pCriteria->enabled or m_skipFrame or
+                (pCriteria->limit and m_triggered >= pCriteria->limit) or m_occurrences) 
             {
                 return 0;
             }        
@@ -1018,11 +1443,9 @@ namespace DSL
             // update the total event count static variable
             s_eventCount++;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &pOdeAction: m_pOdeActionsList)
             {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->InvokeOccurrence(m_pSelf, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1033,59 +1456,163 @@ namespace DSL
 
     // *****************************************************************************
 
-    InstanceOdeTrigger::InstanceOdeTrigger(const char* name, 
-        const char* source, uint classId, uint limit)
-        : OdeTrigger(name, source, classId, limit)
+    OdeInstanceTable::OdeInstanceTable()
+        : m_entries(64)
+        , m_size(0)
     {
         LOG_FUNC();
     }
-
-    InstanceOdeTrigger::~InstanceOdeTrigger()
+    
+    uint64_t& OdeInstanceTable::Find(uint sourceId, int classId)
     {
-        LOG_FUNC();
+        // Don't log function entry/exit
+        
+        // Keep the load factor at or below 1/2 to keep the probe chains short
+        if ((m_size+1)*2 > m_entries.size())
+        {
+            rebuild(m_entries.size()*2, false, 0);
+        }
+        uint64_t key = packKey(sourceId, classId);
+        uint64_t mask = m_entries.size() - 1;
+        
+        for (uint64_t i = hashKey(key) & mask; ; i = (i+1) & mask)
+        {
+            Entry& entry = m_entries[i];
+            if (!entry.inUse)
+            {
+                entry.key = key;
+                entry.lastInstance = 0;
+                entry.inUse = true;
+                m_size++;
+                return entry.lastInstance;
+            }
+            if (entry.key == key)
+            {
+                return entry.lastInstance;
+            }
+        }
     }
-
-    void InstanceOdeTrigger::Reset()
+    
+    void OdeInstanceTable::EvictSource(uint sourceId)
     {
         LOG_FUNC();
-        {
+        
+        rebuild(m_entries.size(), true, sourceId);
+    }
+    
+    void OdeInstanceTable::Clear()
+    {
+        LOG_FUNC();
+        
+        for (auto& entry: m_entries)
+        {
+            entry.inUse = false;
+        }
+        m_size = 0;
+    }
+    
+    uint OdeInstanceTable::GetSize()
+    {
+        LOG_FUNC();
+        
+        return m_size;
+    }
+    
+    void OdeInstanceTable::rebuild(uint capacity, bool evictSource, uint sourceId)
+    {
+        LOG_FUNC();
+        
+        std::vector<Entry> entries(capacity);
+        entries.swap(m_entries);
+        m_size = 0;
+        
+        for (const auto& entry: entries)
+        {
+            if (entry.inUse and 
+                !(evictSource and (uint)(entry.key >> 32) == sourceId))
+            {
+                Find((uint)(entry.key >> 32), (int)(uint32_t)entry.key) = 
+                    entry.lastInstance;
+            }
+        }
+    }
+
+    // *****************************************************************************
+
+    InstanceOdeTrigger::InstanceOdeTrigger(const char* name, 
+        const char* source, uint classId, uint limit)
+        : OdeTrigger(name, source, classId, limit)
+    {
+        LOG_FUNC();
+    }
+
+    InstanceOdeTrigger::~InstanceOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+
+    void InstanceOdeTrigger::Reset()
+    {
+        LOG_FUNC();
+        {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            m_instances.clear();
+            m_instances.Clear();
+            m_lastFrameNums.clear();
         }
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
     
+    void InstanceOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta)
+    {
+        // Note: function is called from the system (callback) context
+        OdeTrigger::PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        uint sourceId = pFrameMeta->source_id;
+        if (sourceId >= m_lastFrameNums.size())
+        {
+            m_lastFrameNums.resize(sourceId+1, -1);
+        }
+        // A frame number lower than the last for the same source means that
+        // the source was removed and a new stream has been added in its place.
+        if (pFrameMeta->frame_num < m_lastFrameNums[sourceId])
+        {
+            LOG_INFO("Trigger '" << GetName() << "' evicting instances for source_id = "
+                << sourceId);
+            m_instances.EvictSource(sourceId);
+        }
+        m_lastFrameNums[sourceId] = pFrameMeta->frame_num;
+    }
+    
     bool InstanceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,
+        DisplayMetaData& displayMetaData,
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
-        std::string sourceAndClassId = std::to_string(pFrameMeta->source_id) + "_" 
-            + std::to_string(pObjectMeta->class_id);
+        // Last Tracking Id for the source_id-class_id combination, 0 if new.
+        uint64_t& lastInstance = 
+            m_instances.Find(pFrameMeta->source_id, pObjectMeta->class_id);
             
-        // If this is the first time seeing an object of "class_id" for "source_id".
-        if (m_instances.find(sourceAndClassId) == m_instances.end())
-        {
-            // Initialize the frame number for the new source
-            m_instances[sourceAndClassId] = 0;
-        }
-        if (m_instances[sourceAndClassId] < pObjectMeta->object_id)
+        if (lastInstance < pObjectMeta->object_id)
         {
             // Update the running instance
-            m_instances[sourceAndClassId] = pObjectMeta->object_id;
+            lastInstance = pObjectMeta->object_id;
             
             IncrementAndCheckTriggerCount();
             m_occurrences++;
@@ -1095,20 +1622,21 @@ namespace DSL
 
             if (m_pHeatMapper)
             {
-                std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                    pFrameMeta, pObjectMeta);
+                m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+            }
+            if (m_pAccumulator)
+            {
+                m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
             }
 
             // set the primary metric to the new instance occurrence for this frame
             pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &pOdeAction: m_pOdeActionsList)
             {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
                 try
                 {
-                    pOdeAction->HandleOccurrence(shared_from_this(), pBuffer, 
+                    pOdeAction->InvokeOccurrence(m_pSelf, pBuffer, 
                         displayMetaData, pFrameMeta, pObjectMeta);
                 }
                 catch(...)
@@ -1138,28 +1666,257 @@ namespace DSL
     }
     
     bool SummationOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         m_occurrences++;
 
         return true;
     }
 
     uint SummationOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    {
+        // create scope so the property-mutex can be unlocked before
+        // calling the base-class PostProcessFrame which locks the mutex.
+        {
+            // Note: function is called from the system (callback) context
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or 
+                (pCriteria->limit and m_triggered >= pCriteria->limit))
+            {
+                return 0;
+            }
+            // event has been triggered
+            IncrementAndCheckTriggerCount();
+
+             // update the total event count static variable
+            s_eventCount++;
+
+            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
+                DSL_FRAME_INFO_OCCURRENCES;
+            pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
+            for (const auto &pOdeAction: m_pOdeActionsList)
+            {
+                pOdeAction->InvokeOccurrence(m_pSelf, 
+                    pBuffer, displayMetaData, pFrameMeta, NULL);
+            }
+        }
+        // mutex unlocked safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+   }
+
+    // *****************************************************************************
+    
+    ClassCountOdeTrigger::ClassCountOdeTrigger(const char* name, 
+        const char* source, const uint* classIds, uint numClassIds, uint limit)
+        : OdeTrigger(name, source, DSL_ODE_ANY_CLASS, limit)
+        , m_classIndices(DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES, 0)
+        , m_numClassCounts(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_countsMutex);
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        setClassIds(classIds, numClassIds);
+        
+        // Publish the snapshot again with the class-id set.
+        updateCriteria();
+    }
+
+    ClassCountOdeTrigger::~ClassCountOdeTrigger()
+    {
+        LOG_FUNC();
+        
+        g_mutex_clear(&m_countsMutex);
+    }
+    
+    void ClassCountOdeTrigger::GetClassIds(const uint** classIds, uint* numClassIds)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *classIds = m_classIds.data();
+        *numClassIds = m_classIds.size();
+    }
+    
+    bool ClassCountOdeTrigger::SetClassIds(const uint* classIds, uint numClassIds)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (!numClassIds)
+        {
+            LOG_ERROR("At least one class-id is required for Class Count Trigger '" 
+                << GetName() << "'");
+            return false;
+        }
+        for (uint i = 0; i < numClassIds; i++)
+        {
+            if (classIds[i] >= DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES)
+            {
+                LOG_ERROR("Invalid class-id = " << classIds[i] 
+                    << " for Class Count Trigger '" << GetName() << "'");
+                return false;
+            }
+        }
+        setClassIds(classIds, numClassIds);
+        
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
+        
+        return true;
+    }
+    
+    void ClassCountOdeTrigger::setClassIds(const uint* classIds, uint numClassIds)
+    {
+        LOG_FUNC();
+        // internal do not lock m_propertyMutex
+        
+        m_classIdSet.reset();
+        for (uint i = 0; i < numClassIds; i++)
+        {
+            m_classIdSet.set(classIds[i]);
+        }
+        
+        // iterating the set produces the class-ids in ascending order
+        m_classIds.clear();
+        for (uint classId = 0; classId < m_classIdSet.size(); classId++)
+        {
+            if (m_classIdSet.test(classId))
+            {
+                m_classIndices[classId] = m_classIds.size();
+                m_classIds.push_back(classId);
+            }
+        }
+        m_classCounts.assign(m_classIds.size(), 0);
+        
+        LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_countsMutex);
+        
+        // counts for the previous class-ids are meaningless now
+        m_sourceClassCounts.clear();
+        m_numClassCounts = m_classIds.size();
+    }
+    
+    void ClassCountOdeTrigger::GetClassCounts(uint sourceId, 
+        const uint** counts, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_countsMutex);
+        
+        auto imap = m_sourceClassCounts.find(sourceId);
+        if (imap != m_sourceClassCounts.end())
+        {
+            m_outCounts = imap->second;
+        }
+        else
+        {
+            m_outCounts.assign(m_numClassCounts, 0);
+        }
+        *counts = m_outCounts.data();
+        *size = m_outCounts.size();
+    }
+    
+    bool ClassCountOdeTrigger::GetRoutingCriteria(int* sourceId, 
+        std::vector<uint>& classIds)
+    {
+        LOG_FUNC();
+        
+        if (!OdeTrigger::GetRoutingCriteria(sourceId, classIds))
+        {
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // route on all class-ids in the set
+        classIds = m_classIds;
+        return true;
+    }
+    
+    void ClassCountOdeTrigger::copyCriteria(OdeTriggerCriteria* pCriteria)
+    {
+        LOG_FUNC();
+        
+        OdeTrigger::copyCriteria(pCriteria);
+        
+        pCriteria->classIdSet = m_classIdSet;
+    }
+    
+    void ClassCountOdeTrigger::PreProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta)
+    {
+        // Note: function is called from the system (callback) context
+        OdeTrigger::PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        std::fill(m_classCounts.begin(), m_classCounts.end(), 0);
+    }
+    
+    bool ClassCountOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
+        // A single test of the class-id set replaces the class-id filter
+        uint classId(pObjectMeta->class_id);
+        if (classId >= DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES or
+            !pCriteria->classIdSet.test(classId) or
+            !CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta, 
+                DSL_ODE_ANY_CLASS) or 
+            !CheckForInside(pCriteria, pObjectMeta))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // The class-ids may have been updated since the snapshot was read.
+        if (!m_classIdSet.test(classId))
+        {
+            return false;
+        }
+        m_occurrences++;
+        m_classCounts[m_classIndices[classId]]++;
+        
+        if (m_pHeatMapper)
+        {
+            m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+        }
+        if (m_pAccumulator)
+        {
+            m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
+        }
+        return true;
+    }
+
+    uint ClassCountOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1168,7 +1925,23 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame or (m_limit and m_triggered >= m_limit))
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            // Counts are only stored, and Actions invoked, for the frames 
+            // of the Trigger's own source.
+            if (!pCriteria->enabled or m_skipFrame or 
+                !CheckForSourceId(pCriteria, pFrameMeta->source_id))
+            {
+                return 0;
+            }
+            // Save the per-class counts before invoking the actions so 
+            // that they can be queried on invocation.
+            {
+                LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_countsMutex);
+                
+                m_sourceClassCounts[pFrameMeta->source_id] = m_classCounts;
+            }
+            if (pCriteria->limit and m_triggered >= pCriteria->limit)
             {
                 return 0;
             }
@@ -1181,11 +1954,9 @@ namespace DSL
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_ACTIVE_INDEX] = 
                 DSL_FRAME_INFO_OCCURRENCES;
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = m_occurrences;
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &pOdeAction: m_pOdeActionsList)
             {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->InvokeOccurrence(m_pSelf, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1213,22 +1984,23 @@ namespace DSL
     }
     
     bool CustomOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
         // conditional execution
-        if (!m_enabled or 
-            !m_clientChecker or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!m_clientChecker or 
+            !CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         try
         {
             if (!m_clientChecker(pBuffer, pFrameMeta, pObjectMeta, m_clientData))
@@ -1251,22 +2023,23 @@ namespace DSL
 
         if (m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                pFrameMeta, pObjectMeta);
+            m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+        }
+        if (m_pAccumulator)
+        {
+            m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
         }
 
-        for (const auto &imap: m_pOdeActionsIndexed)
+        for (const auto &pOdeAction: m_pOdeActionsList)
         {
-            DSL_ODE_ACTION_PTR pOdeAction = 
-                std::dynamic_pointer_cast<OdeAction>(imap.second);
-            pOdeAction->HandleOccurrence(shared_from_this(), 
+            pOdeAction->InvokeOccurrence(m_pSelf, 
                 pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
         }
         return true;
     }
     
     uint CustomOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1275,8 +2048,10 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // conditional execution
-            if (!m_enabled or m_clientPostProcessor == NULL)
+            if (!pCriteria->enabled or m_clientPostProcessor == NULL)
             {
                 return false;
             }
@@ -1300,11 +2075,9 @@ namespace DSL
              // update the total event count static variable
             s_eventCount++;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &pOdeAction: m_pOdeActionsList)
             {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->InvokeOccurrence(m_pSelf, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1347,32 +2120,37 @@ namespace DSL
     }
     
     bool CountOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         m_occurrences++;
         
         if (m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                pFrameMeta, pObjectMeta);
+            m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+        }
+        if (m_pAccumulator)
+        {
+            m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
         }
         return true;
     }
 
     uint CountOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1381,7 +2159,10 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame or (m_limit and m_triggered >= m_limit) or
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or 
+                (pCriteria->limit and m_triggered >= pCriteria->limit) or
                 (m_occurrences < m_minimum) or (m_occurrences > m_maximum))
             {
                 return 0;
@@ -1392,11 +2173,9 @@ namespace DSL
              // update the total event count static variable
             s_eventCount++;
 
-            for (const auto &imap: m_pOdeActionsIndexed)
+            for (const auto &pOdeAction: m_pOdeActionsList)
             {
-                DSL_ODE_ACTION_PTR pOdeAction = 
-                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                pOdeAction->HandleOccurrence(shared_from_this(), 
+                pOdeAction->InvokeOccurrence(m_pSelf, 
                     pBuffer, displayMetaData, pFrameMeta, NULL);
             }
         }
@@ -1410,6 +2189,8 @@ namespace DSL
     SmallestOdeTrigger::SmallestOdeTrigger(const char* name, 
         const char* source, uint classId, uint limit)
         : OdeTrigger(name, source, classId, limit)
+        , m_pSmallestObjectMeta(NULL)
+        , m_smallestArea(0)
     {
         LOG_FUNC();
     }
@@ -1420,27 +2201,35 @@ namespace DSL
     }
     
     bool SmallestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrenceMetaList.push_back(pObjectMeta);
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
+        // Keep the smallest object as they occur - first one wins on a tie.
+        uint rectArea = pObjectMeta->rect_params.width * 
+            pObjectMeta->rect_params.height;
+        if (!m_pSmallestObjectMeta or rectArea < m_smallestArea)
+        {
+            m_pSmallestObjectMeta = pObjectMeta;
+            m_smallestArea = rectArea;
+        }
         return true;
     }
 
     uint SmallestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1451,8 +2240,10 @@ namespace DSL
             
             m_occurrences = 0;
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // need at least one object for a Minimum event
-            if (m_enabled and m_occurrenceMetaList.size())
+            if (pCriteria->enabled and m_pSmallestObjectMeta)
             {
                 // One occurrence to return and increment the accumulative Trigger count
                 m_occurrences = 1;
@@ -1460,40 +2251,31 @@ namespace DSL
                 // update the total event count static variable
                 s_eventCount++;
 
-                uint smallestArea = UINT32_MAX;
-                NvDsObjectMeta* pSmallestObject(NULL);
-                
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &ivec: m_occurrenceMetaList) 
-                {
-                    uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
-                    if (rectArea < smallestArea) 
-                    { 
-                        smallestArea = rectArea;
-                        pSmallestObject = ivec;    
-                    }
-                }
+                NvDsObjectMeta* pSmallestObject(m_pSmallestObjectMeta);
+                uint smallestArea(m_smallestArea);
                 // conditionally add the 
                 if (m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pSmallestObject);
+                    m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pSmallestObject);
+                }
+                if (m_pAccumulator)
+                {
+                    m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pSmallestObject);
                 }
                 // set the primary metric as the smallest bounding box by area
                 pSmallestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                     = smallestArea;
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: m_pOdeActionsList)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
                     
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
                         pBuffer, displayMetaData, pFrameMeta, pSmallestObject);
                 }
             }   
 
             // reset for next frame
-            m_occurrenceMetaList.clear();
+            m_pSmallestObjectMeta = NULL;
+            m_smallestArea = 0;
         }
         // mutex unlocked - safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer,
@@ -1505,6 +2287,8 @@ namespace DSL
     LargestOdeTrigger::LargestOdeTrigger(const char* name, 
         const char* source, uint classId, uint limit)
         : OdeTrigger(name, source, classId, limit)
+        , m_pLargestObjectMeta(NULL)
+        , m_largestArea(0)
     {
         LOG_FUNC();
     }
@@ -1515,27 +2299,35 @@ namespace DSL
     }
     
     bool LargestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
-        m_occurrenceMetaList.push_back(pObjectMeta);
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
+        // Keep the largest object as they occur - first one wins on a tie.
+        uint rectArea = pObjectMeta->rect_params.width * 
+            pObjectMeta->rect_params.height;
+        if (!m_pLargestObjectMeta or rectArea > m_largestArea)
+        {
+            m_pLargestObjectMeta = pObjectMeta;
+            m_largestArea = rectArea;
+        }
         return true;
     }
 
     uint LargestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1546,8 +2338,10 @@ namespace DSL
             
             m_occurrences = 0;
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // need at least one object for a Minimum event
-            if (m_enabled and m_occurrenceMetaList.size())
+            if (pCriteria->enabled and m_pLargestObjectMeta)
             {
                 // Once occurrence to return and increment the accumulative Trigger count
                 m_occurrences = 1;
@@ -1555,43 +2349,34 @@ namespace DSL
                 // update the total event count static variable
                 s_eventCount++;
 
-                uint largestArea = 0;
-                NvDsObjectMeta* pLargestObject(NULL);
-                
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &ivec: m_occurrenceMetaList) 
-                {
-                    uint rectArea = ivec->rect_params.width * ivec->rect_params.height;
-                    if (rectArea > largestArea) 
-                    { 
-                        largestArea = rectArea;
-                        pLargestObject = ivec;    
-                    }
-                }
+                NvDsObjectMeta* pLargestObject(m_pLargestObjectMeta);
+                uint largestArea(m_largestArea);
 
                 // If the client has added a heat mapper, call to add-occurrence
                 if (m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pLargestObject);
+                    m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pLargestObject);
+                }
+                if (m_pAccumulator)
+                {
+                    m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pLargestObject);
                 }
                 
                 // set the primary metric as the larget area
                 pLargestObject->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
                     = largestArea;
                 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: m_pOdeActionsList)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
                     
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
                         pBuffer, displayMetaData, pFrameMeta, pLargestObject);
                 }
             }   
 
             // reset for next frame
-            m_occurrenceMetaList.clear();
+            m_pLargestObjectMeta = NULL;
+            m_largestArea = 0;
         }
         // mutex unlocked  - safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer,
@@ -1628,28 +2413,29 @@ namespace DSL
     }
     
     bool NewLowOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         m_occurrences++;
         
         return true;
     }
 
     uint NewLowOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1658,7 +2444,9 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame)
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame)
             {
                 return 0;
             }
@@ -1680,11 +2468,9 @@ namespace DSL
                 pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
                     m_occurrences;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: m_pOdeActionsList)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
                         pBuffer, displayMetaData, pFrameMeta, NULL);
                 }
                 // new high m_occurrences means ODE occurrence = 1
@@ -1731,28 +2517,29 @@ namespace DSL
     }
     
     bool NewHighOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_enabled or 
-            !CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
         
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
         m_occurrences++;
         
         return true;
     }
 
     uint NewHighOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -1761,7 +2548,9 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame)
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame)
             {
                 return 0;
             }
@@ -1783,11 +2572,9 @@ namespace DSL
                 pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES] = 
                     m_occurrences;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: m_pOdeActionsList)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
                         pBuffer, displayMetaData, pFrameMeta, NULL);
                 }
                 // new high m_occurrences means ODE occurrence = 1
@@ -1833,6 +2620,22 @@ namespace DSL
         // call the base class to complete the Reset
         OdeTrigger::Reset();
     }
+    
+    uint TrackingOdeTrigger::GetMissTolerance()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        return m_pTrackedObjectsPerSource->GetMissTolerance();
+    }
+    
+    void TrackingOdeTrigger::SetMissTolerance(uint missTolerance)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_pTrackedObjectsPerSource->SetMissTolerance(missTolerance);
+    }
    
     // *****************************************************************************
     
@@ -1860,14 +2663,14 @@ namespace DSL
     }
 
     bool CrossOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!m_pOdeAreasIndexed.size())
+        if (!pCriteria->pOdeAreasList.size())
         {
             LOG_ERROR("At least one OdeArea is required for CrossOdeTrigger '" 
                 << GetName() << "'");
@@ -1875,11 +2678,13 @@ namespace DSL
         }
 
         // Check for minimum criteria - but not for within an Area. 
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta))
         {
             return false;
         }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
         // if this is the first occurrence of this object for this source
         if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
@@ -1896,18 +2701,17 @@ namespace DSL
         }
 
         // Else, get the tracked object and update with current frame meta
-        std::shared_ptr<TrackedObject> pTrackedObject = 
+        TrackedObject* pTrackedObject = 
             m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
                 pObjectMeta->object_id);
                 
         pTrackedObject->Update(pFrameMeta->frame_num, 
+            m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta),
             (NvBbox_Coords*)&pObjectMeta->rect_params);
             
         // Iterate through the map of 1 or more Areas to test for line cross
-        for (const auto &imap: m_pOdeAreasIndexed)
+        for (const auto &pOdeArea: pCriteria->pOdeAreasList)
         {
-            DSL_ODE_AREA_PTR pOdeArea = 
-                std::dynamic_pointer_cast<OdeArea>(imap.second);
                 
             uint testPoint = pOdeArea->GetBboxTestPoint();
                 
@@ -1933,13 +2737,14 @@ namespace DSL
                 return false;
             }
             
-            // Get the trace vector for the testpoint defined for this Area
-            DSL_RGBA_MULTI_LINE_PTR pTrace = 
-                pTrackedObject->GetTrace(testPoint, m_testMethod, m_traceLineWidth);
-
-            // If the client has enabled object tracing
+            // If the client has enabled object tracing - the only case that
+            // requires the full trace to be materialized.
             if (m_traceEnabled)
             {
+                DSL_RGBA_MULTI_LINE_PTR pTrace = 
+                    pTrackedObject->GetTrace(testPoint, m_testMethod, 
+                        m_traceLineWidth);
+
                 // If the object has a previous trace from a line cross event.
                 if (pTrackedObject->HasPreviousTrace())
                 {
@@ -1959,10 +2764,39 @@ namespace DSL
             }
             
             uint direction;
+            bool crossed(false);
+
+            // End-points are tested as a single segment from first to last,
+            // without state, as the trace between them is not considered.
+            if (m_testMethod == DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS)
+            {
+                TrackedObjectCrossState crossState{pOdeArea, 
+                    DSL_AREA_POINT_LOCATION_ON_LINE, false};
+                    
+                crossed = pOdeArea->DoesSegmentCrossLine(firstCoordinate, 
+                    lastCoordinate, crossState, direction);
+            }
+            // Else, test only the newest segment of the trace, with the 
+            // object's per-area state maintained since the start of the trace.
+            else
+            {
+                TrackedObjectCrossState& crossState = 
+                    pTrackedObject->GetCrossState(pOdeArea);
+                    
+                // The side of the trace is established with its first point.
+                if (crossState.side == DSL_AREA_POINT_LOCATION_ON_LINE)
+                {
+                    crossState.side = pOdeArea->GetPointLocation(firstCoordinate);
+                }
+                dsl_coordinate segmentStart, segmentEnd;
+                pTrackedObject->GetLastSegment(testPoint, segmentStart, segmentEnd);
+                
+                crossed = pOdeArea->DoesSegmentCrossLine(segmentStart, 
+                    segmentEnd, crossState, direction);
+            }
 
             // Check of the trace has crossed the area
-            if (pOdeArea->DoesTraceCrossLine(pTrace->coordinates, 
-                pTrace->num_coordinates, direction))
+            if (crossed)
             {
                 // If we've crosed before reaching the minimum frame count
                 if (pTrackedObject->preEventFrameCount < m_minFrameCount)
@@ -1998,8 +2832,11 @@ namespace DSL
                 // If the client has added a heat mapper, call to add the occurrence data
                 if (m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pObjectMeta);
+                    m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+                }
+                if (m_pAccumulator)
+                {
+                    m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
                 }
 
                 // add the persistence value to the array of misc_obj_info
@@ -2011,11 +2848,9 @@ namespace DSL
                 pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
                     (uint64_t)(pTrackedObject->GetDurationMs());
                     
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: m_pOdeActionsList)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
 
@@ -2031,14 +2866,16 @@ namespace DSL
     }
 
     uint CrossOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // Note: function is called from the system (callback) context
         // Gaurd against property updates from the client API
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
         // Filter on skip-frame interval
-        if (!m_enabled or m_skipFrame)
+        if (!pCriteria->enabled or m_skipFrame)
         {
             return 0;
         }
@@ -2047,8 +2884,7 @@ namespace DSL
         // the base/super class PostProcessFrame is not called .
         if (m_pHeatMapper)
         {
-            std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->AddDisplayMeta(
-                displayMetaData);
+            m_pOdeHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
         }
 
         // If the client has added an accumulator, 
@@ -2068,18 +2904,18 @@ namespace DSL
             pFrameMeta->misc_frame_info[DSL_FRAME_INFO_OCCURRENCES_DIRECTION_OUT] = 
                 m_occurrencesOutAccumulated;
                 
-            DSL_ODE_ACCUMULATOR_PTR pOdeAccumulator = 
-                std::dynamic_pointer_cast<OdeAccumulator>(m_pAccumulator);
-                
-            pOdeAccumulator->HandleOccurrences(shared_from_this(),
-                pBuffer, displayMetaData, pFrameMeta);
+            m_pOdeAccumulator->HandleOccurrences(m_pSelf,
+                pBuffer, displayMetaData, pFrameMeta, 
+                m_occurrencesIn + m_occurrencesOut);
         }
         // clear the occurrence counters 
         m_occurrencesIn = 0;
         m_occurrencesOut = 0;
 
-        // purge all tracked objects, for all sources that are not in the current frame.
-        m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+        // purge all tracked objects for this source that have exceeded the 
+        // miss tolerance.
+        m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+            pFrameMeta->frame_num);
         
         return m_occurrences;
     }
@@ -2177,19 +3013,21 @@ namespace DSL
     }
     
     bool PersistenceOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
         {
             return false;
         }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
 
         // if this is the first occurrence of any object for this source
         if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
@@ -2201,11 +3039,12 @@ namespace DSL
         }
         else
         {
-            std::shared_ptr<TrackedObject> pTrackedObject = 
+            TrackedObject* pTrackedObject = 
                 m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
+                m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta),
                 (NvBbox_Coords*)&pObjectMeta->rect_params);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
@@ -2227,8 +3066,11 @@ namespace DSL
                 // If the client has added a heat mapper, call to add the occurrence data
                 if (m_pHeatMapper)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, pObjectMeta);
+                    m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+                }
+                if (m_pAccumulator)
+                {
+                    m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
                 }
 
                 // add the persistence value to the array of misc_obj_info
@@ -2237,11 +3079,9 @@ namespace DSL
                 pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
                     (uint64_t)(trackedTimeMs/1000);
                     
-                for (const auto &imap: m_pOdeActionsIndexed)
+                for (const auto &pOdeAction: m_pOdeActionsList)
                 {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
                         pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
                 }
             }
@@ -2250,7 +3090,7 @@ namespace DSL
     }
 
     uint PersistenceOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2259,12 +3099,16 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
             {
                 return 0;
             }
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+            // purge all tracked objects for this source that have exceeded the 
+            // miss tolerance.
+            m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+                pFrameMeta->frame_num);
         }
         // mutext unlocked - safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer,
@@ -2273,64 +3117,222 @@ namespace DSL
 
     // *****************************************************************************
     
-    LatestOdeTrigger::LatestOdeTrigger(const char* name, const char* source, 
-        uint classId, uint limit)
+    DwellOdeTrigger::DwellOdeTrigger(const char* name, 
+        const char* source, uint classId, uint limit, uint threshold)
         : TrackingOdeTrigger(name, source, classId, limit, 0)
-        , m_pLatestObjectMeta(NULL)
-        , m_latestTrackedTimeMs(0)
+        , m_thresholdMs(threshold*1000.0)
     {
         LOG_FUNC();
+        
+        g_mutex_init(&m_occupancyMutex);
+        
+        // Notified on purge so the occupancy can be updated for objects
+        // that are no longer detected while inside an Area.
+        m_pTrackedObjectsPerSource->SetRemoveListener(
+            DwellTrackedObjectRemoveListener, this);
     }
 
-    LatestOdeTrigger::~LatestOdeTrigger()
+    DwellOdeTrigger::~DwellOdeTrigger()
+    {
+        LOG_FUNC();
+        
+        m_pTrackedObjectsPerSource->SetRemoveListener(NULL, NULL);
+        
+        g_mutex_clear(&m_occupancyMutex);
+    }
+
+    uint DwellOdeTrigger::GetThreshold()
     {
         LOG_FUNC();
+        
+        return m_thresholdMs/1000;
     }
 
-    bool LatestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+    void DwellOdeTrigger::SetThreshold(uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_thresholdMs = threshold*1000.0;
+    }
+    
+    bool DwellOdeTrigger::GetOccupancy(DSL_BASE_PTR pArea, uint* occupancy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_occupancyMutex);
+        
+        for (uint i = 0; i < m_dwellAreas.size(); i++)
+        {
+            if (m_dwellAreas[i] == pArea.get())
+            {
+                *occupancy = m_occupancy[i];
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    void DwellOdeTrigger::Reset()
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_occupancyMutex);
+            
+            // The tracked objects and occupancy counts must be cleared 
+            // together, or the counts would no longer match the objects.
+            m_pTrackedObjectsPerSource->Clear();
+            m_occupancy.assign(m_occupancy.size(), 0);
+        }
+        // tracked objects cleared - call the base OdeTrigger to complete
+        OdeTrigger::Reset();
+    }
+    
+    void DwellOdeTrigger::copyCriteria(OdeTriggerCriteria* pCriteria)
+    {
+        LOG_FUNC();
+        
+        OdeTrigger::copyCriteria(pCriteria);
+        
+        if (m_dwellAreas == m_pOdeAreasList)
+        {
+            return;
+        }
+        // The Areas have changed. The area states of the tracked objects 
+        // are indexed by Area, so all tracking starts over.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_occupancyMutex);
+        
+        m_pTrackedObjectsPerSource->Clear();
+        
+        m_dwellAreas = m_pOdeAreasList;
+        m_occupancy.assign(m_dwellAreas.size(), 0);
+        m_areaExclusions.clear();
+        for (const auto &pOdeArea: m_dwellAreas)
+        {
+            m_areaExclusions.push_back(pOdeArea->IsType(typeid(OdeExclusionArea)));
+        }
+    }
+    
+    bool DwellOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or !CheckForInside(pObjectMeta))
+        if (!pCriteria->pOdeAreasList.size())
         {
+            LOG_ERROR("At least one OdeArea is required for DwellOdeTrigger '" 
+                << GetName() << "'");
             return false;
         }
 
-        // if this is the first occurrence of any object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id))
+        // Check for minimum criteria - but not for within an Area. 
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta))
         {
-            // Create a new Tracked object and return without occurence
-            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        double frameTimeMs = m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta);
+
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                pObjectMeta->object_id);
+                
+        // if this is the first occurrence of this object for this source
+        if (!pTrackedObject)
+        {
+            pTrackedObject = m_pTrackedObjectsPerSource->Track(pFrameMeta, 
                 pObjectMeta, nullptr);
         }
         else
         {
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
-                    pObjectMeta->object_id);
-                    
-            pTrackedObject->Update(pFrameMeta->frame_num, 
+            pTrackedObject->Update(pFrameMeta->frame_num, frameTimeMs,
                 (NvBbox_Coords*)&pObjectMeta->rect_params);
-
-            double trackedTimeMs = pTrackedObject->GetDurationMs();
+        }
+        
+        bool occurrence(false);
+        
+        // Test each Area against the object's last known state for that Area,
+        // i.e. constant work per object per Area, per frame. 
+        for (uint i = 0; i < m_dwellAreas.size(); i++)
+        {
+            TrackedObjectAreaState& areaState = pTrackedObject->GetAreaState(i);
             
-            if ((m_pLatestObjectMeta == NULL) or (trackedTimeMs < m_latestTrackedTimeMs))
+            bool inside = (m_dwellAreas[i]->IsBboxInside(pObjectMeta->rect_params)
+                != m_areaExclusions[i]);
+                
+            // update the Area's occupancy only as the object enters or leaves.
+            if (inside != areaState.inside)
             {
-                m_pLatestObjectMeta = pObjectMeta;
-                m_latestTrackedTimeMs = trackedTimeMs;
+                LOCK_2ND_MUTEX_FOR_CURRENT_SCOPE(&m_occupancyMutex);
+                
+                areaState.inside = inside;
+                if (inside)
+                {
+                    areaState.entryTimeMs = frameTimeMs;
+                    areaState.occurred = false;
+                    m_occupancy[i]++;
+                }
+                else
+                {
+                    m_occupancy[i]--;
+                }
+            }
+            if (!inside or areaState.occurred)
+            {
+                continue;
+            }
+            
+            double dwellTimeMs = (frameTimeMs > areaState.entryTimeMs)
+                ? frameTimeMs - areaState.entryTimeMs : 0;
+                
+            if (dwellTimeMs < m_thresholdMs or 
+                (pCriteria->limit and m_triggered >= pCriteria->limit))
+            {
+                continue;
+            }
+            
+            // one occurrence per object visit to the Area.
+            areaState.occurred = true;
+            occurrence = true;
+            
+            // event has been triggered
+            IncrementAndCheckTriggerCount();
+            m_occurrences++;
+
+            // update the total event count static variable
+            s_eventCount++;
+
+            // If the client has added a heat mapper, call to add the occurrence data
+            if (m_pHeatMapper)
+            {
+                m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+            }
+            if (m_pAccumulator)
+            {
+                m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
+            }
+
+            // set the primary metric as the dwell time in seconds
+            pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                (uint64_t)(dwellTimeMs/1000);
+                
+            for (const auto &pOdeAction: m_pOdeActionsList)
+            {
+                pOdeAction->InvokeOccurrence(m_pSelf, 
+                    pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
             }
         }
-        return true;
+        return occurrence;
     }
-    
-    uint LatestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+
+    uint DwellOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2339,100 +3341,497 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
             {
                 return 0;
             }
+            // purge all tracked objects for this source that have exceeded the 
+            // miss tolerance - the occupancy is updated by the remove listener.
+            m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+                pFrameMeta->frame_num);
+        }
+        // mutext unlocked - safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+    }
+    
+    void DwellOdeTrigger::HandleTrackedObjectRemove(TrackedObject* pTrackedObject)
+    {
+        // Note: called with the property mutex held. 
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_occupancyMutex);
+        
+        const std::vector<TrackedObjectAreaState>& areaStates = 
+            pTrackedObject->GetAreaStates();
             
-            // If we a Latest Object ODE 
-            if (m_pLatestObjectMeta != NULL)
+        for (uint i = 0; i < areaStates.size() and i < m_occupancy.size(); i++)
+        {
+            if (areaStates[i].inside)
             {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
-
-                // update the total event count static variable
-                s_eventCount++;
-
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
-                {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pLatestObjectMeta);
-                }
-                
-                // add the persistence value to the array of misc_obj_info
-                // as both the Primary and Persistence specific indecies.
-                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
-                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
-                    (uint64_t)(m_latestTrackedTimeMs/1000);
-
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, m_pLatestObjectMeta);
-                }
-            
-                // clear the Newest Object data for the next frame 
-                m_pLatestObjectMeta = NULL;
-                m_latestTrackedTimeMs = 0;
+                m_occupancy[i]--;
             }
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
         }
-        // mutex unlocked - safe to call base class
-        return OdeTrigger::PostProcessFrame(pBuffer,
-            displayMetaData, pFrameMeta);
+    }
+    
+    static void DwellTrackedObjectRemoveListener(
+        TrackedObject* pTrackedObject, void* pTrigger)
+    {
+        static_cast<DwellOdeTrigger*>(pTrigger)->
+            HandleTrackedObjectRemove(pTrackedObject);
     }
 
     // *****************************************************************************
     
-    EarliestOdeTrigger::EarliestOdeTrigger(const char* name, const char* source, 
-        uint classId, uint limit)
+    VelocityOdeTrigger::VelocityOdeTrigger(const char* name, 
+        const char* source, uint classId, uint limit, double minimum, 
+        double maximum)
         : TrackingOdeTrigger(name, source, classId, limit, 0)
-        , m_pEarliestObjectMeta(NULL)
-        , m_earliestTrackedTimeMs(0)
+        , m_minimumSpeed(minimum)
+        , m_maximumSpeed(maximum)
+        , m_minimumHeading(0)
+        , m_maximumHeading(360)
     {
         LOG_FUNC();
     }
 
-    EarliestOdeTrigger::~EarliestOdeTrigger()
+    VelocityOdeTrigger::~VelocityOdeTrigger()
     {
         LOG_FUNC();
     }
 
-    bool EarliestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
-        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    void VelocityOdeTrigger::GetSpeedRange(double* minimum, double* maximum)
     {
-        // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
+        LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        if (!CheckForSourceId(pFrameMeta->source_id) or 
-            !CheckForMinCriteria(pFrameMeta, pObjectMeta) or 
-            !CheckForInside(pObjectMeta))
-        {
-            return false;
-        }
+        *minimum = m_minimumSpeed;
+        *maximum = m_maximumSpeed;
+    }
 
-        // if this is the first occurrence of any object for this source
-        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
-            pObjectMeta->object_id)) 
-        {
-            // Create a new Tracked object and return without occurence
-            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
-                pObjectMeta, nullptr);
-        }
-        else
-        {
-            std::shared_ptr<TrackedObject> pTrackedObject = 
-                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+    void VelocityOdeTrigger::SetSpeedRange(double minimum, double maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_minimumSpeed = minimum;
+        m_maximumSpeed = maximum;
+    }
+    
+    void VelocityOdeTrigger::GetHeadingRange(uint* minimum, uint* maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *minimum = m_minimumHeading;
+        *maximum = m_maximumHeading;
+    }
+
+    void VelocityOdeTrigger::SetHeadingRange(uint minimum, uint maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_minimumHeading = minimum;
+        m_maximumHeading = maximum;
+    }
+    
+    bool VelocityOdeTrigger::SetHomography(uint sourceId, const double* homography)
+    {
+        LOG_FUNC();
+        
+        for (uint i = 0; i < 9; i++)
+        {
+            if (!std::isfinite(homography[i]))
+            {
+                LOG_ERROR("Homography value " << homography[i] 
+                    << " is not finite for VelocityOdeTrigger '" << GetName() << "'");
+                return false;
+            }
+        }
+        const double* h = homography;
+        double determinant = h[0]*(h[4]*h[8] - h[5]*h[7]) 
+            - h[1]*(h[3]*h[8] - h[5]*h[6]) + h[2]*(h[3]*h[7] - h[4]*h[6]);
+        if (determinant == 0)
+        {
+            LOG_ERROR("Homography is not invertible for VelocityOdeTrigger '" 
+                << GetName() << "'");
+            return false;
+        }
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (sourceId >= m_homographies.size())
+        {
+            m_homographies.resize(sourceId + 1, Homography{{0}, false});
+        }
+        std::copy(homography, homography + 9, m_homographies[sourceId].matrix);
+        m_homographies[sourceId].enabled = true;
+        
+        // positions of the objects tracked so far are in the wrong units.
+        m_pTrackedObjectsPerSource->Clear();
+        
+        return true;
+    }
+    
+    bool VelocityOdeTrigger::RemoveHomography(uint sourceId)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        if (sourceId >= m_homographies.size() or 
+            !m_homographies[sourceId].enabled)
+        {
+            return false;
+        }
+        m_homographies[sourceId].enabled = false;
+        
+        // positions of the objects tracked so far are in the wrong units.
+        m_pTrackedObjectsPerSource->Clear();
+        
+        return true;
+    }
+    
+    bool VelocityOdeTrigger::transformPosition(uint sourceId, double& x, double& y)
+    {
+        // No function log - avoid overhead.
+        
+        if (sourceId >= m_homographies.size() or 
+            !m_homographies[sourceId].enabled)
+        {
+            return true;
+        }
+        const double* h = m_homographies[sourceId].matrix;
+        
+        double w = h[6]*x + h[7]*y + h[8];
+        if (fabs(w) < 1e-12)
+        {
+            return false;
+        }
+        double transformedX = (h[0]*x + h[1]*y + h[2])/w;
+        double transformedY = (h[3]*x + h[4]*y + h[5])/w;
+        
+        x = transformedX;
+        y = transformedY;
+        return true;
+    }
+    
+    bool VelocityOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        double frameTimeMs = m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta);
+
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                pObjectMeta->object_id);
+                
+        // if this is the first occurrence of this object for this source
+        if (!pTrackedObject)
+        {
+            pTrackedObject = m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+                pObjectMeta, nullptr);
+        }
+        else
+        {
+            pTrackedObject->Update(pFrameMeta->frame_num, frameTimeMs,
+                (NvBbox_Coords*)&pObjectMeta->rect_params);
+        }
+        
+        // The bottom-center of the bbox is used as the object's position - 
+        // the point on the ground plane for a typical camera view.
+        double x = pObjectMeta->rect_params.left + pObjectMeta->rect_params.width/2;
+        double y = pObjectMeta->rect_params.top + pObjectMeta->rect_params.height;
+        
+        if (!transformPosition(pFrameMeta->source_id, x, y))
+        {
+            return false;
+        }
+        const TrackedObjectMotionState& motionState = 
+            pTrackedObject->UpdateMotion(x, y, frameTimeMs, 
+                DSL_ODE_TRIGGER_VELOCITY_SMOOTHING);
+            
+        // velocity is unknown until the object has two positions.
+        if (motionState.updates < 2)
+        {
+            return false;
+        }
+        
+        double speed = sqrt(motionState.velocityX*motionState.velocityX +
+            motionState.velocityY*motionState.velocityY);
+            
+        if (speed < m_minimumSpeed or (m_maximumSpeed and speed > m_maximumSpeed))
+        {
+            return false;
+        }
+        
+        // heading in degrees, clockwise from the positive x-axis as y is down.
+        double heading = atan2(motionState.velocityY, 
+            motionState.velocityX)*180/M_PI;
+        if (heading < 0)
+        {
+            heading += 360;
+        }
+        
+        // A stationary object has no heading, so it can only be within the
+        // full range.
+        if (m_minimumHeading != 0 or m_maximumHeading != 360)
+        {
+            bool withinRange = (m_minimumHeading <= m_maximumHeading)
+                ? (heading >= m_minimumHeading and heading <= m_maximumHeading)
+                : (heading >= m_minimumHeading or heading <= m_maximumHeading);
+                
+            if (!speed or !withinRange)
+            {
+                return false;
+            }
+        }
+        
+        // event has been triggered
+        IncrementAndCheckTriggerCount();
+        m_occurrences++;
+
+        // update the total event count static variable
+        s_eventCount++;
+
+        // If the client has added a heat mapper, call to add the occurrence data
+        if (m_pHeatMapper)
+        {
+            m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, pObjectMeta);
+        }
+        if (m_pAccumulator)
+        {
+            m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, pObjectMeta);
+        }
+
+        // set the primary metric as the scaled speed, so that speeds below one
+        // unit per second are not lost, and add the heading
+        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+            (uint64_t)round(speed*DSL_ODE_TRIGGER_VELOCITY_METRIC_SCALE);
+        pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_HEADING] = 
+            (uint64_t)round(heading) % 360;
+            
+        for (const auto &pOdeAction: m_pOdeActionsList)
+        {
+            pOdeAction->InvokeOccurrence(m_pSelf, 
+                pBuffer, displayMetaData, pFrameMeta, pObjectMeta);
+        }
+        return true;
+    }
+
+    uint VelocityOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    {
+        // create scope so the property-mutex can be unlocked before
+        // calling the base-class PostProcessFrame which locks the mutex.
+        {
+            // Note: function is called from the system (callback) context
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
+            {
+                return 0;
+            }
+            // purge all tracked objects for this source that have exceeded the 
+            // miss tolerance.
+            m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+                pFrameMeta->frame_num);
+        }
+        // mutext unlocked - safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+    }
+
+    // *****************************************************************************
+    
+    LatestOdeTrigger::LatestOdeTrigger(const char* name, const char* source, 
+        uint classId, uint limit)
+        : TrackingOdeTrigger(name, source, classId, limit, 0)
+        , m_pLatestObjectMeta(NULL)
+        , m_latestTrackedTimeMs(0)
+    {
+        LOG_FUNC();
+    }
+
+    LatestOdeTrigger::~LatestOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+
+    bool LatestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        // if this is the first occurrence of any object for this source
+        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+            pObjectMeta->object_id))
+        {
+            // Create a new Tracked object and return without occurence
+            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+                pObjectMeta, nullptr);
+        }
+        else
+        {
+            TrackedObject* pTrackedObject = 
+                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                    pObjectMeta->object_id);
+                    
+            pTrackedObject->Update(pFrameMeta->frame_num, 
+                m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta),
+                (NvBbox_Coords*)&pObjectMeta->rect_params);
+
+            double trackedTimeMs = pTrackedObject->GetDurationMs();
+            
+            if ((m_pLatestObjectMeta == NULL) or (trackedTimeMs < m_latestTrackedTimeMs))
+            {
+                m_pLatestObjectMeta = pObjectMeta;
+                m_latestTrackedTimeMs = trackedTimeMs;
+            }
+        }
+        return true;
+    }
+    
+    uint LatestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    {
+        // create scope so the property-mutex can be unlocked before
+        // calling the base-class PostProcessFrame which locks the mutex.
+        {
+            // Note: function is called from the system (callback) context
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
+            {
+                return 0;
+            }
+            
+            // If we a Latest Object ODE 
+            if (m_pLatestObjectMeta != NULL)
+            {
+                // event has been triggered
+                IncrementAndCheckTriggerCount();
+                m_occurrences++;
+
+                // update the total event count static variable
+                s_eventCount++;
+
+                // If the client has added a heat mapper, call to add the occurrence data
+                if (m_pHeatMapper)
+                {
+                    m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, m_pLatestObjectMeta);
+                }
+                if (m_pAccumulator)
+                {
+                    m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, m_pLatestObjectMeta);
+                }
+                
+                // add the persistence value to the array of misc_obj_info
+                // as both the Primary and Persistence specific indecies.
+                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
+                m_pLatestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                    (uint64_t)(m_latestTrackedTimeMs/1000);
+
+                for (const auto &pOdeAction: m_pOdeActionsList)
+                {
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
+                        pBuffer, displayMetaData, pFrameMeta, m_pLatestObjectMeta);
+                }
+            
+                // clear the Newest Object data for the next frame 
+                m_pLatestObjectMeta = NULL;
+                m_latestTrackedTimeMs = 0;
+            }
+            // purge all tracked objects for this source that have exceeded the 
+            // miss tolerance.
+            m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+                pFrameMeta->frame_num);
+        }
+        // mutex unlocked - safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+    }
+
+    // *****************************************************************************
+    
+    EarliestOdeTrigger::EarliestOdeTrigger(const char* name, const char* source, 
+        uint classId, uint limit)
+        : TrackingOdeTrigger(name, source, classId, limit, 0)
+        , m_pEarliestObjectMeta(NULL)
+        , m_earliestTrackedTimeMs(0)
+    {
+        LOG_FUNC();
+    }
+
+    EarliestOdeTrigger::~EarliestOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+
+    bool EarliestOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+
+        // if this is the first occurrence of any object for this source
+        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+            pObjectMeta->object_id)) 
+        {
+            // Create a new Tracked object and return without occurence
+            m_pTrackedObjectsPerSource->Track(pFrameMeta, 
+                pObjectMeta, nullptr);
+        }
+        else
+        {
+            TrackedObject* pTrackedObject = 
+                m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
                     pObjectMeta->object_id);
                     
             pTrackedObject->Update(pFrameMeta->frame_num, 
+                m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta),
                 (NvBbox_Coords*)&pObjectMeta->rect_params);
 
             double trackedTimeMs = pTrackedObject->GetDurationMs();
@@ -2443,13 +3842,202 @@ namespace DSL
                 m_pEarliestObjectMeta = pObjectMeta;
                 m_earliestTrackedTimeMs = trackedTimeMs;
                 
-            }
+            }
+        }
+        return true;
+    }
+    
+    uint EarliestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    {
+        // create scope so the property-mutex can be unlocked before
+        // calling the base-class PostProcessFrame which locks the mutex.
+        {
+            // Note: function is called from the system (callback) context
+            // Gaurd against property updates from the client API
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+            
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (!pCriteria->enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
+            {
+                return 0;
+            }
+            
+            if (m_pEarliestObjectMeta != NULL)
+            {
+                // event has been triggered
+                IncrementAndCheckTriggerCount();
+                m_occurrences++;
+
+                // update the total event count static variable
+                s_eventCount++;
+
+                // If the client has added a heat mapper, call to add the occurrence data
+                if (m_pHeatMapper)
+                {
+                    m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, m_pEarliestObjectMeta);
+                }
+                if (m_pAccumulator)
+                {
+                    m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, m_pEarliestObjectMeta);
+                }
+
+                // add the persistence value to the array of misc_obj_info
+                // as both the Primary and Persistence specific indecies.
+                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
+                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                    (uint64_t)(m_earliestTrackedTimeMs/1000);
+
+                for (const auto &pOdeAction: m_pOdeActionsList)
+                {
+                    pOdeAction->InvokeOccurrence(m_pSelf, 
+                        pBuffer, displayMetaData, pFrameMeta, m_pEarliestObjectMeta);
+                }
+            
+                // clear the Earliest Object data for the next frame 
+                m_pEarliestObjectMeta = NULL;
+                m_earliestTrackedTimeMs = 0;
+            }
+            
+            // purge all tracked objects for this source that have exceeded the 
+            // miss tolerance.
+            m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+                pFrameMeta->frame_num);
+        }
+        // mutex unlocked - safe to call base class
+        return OdeTrigger::PostProcessFrame(pBuffer,
+            displayMetaData, pFrameMeta);
+    }
+
+    // *****************************************************************************
+
+    TopKOdeTrigger::TopKOdeTrigger(const char* name, const char* source, 
+        uint classId, uint limit, uint k, uint key, uint order)
+        : TrackingOdeTrigger(name, source, classId, limit, 0)
+        , m_k(k)
+        , m_key(key)
+        , m_order(order)
+        , m_sequence(0)
+    {
+        LOG_FUNC();
+        
+        m_topKHeap.reserve(m_k);
+    }
+
+    TopKOdeTrigger::~TopKOdeTrigger()
+    {
+        LOG_FUNC();
+    }
+
+    void TopKOdeTrigger::GetSettings(uint* k, uint* key, uint* order)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        *k = m_k;
+        *key = m_key;
+        *order = m_order;
+    }
+
+    void TopKOdeTrigger::SetSettings(uint k, uint key, uint order)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // Objects are only tracked while ranking by dwell time
+        if (m_key == DSL_ODE_TRIGGER_TOP_K_KEY_DWELL and 
+            key != DSL_ODE_TRIGGER_TOP_K_KEY_DWELL)
+        {
+            m_pTrackedObjectsPerSource->Clear();
+        }
+        m_k = k;
+        m_key = key;
+        m_order = order;
+        
+        // The heap is ordered by the previous settings.
+        m_topKHeap.clear();
+        m_topKHeap.reserve(m_k);
+        m_sequence = 0;
+    }
+
+    double TopKOdeTrigger::getKey(NvDsFrameMeta* pFrameMeta, 
+        NvDsObjectMeta* pObjectMeta)
+    {
+        // Don't log function entry/exit
+        switch (m_key)
+        {
+        case DSL_ODE_TRIGGER_TOP_K_KEY_AREA :
+            return pObjectMeta->rect_params.width * pObjectMeta->rect_params.height;
+        case DSL_ODE_TRIGGER_TOP_K_KEY_CONFIDENCE :
+            return pObjectMeta->confidence;
+        case DSL_ODE_TRIGGER_TOP_K_KEY_TRACKER_CONFIDENCE :
+            return pObjectMeta->tracker_confidence;
+        case DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y :
+            return pObjectMeta->rect_params.top + pObjectMeta->rect_params.height;
+        default :
+            break;
+        }
+        
+        // DSL_ODE_TRIGGER_TOP_K_KEY_DWELL - new objects have no dwell time yet.
+        if (!m_pTrackedObjectsPerSource->IsTracked(pFrameMeta->source_id,
+            pObjectMeta->object_id)) 
+        {
+            m_pTrackedObjectsPerSource->Track(pFrameMeta, pObjectMeta, nullptr);
+            return 0;
+        }
+        TrackedObject* pTrackedObject = 
+            m_pTrackedObjectsPerSource->GetObject(pFrameMeta->source_id,
+                pObjectMeta->object_id);
+                
+        pTrackedObject->Update(pFrameMeta->frame_num, 
+            m_pTrackedObjectsPerSource->GetFrameTimeMs(pFrameMeta),
+            (NvBbox_Coords*)&pObjectMeta->rect_params);
+
+        return pTrackedObject->GetDurationMs();
+    }
+
+    bool TopKOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, 
+        NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
+    {
+        // Note: function is called from the system (callback) context
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
+        if (!CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta) or 
+            !CheckForInside(pCriteria, pObjectMeta))
+        {
+            return false;
+        }
+        
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        auto ranksAheadOf = [this](const TopKEntry& a, const TopKEntry& b)
+            {return ranksAhead(a, b);};
+        
+        TopKEntry entry{getKey(pFrameMeta, pObjectMeta), m_sequence++, pObjectMeta};
+
+        // The front of the heap is the lowest ranked of the current Top-K. 
+        // Until K objects have occurred, every object is kept. After, a new 
+        // object replaces the front only if it ranks ahead of it.
+        if (m_topKHeap.size() < m_k)
+        {
+            m_topKHeap.push_back(entry);
+            std::push_heap(m_topKHeap.begin(), m_topKHeap.end(), ranksAheadOf);
+        }
+        else if (ranksAhead(entry, m_topKHeap.front()))
+        {
+            std::pop_heap(m_topKHeap.begin(), m_topKHeap.end(), ranksAheadOf);
+            m_topKHeap.back() = entry;
+            std::push_heap(m_topKHeap.begin(), m_topKHeap.end(), ranksAheadOf);
         }
         return true;
     }
     
-    uint EarliestOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+    uint TopKOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2458,48 +4046,73 @@ namespace DSL
             // Gaurd against property updates from the client API
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
             
-            if (!m_enabled or m_skipFrame or m_pTrackedObjectsPerSource->IsEmpty())
-            {
-                return 0;
-            }
+            m_occurrences = 0;
             
-            if (m_pEarliestObjectMeta != NULL)
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
+            if (pCriteria->enabled and m_topKHeap.size())
             {
-                // event has been triggered
-                IncrementAndCheckTriggerCount();
-                m_occurrences++;
-
-                // update the total event count static variable
-                s_eventCount++;
-
-                // If the client has added a heat mapper, call to add the occurrence data
-                if (m_pHeatMapper)
+                // sort the Top-K objects into rank order, best first.
+                std::sort_heap(m_topKHeap.begin(), m_topKHeap.end(), 
+                    [this](const TopKEntry& a, const TopKEntry& b)
+                        {return ranksAhead(a, b);});
+                        
+                for (const auto &entry: m_topKHeap)
                 {
-                    std::dynamic_pointer_cast<OdeHeatMapper>(m_pHeatMapper)->HandleOccurrence(
-                        pFrameMeta, m_pEarliestObjectMeta);
-                }
+                    if (pCriteria->limit and m_triggered >= pCriteria->limit)
+                    {
+                        break;
+                    }
+                    // event has been triggered
+                    IncrementAndCheckTriggerCount();
+                    m_occurrences++;
 
-                // add the persistence value to the array of misc_obj_info
-                // as both the Primary and Persistence specific indecies.
-                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PERSISTENCE] = 
-                m_pEarliestObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
-                    (uint64_t)(m_earliestTrackedTimeMs/1000);
+                    // update the total event count static variable
+                    s_eventCount++;
 
-                for (const auto &imap: m_pOdeActionsIndexed)
-                {
-                    DSL_ODE_ACTION_PTR pOdeAction = 
-                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                        pBuffer, displayMetaData, pFrameMeta, m_pEarliestObjectMeta);
+                    // If the client has added a heat mapper, call to add-occurrence
+                    if (m_pHeatMapper)
+                    {
+                        m_pOdeHeatMapper->HandleOccurrence(pFrameMeta, entry.pObjectMeta);
+                    }
+                    if (m_pAccumulator)
+                    {
+                        m_pOdeAccumulator->HandleObjectOccurrence(pFrameMeta, entry.pObjectMeta);
+                    }
+                    
+                    // set the primary metric as the key value - confidence 
+                    // values in percent and dwell time in seconds.
+                    double metric(entry.key);
+                    if (m_key == DSL_ODE_TRIGGER_TOP_K_KEY_CONFIDENCE or
+                        m_key == DSL_ODE_TRIGGER_TOP_K_KEY_TRACKER_CONFIDENCE)
+                    {
+                        metric *= 100;
+                    }
+                    else if (m_key == DSL_ODE_TRIGGER_TOP_K_KEY_DWELL)
+                    {
+                        metric /= 1000;
+                    }
+                    entry.pObjectMeta->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = 
+                        (uint64_t)metric;
+                    
+                    for (const auto &pOdeAction: m_pOdeActionsList)
+                    {
+                        pOdeAction->InvokeOccurrence(m_pSelf, 
+                            pBuffer, displayMetaData, pFrameMeta, entry.pObjectMeta);
+                    }
                 }
-            
-                // clear the Earliest Object data for the next frame 
-                m_pEarliestObjectMeta = NULL;
-                m_earliestTrackedTimeMs = 0;
+            }
+            if (m_key == DSL_ODE_TRIGGER_TOP_K_KEY_DWELL)
+            {
+                // purge all tracked objects for this source that have exceeded 
+                // the miss tolerance.
+                m_pTrackedObjectsPerSource->Purge(pFrameMeta->source_id, 
+                    pFrameMeta->frame_num);
             }
             
-            // purge all tracked objects, for all sources that are not in the current frame.
-            m_pTrackedObjectsPerSource->Purge(pFrameMeta->frame_num);
+            // reset for next frame - capacity is retained.
+            m_topKHeap.clear();
+            m_sequence = 0;
         }
         // mutex unlocked - safe to call base class
         return OdeTrigger::PostProcessFrame(pBuffer,
@@ -2515,10 +4128,14 @@ namespace DSL
         : OdeTrigger(name, source, classIdA, limit)
         , m_classIdA(classIdA)
         , m_classIdB(classIdB)
+        , m_broadPhaseMinObjects(DSL_ODE_BROAD_PHASE_MIN_OBJECTS_DEFAULT)
     {
         LOG_FUNC();
         
         m_classIdAOnly = (m_classIdA == m_classIdB);
+        
+        // Republish the criteria snapshot with both class-ids
+        updateCriteria();
     }
 
     ABOdeTrigger::~ABOdeTrigger()
@@ -2542,46 +4159,84 @@ namespace DSL
         m_classIdA = classIdA;
         m_classIdB = classIdB;
         m_classIdAOnly = (m_classIdA == m_classIdB);
+        
+        updateCriteria();
+        NotifyCriteriaChangeListeners();
+    }
+    
+    void ABOdeTrigger::copyCriteria(OdeTriggerCriteria* pCriteria)
+    {
+        LOG_FUNC();
+        
+        OdeTrigger::copyCriteria(pCriteria);
+        
+        pCriteria->classId = m_classIdA;
+        pCriteria->classIdB = m_classIdB;
+    }
+
+    bool ABOdeTrigger::GetRoutingCriteria(int* sourceId, std::vector<uint>& classIds)
+    {
+        LOG_FUNC();
+        
+        if (!OdeTrigger::GetRoutingCriteria(sourceId, classIds))
+        {
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        // route on both class-ids A and B
+        classIds.clear();
+        classIds.push_back(m_classIdA);
+        if (!m_classIdAOnly)
+        {
+            classIds.push_back(m_classIdB);
+        }
+        return true;
     }
     
     bool ABOdeTrigger::CheckForOccurrence(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData, 
+        DisplayMetaData& displayMetaData, 
         NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta)
     {
         // Note: function is called from the system (callback) context
-        // Gaurd against property updates from the client API
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        // Check the current criteria snapshot first, without locking.
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        
+        if (!pCriteria->enabled or 
+            !CheckForSourceId(pCriteria, pFrameMeta->source_id))
+        {
+            return false;
+        }
         
-        if (!m_enabled or !CheckForSourceId(pFrameMeta->source_id))
+        bool occurrenceA = 
+            CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta, 
+                pCriteria->classId) and CheckForInside(pCriteria, pObjectMeta);
+        bool occurrenceB = !occurrenceA and 
+            pCriteria->classId != pCriteria->classIdB and
+            CheckForMinCriteria(pCriteria, pFrameMeta, pObjectMeta, 
+                pCriteria->classIdB) and CheckForInside(pCriteria, pObjectMeta);
+        
+        if (!occurrenceA and !occurrenceB)
         {
             return false;
         }
         
-        bool occurrenceAdded(false);
+        // Gaurd against property updates from the client API
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
         
-        m_classId = m_classIdA;
-        if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
-            CheckForInside(pObjectMeta))
+        if (occurrenceA)
         {
             m_occurrenceMetaListA.push_back(pObjectMeta);
-            occurrenceAdded = true;
         }
-        else if (!m_classIdAOnly)
+        else
         {
-            m_classId = m_classIdB;
-            if (CheckForMinCriteria(pFrameMeta, pObjectMeta) and 
-                CheckForInside(pObjectMeta))
-            {
-                m_occurrenceMetaListB.push_back(pObjectMeta);
-                occurrenceAdded = true;
-            }
+            m_occurrenceMetaListB.push_back(pObjectMeta);
         }
-        
-        return occurrenceAdded;
+        return true;
     }
 
     uint ABOdeTrigger::PostProcessFrame(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         if (m_classIdAOnly)
         {
@@ -2590,6 +4245,100 @@ namespace DSL
         return  PostProcessFrameAB(pBuffer, displayMetaData, pFrameMeta);
     }
 
+    uint ABOdeTrigger::GetBroadPhaseMinObjects()
+    {
+        LOG_FUNC();
+        
+        return m_broadPhaseMinObjects;
+    }
+
+    void ABOdeTrigger::SetBroadPhaseMinObjects(uint minObjects)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_propertyMutex);
+        
+        m_broadPhaseMinObjects = minObjects;
+    }
+
+    void ABOdeTrigger::buildCandidatePairs()
+    {
+        // Note: function is called from the system (callback) context
+        // with the property mutex held.
+        
+        uint countA = m_occurrenceMetaListA.size();
+        uint countB = m_occurrenceMetaListB.size();
+        uint count = (m_classIdAOnly) ? countA : countA + countB;
+        
+        double margin(0);
+        if (count >= m_broadPhaseMinObjects and prepareBroadPhase(&margin))
+        {
+            if (m_classIdAOnly)
+            {
+                m_broadPhase.FindPairs(m_broadPhaseBoxesA, 
+                    margin, m_candidatePairs);
+            }
+            else
+            {
+                m_broadPhase.FindPairs(m_broadPhaseBoxesA, 
+                    m_broadPhaseBoxesB, margin, m_candidatePairs);
+            }
+            return;
+        }
+        
+        // otherwise, every pair is a candidate - in brute-force order
+        m_candidatePairs.clear();
+        if (m_classIdAOnly)
+        {
+            for (uint i = 0; i+1 < countA; i++) 
+            {
+                for (uint j = i+1; j < countA; j++) 
+                {
+                    m_candidatePairs.push_back(BroadPhasePair(i, j));
+                }
+            }
+        }
+        else
+        {
+            for (uint i = 0; i < countA; i++) 
+            {
+                for (uint j = 0; j < countB; j++) 
+                {
+                    m_candidatePairs.push_back(BroadPhasePair(i, j));
+                }
+            }
+        }
+    }
+    
+    bool ABOdeTrigger::handlePairOccurrence(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta,
+        NvDsObjectMeta* pObjectMetaA, NvDsObjectMeta* pObjectMetaB)
+    {
+        // Note: function is called from the system (callback) context
+        // with the property mutex held.
+
+        // event has been triggered
+        m_occurrences++;
+        IncrementAndCheckTriggerCount();
+        
+         // update the total event count static variable
+        s_eventCount++;
+
+        // set the primary metric as the current occurrence for this frame
+        pObjectMetaA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
+        pObjectMetaB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] = m_occurrences;
+
+        for (const auto &pOdeAction: m_pOdeActionsList)
+        {
+            // Invoke each action twice, once for each object in the tested pair
+            pOdeAction->InvokeOccurrence(m_pSelf, 
+                pBuffer, displayMetaData, pFrameMeta, pObjectMetaA);
+            pOdeAction->InvokeOccurrence(m_pSelf, 
+                pBuffer, displayMetaData, pFrameMeta, pObjectMetaB);
+        }
+        const OdeTriggerCriteria* pCriteria = GetCriteria();
+        return (pCriteria->limit and m_triggered >= pCriteria->limit);
+    }
+
     // *****************************************************************************
     
     DistanceOdeTrigger::DistanceOdeTrigger(const char* name, const char* source, 
@@ -2645,7 +4394,7 @@ namespace DSL
     
     
     uint DistanceOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2656,50 +4405,28 @@ namespace DSL
             
             m_occurrences = 0;
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // need at least two objects for intersection to occur
-            while (m_enabled and m_occurrenceMetaListA.size() > 1)
+            if (pCriteria->enabled and m_occurrenceMetaListA.size() > 1)
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (uint i = 0; i < m_occurrenceMetaListA.size()-1 ; i++) 
+                buildCandidatePairs();
+                
+                // iterate through the candidate pairs of object occurrences 
+                // that passed all min criteria
+                for (const auto &pair: m_candidatePairs) 
                 {
-                    for (uint j = i+1; j < m_occurrenceMetaListA.size() ; j++) 
+                    NvDsObjectMeta* pObjectMetaA = m_occurrenceMetaListA[pair.first];
+                    NvDsObjectMeta* pObjectMetaB = m_occurrenceMetaListA[pair.second];
+
+                    if (CheckDistance(pObjectMetaA, pObjectMetaB) and
+                        handlePairOccurrence(pBuffer, displayMetaData, pFrameMeta,
+                            pObjectMetaA, pObjectMetaB))
                     {
-                        if (CheckDistance(m_occurrenceMetaListA[i], 
-                            m_occurrenceMetaListA[j]))
-                        {
-                            // event has been triggered
-                            m_occurrences++;
-                            IncrementAndCheckTriggerCount();
-                            
-                             // update the total event count static variable
-                            s_eventCount++;
-
-                            // set the primary metric as the current occurrence for this frame
-                            m_occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-                            m_occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-
-                            for (const auto &imap: m_pOdeActionsIndexed)
-                            {
-                                DSL_ODE_ACTION_PTR pOdeAction = 
-                                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                
-                                // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
-                            }
-                            if (m_limit and m_triggered >= m_limit)
-                            {
-                                m_occurrenceMetaListA.clear();
-                                break;
-                            }
-                        }
+                        // trigger limit has been reached
+                        break;
                     }
                 }
-                break;
             }   
 
             // reset for next frame
@@ -2711,7 +4438,7 @@ namespace DSL
     }
    
     uint DistanceOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2722,57 +4449,32 @@ namespace DSL
             
             m_occurrences = 0;
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // need at least one object from each of the two Classes 
-            while (m_enabled and m_occurrenceMetaListA.size() and m_occurrenceMetaListB.size())
+            if (pCriteria->enabled and m_occurrenceMetaListA.size() and 
+                m_occurrenceMetaListB.size())
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &iterA: m_occurrenceMetaListA) 
+                buildCandidatePairs();
+                
+                // iterate through the candidate pairs of object occurrences 
+                // that passed all min criteria
+                for (const auto &pair: m_candidatePairs) 
                 {
-                    for (const auto &iterB: m_occurrenceMetaListB) 
+                    NvDsObjectMeta* pObjectMetaA = m_occurrenceMetaListA[pair.first];
+                    NvDsObjectMeta* pObjectMetaB = m_occurrenceMetaListB[pair.second];
+
+                    // ensure we are not testing the same object which can be in both 
+                    // vectors if Class Id A and B are specified to be the same.
+                    if (pObjectMetaA != pObjectMetaB and
+                        CheckDistance(pObjectMetaA, pObjectMetaB) and
+                        handlePairOccurrence(pBuffer, displayMetaData, pFrameMeta,
+                            pObjectMetaA, pObjectMetaB))
                     {
-                        // ensure we are not testing the same object which can be in both vectors
-                        // if Class Id A and B are specified to be the same.
-                        if (iterA != iterB)
-                        {
-                            if (CheckDistance(iterA, iterB))
-                            {
-                                // event has been triggered
-                                m_occurrences++;
-                                IncrementAndCheckTriggerCount();
-                                
-                                 // update the total event count static variable
-                                s_eventCount++;
-
-                                // set the primary metric as the current occurrence 
-                                // for this frame
-                                iterA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-                                iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-
-                                for (const auto &imap: m_pOdeActionsIndexed)
-                                {
-                                    DSL_ODE_ACTION_PTR pOdeAction = 
-                                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                    
-                                    // Invoke each action twice, once for each object 
-                                    // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterB);
-                                }
-                                if (m_limit and m_triggered >= m_limit)
-                                {
-                                    m_occurrenceMetaListA.clear();
-                                    m_occurrenceMetaListB.clear();
-                                    break;
-                                }
-                            }
-                        }
+                        // trigger limit has been reached
+                        break;
                     }
                 }
-                break;
             }   
 
             // reset for next frame
@@ -2784,6 +4486,85 @@ namespace DSL
             displayMetaData, pFrameMeta);
     }
 
+    bool DistanceOdeTrigger::prepareBroadPhase(double* margin)
+    {
+        // Note: function is called from the system (callback) context
+        // with the property mutex held.
+
+        // Events are triggered for pairs closer than the minimum OR further
+        // than the maximum distance. The broad-phase can only skip pairs that 
+        // are provably beyond the minimum, and so requires that no pair in 
+        // the frame can be further apart than the maximum.
+        uint maxMinimum(0), minMaximum(UINT32_MAX);
+        
+        m_broadPhaseBoxesA.clear();
+        m_broadPhaseBoxesB.clear();
+        
+        for (const auto &pObjectMeta: m_occurrenceMetaListA)
+        {
+            addBroadPhaseBox(pObjectMeta, m_broadPhaseBoxesA, 
+                &maxMinimum, &minMaximum);
+        }
+        if (!m_classIdAOnly)
+        {
+            for (const auto &pObjectMeta: m_occurrenceMetaListB)
+            {
+                addBroadPhaseBox(pObjectMeta, m_broadPhaseBoxesB, 
+                    &maxMinimum, &minMaximum);
+            }
+        }
+        
+        // the diagonal of the extents of all test geometries is an upper 
+        // bound on the distance between any two of them.
+        BroadPhaseBox extents = m_broadPhaseBoxesA.front();
+        for (const auto &boxes: {&m_broadPhaseBoxesA, &m_broadPhaseBoxesB})
+        {
+            for (const auto &box: *boxes)
+            {
+                extents.left = std::min(extents.left, box.left);
+                extents.top = std::min(extents.top, box.top);
+                extents.right = std::max(extents.right, box.right);
+                extents.bottom = std::max(extents.bottom, box.bottom);
+            }
+        }
+        double diagonal = sqrt(pow(extents.right - extents.left, 2) + 
+            pow(extents.bottom - extents.top, 2));
+            
+        // allow an extra pixel for rounding of the calculated distances
+        if (ceil(diagonal) + 1 > minMaximum)
+        {
+            return false;
+        }
+        *margin = double(maxMinimum) + 1;
+        return true;
+    }
+    
+    void DistanceOdeTrigger::addBroadPhaseBox(NvDsObjectMeta* pObjectMeta,
+        std::vector<BroadPhaseBox>& boxes, uint* maxMinimum, uint* minMaximum)
+    {
+        if (m_testPoint == DSL_BBOX_POINT_ANY)
+        {
+            boxes.push_back({double(pObjectMeta->rect_params.left), 
+                double(pObjectMeta->rect_params.top),
+                double(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width),
+                double(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height)});
+        }
+        else
+        {
+            uint x(0), y(0);
+            getTestPoint(pObjectMeta, &x, &y);
+            boxes.push_back({double(x), double(y), double(x), double(y)});
+        }
+        
+        // the object can be either A or B in the pair when calculating 
+        // the range, depending on the test method.
+        uint minimum(0), maximum(0);
+        getRange(pObjectMeta, pObjectMeta, &minimum, &maximum);
+        
+        *maxMinimum = std::max(*maxMinimum, minimum);
+        *minMaximum = std::min(*minMaximum, maximum);
+    }
+
     bool DistanceOdeTrigger::CheckDistance(NvDsObjectMeta* pObjectMetaA, 
         NvDsObjectMeta* pObjectMetaB)
     {
@@ -2796,67 +4577,8 @@ namespace DSL
         }
         else{
             uint xa(0), ya(0), xb(0), yb(0);
-            switch (m_testPoint)
-            {
-            case DSL_BBOX_POINT_CENTER :
-                xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width/2);
-                ya = round(pObjectMetaA->rect_params.top + pObjectMetaA->rect_params.height/2);
-                xb = round(pObjectMetaB->rect_params.left + pObjectMetaB->rect_params.width/2);
-                yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height/2);
-                break;
-            case DSL_BBOX_POINT_NORTH_WEST :
-                xa = round(pObjectMetaA->rect_params.left);
-                ya = round(pObjectMetaA->rect_params.top);
-                xb = round(pObjectMetaB->rect_params.left);
-                yb = round(pObjectMetaB->rect_params.top);
-                break;
-            case DSL_BBOX_POINT_NORTH :
-                xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width/2);
-                ya = round(pObjectMetaA->rect_params.top);
-                xb = round(pObjectMetaB->rect_params.left + pObjectMetaB->rect_params.width/2);
-                yb = round(pObjectMetaB->rect_params.top);
-                break;
-            case DSL_BBOX_POINT_NORTH_EAST :
-                xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width);
-                ya = round(pObjectMetaA->rect_params.top);
-                xb = round(pObjectMetaB->rect_params.left + pObjectMetaB->rect_params.width);
-                yb = round(pObjectMetaB->rect_params.top);
-                break;
-            case DSL_BBOX_POINT_EAST :
-                xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width);
-                ya = round(pObjectMetaA->rect_params.top + pObjectMetaA->rect_params.height/2);
-                xb = round(pObjectMetaB->rect_params.left + pObjectMetaB->rect_params.width);
-                yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height/2);
-                break;
-            case DSL_BBOX_POINT_SOUTH_EAST :
-                xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width);
-                ya = round(pObjectMetaA->rect_params.top + pObjectMetaA->rect_params.height);
-                xb = round(pObjectMetaB->rect_params.left + pObjectMetaB->rect_params.width);
-                yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height);
-                break;
-            case DSL_BBOX_POINT_SOUTH :
-                xa = round(pObjectMetaA->rect_params.left + pObjectMetaA->rect_params.width/2);
-                ya = round(pObjectMetaA->rect_params.top + pObjectMetaA->rect_params.height);
-                xb = round(pObjectMetaB->rect_params.left + pObjectMetaB->rect_params.width/2);
-                yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height);
-                break;
-            case DSL_BBOX_POINT_SOUTH_WEST :
-                xa = round(pObjectMetaA->rect_params.left);
-                ya = round(pObjectMetaA->rect_params.top + pObjectMetaA->rect_params.height);
-                xb = round(pObjectMetaB->rect_params.left);
-                yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height);
-                break;
-            case DSL_BBOX_POINT_WEST :
-                xa = round(pObjectMetaA->rect_params.left);
-                ya = round(pObjectMetaA->rect_params.top + pObjectMetaA->rect_params.height/2);
-                xb = round(pObjectMetaB->rect_params.left);
-                yb = round(pObjectMetaB->rect_params.top + pObjectMetaB->rect_params.height/2);
-                break;
-            default:
-                LOG_ERROR("Invalid DSL_BBOX_POINT = '" << m_testPoint 
-                    << "' for DistanceOdeTrigger Trigger '" << GetName() << "'");
-                throw;
-            }
+            getTestPoint(pObjectMetaA, &xa, &ya);
+            getTestPoint(pObjectMetaB, &xb, &yb);
 
             GeosPoint pointA(xa, ya);
             GeosPoint pointB(xb, yb);
@@ -2864,30 +4586,85 @@ namespace DSL
         }
         
         uint minimum(0), maximum(0);
+        getRange(pObjectMetaA, pObjectMetaB, &minimum, &maximum);
+
+        return (minimum > distance or maximum < distance);
+    }
+    
+    void DistanceOdeTrigger::getTestPoint(NvDsObjectMeta* pObjectMeta, 
+        uint* x, uint* y)
+    {
+        switch (m_testPoint)
+        {
+        case DSL_BBOX_POINT_CENTER :
+            *x = round(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width/2);
+            *y = round(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height/2);
+            break;
+        case DSL_BBOX_POINT_NORTH_WEST :
+            *x = round(pObjectMeta->rect_params.left);
+            *y = round(pObjectMeta->rect_params.top);
+            break;
+        case DSL_BBOX_POINT_NORTH :
+            *x = round(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width/2);
+            *y = round(pObjectMeta->rect_params.top);
+            break;
+        case DSL_BBOX_POINT_NORTH_EAST :
+            *x = round(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width);
+            *y = round(pObjectMeta->rect_params.top);
+            break;
+        case DSL_BBOX_POINT_EAST :
+            *x = round(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width);
+            *y = round(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height/2);
+            break;
+        case DSL_BBOX_POINT_SOUTH_EAST :
+            *x = round(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width);
+            *y = round(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height);
+            break;
+        case DSL_BBOX_POINT_SOUTH :
+            *x = round(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width/2);
+            *y = round(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height);
+            break;
+        case DSL_BBOX_POINT_SOUTH_WEST :
+            *x = round(pObjectMeta->rect_params.left);
+            *y = round(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height);
+            break;
+        case DSL_BBOX_POINT_WEST :
+            *x = round(pObjectMeta->rect_params.left);
+            *y = round(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height/2);
+            break;
+        default:
+            LOG_ERROR("Invalid DSL_BBOX_POINT = '" << m_testPoint 
+                << "' for DistanceOdeTrigger Trigger '" << GetName() << "'");
+            throw;
+        }
+    }
+    
+    void DistanceOdeTrigger::getRange(NvDsObjectMeta* pObjectMetaA, 
+        NvDsObjectMeta* pObjectMetaB, uint* minimum, uint* maximum)
+    {
         switch (m_testMethod)
         {
         case DSL_DISTANCE_METHOD_FIXED_PIXELS :
-            minimum = m_minimum;
-            maximum = m_maximum;
+            *minimum = m_minimum;
+            *maximum = m_maximum;
             break;
         case DSL_DISTANCE_METHOD_PERCENT_WIDTH_A :
-            minimum = uint((m_minimum*pObjectMetaA->rect_params.width)/100);
-            maximum = uint((m_maximum*pObjectMetaA->rect_params.width)/100);
+            *minimum = uint((m_minimum*pObjectMetaA->rect_params.width)/100);
+            *maximum = uint((m_maximum*pObjectMetaA->rect_params.width)/100);
             break;
         case DSL_DISTANCE_METHOD_PERCENT_WIDTH_B :
-            minimum = uint((m_minimum*pObjectMetaB->rect_params.width)/100);
-            maximum = uint((m_maximum*pObjectMetaB->rect_params.width)/100);
+            *minimum = uint((m_minimum*pObjectMetaB->rect_params.width)/100);
+            *maximum = uint((m_maximum*pObjectMetaB->rect_params.width)/100);
             break;
         case DSL_DISTANCE_METHOD_PERCENT_HEIGHT_A :
-            minimum = uint((m_minimum*pObjectMetaA->rect_params.height)/100);
-            maximum = uint((m_maximum*pObjectMetaA->rect_params.height)/100);
+            *minimum = uint((m_minimum*pObjectMetaA->rect_params.height)/100);
+            *maximum = uint((m_maximum*pObjectMetaA->rect_params.height)/100);
             break;
         case DSL_DISTANCE_METHOD_PERCENT_HEIGHT_B :
-            minimum = uint((m_minimum*pObjectMetaB->rect_params.height)/100);
-            maximum = uint((m_maximum*pObjectMetaB->rect_params.height)/100);
+            *minimum = uint((m_minimum*pObjectMetaB->rect_params.height)/100);
+            *maximum = uint((m_maximum*pObjectMetaB->rect_params.height)/100);
             break;
         }    
-        return (minimum > distance or maximum < distance);
     }
 
     // *****************************************************************************
@@ -2905,7 +4682,7 @@ namespace DSL
     }
     
     uint IntersectionOdeTrigger::PostProcessFrameA(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2916,49 +4693,29 @@ namespace DSL
             
             m_occurrences = 0;
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // need at least two objects for intersection to occur
-            if (m_enabled and m_occurrenceMetaListA.size() > 1)
+            if (pCriteria->enabled and m_occurrenceMetaListA.size() > 1)
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (uint i = 0; i < m_occurrenceMetaListA.size()-1 ; i++) 
+                buildCandidatePairs();
+                
+                // iterate through the candidate pairs of object occurrences 
+                // that passed all min criteria
+                for (const auto &pair: m_candidatePairs) 
                 {
-                    for (uint j = i+1; j < m_occurrenceMetaListA.size() ; j++) 
+                    NvDsObjectMeta* pObjectMetaA = m_occurrenceMetaListA[pair.first];
+                    NvDsObjectMeta* pObjectMetaB = m_occurrenceMetaListA[pair.second];
+
+                    // check each in turn for any frame overlap
+                    GeosRectangle rectA(pObjectMetaA->rect_params);
+                    GeosRectangle rectB(pObjectMetaB->rect_params);
+                    if (rectA.Overlaps(rectB) and
+                        handlePairOccurrence(pBuffer, displayMetaData, pFrameMeta,
+                            pObjectMetaA, pObjectMetaB))
                     {
-                        // check each in turn for any frame overlap
-                        GeosRectangle rectA(m_occurrenceMetaListA[i]->rect_params);
-                        GeosRectangle rectB(m_occurrenceMetaListA[j]->rect_params);
-                        if (rectA.Overlaps(rectB))
-                        {
-                            // event has been triggered
-                            m_occurrences++;
-                            IncrementAndCheckTriggerCount();
-                            
-                             // update the total event count static variable
-                            s_eventCount++;
-
-                            // set the primary metric as the current occurrence for this frame
-                            m_occurrenceMetaListA[i]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-                            m_occurrenceMetaListA[j]->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                = m_occurrences;
-
-                            for (const auto &imap: m_pOdeActionsIndexed)
-                            {
-                                DSL_ODE_ACTION_PTR pOdeAction = 
-                                    std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                
-                                // Invoke each action twice, once for each object in the tested pair
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[i]);
-                                pOdeAction->HandleOccurrence(shared_from_this(), 
-                                    pBuffer, displayMetaData, pFrameMeta, m_occurrenceMetaListA[j]);
-                            }
-                            if (m_limit and m_triggered >= m_limit)
-                            {
-                                m_occurrenceMetaListA.clear();
-                                return m_occurrences;
-                            }
-                        }
+                        m_occurrenceMetaListA.clear();
+                        return m_occurrences;
                     }
                 }
             }   
@@ -2972,7 +4729,7 @@ namespace DSL
    }
 
     uint IntersectionOdeTrigger::PostProcessFrameAB(GstBuffer* pBuffer, 
-        std::vector<NvDsDisplayMeta*>& displayMetaData,  NvDsFrameMeta* pFrameMeta)
+        DisplayMetaData& displayMetaData,  NvDsFrameMeta* pFrameMeta)
     {
         // create scope so the property-mutex can be unlocked before
         // calling the base-class PostProcessFrame which locks the mutex.
@@ -2983,57 +4740,37 @@ namespace DSL
             
             m_occurrences = 0;
             
+            const OdeTriggerCriteria* pCriteria = GetCriteria();
+            
             // need at least one object from each of the two Classes 
-            if (m_enabled and m_occurrenceMetaListA.size() and m_occurrenceMetaListB.size())
+            if (pCriteria->enabled and m_occurrenceMetaListA.size() and 
+                m_occurrenceMetaListB.size())
             {
-                // iterate through the list of object occurrences that passed all min criteria
-                for (const auto &iterA: m_occurrenceMetaListA) 
+                buildCandidatePairs();
+                
+                // iterate through the candidate pairs of object occurrences 
+                // that passed all min criteria
+                for (const auto &pair: m_candidatePairs) 
                 {
-                    for (const auto &iterB: m_occurrenceMetaListB) 
+                    NvDsObjectMeta* pObjectMetaA = m_occurrenceMetaListA[pair.first];
+                    NvDsObjectMeta* pObjectMetaB = m_occurrenceMetaListB[pair.second];
+
+                    // ensure we are not testing the same object which can be in both 
+                    // vectors if Class Id A and B are specified to be the same.
+                    if (pObjectMetaA == pObjectMetaB)
+                    {
+                        continue;
+                    }
+                    // check each in turn for any frame overlap
+                    GeosRectangle rectA(pObjectMetaA->rect_params);
+                    GeosRectangle rectB(pObjectMetaB->rect_params);
+                    if (rectA.Overlaps(rectB) and
+                        handlePairOccurrence(pBuffer, displayMetaData, pFrameMeta,
+                            pObjectMetaA, pObjectMetaB))
                     {
-                        // ensure we are not testing the same object which can be in both vectors
-                        // if Class Id A and B are specified to be the same.
-                        if (iterA != iterB)
-                        {
-                            // check each in turn for any frame overlap
-                            GeosRectangle rectA(iterA->rect_params);
-                            GeosRectangle rectB(iterB->rect_params);
-                            if (rectA.Overlaps(rectB))
-                            {
-                                // event has been triggered
-                                m_occurrences++;
-                                IncrementAndCheckTriggerCount();
-                                
-                                 // update the total event count static variable
-                                s_eventCount++;
-
-                                // set the primary metric as the current occurrence 
-                                // for this frame
-                                iterA->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-                                iterB->misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] 
-                                    = m_occurrences;
-                                
-                                for (const auto &imap: m_pOdeActionsIndexed)
-                                {
-                                    DSL_ODE_ACTION_PTR pOdeAction = 
-                                        std::dynamic_pointer_cast<OdeAction>(imap.second);
-                                    
-                                    // Invoke each action twice, once for each object 
-                                    // in the tested pair
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterA);
-                                    pOdeAction->HandleOccurrence(shared_from_this(), 
-                                        pBuffer, displayMetaData, pFrameMeta, iterB);
-                                }
-                                if (m_limit and m_triggered >= m_limit)
-                                {
-                                    m_occurrenceMetaListA.clear();
-                                    m_occurrenceMetaListB.clear();
-                                    return m_occurrences;
-                                }
-                            }
-                        }
+                        m_occurrenceMetaListA.clear();
+                        m_occurrenceMetaListB.clear();
+                        return m_occurrences;
                     }
                 }
             }   
@@ -3046,4 +4783,38 @@ namespace DSL
         return OdeTrigger::PostProcessFrame(pBuffer,
             displayMetaData, pFrameMeta);
     }
-}
\ No newline at end of file
+
+    bool IntersectionOdeTrigger::prepareBroadPhase(double* margin)
+    {
+        // Note: function is called from the system (callback) context
+        // with the property mutex held.
+
+        m_broadPhaseBoxesA.clear();
+        m_broadPhaseBoxesB.clear();
+        
+        for (const auto &pObjectMeta: m_occurrenceMetaListA)
+        {
+            addBroadPhaseBox(pObjectMeta, m_broadPhaseBoxesA);
+        }
+        if (!m_classIdAOnly)
+        {
+            for (const auto &pObjectMeta: m_occurrenceMetaListB)
+            {
+                addBroadPhaseBox(pObjectMeta, m_broadPhaseBoxesB);
+            }
+        }
+        // Overlapping rectangles must share interior points, touching or 
+        // separated bounding boxes can never overlap.
+        *margin = 0;
+        return true;
+    }
+    
+    void IntersectionOdeTrigger::addBroadPhaseBox(NvDsObjectMeta* pObjectMeta,
+        std::vector<BroadPhaseBox>& boxes)
+    {
+        boxes.push_back({double(pObjectMeta->rect_params.left), 
+            double(pObjectMeta->rect_params.top),
+            double(pObjectMeta->rect_params.left + pObjectMeta->rect_params.width),
+            double(pObjectMeta->rect_params.top + pObjectMeta->rect_params.height)});
+    }
+}
@@ -28,11 +28,131 @@ THE SOFTWARE.
 #include "Dsl.h"
 #include "DslApi.h"
 #include "DslOdeBase.h"
+#include "DslOdeMetrics.h"
 #include "DslOdeTrackedObject.h"
 #include "DslDisplayTypes.h"
+#include "DslBroadPhase.h"
 
 namespace DSL
 {
+    // forward declarations for the typed child lists
+    class OdeAction;
+    class OdeArea;
+    class OdeAccumulator;
+    class OdeHeatMapper;
+
+    /**
+     * @brief callback typedef for an internal listener to be notified on change
+     * of a Trigger's source, class-id, or enabled setting.
+     */
+    typedef void (*dsl_ode_trigger_criteria_change_listener_cb)(void* client_data);
+
+    /**
+     * @brief Load-shedding interval used to skip all frames for a Trigger.
+     */
+    #define DSL_ODE_TRIGGER_SHED_INTERVAL_ALL UINT32_MAX
+
+    /**
+     * @struct OdeTriggerCriteria
+     * @brief Immutable snapshot of an ODE Trigger's filter criteria. A new snapshot
+     * is published by each property setter, and read by the streaming thread 
+     * without locking. Only the lazily resolved source and inference component 
+     * ids are updated after publication.
+     */
+    struct OdeTriggerCriteria
+    {
+        /**
+         * @brief enabled setting at time of publication.
+         */
+        bool enabled;
+        
+        /**
+         * @brief unique source name filter, empty if disabled.
+         */
+        std::string source;
+        
+        /**
+         * @brief unique source id filter, -1 until resolved from the source name.
+         */
+        mutable std::atomic<int> sourceId;
+        
+        /**
+         * @brief unique inference component name filter, empty if disabled.
+         */
+        std::string infer;
+        
+        /**
+         * @brief unique inference component id, -1 until resolved from the name.
+         */
+        mutable std::atomic<int> inferId;
+        
+        /**
+         * @brief GIE Class Id filter, Class A for AB Triggers.
+         */
+        uint classId;
+        
+        /**
+         * @brief Class B filter for AB Triggers, equal to classId otherwise.
+         */
+        uint classIdB;
+        
+        /**
+         * @brief set of class-ids to count for Class Count Triggers, empty otherwise.
+         */
+        std::bitset<DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES> classIdSet;
+        
+        /**
+         * @brief trigger limit, 0 = no limit.
+         */
+        uint limit;
+        
+        /**
+         * @brief minimum inference and tracker confidence [0.0..1.0].
+         */
+        float minConfidence;
+        float minTrackerConfidence;
+        
+        /**
+         * @brief minimum and maximum rectangle dimensions, 0 = no filter.
+         */
+        float minWidth;
+        float minHeight;
+        float maxWidth;
+        float maxHeight;
+        
+        /**
+         * @brief if set, the Frame meta value "bInferDone" must be set.
+         */
+        bool inferDoneOnly;
+        
+        /**
+         * @brief minimum frame count numerator and denominator.
+         */
+        uint minFrameCountN;
+        uint minFrameCountD;
+        
+        /**
+         * @brief process interval in units of frames, 0 = every frame.
+         */
+        uint interval;
+        
+        /**
+         * @brief load-shedding priority, one of DSL_ODE_TRIGGER_PRIORITY_*.
+         */
+        uint priority;
+        
+        /**
+         * @brief shared references to all child ODE Areas, held to keep the 
+         * Areas in pOdeAreasList valid for the life of the snapshot.
+         */
+        std::vector<DSL_BASE_PTR> pOdeAreas;
+        
+        /**
+         * @brief flat list of typed child ODE Area pointers in add-order.
+         */
+        std::vector<OdeArea*> pOdeAreasList;
+    };
+
     /**
      * @brief convenience macros for shared pointer abstraction
      */
@@ -62,6 +182,12 @@ namespace DSL
         std::shared_ptr<SummationOdeTrigger>(new SummationOdeTrigger(name, \
             source, classId, limit))
         
+    #define DSL_ODE_TRIGGER_CLASS_COUNT_PTR std::shared_ptr<ClassCountOdeTrigger>
+    #define DSL_ODE_TRIGGER_CLASS_COUNT_NEW(name, \
+        source, classIds, numClassIds, limit) \
+        std::shared_ptr<ClassCountOdeTrigger>(new ClassCountOdeTrigger(name, \
+            source, classIds, numClassIds, limit))
+        
     #define DSL_ODE_TRIGGER_CUSTOM_PTR std::shared_ptr<CustomOdeTrigger>
     #define DSL_ODE_TRIGGER_CUSTOM_NEW(name, \
     source, classId, limit, clientChecker, clientPostProcessor, clientData) \
@@ -110,6 +236,20 @@ namespace DSL
             (new PersistenceOdeTrigger(name, \
                 source, classId, limit, minimum, maximum))
                 
+    #define DSL_ODE_TRIGGER_DWELL_PTR std::shared_ptr<DwellOdeTrigger>
+    #define DSL_ODE_TRIGGER_DWELL_NEW(name, \
+        source, classId, limit, threshold) \
+        std::shared_ptr<DwellOdeTrigger> \
+            (new DwellOdeTrigger(name, \
+                source, classId, limit, threshold))
+                
+    #define DSL_ODE_TRIGGER_VELOCITY_PTR std::shared_ptr<VelocityOdeTrigger>
+    #define DSL_ODE_TRIGGER_VELOCITY_NEW(name, \
+        source, classId, limit, minimum, maximum) \
+        std::shared_ptr<VelocityOdeTrigger> \
+            (new VelocityOdeTrigger(name, \
+                source, classId, limit, minimum, maximum))
+                
     #define DSL_ODE_TRIGGER_LATEST_PTR std::shared_ptr<LatestOdeTrigger>
     #define DSL_ODE_TRIGGER_LATEST_NEW(name, source, classId, limit) \
         std::shared_ptr<LatestOdeTrigger>(new LatestOdeTrigger(name, \
@@ -120,6 +260,11 @@ namespace DSL
         std::shared_ptr<EarliestOdeTrigger>(new EarliestOdeTrigger(name, \
             source, classId, limit))
 
+    #define DSL_ODE_TRIGGER_TOP_K_PTR std::shared_ptr<TopKOdeTrigger>
+    #define DSL_ODE_TRIGGER_TOP_K_NEW(name, source, classId, limit, k, key, order) \
+        std::shared_ptr<TopKOdeTrigger>(new TopKOdeTrigger(name, \
+            source, classId, limit, k, key, order))
+
 
     // Triggers for ClassA - ClassB Testing
 
@@ -153,7 +298,7 @@ namespace DSL
         /**
          * @brief total count of all events
          */
-        static uint64_t s_eventCount;
+        static std::atomic<uint64_t> s_eventCount;
         
         /**
          * @brief Function to check a given Object Meta data structure for the 
@@ -165,7 +310,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         virtual bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta){return false;};
 
         /**
@@ -176,7 +321,7 @@ namespace DSL
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre processing
          */
         virtual void PreProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
         
         /**
@@ -187,7 +332,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -299,6 +444,97 @@ namespace DSL
         bool RemoveLimitEventListener(
             dsl_ode_trigger_limit_event_listener_cb listener);
         
+        /**
+         * @brief Adds a "criteria change listener" function to be notified
+         * on any change to the Trigger's source, class-id, or enabled setting.
+         * Used by the parent ODE Pad Probe Handler to maintain its routing index.
+         * @return true if the listener function was successfully added, false otherwise.
+         */
+        bool AddCriteriaChangeListener(
+            dsl_ode_trigger_criteria_change_listener_cb listener, void* clientData);
+
+        /**
+         * @brief Removes a "criteria change listener" function previously added
+         * with a call to AddCriteriaChangeListener.
+         * @return true if the listener function was successfully removed, false otherwise.
+         */
+        bool RemoveCriteriaChangeListener(
+            dsl_ode_trigger_criteria_change_listener_cb listener);
+        
+        /**
+         * @brief Notifies all criteria change listeners. Must be called 
+         * with the property mutex held.
+         */
+        void NotifyCriteriaChangeListeners();
+        
+        /**
+         * @brief Gets the routing criteria for this Trigger, i.e. the source and 
+         * class-ids of all objects that can possibly meet the Trigger's criteria.
+         * @param[out] sourceId unique source-id to filter on, -1 for any source.
+         * @param[out] classIds one or more class-ids to filter on. A value of
+         * DSL_ODE_ANY_CLASS indicates any class.
+         * @return false if the Trigger is disabled and requires no objects. 
+         */
+        virtual bool GetRoutingCriteria(int* sourceId, std::vector<uint>& classIds);
+        
+        /**
+         * @brief Determines if the Trigger's frame-level processing is limited to
+         * the frames of its own source, i.e. the Trigger can be processed in 
+         * parallel with the Triggers of other sources without changing results. 
+         * False if the Trigger has no source filter, has an Accumulator or 
+         * Heat-Mapper which are updated on the frames of all sources, or has an 
+         * Action that is not reentrant.
+         * @return true if the Trigger can be processed per source.
+         */
+        virtual bool IsSourcePartitionable();
+        
+        /**
+         * @brief Gets the Trigger's criteria snapshot for the current frame, 
+         * pinned by PreProcessFrame so that all processing of a frame uses the
+         * same criteria. The pinned snapshot remains valid until the frame is 
+         * released with ReleaseCriteria. The current snapshot if no frame is in 
+         * progress, valid until the next criteria update.
+         * @return pointer to the immutable criteria snapshot.
+         */
+        const OdeTriggerCriteria* GetCriteria()
+        {
+            return (m_pFrameCriteria) 
+                ? m_pFrameCriteria
+                : m_pCriteria.load(std::memory_order_acquire);
+        };
+        
+        /**
+         * @brief Frees all criteria snapshots replaced since the last call. Must 
+         * only be called from the streaming thread between frames, when no other
+         * snapshot reads for this Trigger can be in progress.
+         */
+        void ReclaimCriteria();
+        
+        /**
+         * @brief Unpins the criteria snapshot pinned by PreProcessFrame once 
+         * the frame has been post-processed, so that snapshots replaced between
+         * frames are freed on update.
+         */
+        void ReleaseCriteria();
+        
+        /**
+         * @brief Gets the runtime metrics for this ODE Trigger. The metrics are
+         * recorded by the ODE Pad Probe Handler while its metrics are enabled.
+         * @return reference to the Trigger's runtime metrics.
+         */
+        OdeRuntimeMetrics& GetRuntimeMetrics()
+        {
+            // Don't log function entry/exit
+            return m_runtimeMetrics;
+        };
+        
+        /**
+         * @brief Handles a change to the Trigger's enabled setting by publishing
+         * a new criteria snapshot and notifying the criteria change listeners.
+         * Note: called with the property mutex held.
+         */
+        void HandleEnabledStateChange();
+        
         /**
          * @brief Gets the ClassId filter used for Object detection 
          * @return the current ClassId filter value
@@ -461,46 +697,130 @@ namespace DSL
          */
         void SetInterval(uint interval);
         
+        /**
+         * @brief Gets the current load-shedding priority for this Trigger
+         * @return one of the DSL_ODE_TRIGGER_PRIORITY constants, default = NORMAL
+         */
+        uint GetPriority();
+        
+        /**
+         * @brief Sets the load-shedding priority for this Trigger. LOW priority 
+         * Triggers are decimated by the parent ODE Pad Probe Handler when it 
+         * exceeds its time budget.
+         * @param[in] priority one of the DSL_ODE_TRIGGER_PRIORITY constants.
+         */
+        void SetPriority(uint priority);
+        
+        /**
+         * @brief Gets the current load-shedding interval for this Trigger.
+         * @return current load-shedding interval, 0 = not shedding.
+         */
+        uint GetShedInterval()
+        {
+            // Don't log function entry/exit
+            return m_shedInterval.load(std::memory_order_relaxed);
+        };
+        
+        /**
+         * @brief Sets the load-shedding interval for this Trigger, applied on top 
+         * of the process interval. Called by the parent ODE Pad Probe Handler.
+         * @param[in] interval new load-shedding interval in units of frames, 
+         * 0 = not shedding, DSL_ODE_TRIGGER_SHED_INTERVAL_ALL = skip all frames.
+         */
+        void SetShedInterval(uint interval)
+        {
+            // Don't log function entry/exit
+            m_shedInterval.store(interval, std::memory_order_relaxed);
+        };
+        
     protected:
     
+        /**
+         * @brief Pins the current criteria snapshot for the frame in progress.
+         * Called once per frame by PreProcessFrame.
+         * @return the pinned criteria snapshot.
+         */
+        const OdeTriggerCriteria* pinCriteria();
+        
+        /**
+         * @brief Determines if the current frame should be skipped according to 
+         * the current load-shedding interval. Called once per processed frame.
+         * @param[in] sourceId unique source-id of the frame.
+         * @return true if the frame should be skipped, false otherwise.
+         */
+        bool shedFrame(uint sourceId);
+    
         /**
          * @brief Common function to check if an Object's meta data meets the 
-         * min criteria for ODE occurrence.
+         * min criteria for ODE occurrence. Does not lock the property mutex.
+         * @param[in] pCriteria criteria snapshot to check against.
          * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
          * the frame that holds the Object Meta
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
          * for min criteria
          * @return true if Min Criteria is met, false otherwise
          */
-        bool CheckForMinCriteria(NvDsFrameMeta* pFrameMeta, 
-            NvDsObjectMeta* pObjectMeta);
+        bool CheckForMinCriteria(const OdeTriggerCriteria* pCriteria,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Common function to check if an Object's meta data meets the 
+         * min criteria for ODE occurrence using a specific class-id filter.
+         * @param[in] pCriteria criteria snapshot to check against.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - 
+         * the frame that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
+         * for min criteria
+         * @param[in] classId class-id filter to use in place of pCriteria->classId.
+         * @return true if Min Criteria is met, false otherwise
+         */
+        bool CheckForMinCriteria(const OdeTriggerCriteria* pCriteria,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta, uint classId);
 
         /**
          * @brief Common function to check if an Object's bbox fails within
          * one of the Triggers Areas
+         * @param[in] pCriteria criteria snapshot with the Areas to check.
          * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to test 
          * for within
          * @return true if the bbox is within one of the trigger's area, false otherwise
          */
-        bool CheckForInside(NvDsObjectMeta* pObjectMeta);
+        bool CheckForInside(const OdeTriggerCriteria* pCriteria,
+            NvDsObjectMeta* pObjectMeta);
         
         /**
          * @brief Common function to check if a Frame's source id meets the 
          * criteria for ODE occurrence.
+         * @param[in] pCriteria criteria snapshot to check against.
          * @param sourceId a Frame's Source Id to check against the trigger's 
          * source filter if set.
          * @return true if Source Id criteria is met, false otherwise
          */
-        bool CheckForSourceId(int sourceId);
+        bool CheckForSourceId(const OdeTriggerCriteria* pCriteria, int sourceId);
         
         /**
          * @brief Common function to check if an Objects's infer component id 
          * meets the criteria for ODE occurrence.
+         * @param[in] pCriteria criteria snapshot to check against.
          * @param inferId an object's inference component Id to check against 
          * the trigger's infer filter if set.
          * @return true if Source Id criteria is met, false otherwise
          */
-        bool CheckForInferId(int inferId);
+        bool CheckForInferId(const OdeTriggerCriteria* pCriteria, int inferId);
+        
+        /**
+         * @brief Publishes a new criteria snapshot built from the current property 
+         * values, retiring the previous. Must be called with the property mutex 
+         * held after any change to a value held in the snapshot.
+         */
+        void updateCriteria();
+        
+        /**
+         * @brief Copies the Trigger's current property values into a new criteria
+         * snapshot. Derived Triggers with additional criteria must call the base.
+         * @param[out] pCriteria new criteria snapshot to fill in.
+         */
+        virtual void copyCriteria(OdeTriggerCriteria* pCriteria);
         
         /**
          * @brief Increments the Trigger Occurrence counter and checks to see
@@ -509,6 +829,18 @@ namespace DSL
          */
         void IncrementAndCheckTriggerCount();
 
+        /**
+         * @brief Rebuilds the flat m_pOdeActionsList from m_pOdeActionsIndexed.
+         * Called on Action add/remove with the property mutex held.
+         */
+        void updateActionsList();
+
+        /**
+         * @brief Rebuilds the flat m_pOdeAreasList from m_pOdeAreasIndexed.
+         * Called on Area add/remove with the property mutex held.
+         */
+        void updateAreasList();
+
         /**
          * @brief Index variable to incremment/assign on ODE Area add.
          */
@@ -523,6 +855,12 @@ namespace DSL
          * @brief Map of child ODE Areas indexed by thier add-order for execution
          */
         std::map <uint, DSL_BASE_PTR> m_pOdeAreasIndexed;
+        
+        /**
+         * @brief Flat list of typed child ODE Area pointers in add-order, 
+         * iterated on every frame/object. Owned by the maps above.
+         */
+        std::vector<OdeArea*> m_pOdeAreasList;
 
         /**
          * @brief Index variable to incremment/assign on ODE Action add.
@@ -539,15 +877,40 @@ namespace DSL
          */
         std::map <uint, DSL_BASE_PTR> m_pOdeActionsIndexed;
         
+        /**
+         * @brief Flat list of typed child ODE Action pointers in add-order, 
+         * iterated on every occurrence. Owned by the maps above.
+         */
+        std::vector<OdeAction*> m_pOdeActionsList;
+        
         /**
          * @brief optional metric accumulator owned by the ODE Trigger.
          */
         DSL_BASE_PTR m_pAccumulator;
+        
+        /**
+         * @brief typed pointer to the optional accumulator, used on every 
+         * occurrence. Owned by m_pAccumulator.
+         */
+        OdeAccumulator* m_pOdeAccumulator;
     
         /**
          * @brief optional ODE Heat-Mapper owned by the ODE Trigger.
          */
         DSL_BASE_PTR m_pHeatMapper;
+        
+        /**
+         * @brief typed pointer to the optional Heat-Mapper, used on every 
+         * occurrence. Owned by m_pHeatMapper.
+         */
+        OdeHeatMapper* m_pOdeHeatMapper;
+        
+        /**
+         * @brief non-owning shared pointer to this Trigger, passed to the 
+         * Actions and Accumulator on each occurrence without the reference 
+         * counting of shared_from_this(). 
+         */
+        DSL_BASE_PTR m_pSelf;
     
         /**
          * @brief auto-reset timeout in units of seconds
@@ -571,16 +934,71 @@ namespace DSL
         std::map<dsl_ode_trigger_limit_event_listener_cb, 
             void*>m_limitEventListeners;
         
+        /**
+         * @brief map of all currently registered criteria-change-listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_ode_trigger_criteria_change_listener_cb, 
+            void*>m_criteriaChangeListeners;
+        
+        /**
+         * @brief Mutex for the criteria-change-listeners, separate from the 
+         * property mutex so that a parent Handler can remove its listener from 
+         * a client callback invoked while the property mutex is held.
+         */
+        GMutex m_criteriaListenersMutex;
+        
         /**
          * @brief current number of frames in the current interval
          */
         uint m_intervalCounter;
         
+        /**
+         * @brief load-shedding interval set by the parent ODE Pad Probe Handler,
+         * 0 = not shedding.
+         */
+        std::atomic<uint> m_shedInterval;
+        
+        /**
+         * @brief current number of frames in the current load-shedding interval,
+         * keyed by source-id.
+         */
+        std::unordered_map<uint, uint> m_shedCounters;
+        
         /**
          * @brief flag to identify frames that should be skipped, if m_skipFrameInterval > 0
          */
          bool m_skipFrame;
          
+        /**
+         * @brief current criteria snapshot, read without locking.
+         */
+        std::atomic<const OdeTriggerCriteria*> m_pCriteria;
+        
+        /**
+         * @brief criteria snapshot pinned for the frame in progress, NULL 
+         * between frames. Only accessed from the processing context.
+         */
+        const OdeTriggerCriteria* m_pFrameCriteria;
+        
+        /**
+         * @brief true while a frame is in progress, from PreProcessFrame until 
+         * ReleaseCriteria. Replaced snapshots are retired while set, and freed 
+         * on update otherwise.
+         */
+        std::atomic<bool> m_frameInProgress;
+        
+        /**
+         * @brief criteria snapshots replaced during a frame in progress, since 
+         * the last ReclaimCriteria.
+         */
+        std::vector<std::unique_ptr<const OdeTriggerCriteria>> m_pRetiredCriteria;
+        
+        /**
+         * @brief set when m_pRetiredCriteria has snapshots to reclaim.
+         */
+        std::atomic<bool> m_criteriaRetired;
+         
     public:
     
         // access made public for performance reasons
@@ -591,9 +1009,10 @@ namespace DSL
         std::wstring m_wName;
         
         /**
-         * @brief trigger count, incremented on every event occurrence
+         * @brief trigger count, incremented on every event occurrence. 
+         * Atomic as the limit is checked without locking.
          */
-        uint64_t m_triggered;    
+        std::atomic<uint64_t> m_triggered;    
     
         /**
          * @brief trigger limit, once reached, actions will no longer be invoked
@@ -612,6 +1031,11 @@ namespace DSL
          */
         uint m_occurrencesAccumulated;
         
+        /**
+         * @brief runtime metrics for this ODE Trigger.
+         */
+        OdeRuntimeMetrics m_runtimeMetrics;
+        
 
         /**
          * @brief unique source name filter for this event
@@ -677,6 +1101,11 @@ namespace DSL
          */
         uint m_interval;
         
+        /**
+         * @brief load-shedding priority, default = DSL_ODE_TRIGGER_PRIORITY_NORMAL
+         */
+        uint m_priority;
+        
         /**
          * @brief Minimum frame count numerator to trigger an ODE occurrence
          */
@@ -697,6 +1126,14 @@ namespace DSL
     
     static int TriggerResetTimeoutHandler(gpointer pTrigger);
     
+    /**
+     * @brief Enabled state change listener callback function, registered by 
+     * each Trigger with its OdeBase to notify its criteria change listeners.
+     * @param[in] enabled new enabled setting.
+     * @param[in] pTrigger pointer to the ODE Trigger that was updated.
+     */
+    static void TriggerEnabledStateChangeHandler(boolean enabled, void* pTrigger);
+    
     
     class AlwaysOdeTrigger : public OdeTrigger
     {
@@ -712,7 +1149,7 @@ namespace DSL
          * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre-processing
          */
         void PreProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -722,7 +1159,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta);
         
     private:
     
@@ -751,7 +1188,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
     private:
@@ -774,7 +1211,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -784,8 +1221,15 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+        
+        /**
+         * @brief The Absence Trigger is post processed for the frames of all
+         * sources, and therefore can not be processed per source.
+         * @return false always.
+         */
+        bool IsSourcePartitionable(){return false;};
 
     private:
     
@@ -804,6 +1248,20 @@ namespace DSL
          * @brief Overrides the base Reset in order to clear m_trackedObjectsPerSource
          */
         void Reset();
+        
+        /**
+         * @brief Gets the current miss tolerance for this TrackingOdeTrigger.
+         * @return number of consecutive frames a tracked object can go 
+         * undetected before it is purged.
+         */
+        uint GetMissTolerance();
+        
+        /**
+         * @brief Sets the miss tolerance for this TrackingOdeTrigger.
+         * @param[in] missTolerance number of consecutive frames a tracked object
+         * can go undetected before it is purged.
+         */
+        void SetMissTolerance(uint missTolerance);
 
     protected:
 
@@ -833,7 +1291,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -843,7 +1301,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, NvDsFrameMeta* pFrameMeta);
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta);
 
         /**
          * @brief Gets the current max-trace-point setting for this CrossOdeTrigger.
@@ -946,6 +1404,100 @@ namespace DSL
     
     };
     
+    /**
+     * @class OdeInstanceTable
+     * @brief Open-addressing (linear probing) hash table of the last Tracking Id
+     * seen for each source_id-class_id combination, keyed by the pair packed 
+     * into a single 64-bit value. Not thread safe - guarded by the owner.
+     */
+    class OdeInstanceTable
+    {
+    public:
+    
+        /**
+         * @brief ctor for the OdeInstanceTable class
+         */
+        OdeInstanceTable();
+        
+        /**
+         * @brief Finds the entry for a source_id-class_id combination, 
+         * inserting a new entry, initialized to 0, if not found.
+         * @param[in] sourceId source_id for the entry.
+         * @param[in] classId class_id for the entry.
+         * @return reference to the entry's last Tracking Id, valid until the 
+         * next call to Find, EvictSource, or Clear.
+         */
+        uint64_t& Find(uint sourceId, int classId);
+        
+        /**
+         * @brief Removes all entries for a given source_id.
+         * @param[in] sourceId source_id to evict.
+         */
+        void EvictSource(uint sourceId);
+        
+        /**
+         * @brief Removes all entries.
+         */
+        void Clear();
+        
+        /**
+         * @brief Gets the current number of entries.
+         * @return number of entries in use.
+         */
+        uint GetSize();
+        
+    private:
+    
+        /**
+         * @struct Entry
+         * @brief a single table entry.
+         */
+        struct Entry
+        {
+            uint64_t key;
+            uint64_t lastInstance;
+            bool inUse;
+        };
+        
+        /**
+         * @brief Packs a source_id-class_id combination into a single key.
+         */
+        static inline uint64_t packKey(uint sourceId, int classId)
+        {
+            return ((uint64_t)sourceId << 32) | (uint32_t)classId;
+        }
+        
+        /**
+         * @brief Mixes all bits of a key into the table index.
+         */
+        static inline uint64_t hashKey(uint64_t key)
+        {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            key ^= key >> 33;
+            return key;
+        }
+        
+        /**
+         * @brief Rebuilds the table with a new capacity, omitting all entries 
+         * for a given source_id.
+         * @param[in] capacity new capacity, must be a power of 2.
+         * @param[in] evictSource true to omit the entries for sourceId.
+         * @param[in] sourceId source_id to omit if evictSource is true.
+         */
+        void rebuild(uint capacity, bool evictSource, uint sourceId);
+        
+        /**
+         * @brief table entries, capacity is always a power of 2.
+         */
+        std::vector<Entry> m_entries;
+        
+        /**
+         * @brief number of entries in use.
+         */
+        uint m_size;
+    };
+
     class InstanceOdeTrigger : public OdeTrigger
     {
     public:
@@ -960,6 +1512,16 @@ namespace DSL
          */
         void Reset();
 
+        /**
+         * @brief Overrides the base PreProcessFrame in order to evict the
+         * instances for a source that has been removed and replaced.
+         * @param[in] pBuffer pointer to the GST Buffer containing all meta
+         * @param[in] pFrameMeta pointer to NvDsFrameMeta data for pre processing
+         */
+        void PreProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
+
         /**
          * @brief Function to check a given Object Meta data structure for New Instances of a Class
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta - that holds the Object Meta
@@ -968,14 +1530,19 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
             
     private:
         /**
-         * @brief map of last Tracking Ids per unique source_id-class_id combination
+         * @brief table of last Tracking Ids per unique source_id-class_id combination
+         */
+        OdeInstanceTable m_instances;
+        
+        /**
+         * @brief last frame number processed for each source_id, -1 if none.
          */
-        std::map <std::string, uint64_t> m_instances;
+        std::vector<gint> m_lastFrameNums;
     
     };
     
@@ -997,7 +1564,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1007,19 +1574,161 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
     
     };
     
-    class CustomOdeTrigger : public OdeTrigger
+    class ClassCountOdeTrigger : public OdeTrigger
     {
     public:
     
-        CustomOdeTrigger(const char* name, const char* source, 
-            uint classId, uint limit, dsl_ode_check_for_occurrence_cb clientChecker, 
+        ClassCountOdeTrigger(const char* name, const char* source, 
+            const uint* classIds, uint numClassIds, uint limit);
+        
+        ~ClassCountOdeTrigger();
+
+        /**
+         * @brief Gets the current set of class-ids counted by this Trigger.
+         * @param[out] classIds array of class-ids in ascending order.
+         * @param[out] numClassIds number of class-ids in the array.
+         */
+        void GetClassIds(const uint** classIds, uint* numClassIds);
+        
+        /**
+         * @brief Sets the set of class-ids to count. All counts are cleared.
+         * @param[in] classIds array of class-ids, duplicates are ignored.
+         * @param[in] numClassIds number of class-ids in the array.
+         * @return false if the array is empty or a class-id is out of range.
+         */
+        bool SetClassIds(const uint* classIds, uint numClassIds);
+        
+        /**
+         * @brief Gets the per-class counts from the last frame processed for 
+         * a given source. Does not lock the property mutex so that it can be 
+         * called from the Trigger's ODE Actions on invocation.
+         * @param[in] sourceId unique source-id to get the counts for.
+         * @param[out] counts array of counts, one per class-id in ascending 
+         * class-id order, all 0 if no frame has been processed for the source.
+         * @param[out] size number of counts in the array.
+         */
+        void GetClassCounts(uint sourceId, const uint** counts, uint* size);
+        
+        /**
+         * @brief Gets the routing criteria for this Trigger, the source-id 
+         * and all class-ids to count.
+         * @param[out] sourceId unique source-id to filter on, -1 for any source.
+         * @param[out] classIds all class-ids to filter on.
+         * @return false if the Trigger is disabled and requires no objects. 
+         */
+        bool GetRoutingCriteria(int* sourceId, std::vector<uint>& classIds);
+
+        /**
+         * @brief Function to pre process the frame, resetting the per-class 
+         * counts for the current frame.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to pre process.
+         */
+        void PreProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData,
+            NvDsFrameMeta* pFrameMeta);
+
+        /**
+         * @brief Function to check a given Object Meta data structure for Object 
+         * occurrence, counting the Object against its class-id if in the set.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
+         * Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame 
+         * that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData,
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to post process the frame, saving the per-class counts
+         * for the frame's source and generating a Class Count Event.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta);
+
+    protected:
+    
+        /**
+         * @brief Copies the base criteria along with the set of class-ids 
+         * into a new criteria snapshot.
+         * @param[out] pCriteria new criteria snapshot to fill in.
+         */
+        void copyCriteria(OdeTriggerCriteria* pCriteria);
+
+    private:
+    
+        /**
+         * @brief Updates the set, list, and indices of class-ids to count. 
+         * Must be called with the property mutex held.
+         * @param[in] classIds array of valid class-ids.
+         * @param[in] numClassIds number of class-ids in the array.
+         */
+        void setClassIds(const uint* classIds, uint numClassIds);
+    
+        /**
+         * @brief set of class-ids to count.
+         */
+        std::bitset<DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES> m_classIdSet;
+        
+        /**
+         * @brief class-ids to count in ascending order.
+         */
+        std::vector<uint> m_classIds;
+        
+        /**
+         * @brief index into m_classIds and the count vectors for each class-id.
+         */
+        std::vector<uint16_t> m_classIndices;
+        
+        /**
+         * @brief per-class counts for the current frame.
+         */
+        std::vector<uint> m_classCounts;
+        
+        /**
+         * @brief mutex to guard the per-class counts of the last frame 
+         * processed for each source, separate from the property mutex.
+         */
+        GMutex m_countsMutex;
+        
+        /**
+         * @brief map of source-id to per-class counts for the last frame 
+         * processed for the source.
+         */
+        std::map<uint, std::vector<uint>> m_sourceClassCounts;
+        
+        /**
+         * @brief number of per-class counts for each source, guarded by 
+         * m_countsMutex.
+         */
+        uint m_numClassCounts;
+        
+        /**
+         * @brief per-class counts returned by GetClassCounts.
+         */
+        std::vector<uint> m_outCounts;
+    };
+    
+    class CustomOdeTrigger : public OdeTrigger
+    {
+    public:
+    
+        CustomOdeTrigger(const char* name, const char* source, 
+            uint classId, uint limit, dsl_ode_check_for_occurrence_cb clientChecker, 
             dsl_ode_post_process_frame_cb clientPostProcessor, void* clientData);
         
         ~CustomOdeTrigger();
@@ -1038,7 +1747,7 @@ namespace DSL
          */
 
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
         /**
          * @brief Function to call the client provided callback to post process the frame 
@@ -1047,9 +1756,16 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
         
+        /**
+         * @brief The client's post-process callback is called for the frames of
+         * all sources, and therefore the Trigger can not be processed per source.
+         * @return false always.
+         */
+        bool IsSourcePartitionable(){return false;};
+        
     private:
     
         /**
@@ -1088,7 +1804,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1099,7 +1815,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1130,7 +1846,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1141,7 +1857,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1188,7 +1904,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1200,7 +1916,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1216,6 +1932,261 @@ namespace DSL
         double m_maximumMs;
     };
 
+    class DwellOdeTrigger : public TrackingOdeTrigger
+    {
+    public:
+    
+        DwellOdeTrigger(const char* name, const char* source, uint classId, 
+            uint limit, uint threshold);
+        
+        ~DwellOdeTrigger();
+
+        /**
+         * @brief Gets the current dwell-time threshold in use.
+         * @return current threshold in units of seconds.
+         */
+        uint GetThreshold();
+
+        /**
+         * @brief Sets the dwell-time threshold to use.
+         * @param[in] threshold new threshold in units of seconds, 0 = on entry.
+         */
+        void SetThreshold(uint threshold);
+
+        /**
+         * @brief Gets the current occupancy of one of the Trigger's Areas.
+         * @param[in] pArea shared pointer to the ODE Area to query.
+         * @param[out] occupancy number of tracked objects inside the Area.
+         * @return false if the Area is not a child of this Trigger.
+         */
+        bool GetOccupancy(DSL_BASE_PTR pArea, uint* occupancy);
+
+        /**
+         * @brief Overrides the base Reset in order to clear the occupancy
+         * of all Areas.
+         */
+        void Reset();
+
+        /**
+         * @brief Function to check a given Object Meta data structure for 
+         * entering, leaving, or dwelling inside each of the Trigger's Areas.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
+         * Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame 
+         * that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to post process the frame, purging the tracked objects
+         * that have not been detected within the miss tolerance.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData,  
+            NvDsFrameMeta* pFrameMeta);
+            
+        /**
+         * @brief Handles the removal of a tracked object by decrementing the 
+         * occupancy of each Area the object was inside.
+         * @param[in] pTrackedObject tracked object that is about to be removed.
+         */
+        void HandleTrackedObjectRemove(TrackedObject* pTrackedObject);
+
+    protected:
+    
+        /**
+         * @brief Overrides the base copyCriteria in order to clear all tracked 
+         * objects and occupancy counts when the Trigger's Areas change.
+         * @param[in] pCriteria criteria snapshot to fill in.
+         */
+        void copyCriteria(OdeTriggerCriteria* pCriteria);
+
+    private:
+
+        /**
+         * @brief dwell-time threshold in units of ms.
+         */
+        double m_thresholdMs;
+        
+        /**
+         * @brief Areas the occupancy counts and the tracked objects' area 
+         * states are indexed by, i.e. m_pOdeAreasList when last updated.
+         */
+        std::vector<OdeArea*> m_dwellAreas;
+        
+        /**
+         * @brief true for each Area in m_dwellAreas that is an Exclusion Area,
+         * i.e. an object is inside when outside of the Area's polygon.
+         */
+        std::vector<bool> m_areaExclusions;
+    
+        /**
+         * @brief mutex to guard the occupancy counts, separate from the 
+         * property mutex so they can be queried while Actions are invoked.
+         */
+        GMutex m_occupancyMutex;
+        
+        /**
+         * @brief current number of tracked objects inside each Area, for 
+         * all sources, indexed by Area.
+         */
+        std::vector<uint> m_occupancy;
+    };
+    
+    /**
+     * @brief Tracked object remove listener callback function, registered 
+     * with the tracked objects of each DwellOdeTrigger.
+     * @param[in] pTrackedObject tracked object that is about to be removed.
+     * @param[in] pTrigger pointer to the Dwell ODE Trigger to notify.
+     */
+    static void DwellTrackedObjectRemoveListener(
+        TrackedObject* pTrackedObject, void* pTrigger);
+
+    /**
+     * @brief Weight of each new velocity in the running velocity estimate 
+     * maintained by the Velocity Trigger for each tracked object.
+     */
+    #define DSL_ODE_TRIGGER_VELOCITY_SMOOTHING  0.5
+
+    class VelocityOdeTrigger : public TrackingOdeTrigger
+    {
+    public:
+    
+        VelocityOdeTrigger(const char* name, const char* source, uint classId, 
+            uint limit, double minimum, double maximum);
+        
+        ~VelocityOdeTrigger();
+
+        /**
+         * @brief Gets the current minimum and maximum speed settings in use. 
+         * A value of 0 means no minimum or maximum.
+         * @param[out] minimum current minimum speed setting in use.
+         * @param[out] maximum current maximum speed setting in use.
+         */
+        void GetSpeedRange(double* minimum, double* maximum);
+
+        /**
+         * @brief Sets new minimum and maximum speed settings to use.
+         * A value of 0 means no minimum or maximum.
+         * @param[in] minimum new minimum speed to use.
+         * @param[in] maximum new maximum speed to use.
+         */
+        void SetSpeedRange(double minimum, double maximum);
+
+        /**
+         * @brief Gets the current heading range in use.
+         * @param[out] minimum start of the heading range in degrees.
+         * @param[out] maximum end of the heading range in degrees.
+         */
+        void GetHeadingRange(uint* minimum, uint* maximum);
+
+        /**
+         * @brief Sets a new heading range to use. The range wraps through 0
+         * if minimum > maximum.
+         * @param[in] minimum start of the heading range in degrees, <= 360.
+         * @param[in] maximum end of the heading range in degrees, <= 360.
+         */
+        void SetHeadingRange(uint minimum, uint maximum);
+
+        /**
+         * @brief Sets the homography to transform object positions for a source.
+         * All tracked objects are cleared as their positions are no longer
+         * in the same units.
+         * @param[in] sourceId source to set the homography for.
+         * @param[in] homography 3x3 matrix, as 9 values in row-major order.
+         * @return false if the matrix is not finite and invertible.
+         */
+        bool SetHomography(uint sourceId, const double* homography);
+
+        /**
+         * @brief Removes the homography for a source. All tracked objects 
+         * are cleared as their positions are no longer in the same units.
+         * @param[in] sourceId source to remove the homography for.
+         * @return false if the source has no homography.
+         */
+        bool RemoveHomography(uint sourceId);
+
+        /**
+         * @brief Function to check a given Object Meta data structure for Object 
+         * occurrence, updating the running velocity estimate for the object.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
+         * Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame 
+         * that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to post process the frame, purging the tracked objects
+         * that have not been detected within the miss tolerance.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData,  
+            NvDsFrameMeta* pFrameMeta);
+
+    private:
+    
+        /**
+         * @brief Transforms a position with the homography for a source, if set.
+         * @param[in] sourceId source the position is from.
+         * @param[in,out] x position to transform.
+         * @param[in,out] y position to transform.
+         * @return false if the position can't be transformed, i.e. it maps to
+         * the horizon line of the homography.
+         */
+        bool transformPosition(uint sourceId, double& x, double& y);
+
+        /**
+         * @struct Homography
+         * @brief 3x3 homography matrix for a single source.
+         */
+        struct Homography
+        {
+            double matrix[9];
+            bool enabled;
+        };
+
+        /**
+         * @brief minimum speed to trigger an occurrence - 0 = no minimum.
+         */
+        double m_minimumSpeed;
+    
+        /**
+         * @brief maximum speed to trigger an occurrence - 0 = no maximum.
+         */
+        double m_maximumSpeed;
+        
+        /**
+         * @brief start of the heading range in degrees.
+         */
+        uint m_minimumHeading;
+        
+        /**
+         * @brief end of the heading range in degrees.
+         */
+        uint m_maximumHeading;
+        
+        /**
+         * @brief homographies indexed by source id, vector for constant
+         * time lookup per object.
+         */
+        std::vector<Homography> m_homographies;
+    };
+    
     class CountOdeTrigger : public OdeTrigger
     {
     public:
@@ -1252,7 +2223,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1263,7 +2234,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1299,7 +2270,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1310,17 +2281,21 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
     
         /**
-         * @brief list of pointers to NvDsObjectMeta data
-         * Each object occurrence that matches the min criteria will be added
-         * to list to be checked for Smallest object on PostProcessFrame
+         * @brief pointer to the smallest object occurrence that met the min 
+         * criteria for the current frame, NULL if none.
          */ 
-        std::vector<NvDsObjectMeta*> m_occurrenceMetaList;
+        NvDsObjectMeta* m_pSmallestObjectMeta;
+        
+        /**
+         * @brief rectangle area of the smallest object for the current frame.
+         */
+        uint m_smallestArea;
     
     };
 
@@ -1343,7 +2318,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1354,20 +2329,152 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
     
         /**
-         * @brief list of pointers to NvDsObjectMeta data
-         * Each object occurrence that matches the min criteria will be added
-         * to list to be checked for Largest object on PostProcessFrame
+         * @brief pointer to the largest object occurrence that met the min 
+         * criteria for the current frame, NULL if none.
          */ 
-        std::vector<NvDsObjectMeta*> m_occurrenceMetaList;
+        NvDsObjectMeta* m_pLargestObjectMeta;
+        
+        /**
+         * @brief rectangle area of the largest object for the current frame.
+         */
+        uint m_largestArea;
     
     };
 
+    class TopKOdeTrigger : public TrackingOdeTrigger
+    {
+    public:
+    
+        TopKOdeTrigger(const char* name, const char* source, uint classId, 
+            uint limit, uint k, uint key, uint order);
+        
+        ~TopKOdeTrigger();
+
+        /**
+         * @brief Gets the current K, key, and order settings in use.
+         * @param[out] k maximum number of objects to trigger on per frame.
+         * @param[out] key one of the DSL_ODE_TRIGGER_TOP_K_KEY constants.
+         * @param[out] order one of the DSL_ODE_TRIGGER_TOP_K_ORDER constants.
+         */
+        void GetSettings(uint* k, uint* key, uint* order);
+
+        /**
+         * @brief Sets the K, key, and order settings to use.
+         * @param[in] k maximum number of objects to trigger on per frame.
+         * @param[in] key one of the DSL_ODE_TRIGGER_TOP_K_KEY constants.
+         * @param[in] order one of the DSL_ODE_TRIGGER_TOP_K_ORDER constants.
+         */
+        void SetSettings(uint k, uint key, uint order);
+
+        /**
+         * @brief Function to check a given Object Meta data structure for Object 
+         * occurrence, keeping the Object if it ranks within the current Top-K.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame 
+         * Meta - that holds the Object Meta
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data - the frame 
+         * that holds the Object Meta
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to check
+         * @return true if Occurrence, false otherwise
+         */
+        bool CheckForOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+
+        /**
+         * @brief Function to post process the frame and generate a Top-K ODE 
+         * occurrence for each of the Top-K objects, in rank order.
+         * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
+         * @param[in] pFrameMeta Frame meta data to post process.
+         * @return the number of ODE Occurrences triggered on post process
+         */
+        uint PostProcessFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData,  
+            NvDsFrameMeta* pFrameMeta);
+
+    private:
+    
+        /**
+         * @struct TopKEntry
+         * @brief An object occurrence kept in the Top-K heap.
+         */
+        struct TopKEntry
+        {
+            /**
+             * @brief the object's key value.
+             */
+            double key;
+            
+            /**
+             * @brief order of occurrence within the frame, used to rank
+             * objects with the same key value - first one wins.
+             */
+            uint sequence;
+            
+            /**
+             * @brief the object's meta data.
+             */
+            NvDsObjectMeta* pObjectMeta;
+        };
+        
+        /**
+         * @brief Gets the key value for a given object occurrence, updating
+         * the object's tracked duration if the key is DWELL.
+         * @param[in] pFrameMeta pointer to the parent NvDsFrameMeta data.
+         * @param[in] pObjectMeta pointer to a NvDsObjectMeta data to get the key for.
+         * @return the object's key value.
+         */
+        double getKey(NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
+        
+        /**
+         * @brief Determines if one object occurrence ranks ahead of another
+         * according to the current order setting.
+         * @return true if occurrence a ranks ahead of occurrence b.
+         */
+        bool ranksAhead(const TopKEntry& a, const TopKEntry& b)
+        {
+            // Don't log function entry/exit
+            if (a.key != b.key)
+            {
+                return (m_order == DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST) 
+                    ? (a.key > b.key) : (a.key < b.key);
+            }
+            return a.sequence < b.sequence;
+        };
+    
+        /**
+         * @brief maximum number of objects to trigger on per frame.
+         */
+        uint m_k;
+        
+        /**
+         * @brief one of the DSL_ODE_TRIGGER_TOP_K_KEY constants.
+         */
+        uint m_key;
+        
+        /**
+         * @brief one of the DSL_ODE_TRIGGER_TOP_K_ORDER constants.
+         */
+        uint m_order;
+        
+        /**
+         * @brief number of objects that have occurred in the current frame.
+         */
+        uint m_sequence;
+        
+        /**
+         * @brief heap of the current Top-K object occurrences, with the lowest
+         * ranked occurrence at the front. Capacity is reserved for K entries 
+         * so the heap never grows while processing frames.
+         */
+        std::vector<TopKEntry> m_topKHeap;
+    };
+
     class LatestOdeTrigger : public TrackingOdeTrigger
     {
     public:
@@ -1387,7 +2494,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1398,7 +2505,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1433,7 +2540,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1444,7 +2551,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,  
+            DisplayMetaData& displayMetaData,  
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1484,7 +2591,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1495,7 +2602,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1537,7 +2644,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1548,7 +2655,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     private:
@@ -1591,7 +2698,7 @@ namespace DSL
          * @return true if Occurrence, false otherwise
          */
         bool CheckForOccurrence(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData,
+            DisplayMetaData& displayMetaData,
             NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMeta);
 
         /**
@@ -1601,7 +2708,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrame(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -1619,9 +2726,67 @@ namespace DSL
          * @param[in] classId new filter value to use
          */
         void SetClassIdAB(uint classIdA, uint classIdB);
+        
+        /**
+         * @brief Gets the routing criteria for this ABOdeTrigger, the 
+         * source-id and both class-ids A and B.
+         * @param[out] sourceId unique source-id to filter on, -1 for any source.
+         * @param[out] classIds class-ids A and B to filter on.
+         * @return false if the Trigger is disabled and requires no objects. 
+         */
+        bool GetRoutingCriteria(int* sourceId, std::vector<uint>& classIds);
+        
+        /**
+         * @brief Gets the minimum number of objects in a frame required to use 
+         * the broad-phase when selecting the object pairs to test.
+         * @return current minimum number of objects.
+         */
+        uint GetBroadPhaseMinObjects();
+        
+        /**
+         * @brief Sets the minimum number of objects in a frame required to use 
+         * the broad-phase. Set to 0 to always, or UINT32_MAX to never use it.
+         * @param[in] minObjects new minimum number of objects to use.
+         */
+        void SetBroadPhaseMinObjects(uint minObjects);
 
     protected:
 
+        /**
+         * @brief Builds the list of candidate object pairs to test for the 
+         * current frame, ordered as a brute-force nested loop would test them. 
+         * The broad-phase is used if enough objects have occurred and the 
+         * derived class is able to prepare it. Otherwise, all pairs are added.
+         */
+        void buildCandidatePairs();
+        
+        /**
+         * @brief Fills in the broad-phase boxes for all objects in the current
+         * frame. Implemented by each derived class according to how it tests 
+         * a pair of objects.
+         * @param[out] margin maximum gap between two boxes for the objects to
+         * be tested exactly.
+         * @return false if the broad-phase cannot be used for the current frame.
+         */
+        virtual bool prepareBroadPhase(double* margin) = 0;
+        
+        /**
+         * @brief Handles an ODE occurrence for a pair of objects, updating the 
+         * counts and primary metrics and invoking all actions for both objects.
+         * @return true if the trigger limit has been reached.
+         */
+        bool handlePairOccurrence(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, 
+            NvDsFrameMeta* pFrameMeta, NvDsObjectMeta* pObjectMetaA, 
+            NvDsObjectMeta* pObjectMetaB);
+
+        /**
+         * @brief Copies the base criteria along with class-ids A and B into 
+         * a new criteria snapshot.
+         * @param[out] pCriteria new criteria snapshot to fill in.
+         */
+        void copyCriteria(OdeTriggerCriteria* pCriteria);
+
         /**
          * @brief Function to post process the frame and generate a Distance Event - Class A Only
          * @param[in] pBuffer pointer to batched stream buffer - that holds the Frame Meta
@@ -1629,7 +2794,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta) = 0;
 
         /**
@@ -1639,7 +2804,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         virtual uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta) = 0;
 
         /**
@@ -1670,6 +2835,32 @@ namespace DSL
          * @brief Class ID to for A objects for A-B distance calculation
          */
         uint m_classIdB;
+        
+        /**
+         * @brief minimum number of objects in a frame to use the broad-phase.
+         */
+        uint m_broadPhaseMinObjects;
+        
+        /**
+         * @brief sort-and-sweep broad-phase used to find the candidate pairs.
+         */
+        BroadPhase m_broadPhase;
+        
+        /**
+         * @brief broad-phase boxes for each object in m_occurrenceMetaListA.
+         */
+        std::vector<BroadPhaseBox> m_broadPhaseBoxesA;
+        
+        /**
+         * @brief broad-phase boxes for each object in m_occurrenceMetaListB.
+         */
+        std::vector<BroadPhaseBox> m_broadPhaseBoxesB;
+        
+        /**
+         * @brief candidate pairs of indices into the occurrence lists to test 
+         * for the current frame.
+         */
+        std::vector<BroadPhasePair> m_candidatePairs;
     };
 
     class DistanceOdeTrigger : public ABOdeTrigger
@@ -1722,7 +2913,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
         /**
@@ -1732,7 +2923,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
 
     
@@ -1746,6 +2937,41 @@ namespace DSL
          */
         bool CheckDistance(NvDsObjectMeta* pObjectMetaA, 
             NvDsObjectMeta* pObjectMetaB);
+            
+        /**
+         * @brief Fills in the broad-phase boxes with each object's test point
+         * or bounding box. The broad-phase is only used if no pair of objects 
+         * can be further apart than the maximum distance.
+         * @param[out] margin largest minimum distance of all objects.
+         * @return true if the broad-phase can be used for the current frame.
+         */
+        bool prepareBroadPhase(double* margin);
+        
+        /**
+         * @brief Adds a broad-phase box for an object's test geometry, and 
+         * updates the largest minimum and smallest maximum distances.
+         */
+        void addBroadPhaseBox(NvDsObjectMeta* pObjectMeta, 
+            std::vector<BroadPhaseBox>& boxes, uint* maxMinimum, uint* minMaximum);
+        
+        /**
+         * @brief Gets an object's test point based on the current m_testPoint.
+         * @param[in] pObjectMeta pointer to the object's meta data.
+         * @param[out] x rounded x coordinate of the test point.
+         * @param[out] y rounded y coordinate of the test point.
+         */
+        void getTestPoint(NvDsObjectMeta* pObjectMeta, uint* x, uint* y);
+        
+        /**
+         * @brief Gets the minimum and maximum distance for a pair of objects
+         * based on the current m_testMethod.
+         * @param[in] pObjectMetaA pointer to Object A's meta data.
+         * @param[in] pObjectMetaB pointer to Object B's meta data.
+         * @param[out] minimum minimum distance in pixels.
+         * @param[out] maximum maximum distance in pixels.
+         */
+        void getRange(NvDsObjectMeta* pObjectMetaA, 
+            NvDsObjectMeta* pObjectMetaB, uint* minimum, uint* maximum);
     
         
         /**
@@ -1787,7 +3013,7 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameA(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
     
         /**
@@ -1797,8 +3023,21 @@ namespace DSL
          * @return the number of ODE Occurrences triggered on post process
          */
         uint PostProcessFrameAB(GstBuffer* pBuffer, 
-            std::vector<NvDsDisplayMeta*>& displayMetaData, 
+            DisplayMetaData& displayMetaData, 
             NvDsFrameMeta* pFrameMeta);
+            
+        /**
+         * @brief Fills in the broad-phase boxes with each object's bounding box.
+         * @param[out] margin always 0, the boxes of overlapping objects must intersect.
+         * @return true, the broad-phase can always be used.
+         */
+        bool prepareBroadPhase(double* margin);
+        
+        /**
+         * @brief Adds a broad-phase box for an object's bounding box.
+         */
+        void addBroadPhaseBox(NvDsObjectMeta* pObjectMeta, 
+            std::vector<BroadPhaseBox>& boxes);
     };
 
 }
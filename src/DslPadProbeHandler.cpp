@@ -24,6 +24,7 @@ THE SOFTWARE.
 
 #include "Dsl.h"
 #include "DslPadProbeHandler.h"
+#include "DslOdeAction.h"
 #include "DslBase.h"
 #include "DslBintr.h"
 
@@ -112,7 +113,19 @@ namespace DSL
     OdePadProbeHandler::OdePadProbeHandler(const char* name)
         : PadProbeHandler(name)
         , m_nextTriggerIndex(0)
-        , m_displayMetaAllocSize(1)
+        , m_displayMetaAllocSize(16)
+        , m_pBatchTable(NULL)
+        , m_pBatchBuffer(NULL)
+        , m_routingIndexDirty(false)
+        , m_actionBatchingEnabled(false)
+        , m_metricsEnabled(false)
+        , m_batchMetered(false)
+        , m_batchOccurrences(0)
+        , m_timeBudget(0)
+        , m_maxShedInterval(0)
+        , m_shedInterval(0)
+        , m_shedHoldBatches(0)
+        , m_averageBatchTime(0)
     {
         LOG_FUNC();
         
@@ -126,49 +139,278 @@ namespace DSL
     OdePadProbeHandler::~OdePadProbeHandler()
     {
         LOG_FUNC();
+        
+        // Remove all Triggers now to unregister this Handler's listeners
+        RemoveAllChildren();
     }
 
     bool OdePadProbeHandler::AddChild(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
         if (!Base::AddChild(pChild))
         {
             return false;
         }
         
+        // Listen for changes to the Trigger's routing criteria
+        if (!std::dynamic_pointer_cast<OdeTrigger>(pChild)->AddCriteriaChangeListener(
+            OdeTriggerCriteriaChangeListener, this))
+        {
+            LOG_ERROR("ODE Pad Probe Handler '" << GetName() 
+                << "' failed to add criteria change listener to Trigger '" 
+                << pChild->GetName() << "'");
+            Base::RemoveChild(pChild);
+            return false;
+        }
+        
         // increment next index, assign to the Trigger
         pChild->SetIndex(++m_nextTriggerIndex);
 
         // Add the child to the Indexed map 
         m_pChildrenIndexed[m_nextTriggerIndex] = pChild;
         
+        updateTriggersList();
+        
         return true;
     }
 
     bool OdePadProbeHandler::RemoveChild(DSL_BASE_PTR pChild)
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
         if (!Base::RemoveChild(pChild))
         {
             return false;
         }
         
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->RemoveCriteriaChangeListener(
+            OdeTriggerCriteriaChangeListener);
+        std::dynamic_pointer_cast<OdeTrigger>(pChild)->SetShedInterval(0);
+        
         // Remove the the child from Indexed map
         m_pChildrenIndexed.erase(pChild->GetIndex());
         
+        // Release the Trigger from the current dispatch table. A batch in 
+        // progress holds its own reference until done.
+        m_pDispatchTable = nullptr;
+        
+        updateTriggersList();
+        
         return true;
     }
 
     void OdePadProbeHandler::RemoveAllChildren()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
         
+        for (const auto &pOdeTrigger: m_pTriggersList)
+        {
+            pOdeTrigger->RemoveCriteriaChangeListener(
+                OdeTriggerCriteriaChangeListener);
+            pOdeTrigger->SetShedInterval(0);
+        }
         Base::RemoveAllChildren();
         
-        // Remove all children from Indexed map
+        // Remove all children from Indexed map, flat list, and dispatch table
         m_pChildrenIndexed.clear();
+        m_pTriggersList.clear();
+        m_pDispatchTable = nullptr;
+    }
+
+    void OdePadProbeHandler::updateTriggersList()
+    {
+        LOG_FUNC();
+        
+        // Rebuild the flat, add-ordered list of typed Trigger pointers iterated
+        // by the streaming thread. Ownership remains with m_pChildrenIndexed.
+        m_pTriggersList.clear();
+        m_pTriggersList.reserve(m_pChildrenIndexed.size());
+        
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            m_pTriggersList.push_back(
+                std::dynamic_pointer_cast<OdeTrigger>(imap.second).get());
+        }
+        
+        // the routing index must be rebuilt on next buffer
+        m_routingIndexDirty = true;
+    }
+
+    void OdePadProbeHandler::HandleTriggerCriteriaChange()
+    {
+        // Note: may be called with the Trigger's mutex held, from the client's 
+        // context or from the streaming thread. Only flag the index as dirty to 
+        // avoid lock-order inversion. The index is rebuilt from the streaming thread.
+        m_routingIndexDirty = true;
+    }
+
+    void OdePadProbeHandler::updateRoutingIndex()
+    {
+        LOG_FUNC();
+        
+        std::shared_ptr<DispatchTable> pTable = 
+            std::shared_ptr<DispatchTable>(new DispatchTable);
+        
+        pTable->pWorkerPool = m_pWorkerPool;
+        pTable->pTriggersList = m_pTriggersList;
+        for (const auto &imap: m_pChildrenIndexed)
+        {
+            pTable->pOwners.push_back(imap.second);
+        }
+
+        // Routing criteria for each enabled Trigger, in add-order
+        std::vector<RoutingCriteria> criteria;
+        std::vector<RoutingCriteria> partitionedCriteria;
+        std::vector<RoutingCriteria> serialCriteria;
+        
+        for (const auto &pOdeTrigger: m_pTriggersList)
+        {
+            int sourceId(-1);
+            std::vector<uint> triggerClassIds;
+            
+            bool enabled = pOdeTrigger->GetRoutingCriteria(&sourceId, triggerClassIds);
+            
+            // When processing in parallel, a Trigger can only be handed to a single 
+            // source's worker if it is enabled, bound to a resolved source-id, and
+            // does no processing for frames from any other source. 
+            bool partitioned = m_pWorkerPool and enabled and sourceId != -1 and
+                pOdeTrigger->IsSourcePartitionable();
+                
+            if (m_pWorkerPool)
+            {
+                if (partitioned)
+                {
+                    pTable->partitionedTriggers[sourceId].push_back(pOdeTrigger);
+                }
+                else
+                {
+                    // Disabled Triggers must still pre/post-process each frame
+                    pTable->pSerialTriggersList.push_back(pOdeTrigger);
+                }
+            }
+            if (!enabled)
+            {
+                continue;
+            }
+            uint sourceKey = (sourceId == -1) 
+                ? DSL_ODE_ROUTING_ANY_SOURCE 
+                : (uint)sourceId;
+                
+            RoutingCriteria triggerCriteria{pOdeTrigger, sourceKey, triggerClassIds};
+            
+            criteria.push_back(triggerCriteria);
+            if (m_pWorkerPool)
+            {
+                if (partitioned)
+                {
+                    partitionedCriteria.push_back(triggerCriteria);
+                }
+                else
+                {
+                    serialCriteria.push_back(triggerCriteria);
+                }
+            }
+        }
+        buildRoutingIndex(criteria, pTable->routingIndex);
+        
+        if (m_pWorkerPool)
+        {
+            buildRoutingIndex(partitionedCriteria, pTable->partitionedRoutingIndex);
+            buildRoutingIndex(serialCriteria, pTable->serialRoutingIndex);
+            
+            LOG_INFO("ODE Pad Probe Handler '" << GetName() << "' partitioned "
+                << partitionedCriteria.size() << " Triggers across " 
+                << pTable->partitionedTriggers.size() << " sources with "
+                << pTable->pSerialTriggersList.size() << " Triggers processed serially");
+        }
+        LOG_INFO("ODE Pad Probe Handler '" << GetName() << "' routing index updated with "
+            << criteria.size() << " enabled Triggers and " 
+            << pTable->routingIndex.size() << " routes");
+        
+        m_pDispatchTable = pTable;
+        
+        // Trigger priorities may have changed, or Triggers added/removed.
+        applyShedInterval();
+    }
+    
+    void OdePadProbeHandler::buildRoutingIndex(
+        const std::vector<RoutingCriteria>& criteria, RoutingIndexT& routingIndex)
+    {
+        LOG_FUNC();
+        
+        // Unique set of specific source and class ids in use, plus wildcards
+        std::set<uint> sourceIds{DSL_ODE_ROUTING_ANY_SOURCE};
+        std::set<uint> classIds{DSL_ODE_ANY_CLASS};
+        
+        for (const auto &triggerCriteria: criteria)
+        {
+            sourceIds.insert(triggerCriteria.sourceKey);
+            classIds.insert(triggerCriteria.classIds.begin(), 
+                triggerCriteria.classIds.end());
+        }
+        
+        // Build an add-ordered candidate list for every (source, class) combination,
+        // including wildcards. An Object whose source or class-id is not in use by
+        // any Trigger falls back to the corresponding wildcard list on lookup.
+        for (const auto sourceId: sourceIds)
+        {
+            for (const auto classId: classIds)
+            {
+                std::vector<OdeTrigger*>& candidates = 
+                    routingIndex[routingKey(sourceId, classId)];
+                    
+                for (const auto &triggerCriteria: criteria)
+                {
+                    if (triggerCriteria.sourceKey != DSL_ODE_ROUTING_ANY_SOURCE and
+                        triggerCriteria.sourceKey != sourceId)
+                    {
+                        continue;
+                    }
+                    for (const auto triggerClassId: triggerCriteria.classIds)
+                    {
+                        if (triggerClassId == DSL_ODE_ANY_CLASS or 
+                            triggerClassId == classId)
+                        {
+                            candidates.push_back(triggerCriteria.pOdeTrigger);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    
+    const std::vector<OdeTrigger*>* OdePadProbeHandler::getRoutedTriggers(
+        const RoutingIndexT& routingIndex, uint sourceId, uint classId)
+    {
+        // Do not log function entry
+        
+        // Most specific match first, then fall back to the wildcard routes. 
+        // Each list already includes all matching wildcard Triggers.
+        auto ivec = routingIndex.find(routingKey(sourceId, classId));
+        if (ivec == routingIndex.end())
+        {
+            ivec = routingIndex.find(routingKey(sourceId, DSL_ODE_ANY_CLASS));
+        }
+        if (ivec == routingIndex.end())
+        {
+            ivec = routingIndex.find(
+                routingKey(DSL_ODE_ROUTING_ANY_SOURCE, classId));
+        }
+        if (ivec == routingIndex.end())
+        {
+            ivec = routingIndex.find(
+                routingKey(DSL_ODE_ROUTING_ANY_SOURCE, DSL_ODE_ANY_CLASS));
+        }
+        if (ivec == routingIndex.end() or ivec->second.empty())
+        {
+            return NULL;
+        }
+        return &ivec->second;
     }
 
     uint OdePadProbeHandler::GetDisplayMetaAllocSize()
@@ -185,89 +427,639 @@ namespace DSL
         m_displayMetaAllocSize = size;
     }
     
-    GstPadProbeReturn OdePadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
+    uint OdePadProbeHandler::GetWorkerCount()
     {
-        if (!m_isEnabled)
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        return (m_pWorkerPool) ? m_pWorkerPool->GetNumWorkers() : 0;
+    }
+    
+    bool OdePadProbeHandler::SetWorkerCount(uint count)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        // Existing workers are stopped and joined on release, once any batch 
+        // in progress is done with the current dispatch table.
+        m_pWorkerPool = nullptr;
+        m_pDispatchTable = nullptr;
+        
+        if (count)
         {
-            return GST_PAD_PROBE_OK;
+            try
+            {
+                std::string poolName = GetName() + "-worker-pool";
+                m_pWorkerPool = DSL_WORKER_POOL_NEW(poolName.c_str(), count);
+            }
+            catch(...)
+            {
+                LOG_ERROR("ODE Pad Probe Handler '" << GetName() 
+                    << "' failed to create Worker Pool with " << count << " workers");
+                m_pWorkerPool = nullptr;
+                m_routingIndexDirty = true;
+                return false;
+            }
         }
-        GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
+        // Triggers must be re-partitioned on next buffer
+        m_routingIndexDirty = true;
         
-        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        return true;
+    }
+    
+    bool OdePadProbeHandler::GetActionBatchingEnabled()
+    {
+        LOG_FUNC();
         
-        // For each frame in the batched meta data
-        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
-            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        return m_actionBatchingEnabled;
+    }
+    
+    void OdePadProbeHandler::SetActionBatchingEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        m_actionBatchingEnabled = enabled;
+    }
+    
+    bool OdePadProbeHandler::GetMetricsEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_metricsEnabled;
+    }
+    
+    void OdePadProbeHandler::SetMetricsEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        m_metricsEnabled = enabled;
+    }
+    
+    void OdePadProbeHandler::ClearMetrics()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        m_runtimeMetrics.Clear();
+        
+        for (const auto &pOdeTrigger: m_pTriggersList)
         {
-            // Check for valid frame data
-            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
-            if (pFrameMeta != NULL)
+            pOdeTrigger->GetRuntimeMetrics().Clear();
+        }
+    }
+    
+    void OdePadProbeHandler::PrintMetrics()
+    {
+        LOG_FUNC();
+        
+        dsl_ode_runtime_metrics handlerMetrics;
+        m_runtimeMetrics.Get(&handlerMetrics);
+        
+        // Copy the child Trigger names and metrics with the handler mutex held,
+        // and print once released so that the streaming thread isn't blocked.
+        std::vector<std::pair<std::string, dsl_ode_runtime_metrics>> triggerMetrics;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+            
+            for (const auto &pOdeTrigger: m_pTriggersList)
+            {
+                dsl_ode_runtime_metrics metrics;
+                pOdeTrigger->GetRuntimeMetrics().Get(&metrics);
+                triggerMetrics.push_back(
+                    std::make_pair(pOdeTrigger->GetName(), metrics));
+            }
+        }
+        
+        // Sort the child Triggers by cumulative time, most expensive first.
+        std::stable_sort(triggerMetrics.begin(), triggerMetrics.end(), 
+            [](const std::pair<std::string, dsl_ode_runtime_metrics>& a,
+                const std::pair<std::string, dsl_ode_runtime_metrics>& b)
             {
-                std::vector<NvDsDisplayMeta*> displayMetaData;
-                displayMetaData.reserve(m_displayMetaAllocSize);
+                return a.second.total_time > b.second.total_time;
+            });
+        
+        std::cout << "ODE Pad Probe Handler '" << GetName() << "' frames = " 
+            << handlerMetrics.evaluations << ", occurrences = " 
+            << handlerMetrics.occurrences << ", total time = " 
+            << handlerMetrics.total_time/1000 << " us, max batch time = " 
+            << handlerMetrics.max_time/1000 << " us" << std::endl;
+            
+        for (auto const& ivec: triggerMetrics)
+        {
+            uint percent = (handlerMetrics.total_time)
+                ? (uint)(100*ivec.second.total_time/handlerMetrics.total_time)
+                : 0;
+            std::cout << std::setw(32) << std::left << ivec.first
+                << std::right << " evaluations = " << std::setw(10) 
+                << ivec.second.evaluations << " occurrences = " << std::setw(8) 
+                << ivec.second.occurrences << " total time = " << std::setw(10) 
+                << ivec.second.total_time/1000 << " us (" << std::setw(3) 
+                << percent << "%) max frame time = " << std::setw(8) 
+                << ivec.second.max_time/1000 << " us" << std::endl;
+        }
+    }
+    
+    void OdePadProbeHandler::GetTimeBudget(uint* budget, uint* maxInterval)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+        
+        *budget = m_timeBudget;
+        *maxInterval = m_maxShedInterval;
+    }
+    
+    bool OdePadProbeHandler::SetTimeBudget(uint budget, uint maxInterval)
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+            
+            if (maxInterval == 1)
+            {
+                LOG_ERROR("Invalid maximum load-shedding interval of 1 for ODE Pad Probe Handler '" 
+                    << GetName() << "'");
+                return false;
+            }
+            m_timeBudget = budget;
+            m_maxShedInterval = maxInterval;
+            m_averageBatchTime = 0;
+            m_shedHoldBatches = 0;
+            
+            // Start over with all frames processed. The caller may hold a Trigger's
+            // mutex, so the Triggers are updated from the streaming thread.
+            if (m_shedInterval)
+            {
+                m_shedInterval = 0;
+                m_routingIndexDirty = true;
+                queueLoadSheddingEvent(DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STOPPED);
+            }
+        }
+        notifyLoadSheddingListeners();
+        
+        return true;
+    }
+    
+    bool OdePadProbeHandler::AddLoadSheddingListener(
+        dsl_pph_ode_load_shedding_listener_cb listener, void* clientData)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (m_loadSheddingListeners.find(listener) != 
+            m_loadSheddingListeners.end())
+        {   
+            LOG_ERROR("Load-shedding listener is not unique");
+            return false;
+        }
+        m_loadSheddingListeners[listener] = clientData;
+
+        return true;
+    }
+    
+    bool OdePadProbeHandler::RemoveLoadSheddingListener(
+        dsl_pph_ode_load_shedding_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+
+        if (m_loadSheddingListeners.find(listener) == 
+            m_loadSheddingListeners.end())
+        {   
+            LOG_ERROR("Load-shedding listener was not found");
+            return false;
+        }
+        m_loadSheddingListeners.erase(listener);
+
+        return true;
+    }
+    
+    void OdePadProbeHandler::updateLoadShedding(uint64_t batchTime)
+    {
+        // Note: function is called from the system (callback) context
+        
+        // Exponential moving average with a weight of 1/8 for the new batch
+        m_averageBatchTime = (m_averageBatchTime*7 + batchTime)/8;
+        
+        if (m_shedHoldBatches)
+        {
+            m_shedHoldBatches--;
+            return;
+        }
+        uint64_t budget = (uint64_t)m_timeBudget*1000;
+        
+        if (m_averageBatchTime > budget)
+        {
+            uint maxShedInterval = (m_maxShedInterval) 
+                ? m_maxShedInterval : DSL_ODE_TRIGGER_SHED_INTERVAL_ALL;
+            if (m_shedInterval == maxShedInterval)
+            {
+                return;
+            }
+            uint interval = (m_maxShedInterval)
+                ? std::min((m_shedInterval) ? m_shedInterval*2 : 2, m_maxShedInterval)
+                : DSL_ODE_TRIGGER_SHED_INTERVAL_ALL;
+                
+            setShedInterval(interval, (m_shedInterval) 
+                ? DSL_PPH_ODE_LOAD_SHEDDING_EVENT_INCREASED 
+                : DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STARTED);
+        }
+        else if (m_shedInterval and m_averageBatchTime < budget/2)
+        {
+            uint interval = (m_shedInterval == DSL_ODE_TRIGGER_SHED_INTERVAL_ALL or
+                m_shedInterval/2 < 2) ? 0 : m_shedInterval/2;
                 
-                for (auto i=0; i<m_displayMetaAllocSize; i++)
+            setShedInterval(interval, (interval)
+                ? DSL_PPH_ODE_LOAD_SHEDDING_EVENT_DECREASED 
+                : DSL_PPH_ODE_LOAD_SHEDDING_EVENT_STOPPED);
+        }
+    }
+    
+    void OdePadProbeHandler::setShedInterval(uint interval, uint event)
+    {
+        LOG_FUNC();
+        
+        m_shedInterval = interval;
+        m_shedHoldBatches = DSL_PPH_ODE_LOAD_SHEDDING_HOLD_BATCHES;
+        
+        applyShedInterval();
+        
+        LOG_INFO("ODE Pad Probe Handler '" << GetName() 
+            << "' set load-shedding interval to " << interval 
+            << " with average batch time = " << m_averageBatchTime/1000 << " us");
+        
+        queueLoadSheddingEvent(event);
+    }
+    
+    void OdePadProbeHandler::queueLoadSheddingEvent(uint event)
+    {
+        LOG_FUNC();
+        
+        if (m_loadSheddingListeners.empty())
+        {
+            return;
+        }
+        uint reportedInterval = (m_shedInterval == DSL_ODE_TRIGGER_SHED_INTERVAL_ALL)
+            ? 0 : m_shedInterval;
+            
+        m_loadSheddingEvents.push_back(LoadSheddingEvent{event, 
+            reportedInterval, (uint)(m_averageBatchTime/1000)});
+    }
+    
+    void OdePadProbeHandler::notifyLoadSheddingListeners()
+    {
+        // Note: function is called without the handler mutex held
+        
+        std::vector<LoadSheddingEvent> events;
+        std::map<dsl_pph_ode_load_shedding_listener_cb, void*> listeners;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+            
+            if (m_loadSheddingEvents.empty())
+            {
+                return;
+            }
+            events.swap(m_loadSheddingEvents);
+            listeners = m_loadSheddingListeners;
+        }
+        for (auto const& loadSheddingEvent: events)
+        {
+            // iterate through the map of load-shedding-listeners calling each
+            for(auto const& imap: listeners)
+            {
+                try
                 {
-                    // Acquire new Display meta for this frame, with each Trigger/Action(s)
-                    // adding meta as needed
-                    NvDsDisplayMeta* pDisplayMeta = 
-                        nvds_acquire_display_meta_from_pool(pBatchMeta);
-                    displayMetaData.push_back(pDisplayMeta);
+                    imap.first(loadSheddingEvent.event, loadSheddingEvent.interval, 
+                        loadSheddingEvent.batchTime, imap.second);
                 }
-                // Preprocess the frame
-                for (const auto &imap: m_pChildrenIndexed)
+                catch(...)
                 {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+                    LOG_ERROR("Exception calling Client Load-Shedding-Listener");
                 }
+            }
+        }
+    }
+    
+    void OdePadProbeHandler::applyShedInterval()
+    {
+        LOG_FUNC();
+        
+        for (const auto &pOdeTrigger: m_pTriggersList)
+        {
+            pOdeTrigger->SetShedInterval(
+                (pOdeTrigger->GetPriority() == DSL_ODE_TRIGGER_PRIORITY_LOW)
+                    ? m_shedInterval : 0);
+        }
+    }
+    
+    uint OdePadProbeHandler::processFrame(GstBuffer* pBuffer, 
+        DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta,
+        const std::vector<OdeTrigger*>& triggers, const RoutingIndexT& routingIndex)
+    {
+        // Note: function is called from the system (callback) or worker context
+        
+        // Runtime metrics are only measured if active for the calling thread.
+        // Each timestamp ends the current measurement and starts the next.
+        bool metered = OdeRuntimeMetrics::IsActive();
+        uint64_t start = (metered) ? OdeRuntimeMetrics::Now() : 0;
+        uint occurrences(0);
+        
+        // Queue the occurrences for batchable Actions until the frame is done.
+        bool batched = m_actionBatchingEnabled.load(std::memory_order_relaxed);
+        if (batched)
+        {
+            OdeAction::BeginOccurrenceBatch();
+        }
+        
+        // Preprocess the frame
+        for (const auto &pOdeTrigger: triggers)
+        {
+            // No criteria snapshot reads are in progress for this Trigger
+            // between frames - free any snapshots replaced by the client.
+            pOdeTrigger->ReclaimCriteria();
+            pOdeTrigger->PreProcessFrame(pBuffer, displayMetaData, pFrameMeta);
+            
+            if (metered)
+            {
+                uint64_t now = OdeRuntimeMetrics::Now();
+                pOdeTrigger->GetRuntimeMetrics().AddToFrame(0, 0, now - start);
+                start = now;
+            }
+        }
 
-                // For each detected object in the frame.
-                for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; 
-                    pMeta != NULL; pMeta = pMeta->next)
+        // For each detected object in the frame.
+        for (NvDsMetaList* pMeta = pFrameMeta->obj_meta_list; 
+            pMeta != NULL; pMeta = pMeta->next)
+        {
+            // Check for valid object data
+            NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pMeta->data);
+            if (pObjectMeta != NULL)
+            {
+                // Get the candidate Triggers for this Object's source and class
+                const std::vector<OdeTrigger*>* pCandidates = 
+                    getRoutedTriggers(routingIndex, pFrameMeta->source_id, 
+                        pObjectMeta->class_id);
+                if (!pCandidates)
+                {
+                    continue;
+                }
+                // For each candidate ODE Trigger, check for ODE
+                for (const auto &pOdeTrigger: *pCandidates)
                 {
-                    // Check for valid object data
-                    NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*) (pMeta->data);
-                    if (pObjectMeta != NULL)
+                    try
                     {
-                        // For each ODE Trigger owned by this ODE Manager, check for ODE
-                        for (const auto &imap: m_pChildrenIndexed)
-                        {
-                            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                                std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                            try
-                            {
-                                pOdeTrigger->CheckForOccurrence(pBuffer, 
-                                    displayMetaData, pFrameMeta, pObjectMeta);
-                            }
-                            catch(...)
-                            {
-                                LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
-                                    << "' threw exception");
-                            }                            
-                        }
+                        pOdeTrigger->CheckForOccurrence(pBuffer, 
+                            displayMetaData, pFrameMeta, pObjectMeta);
+                    }
+                    catch(...)
+                    {
+                        LOG_ERROR("Trigger '" << pOdeTrigger->GetName() 
+                            << "' threw exception");
+                    }                            
+                    if (metered)
+                    {
+                        uint64_t now = OdeRuntimeMetrics::Now();
+                        pOdeTrigger->GetRuntimeMetrics().AddToFrame(1, 0, now - start);
+                        start = now;
                     }
                 }
+            }
+        }
+        
+        // After each detected object is checked for ODE individually, post process 
+        // each frame for Absence events, Limit events, etc. (i.e. frame level events).
+        for (const auto &pOdeTrigger: triggers)
+        {
+            uint count = pOdeTrigger->PostProcessFrame(pBuffer, 
+                displayMetaData, pFrameMeta);
+            
+            if (metered)
+            {
+                uint64_t now = OdeRuntimeMetrics::Now();
+                pOdeTrigger->GetRuntimeMetrics().AddToFrame(1, count, now - start);
+                pOdeTrigger->GetRuntimeMetrics().RecordFrame();
+                occurrences += count;
+                start = now;
+            }
+        }
+        if (batched)
+        {
+            OdeAction::EndOccurrenceBatch(pBuffer, displayMetaData, pFrameMeta);
+        }
+        
+        // Unpin each Trigger's criteria snapshot once all Actions are done. 
+        for (const auto &pOdeTrigger: triggers)
+        {
+            pOdeTrigger->ReleaseCriteria();
+        }
+        return occurrences;
+    }
+    
+    uint OdePadProbeHandler::processBatchInParallel(GstBuffer* pBuffer, 
+        NvDsBatchMeta* pBatchMeta, const DispatchTable& table)
+    {
+        // Note: function is called from the system (callback) context
+        
+        m_pBatchTable = &table;
+        m_pBatchBuffer = pBuffer;
+        m_batchFrames.clear();
+        m_batchTasks.clear();
+        m_batchOccurrences.store(0, std::memory_order_relaxed);
+        uint occurrences(0);
+        
+        // Acquire all Display Meta from the streaming thread, and group the
+        // frames by source, preserving batch order within each source.
+        std::map<uint, uint> taskIndices;
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+            if (pFrameMeta == NULL)
+            {
+                continue;
+            }
+            uint frameIndex = m_batchFrames.size();
+            m_batchFrames.push_back(pFrameMeta);
+            if (m_batchDisplayMetaData.size() < m_batchFrames.size())
+            {
+                m_batchDisplayMetaData.push_back(DisplayMetaData());
+            }
+            m_batchDisplayMetaData[frameIndex].Reset(pBatchMeta, 
+                m_displayMetaAllocSize);
+            
+            // Only sources with partitioned Triggers need a task
+            if (table.partitionedTriggers.find(pFrameMeta->source_id) == 
+                table.partitionedTriggers.end())
+            {
+                continue;
+            }
+            auto itask = taskIndices.find(pFrameMeta->source_id);
+            if (itask == taskIndices.end())
+            {
+                itask = taskIndices.emplace(pFrameMeta->source_id, 
+                    m_batchTasks.size()).first;
+                m_batchTasks.push_back(std::make_pair(pFrameMeta->source_id, 
+                    std::vector<uint>()));
+            }
+            m_batchTasks[itask->second].second.push_back(frameIndex);
+        }
+        
+        // Process the partitioned Triggers, one task per source. Returns
+        // once all tasks have completed.
+        if (m_batchTasks.size())
+        {
+            table.pWorkerPool->Execute(m_batchTasks.size(), OdeBatchSourceTask, this);
+        }
+        
+        // Process all remaining Triggers serially, in batch order.
+        for (uint i=0; i<m_batchFrames.size(); i++)
+        {
+            occurrences += processFrame(pBuffer, m_batchDisplayMetaData[i], 
+                m_batchFrames[i], table.pSerialTriggersList, table.serialRoutingIndex);
                 
-                // After each detected object is checked for ODE individually, post process 
-                // each frame for Absence events, Limit events, etc. (i.e. frame level events).
-                for (const auto &imap: m_pChildrenIndexed)
-                {
-                    DSL_ODE_TRIGGER_PTR pOdeTrigger = 
-                        std::dynamic_pointer_cast<OdeTrigger>(imap.second);
-                    pOdeTrigger->PostProcessFrame(pBuffer, displayMetaData, pFrameMeta);
-                }
+            // Add the Display Meta used, if any, to the frame
+            m_batchDisplayMetaData[i].AddToFrame(m_batchFrames[i]);
+        }
+        m_pBatchBuffer = NULL;
+        m_pBatchTable = NULL;
+        
+        return occurrences + m_batchOccurrences.load(std::memory_order_relaxed);
+    }
+    
+    void OdePadProbeHandler::HandleBatchSourceTask(uint taskIndex)
+    {
+        // Note: function is called from a worker context while the streaming 
+        // thread waits for all tasks of the current batch to complete.
+        
+        uint sourceId = m_batchTasks[taskIndex].first;
+        const std::vector<OdeTrigger*>& triggers = 
+            m_pBatchTable->partitionedTriggers.at(sourceId);
+        
+        // Measure metrics on this thread if measured for the batch. The 
+        // streaming thread also runs tasks, so its active state is restored.
+        bool wasActive = OdeRuntimeMetrics::IsActive();
+        OdeRuntimeMetrics::SetActive(m_batchMetered);
+        uint occurrences(0);
+        
+        for (const auto frameIndex: m_batchTasks[taskIndex].second)
+        {
+            occurrences += processFrame(m_pBatchBuffer, 
+                m_batchDisplayMetaData[frameIndex], m_batchFrames[frameIndex], 
+                triggers, m_pBatchTable->partitionedRoutingIndex);
+        }
+        if (occurrences)
+        {
+            m_batchOccurrences.fetch_add(occurrences, std::memory_order_relaxed);
+        }
+        OdeRuntimeMetrics::SetActive(wasActive);
+    }
+    
+    GstPadProbeReturn OdePadProbeHandler::HandlePadData(GstPadProbeInfo* pInfo)
+    {
+        // The handler mutex is only held while taking the dispatch table for 
+        // the batch, and while updating the load-shedding state once done. The 
+        // Actions and listeners called while processing can call back into 
+        // this Handler, e.g. to add/remove Triggers or to clear the metrics.
+        std::shared_ptr<DispatchTable> pTable;
+        bool timed(false);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
+            
+            if (!m_isEnabled)
+            {
+                return GST_PAD_PROBE_OK;
+            }
+            
+            // Rebuild the routing index if any Trigger criteria has changed.
+            if (m_routingIndexDirty.exchange(false) or !m_pDispatchTable)
+            {
+                updateRoutingIndex();
+            }
+            pTable = m_pDispatchTable;
+            
+            // Runtime metrics are measured for the entire batch, or not at all.
+            // The batch is timed if metrics are enabled or a time budget is set.
+            m_batchMetered = m_metricsEnabled;
+            timed = (m_batchMetered or m_timeBudget);
+        }
+        
+        GstBuffer* pBuffer = (GstBuffer*)pInfo->data;
+        
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        
+        uint64_t start = (timed) ? OdeRuntimeMetrics::Now() : 0;
+        
+        if (m_batchMetered)
+        {
+            OdeRuntimeMetrics::SetActive(true);
+        }
+        
+        // Fan out to the worker pool only if there is work to partition.
+        uint occurrences = (pTable->pWorkerPool and pTable->partitionedTriggers.size())
+            ? processBatchInParallel(pBuffer, pBatchMeta, *pTable)
+            : processBatch(pBuffer, pBatchMeta, *pTable);
+
+        if (timed)
+        {
+            uint64_t batchTime = OdeRuntimeMetrics::Now() - start;
+            
+            if (m_batchMetered)
+            {
+                OdeRuntimeMetrics::SetActive(false);
+                m_runtimeMetrics.Record(pBatchMeta->num_frames_in_batch, 
+                    occurrences, batchTime);
+            }
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padHandlerMutex);
                 
-                for (const auto & ivec: displayMetaData)
+                if (m_timeBudget)
                 {
-                    // Add the updated display data to the frame
-                    nvds_add_display_meta_to_frame(pFrameMeta, ivec);
+                    updateLoadShedding(batchTime);
                 }
             }
+            notifyLoadSheddingListeners();
         }
         return GST_PAD_PROBE_OK;
     }
 
+    uint OdePadProbeHandler::processBatch(GstBuffer* pBuffer, 
+        NvDsBatchMeta* pBatchMeta, const DispatchTable& table)
+    {
+        // Note: function is called from the system (callback) context
+        
+        uint occurrences(0);
+        
+        // For each frame in the batched meta data
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            // Check for valid frame data
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+            if (pFrameMeta != NULL)
+            {
+                // Display Meta is acquired on demand by the Triggers/Actions
+                DisplayMetaData displayMetaData(pBatchMeta, m_displayMetaAllocSize);
+                
+                occurrences += processFrame(pBuffer, displayMetaData, pFrameMeta, 
+                    table.pTriggersList, table.routingIndex);
+                
+                // Add the Display Meta used, if any, to the frame
+                displayMetaData.AddToFrame(pFrameMeta);
+            }
+        }
+        return occurrences;
+    }
+    
+    static void OdeTriggerCriteriaChangeListener(void* pHandler)
+    {
+        static_cast<OdePadProbeHandler*>(pHandler)->HandleTriggerCriteriaChange();
+    }
+
+    static void OdeBatchSourceTask(uint index, void* pHandler)
+    {
+        static_cast<OdePadProbeHandler*>(pHandler)->HandleBatchSourceTask(index);
+    }
+
     //----------------------------------------------------------------------------------------------
 
     CustomPadProbeHandler::CustomPadProbeHandler(const char* name, 
@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslElementr.h"
 #include "DslOdeTrigger.h"
+#include "DslWorkerPool.h"
 #include "DslSourceMeter.h"
 
 
@@ -249,6 +250,17 @@ namespace DSL
 
     //----------------------------------------------------------------------------------------------
 
+    /**
+     * @brief Wildcard source-id key used by the OdePadProbeHandler routing index
+     */
+    #define DSL_ODE_ROUTING_ANY_SOURCE UINT32_MAX
+    
+    /**
+     * @brief Number of batches to hold the OdePadProbeHandler's load-shedding
+     * interval after each change, allowing the average batch time to respond.
+     */
+    #define DSL_PPH_ODE_LOAD_SHEDDING_HOLD_BATCHES 8
+
     /**
      * @class OdePadProbeHandler
      * @brief Pad Probe Handler to Handle a collection ODE triggers
@@ -286,14 +298,16 @@ namespace DSL
         void RemoveAllChildren();
         
         /**
-         * @brief Gets the current Display Meta Allocation per frame size.
-         * @return the allocation size, default = 1
+         * @brief Gets the current Display Meta Allocation per frame size, the 
+         * maximum number of Display Meta structures acquired on demand per frame.
+         * @return the allocation size, default = 16
          */
         uint GetDisplayMetaAllocSize();
         
         /**
-         * @brief Gets the current Display Meta Allocation per frame size.
-         * @return the allocation size, default = 1
+         * @brief Sets the Display Meta Allocation per frame size, the maximum 
+         * number of Display Meta structures acquired on demand per frame.
+         * @param[in] count new allocation size, 0 = display meta disabled.
          */
         void SetDisplayMetaAllocSize(uint count);
 
@@ -305,10 +319,210 @@ namespace DSL
          */
         GstPadProbeReturn HandlePadData(GstPadProbeInfo* pInfo);
         
+        /**
+         * @brief Handles a criteria change notification from a child Trigger.
+         * Note: may be called with the Trigger's property mutex held. 
+         */
+        void HandleTriggerCriteriaChange();
+        
+        /**
+         * @brief Gets the current number of worker threads used to process the 
+         * frames of each batch in parallel.
+         * @return current worker count, 0 = parallel processing disabled (default).
+         */
+        uint GetWorkerCount();
+        
+        /**
+         * @brief Sets the number of worker threads used to process the frames 
+         * of each batch in parallel. Frames are grouped by source, and the 
+         * source-partitionable Triggers of each source are processed by one 
+         * worker. All other Triggers are processed serially, in batch order,
+         * once all workers have completed.
+         * @param[in] count new worker count to use, 0 = disable.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetWorkerCount(uint count);
+        
+        /**
+         * @brief Processes all frames, in batch order, for one source of the 
+         * current batch. Called by the Worker Pool for each source task.
+         * @param[in] taskIndex index into m_batchTasks to process.
+         */
+        void HandleBatchSourceTask(uint taskIndex);
+        
+        /**
+         * @brief Gets the current action batching enabled setting.
+         * @return true if action batching is enabled, false otherwise (default).
+         */
+        bool GetActionBatchingEnabled();
+        
+        /**
+         * @brief Sets the action batching enabled setting. When enabled, the 
+         * occurrences for each Action that supports batched delivery are queued
+         * while processing a frame, and delivered with a single call per Action 
+         * once all Triggers have processed the frame.
+         * @param[in] enabled true to enable action batching, false to disable.
+         */
+        void SetActionBatchingEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the current runtime metrics enabled setting.
+         * @return true if metrics are enabled, false otherwise (default).
+         */
+        bool GetMetricsEnabled();
+        
+        /**
+         * @brief Sets the runtime metrics enabled setting. When enabled, the 
+         * Handler measures each batch, each child Trigger, and each Action
+         * invoked by the Triggers. When disabled, no timestamps are taken. 
+         * @param[in] enabled true to enable metrics, false to disable.
+         */
+        void SetMetricsEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the runtime metrics for this ODE Pad Probe Handler.
+         * @return reference to the Handler's runtime metrics.
+         */
+        OdeRuntimeMetrics& GetRuntimeMetrics()
+        {
+            LOG_FUNC();
+            
+            return m_runtimeMetrics;
+        };
+        
+        /**
+         * @brief Clears the runtime metrics for this ODE Pad Probe Handler 
+         * and for all of its child Triggers.
+         */
+        void ClearMetrics();
+        
+        /**
+         * @brief Prints a summary of the Handler's runtime metrics to the 
+         * console, followed by the metrics of each child Trigger ordered by
+         * cumulative time, most expensive first.
+         */
+        void PrintMetrics();
+        
+        /**
+         * @brief Gets the current time budget settings for this Handler.
+         * @param[out] budget per-batch time budget in microseconds, 0 = disabled.
+         * @param[out] maxInterval maximum load-shedding interval, 0 = skip all.
+         */
+        void GetTimeBudget(uint* budget, uint* maxInterval);
+        
+        /**
+         * @brief Sets the time budget settings for this Handler. Any current 
+         * load-shedding is stopped.
+         * @param[in] budget per-batch time budget in microseconds, 0 = disabled.
+         * @param[in] maxInterval maximum load-shedding interval in frames, 
+         * 0 = skip LOW priority Triggers on all frames while shedding.
+         * @return true on successful update, false otherwise.
+         */
+        bool SetTimeBudget(uint budget, uint maxInterval);
+        
+        /**
+         * @brief Adds a load-shedding listener function to be notified on 
+         * change of this Handler's load-shedding state.
+         * @return true if the listener function was successfully added, false otherwise.
+         */
+        bool AddLoadSheddingListener(
+            dsl_pph_ode_load_shedding_listener_cb listener, void* clientData);
+
+        /**
+         * @brief Removes a load-shedding listener function previously added
+         * with a call to AddLoadSheddingListener.
+         * @return true if the listener function was successfully removed, false otherwise.
+         */
+        bool RemoveLoadSheddingListener(
+            dsl_pph_ode_load_shedding_listener_cb listener);
+        
     private:
     
         /**
-         * @brief specifies how many Display Meta structures are allocated for each frame
+         * @brief typedef for a routing index of add-ordered candidate Triggers 
+         * keyed by (source-id, class-id).
+         */
+        typedef std::unordered_map<uint64_t, std::vector<OdeTrigger*>> RoutingIndexT;
+        
+        /**
+         * @struct RoutingCriteria
+         * @brief the current routing criteria for a single child Trigger.
+         */
+        struct RoutingCriteria
+        {
+            OdeTrigger* pOdeTrigger;
+            uint sourceKey;
+            std::vector<uint> classIds;
+        };
+        
+        /**
+         * @struct DispatchTable
+         * @brief immutable snapshot of the child Triggers, routing indices, and 
+         * Worker Pool used by the streaming thread to process a batch. Rebuilt, 
+         * with the handler mutex held, on the first buffer after any change.
+         */
+        struct DispatchTable
+        {
+            /**
+             * @brief shared pointers to all child Triggers in the table, so that
+             * a Trigger removed by a client callback outlives the current batch.
+             */
+            std::vector<DSL_BASE_PTR> pOwners;
+            
+            /**
+             * @brief flat list of all child Triggers in add-order.
+             */
+            std::vector<OdeTrigger*> pTriggersList;
+            
+            /**
+             * @brief Routing index of add-ordered candidate Triggers keyed by 
+             * (source-id, class-id). Wildcard entries use DSL_ODE_ROUTING_ANY_SOURCE
+             * and DSL_ODE_ANY_CLASS. Only enabled Triggers are indexed.
+             */
+            RoutingIndexT routingIndex;
+            
+            /**
+             * @brief Worker Pool for parallel processing, NULL if disabled.
+             */
+            DSL_WORKER_POOL_PTR pWorkerPool;
+            
+            /**
+             * @brief add-ordered lists of source-partitionable Triggers, keyed by 
+             * source-id. Only used when parallel processing is enabled.
+             */
+            std::map<uint, std::vector<OdeTrigger*>> partitionedTriggers;
+            
+            /**
+             * @brief routing index for the source-partitionable Triggers.
+             */
+            RoutingIndexT partitionedRoutingIndex;
+            
+            /**
+             * @brief add-ordered list of all other Triggers that must be processed 
+             * serially. Only used when parallel processing is enabled.
+             */
+            std::vector<OdeTrigger*> pSerialTriggersList;
+            
+            /**
+             * @brief routing index for the Triggers that must be processed serially.
+             */
+            RoutingIndexT serialRoutingIndex;
+        };
+        
+        /**
+         * @struct LoadSheddingEvent
+         * @brief a change of load-shedding state queued for the listeners.
+         */
+        struct LoadSheddingEvent
+        {
+            uint event;
+            uint interval;
+            uint batchTime;
+        };
+    
+        /**
+         * @brief maximum number of Display Meta structures that can be acquired
+         * for each frame. Structures are only acquired when first used.
          */
         uint m_displayMetaAllocSize;
         
@@ -322,8 +536,250 @@ namespace DSL
          */
         std::map <uint, DSL_BASE_PTR> m_pChildrenIndexed; 
         
+        /**
+         * @brief Flat list of typed child ODE Trigger pointers in add-order.
+         * Owned by m_pChildrenIndexed.
+         */
+        std::vector<OdeTrigger*> m_pTriggersList;
+        
+        /**
+         * @brief Rebuilds the flat m_pTriggersList from m_pChildrenIndexed.
+         * Called on Trigger add/remove with the handler mutex held.
+         */
+        void updateTriggersList();
+        
+        /**
+         * @brief Rebuilds the dispatch table - all routing indices, and the 
+         * per-source Trigger lists if parallel processing is enabled - from the 
+         * current routing criteria of all child Triggers. Called from the 
+         * streaming thread with the handler mutex held.
+         */
+        void updateRoutingIndex();
+        
+        /**
+         * @brief Builds a routing index from a set of Trigger routing criteria.
+         * @param[in] criteria add-ordered routing criteria to index.
+         * @param[out] routingIndex routing index to build.
+         */
+        void buildRoutingIndex(const std::vector<RoutingCriteria>& criteria,
+            RoutingIndexT& routingIndex);
+        
+        /**
+         * @brief Gets the add-ordered list of candidate Triggers for an Object.
+         * @param[in] routingIndex routing index to query.
+         * @param[in] sourceId unique source-id of the Object's frame.
+         * @param[in] classId class-id of the Object.
+         * @return pointer to the list of candidate Triggers, NULL if none.
+         */
+        const std::vector<OdeTrigger*>* getRoutedTriggers(
+            const RoutingIndexT& routingIndex, uint sourceId, uint classId);
+            
+        /**
+         * @brief Pre-processes, checks all objects for occurrence, and post-processes
+         * a single frame for a set of Triggers.
+         * @param[in] pBuffer batched stream buffer that holds the Frame Meta
+         * @param[in] displayMetaData Display Meta allocator for the frame.
+         * @param[in] pFrameMeta Frame Meta to process.
+         * @param[in] triggers add-ordered list of Triggers to process.
+         * @param[in] routingIndex routing index for the same set of Triggers.
+         * @return number of Trigger occurrences if metrics are active, 0 otherwise.
+         */
+        uint processFrame(GstBuffer* pBuffer, 
+            DisplayMetaData& displayMetaData, NvDsFrameMeta* pFrameMeta,
+            const std::vector<OdeTrigger*>& triggers, const RoutingIndexT& routingIndex);
+            
+        /**
+         * @brief Processes all frames of a batch serially, in batch order.
+         * @param[in] pBuffer batched stream buffer that holds the Batch Meta
+         * @param[in] pBatchMeta Batch Meta to process.
+         * @param[in] table dispatch table to process the batch with.
+         * @return number of Trigger occurrences if metrics are active, 0 otherwise.
+         */
+        uint processBatch(GstBuffer* pBuffer, NvDsBatchMeta* pBatchMeta,
+            const DispatchTable& table);
+            
+        /**
+         * @brief Processes all frames of a batch, fanning out the source-partitionable
+         * Triggers per source to the Worker Pool, and then processing all remaining
+         * Triggers serially in batch order.
+         * @param[in] pBuffer batched stream buffer that holds the Batch Meta
+         * @param[in] pBatchMeta Batch Meta to process.
+         * @param[in] table dispatch table to process the batch with.
+         * @return number of Trigger occurrences if metrics are active, 0 otherwise.
+         */
+        uint processBatchInParallel(GstBuffer* pBuffer, NvDsBatchMeta* pBatchMeta,
+            const DispatchTable& table);
+        
+        /**
+         * @brief Updates the average batch time and the load-shedding interval 
+         * after each batch processed while a time budget is set.
+         * @param[in] batchTime time to process the last batch in nanoseconds.
+         */
+        void updateLoadShedding(uint64_t batchTime);
+        
+        /**
+         * @brief Sets a new load-shedding interval, applies it to all LOW 
+         * priority Triggers, and queues the event for all load-shedding listeners.
+         * Called from the streaming thread with the handler mutex held.
+         * @param[in] interval new load-shedding interval, 0 = not shedding.
+         * @param[in] event one of the DSL_PPH_ODE_LOAD_SHEDDING_EVENT constants.
+         */
+        void setShedInterval(uint interval, uint event);
+        
+        /**
+         * @brief Queues a load-shedding event for the listeners. Called with 
+         * the handler mutex held.
+         * @param[in] event one of the DSL_PPH_ODE_LOAD_SHEDDING_EVENT constants.
+         */
+        void queueLoadSheddingEvent(uint event);
+        
+        /**
+         * @brief Notifies all load-shedding listeners of all queued events.
+         * Must be called without the handler mutex held, so that the listeners
+         * can call back into this Handler.
+         */
+        void notifyLoadSheddingListeners();
+        
+        /**
+         * @brief Applies the current load-shedding interval to all LOW priority
+         * Triggers, and clears the interval for all other Triggers.
+         */
+        void applyShedInterval();
+        
+        /**
+         * @brief Returns the routing index key for a given source and class-id. 
+         */
+        static uint64_t routingKey(uint sourceId, uint classId)
+        {
+            return ((uint64_t)sourceId << 32) | classId;
+        };
+        
+        /**
+         * @brief Optional Worker Pool for parallel processing, NULL if disabled.
+         */
+        DSL_WORKER_POOL_PTR m_pWorkerPool;
+        
+        /**
+         * @brief current dispatch table, NULL until built on the next buffer. 
+         * Reset on Trigger removal so that removed Triggers are released.
+         */
+        std::shared_ptr<DispatchTable> m_pDispatchTable;
+        
+        /**
+         * @brief dispatch table for the batch currently being processed in 
+         * parallel. Only accessed from the streaming thread and Worker Pool.
+         */
+        const DispatchTable* m_pBatchTable;
+        
+        /**
+         * @brief the batched stream buffer currently being processed in parallel.
+         */
+        GstBuffer* m_pBatchBuffer;
+        
+        /**
+         * @brief valid Frame Meta for the current batch, in batch order.
+         */
+        std::vector<NvDsFrameMeta*> m_batchFrames;
+        
+        /**
+         * @brief Display Meta for each frame in m_batchFrames. 
+         */
+        std::vector<DisplayMetaData> m_batchDisplayMetaData;
+        
+        /**
+         * @brief one task per source in the current batch, source-id and the 
+         * indices into m_batchFrames for that source in batch order.
+         */
+        std::vector<std::pair<uint, std::vector<uint>>> m_batchTasks;
+        
+        /**
+         * @brief set when a child Trigger's source, class-id, or enabled setting
+         * changes, or on Trigger add/remove. Index is rebuilt on the next buffer.
+         */
+        std::atomic<bool> m_routingIndexDirty;
+        
+        /**
+         * @brief true if action batching is enabled, false otherwise.
+         */
+        std::atomic<bool> m_actionBatchingEnabled;
+        
+        /**
+         * @brief true if runtime metrics are enabled, false otherwise.
+         */
+        std::atomic<bool> m_metricsEnabled;
+        
+        /**
+         * @brief true if runtime metrics are measured for the current batch.
+         */
+        bool m_batchMetered;
+        
+        /**
+         * @brief Trigger occurrences for the current batch, summed by the 
+         * Worker Pool tasks while metrics are measured.
+         */
+        std::atomic<uint64_t> m_batchOccurrences;
+        
+        /**
+         * @brief runtime metrics for this ODE Pad Probe Handler.
+         */
+        OdeRuntimeMetrics m_runtimeMetrics;
+        
+        /**
+         * @brief per-batch time budget in microseconds, 0 = disabled.
+         */
+        uint m_timeBudget;
+        
+        /**
+         * @brief maximum load-shedding interval, 0 = skip all frames.
+         */
+        uint m_maxShedInterval;
+        
+        /**
+         * @brief current load-shedding interval applied to LOW priority 
+         * Triggers, 0 = not shedding.
+         */
+        uint m_shedInterval;
+        
+        /**
+         * @brief number of batches to hold the current load-shedding interval.
+         */
+        uint m_shedHoldBatches;
+        
+        /**
+         * @brief exponential moving average of the batch time in nanoseconds.
+         */
+        uint64_t m_averageBatchTime;
+        
+        /**
+         * @brief map of all currently registered load-shedding listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_pph_ode_load_shedding_listener_cb, 
+            void*>m_loadSheddingListeners;
+        
+        /**
+         * @brief load-shedding events queued for delivery to the listeners
+         * once the handler mutex is released.
+         */
+        std::vector<LoadSheddingEvent> m_loadSheddingEvents;
+        
     };
     
+    /**
+     * @brief Criteria change listener callback function, registered with
+     * each child ODE Trigger added to an OdePadProbeHandler.
+     * @param[in] pHandler pointer to the ODE Pad Probe Handler to notify.
+     */
+    static void OdeTriggerCriteriaChangeListener(void* pHandler);
+    
+    /**
+     * @brief Worker Pool task function, called for each source of a batch
+     * processed in parallel by an OdePadProbeHandler.
+     * @param[in] index index of the source task to process.
+     * @param[in] pHandler pointer to the ODE Pad Probe Handler.
+     */
+    static void OdeBatchSourceTask(uint index, void* pHandler);
+    
     //----------------------------------------------------------------------------------------------
     /**
      * @class MeterPadProbeHandler
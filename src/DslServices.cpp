@@ -90,16 +90,6 @@ const wchar_t* dsl_state_value_to_string(uint state)
     return DSL::Services::GetServices()->StateValueToString(state);
 }
 
-void geosNoticeHandler(const char *fmt, ...)
-{
-    // TODO
-}
-
-void geosErrorHandler(const char *fmt, ...)
-{
-    // TODO
-}
-
 // Single GST debug catagory initialization
 GST_DEBUG_CATEGORY(GST_CAT_DSL);
 
@@ -140,9 +130,6 @@ namespace DSL
             // Single instantiation for the lib's lifetime
             m_pInstance = new Services(doGstDeinit);
             
-            // initialization of GEOS
-            initGEOS(geosNoticeHandler, geosErrorHandler);
-            
             // Initialize private containers
             m_pInstance->InitToStringMaps();
             
@@ -197,9 +184,6 @@ namespace DSL
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-            // Cleanup GEOS
-            finishGEOS();
-            
             // Cleanup Lib cURL
             curl_global_cleanup();
             
@@ -350,6 +334,8 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PPH_ODE_TRIGGER_REMOVE_FAILED] = L"DSL_RESULT_PPH_ODE_TRIGGER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE] = L"DSL_RESULT_PPH_ODE_TRIGGER_NOT_IN_USE";
         m_returnValueToString[DSL_RESULT_PPH_METER_INVALID_INTERVAL] = L"DSL_RESULT_PPH_METER_INVALID_INTERVAL";
+        m_returnValueToString[DSL_RESULT_PPH_CALLBACK_ADD_FAILED] = L"DSL_RESULT_PPH_CALLBACK_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_PPH_CALLBACK_REMOVE_FAILED] = L"DSL_RESULT_PPH_CALLBACK_REMOVE_FAILED";
 
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE] = L"DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND] = L"DSL_RESULT_ODE_TRIGGER_NAME_NOT_FOUND";
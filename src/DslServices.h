@@ -282,6 +282,22 @@ namespace DSL {
         DslReturnType OdeActionEnabledStateChangeListenerRemove(const char* name,
             dsl_ode_enabled_state_change_listener_cb listener);
 
+        DslReturnType OdeActionMetricsGet(const char* name, 
+            dsl_ode_runtime_metrics* metrics);
+
+        DslReturnType OdeActionMetricsClear(const char* name);
+
+        DslReturnType OdeActionExecutionModeGet(const char* name, 
+            uint* mode, uint* queueSize, uint* overflowPolicy);
+
+        DslReturnType OdeActionExecutionModeSet(const char* name, 
+            uint mode, uint queueSize, uint overflowPolicy);
+
+        DslReturnType OdeActionQueueCountersGet(const char* name, 
+            uint* depth, uint* peakDepth, uint64_t* drops);
+
+        DslReturnType OdeActionQueueCountersClear(const char* name);
+
         DslReturnType OdeActionDelete(const char* name);
         
         DslReturnType OdeActionDeleteAll();
@@ -324,6 +340,18 @@ namespace DSL {
         DslReturnType OdeTriggerSummationNew(const char* name, 
             const char* source, uint classId, uint limit);
 
+        DslReturnType OdeTriggerClassCountNew(const char* name, const char* source, 
+            const uint* classIds, uint numClassIds, uint limit);
+
+        DslReturnType OdeTriggerClassCountClassIdsGet(const char* name, 
+            const uint** classIds, uint* numClassIds);
+
+        DslReturnType OdeTriggerClassCountClassIdsSet(const char* name, 
+            const uint* classIds, uint numClassIds);
+
+        DslReturnType OdeTriggerClassCountCountsGet(const char* name, 
+            uint sourceId, const uint** counts, uint* size);
+
         DslReturnType OdeTriggerCustomNew(const char* name, const char* source, 
             uint classId, uint limit,  dsl_ode_check_for_occurrence_cb client_checker, 
             dsl_ode_post_process_frame_cb client_post_processor, void* client_data);
@@ -359,6 +387,15 @@ namespace DSL {
         DslReturnType OdeTriggerLargestNew(const char* name, 
             const char* source, uint classId, uint limit);
 
+        DslReturnType OdeTriggerTopKNew(const char* name, const char* source, 
+            uint classId, uint limit, uint k, uint key, uint order);
+
+        DslReturnType OdeTriggerTopKSettingsGet(const char* name, 
+            uint* k, uint* key, uint* order);
+
+        DslReturnType OdeTriggerTopKSettingsSet(const char* name, 
+            uint k, uint key, uint order);
+
         DslReturnType OdeTriggerNewLowNew(const char* name, 
             const char* source, uint classId, uint limit, uint preset);
 
@@ -378,6 +415,40 @@ namespace DSL {
         DslReturnType OdeTriggerPersistenceRangeSet(const char* name, 
             uint minimum, uint maximum);
 
+        DslReturnType OdeTriggerDwellNew(const char* name, 
+            const char* source, uint classId, uint limit, uint threshold);
+
+        DslReturnType OdeTriggerDwellThresholdGet(const char* name, 
+            uint* threshold);
+        
+        DslReturnType OdeTriggerDwellThresholdSet(const char* name, 
+            uint threshold);
+
+        DslReturnType OdeTriggerDwellOccupancyGet(const char* name, 
+            const char* area, uint* occupancy);
+
+        DslReturnType OdeTriggerVelocityNew(const char* name, 
+            const char* source, uint classId, uint limit, 
+            double minimum, double maximum);
+
+        DslReturnType OdeTriggerVelocitySpeedRangeGet(const char* name, 
+            double* minimum, double* maximum);
+        
+        DslReturnType OdeTriggerVelocitySpeedRangeSet(const char* name, 
+            double minimum, double maximum);
+
+        DslReturnType OdeTriggerVelocityHeadingRangeGet(const char* name, 
+            uint* minimum, uint* maximum);
+        
+        DslReturnType OdeTriggerVelocityHeadingRangeSet(const char* name, 
+            uint minimum, uint maximum);
+
+        DslReturnType OdeTriggerVelocityHomographySet(const char* name, 
+            uint sourceId, const double* homography);
+
+        DslReturnType OdeTriggerVelocityHomographyRemove(const char* name, 
+            uint sourceId);
+
         DslReturnType OdeTriggerEarliestNew(const char* name, 
             const char* source, uint classId, uint limit);
             
@@ -395,6 +466,12 @@ namespace DSL {
             
         DslReturnType OdeTriggerCrossViewSettingsSet(const char* name, 
             boolean enabled, const char* color, uint lineWidth);
+            
+        DslReturnType OdeTriggerTrackingMissToleranceGet(const char* name, 
+            uint* missTolerance);
+            
+        DslReturnType OdeTriggerTrackingMissToleranceSet(const char* name, 
+            uint missTolerance);
         
         DslReturnType OdeTriggerReset(const char* name);
 
@@ -418,6 +495,11 @@ namespace DSL {
         DslReturnType OdeTriggerEnabledStateChangeListenerRemove(const char* name,
             dsl_ode_enabled_state_change_listener_cb listener);
 
+        DslReturnType OdeTriggerMetricsGet(const char* name, 
+            dsl_ode_runtime_metrics* metrics);
+
+        DslReturnType OdeTriggerMetricsClear(const char* name);
+
         DslReturnType OdeTriggerSourceGet(const char* name, const char** source);
         
         DslReturnType OdeTriggerSourceSet(const char* name, const char* source);
@@ -480,6 +562,10 @@ namespace DSL {
         
         DslReturnType OdeTriggerIntervalSet(const char* name, uint interval);
         
+        DslReturnType OdeTriggerPriorityGet(const char* name, uint* priority);
+        
+        DslReturnType OdeTriggerPrioritySet(const char* name, uint priority);
+        
         DslReturnType OdeTriggerActionAdd(const char* name, const char* action);
 
         DslReturnType OdeTriggerActionRemove(const char* name, const char* action);
@@ -516,6 +602,21 @@ namespace DSL {
 
         DslReturnType OdeAccumulatorActionRemoveAll(const char* name);
 
+        DslReturnType OdeAccumulatorWindowsGet(const char* name, 
+            const uint** lengths, uint* numLengths);
+
+        DslReturnType OdeAccumulatorWindowsSet(const char* name, 
+            const uint* lengths, uint numLengths);
+
+        DslReturnType OdeAccumulatorWindowCountsGet(const char* name, 
+            uint sourceId, int classId, const uint64_t** counts, uint* size);
+
+        DslReturnType OdeAccumulatorWindowThresholdGet(const char* name, 
+            uint* window, uint* threshold);
+
+        DslReturnType OdeAccumulatorWindowThresholdSet(const char* name, 
+            uint window, uint threshold);
+
         DslReturnType OdeAccumulatorDelete(const char* name);
         
         DslReturnType OdeAccumulatorDeleteAll();
@@ -537,11 +638,20 @@ namespace DSL {
         DslReturnType OdeHeatMapperLegendSettingsSet(const char* name,
             boolean enabled, uint location, uint width, uint height);
 
+        DslReturnType OdeHeatMapperDecaySettingsGet(const char* name,
+            uint* mode, uint* period);
+
+        DslReturnType OdeHeatMapperDecaySettingsSet(const char* name,
+            uint mode, uint period);
+
         DslReturnType OdeHeatMapperMetricsClear(const char* name);
 
         DslReturnType OdeHeatMapperMetricsGet(const char* name,
             const uint64_t** buffer, uint* size);
 
+        DslReturnType OdeHeatMapperMetricsSourceGet(const char* name,
+            uint sourceId, const uint64_t** buffer, uint* size);
+
         DslReturnType OdeHeatMapperMetricsPrint(const char* name);
 
         DslReturnType OdeHeatMapperMetricsLog(const char* name);
@@ -577,6 +687,39 @@ namespace DSL {
 
         DslReturnType PphOdeDisplayMetaAllocSizeSet(const char* name, uint size);
 
+        DslReturnType PphOdeWorkerCountGet(const char* name, uint* count);
+
+        DslReturnType PphOdeWorkerCountSet(const char* name, uint count);
+
+        DslReturnType PphOdeActionBatchingEnabledGet(const char* name, 
+            boolean* enabled);
+
+        DslReturnType PphOdeActionBatchingEnabledSet(const char* name, 
+            boolean enabled);
+
+        DslReturnType PphOdeMetricsEnabledGet(const char* name, boolean* enabled);
+
+        DslReturnType PphOdeMetricsEnabledSet(const char* name, boolean enabled);
+
+        DslReturnType PphOdeMetricsGet(const char* name, 
+            dsl_ode_runtime_metrics* metrics);
+
+        DslReturnType PphOdeMetricsClear(const char* name);
+
+        DslReturnType PphOdeMetricsPrint(const char* name);
+
+        DslReturnType PphOdeTimeBudgetGet(const char* name, 
+            uint* budget, uint* maxInterval);
+
+        DslReturnType PphOdeTimeBudgetSet(const char* name, 
+            uint budget, uint maxInterval);
+
+        DslReturnType PphOdeLoadSheddingListenerAdd(const char* name, 
+            dsl_pph_ode_load_shedding_listener_cb listener, void* clientData);
+
+        DslReturnType PphOdeLoadSheddingListenerRemove(const char* name, 
+            dsl_pph_ode_load_shedding_listener_cb listener);
+
         DslReturnType PphEnabledGet(const char* name, boolean* enabled);
         
         DslReturnType PphEnabledSet(const char* name, boolean enabled);
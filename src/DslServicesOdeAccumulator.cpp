@@ -151,6 +151,136 @@ namespace DSL
             return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::OdeAccumulatorWindowsGet(const char* name, 
+        const uint** lengths, uint* numLengths)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+
+            m_odeAccumulators[name]->GetWindows(lengths, numLengths);
+
+            LOG_INFO("ODE Accumulator '" << name 
+                << "' returned its Windows successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Accumulator '" << name 
+                << "' threw an exception getting Windows");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorWindowsSet(const char* name, 
+        const uint* lengths, uint numLengths)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+
+            if (!m_odeAccumulators[name]->SetWindows(lengths, numLengths))
+            {
+                LOG_ERROR("ODE Accumulator '" << name 
+                    << "' failed to set Windows");
+                return DSL_RESULT_ODE_ACCUMULATOR_SET_FAILED;
+            }
+            LOG_INFO("ODE Accumulator '" << name 
+                << "' set " << numLengths << " Windows successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Accumulator '" << name 
+                << "' threw an exception setting Windows");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorWindowCountsGet(const char* name, 
+        uint sourceId, int classId, const uint64_t** counts, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+
+            m_odeAccumulators[name]->GetWindowCounts(sourceId, classId, 
+                counts, size);
+
+            LOG_INFO("ODE Accumulator '" << name 
+                << "' returned Window Counts for source = " << sourceId 
+                << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Accumulator '" << name 
+                << "' threw an exception getting Window Counts");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorWindowThresholdGet(const char* name, 
+        uint* window, uint* threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+
+            m_odeAccumulators[name]->GetWindowThreshold(window, threshold);
+
+            LOG_INFO("ODE Accumulator '" << name 
+                << "' returned its Window Threshold successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Accumulator '" << name 
+                << "' threw an exception getting Window Threshold");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeAccumulatorWindowThresholdSet(const char* name, 
+        uint window, uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACCUMULATOR_NAME_NOT_FOUND(m_odeAccumulators, name);
+
+            if (!m_odeAccumulators[name]->SetWindowThreshold(window, threshold))
+            {
+                LOG_ERROR("ODE Accumulator '" << name 
+                    << "' failed to set Window Threshold");
+                return DSL_RESULT_ODE_ACCUMULATOR_SET_FAILED;
+            }
+            LOG_INFO("ODE Accumulator '" << name 
+                << "' set Window Threshold = " << threshold << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Accumulator '" << name 
+                << "' threw an exception setting Window Threshold");
+            return DSL_RESULT_ODE_ACCUMULATOR_THREW_EXCEPTION;
+        }
+    }
     
     DslReturnType Services::OdeAccumulatorDelete(const char* name)
     {
@@ -1629,6 +1629,195 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeActionMetricsGet(const char* name, 
+        dsl_ode_runtime_metrics* metrics)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetRuntimeMetrics().Get(metrics);
+
+            LOG_INFO("ODE Action '" << name 
+                << "' returned runtime metrics successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting runtime metrics");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionMetricsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetRuntimeMetrics().Clear();
+
+            LOG_INFO("ODE Action '" << name 
+                << "' cleared runtime metrics successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception clearing runtime metrics");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionExecutionModeGet(const char* name, 
+        uint* mode, uint* queueSize, uint* overflowPolicy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetExecutionMode(mode, queueSize, overflowPolicy);
+
+            LOG_INFO("ODE Action '" << name << "' returned execution mode = " 
+                << *mode << ", queue size = " << *queueSize 
+                << ", and overflow policy = " << *overflowPolicy 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting execution mode");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionExecutionModeSet(const char* name, 
+        uint mode, uint queueSize, uint overflowPolicy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            if (mode > DSL_ODE_ACTION_EXECUTION_MODE_ASYNC or 
+                overflowPolicy > DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK or
+                !queueSize)
+            {
+                LOG_ERROR("Invalid execution mode settings for ODE Action '" 
+                    << name << "'");
+                return DSL_RESULT_ODE_ACTION_PARAMETER_INVALID;
+            }
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+                
+            if (mode == DSL_ODE_ACTION_EXECUTION_MODE_ASYNC and
+                !pOdeAction->IsAsyncCapable())
+            {
+                LOG_ERROR("ODE Action '" << name 
+                    << "' does not support asynchronous execution");
+                return DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE;
+            }
+            if (!pOdeAction->SetExecutionMode(mode, queueSize, overflowPolicy))
+            {
+                LOG_ERROR("ODE Action '" << name 
+                    << "' failed to set execution mode");
+                return DSL_RESULT_ODE_ACTION_SET_FAILED;
+            }
+            LOG_INFO("ODE Action '" << name << "' set execution mode = " 
+                << mode << ", queue size = " << queueSize 
+                << ", and overflow policy = " << overflowPolicy 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception setting execution mode");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionQueueCountersGet(const char* name, 
+        uint* depth, uint* peakDepth, uint64_t* drops)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->GetQueueCounters(depth, peakDepth, drops);
+
+            LOG_INFO("ODE Action '" << name 
+                << "' returned queue counters successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception getting queue counters");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeActionQueueCountersClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_ACTION_NAME_NOT_FOUND(m_odeActions, name);
+            
+            DSL_ODE_ACTION_PTR pOdeAction = 
+                std::dynamic_pointer_cast<OdeAction>(m_odeActions[name]);
+         
+            pOdeAction->ClearQueueCounters();
+
+            LOG_INFO("ODE Action '" << name 
+                << "' cleared queue counters successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Action '" << name 
+                << "' threw exception clearing queue counters");
+            return DSL_RESULT_ODE_ACTION_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeActionEnabledStateChangeListenerAdd(const char* name,
         dsl_ode_enabled_state_change_listener_cb listener, void* clientData)
     {
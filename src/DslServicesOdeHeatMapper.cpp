@@ -192,6 +192,61 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeHeatMapperDecaySettingsGet(const char* name,
+        uint* mode, uint* period)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            m_odeHeatMappers[name]->GetDecaySettings(mode, period);
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned Decay Settings successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting Decay Settings");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeHeatMapperDecaySettingsSet(const char* name,
+        uint mode, uint period)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            if (!m_odeHeatMappers[name]->SetDecaySettings(mode, period))
+            {
+                LOG_ERROR("ODE HeatMapper '" << name 
+                    << "' failed to set Decay Settings");
+                return DSL_RESULT_ODE_HEAT_MAPPER_SET_FAILED;
+            }
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' set Decay Settings successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception setting Decay Settings");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeHeatMapperMetricsClear(const char* name)
     {
         LOG_FUNC();
@@ -241,6 +296,32 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeHeatMapperMetricsSourceGet(const char* name,
+        uint sourceId, const uint64_t** buffer, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_HEAT_MAPPER_NAME_NOT_FOUND(m_odeHeatMappers, name);
+            
+            m_odeHeatMappers[name]->GetSourceMetrics(sourceId, buffer, size);
+
+            LOG_INFO("ODE Heat-Mapper '" << name 
+                << "' returned metrics for source = " << sourceId 
+                << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE HeatMapper '" << name 
+                << "' threw an exception getting source metrics");
+            return DSL_RESULT_ODE_HEAT_MAPPER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeHeatMapperMetricsPrint(const char* name)
     {
         LOG_FUNC();
@@ -208,6 +208,145 @@ namespace DSL
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }
+
+    DslReturnType Services::OdeTriggerClassCountNew(const char* name, 
+        const char* source, const uint* classIds, uint numClassIds, uint limit)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (!numClassIds)
+            {
+                LOG_ERROR("Invalid parameters - at least one class-id is required "
+                    << "for ODE Class Count Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            for (uint i = 0; i < numClassIds; i++)
+            {
+                if (classIds[i] >= DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES)
+                {
+                    LOG_ERROR("Invalid class-id = " << classIds[i] 
+                        << " for ODE Class Count Trigger '" << name << "'");
+                    return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+                }
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_CLASS_COUNT_NEW(name, 
+                source, classIds, numClassIds, limit);
+            
+            LOG_INFO("New Class Count ODE Trigger '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Class Count ODE Trigger '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+    
+    DslReturnType Services::OdeTriggerClassCountClassIdsGet(const char* name, 
+        const uint** classIds, uint* numClassIds)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                ClassCountOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CLASS_COUNT_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<ClassCountOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetClassIds(classIds, numClassIds);
+
+            LOG_INFO("ODE Class Count Trigger '" << name << "' returned " 
+                << *numClassIds << " class-ids successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Class Count Trigger '" << name 
+                << "' threw exception getting class-ids");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerClassCountClassIdsSet(const char* name, 
+        const uint* classIds, uint numClassIds)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                ClassCountOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CLASS_COUNT_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<ClassCountOdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->SetClassIds(classIds, numClassIds))
+            {
+                LOG_ERROR("ODE Class Count Trigger '" << name 
+                    << "' failed to set class-ids");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            LOG_INFO("ODE Class Count Trigger '" << name << "' set " 
+                << numClassIds << " class-ids successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Class Count Trigger '" << name 
+                << "' threw exception setting class-ids");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerClassCountCountsGet(const char* name, 
+        uint sourceId, const uint** counts, uint* size)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                ClassCountOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CLASS_COUNT_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<ClassCountOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetClassCounts(sourceId, counts, size);
+
+            LOG_INFO("ODE Class Count Trigger '" << name 
+                << "' returned counts for source-id " << sourceId << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Class Count Trigger '" << name 
+                << "' threw exception getting counts");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
     
     DslReturnType Services::OdeTriggerCustomNew(const char* name, const char* source, 
         uint classId, uint limit,  dsl_ode_check_for_occurrence_cb client_checker, 
@@ -542,6 +681,110 @@ namespace DSL
         }
     }
 
+    DslReturnType Services::OdeTriggerTopKNew(const char* name, 
+        const char* source, uint classId, uint limit, uint k, uint key, uint order)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (!k or key > DSL_ODE_TRIGGER_TOP_K_KEY_DWELL or
+                order > DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST)
+            {
+                LOG_ERROR("Invalid parameters - k = " << k << ", key = " << key 
+                    << ", order = " << order << " for ODE Top-K Trigger '" 
+                    << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_TOP_K_NEW(name, 
+                source, classId, limit, k, key, order);
+            
+            LOG_INFO("New Top-K ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Top-K ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerTopKSettingsGet(const char* name, 
+        uint* k, uint* key, uint* order)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                TopKOdeTrigger);
+            
+            DSL_ODE_TRIGGER_TOP_K_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<TopKOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetSettings(k, key, order);
+
+            LOG_INFO("ODE Top-K Trigger '" << name << "' returned k = " << *k 
+                << ", key = " << *key << ", order = " << *order << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Top-K Trigger '" << name 
+                << "' threw exception getting settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerTopKSettingsSet(const char* name, 
+        uint k, uint key, uint order)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                TopKOdeTrigger);
+            
+            if (!k or key > DSL_ODE_TRIGGER_TOP_K_KEY_DWELL or
+                order > DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST)
+            {
+                LOG_ERROR("Invalid parameters - k = " << k << ", key = " << key 
+                    << ", order = " << order << " for ODE Top-K Trigger '" 
+                    << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            DSL_ODE_TRIGGER_TOP_K_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<TopKOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->SetSettings(k, key, order);
+
+            LOG_INFO("ODE Top-K Trigger '" << name << "' set k = " << k 
+                << ", key = " << key << ", order = " << order << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Top-K Trigger '" << name 
+                << "' threw exception setting settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
     DslReturnType Services::OdeTriggerNewHighNew(const char* name, 
         const char* source, uint classId, uint limit, uint preset)
     {
@@ -614,41 +857,487 @@ namespace DSL
                 LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
                 return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
             }
-            if (testMethod > DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS)
-            {
-                LOG_ERROR("Invalid test method = " << testMethod 
-                    << " for ODE Cross Trigger '" << name << "'");
-                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
-            }
-            if (minFrameCount >= maxFrameCount)
+            if (testMethod > DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS)
+            {
+                LOG_ERROR("Invalid test method = " << testMethod 
+                    << " for ODE Cross Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            if (minFrameCount >= maxFrameCount)
+            {
+                LOG_ERROR("Invalid parameters - max_trace_points = " << maxFrameCount 
+                    << "must be greater than min_frame_count = " << minFrameCount
+                    << "for ODE Cross Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            DSL_RGBA_COLOR_PTR pColor = std::dynamic_pointer_cast<RgbaColor>
+                (m_intrinsicDisplayTypes[DISPLAY_TYPE_NO_COLOR.c_str()]);
+            
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_CROSS_NEW(name, 
+                source, classId, limit, minFrameCount, maxFrameCount, 
+                testMethod, pColor);
+            
+            LOG_INFO("New Cross ODE Trigger '" << name 
+                << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Cross ODE Trigger '" << name 
+                << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerCrossTestSettingsGet(const char* name, 
+        uint* minFrameCount, uint* maxFrameCount, uint* testMethod)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CrossOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetTestSettings(minFrameCount, 
+                maxFrameCount, testMethod);
+
+            LOG_INFO("ODE Tracking Trigger '" << name 
+                << "' returned test settings successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Tracking Trigger '" << name 
+                << "' threw exception getting test settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerCrossTestSettingsSet(const char* name, 
+        uint minFrameCount, uint maxFrameCount, uint testMethod)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CrossOdeTrigger);
+            
+            if (testMethod > DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS)
+            {
+                LOG_ERROR("Invalid test method = " << testMethod 
+                    << " for ODE Tracking Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            if (minFrameCount >= maxFrameCount)
+            {
+                LOG_ERROR("Invalid parameters - max_frame_count = " << maxFrameCount
+                    << "must be greater than min_frame_count = " << minFrameCount
+                    << "for ODE Cross Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->SetTestSettings(minFrameCount, 
+                maxFrameCount, testMethod);
+
+            LOG_INFO("ODE Cross Trigger '" << name 
+                << "' set test settings successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Cross Trigger '" << name 
+                << "' threw exception getting test settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerCrossViewSettingsGet(const char* name, 
+        boolean* enabled, const char** color, uint* lineWidth)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CrossOdeTrigger);
+            
+            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+
+            bool bEnabled;
+            pOdeTrigger->GetViewSettings(&bEnabled, color, lineWidth);
+            *enabled = bEnabled;
+
+            LOG_INFO("ODE Tracking Trigger '" << name 
+                << "' returned view settings successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Tracking Trigger '" << name 
+                << "' threw exception getting view settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerCrossViewSettingsSet(const char* name, 
+        boolean enabled, const char* color, uint lineWidth)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                CrossOdeTrigger);
+            DSL_RETURN_IF_DISPLAY_TYPE_NAME_NOT_FOUND(m_displayTypes, color);
+            DSL_RETURN_IF_DISPLAY_TYPE_IS_NOT_COLOR(m_displayTypes, color);
+            
+            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+                
+            DSL_RGBA_COLOR_PTR pColor = 
+                std::dynamic_pointer_cast<RgbaColor>(m_displayTypes[color]);
+
+            pOdeTrigger->SetViewSettings(enabled, pColor, lineWidth);
+
+            LOG_INFO("ODE Track Trigger '" << name 
+                << "' set view settings successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Track Trigger '" << name 
+                << "' threw exception setting view settings");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerTrackingMissToleranceGet(const char* name, 
+        uint* missTolerance)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER(m_odeTriggers, name);
+            
+            DSL_ODE_TRACKING_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<TrackingOdeTrigger>(m_odeTriggers[name]);
+
+            *missTolerance = pOdeTrigger->GetMissTolerance();
+
+            LOG_INFO("ODE Tracking Trigger '" << name 
+                << "' returned miss tolerance = " << *missTolerance 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Tracking Trigger '" << name 
+                << "' threw exception getting miss tolerance");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerTrackingMissToleranceSet(const char* name, 
+        uint missTolerance)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER(m_odeTriggers, name);
+            
+            DSL_ODE_TRACKING_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<TrackingOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->SetMissTolerance(missTolerance);
+
+            LOG_INFO("ODE Tracking Trigger '" << name 
+                << "' set miss tolerance = " << missTolerance 
+                << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Tracking Trigger '" << name 
+                << "' threw exception setting miss tolerance");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerPersistenceNew(const char* name, const char* source, 
+        uint classId, uint limit, uint minimum, uint maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            // check for no maximum
+            maximum = (maximum == 0) ? UINT32_MAX : maximum;
+
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_PERSISTENCE_NEW(name, 
+                source, classId, limit, minimum, maximum);
+            
+            LOG_INFO("New Persistence ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Persistence ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerPersistenceRangeGet(const char* name, 
+        uint* minimum, uint* maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                PersistenceOdeTrigger);
+            
+            DSL_ODE_TRIGGER_PERSISTENCE_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<PersistenceOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->GetRange(minimum, maximum);
+            
+            // check for no maximum
+            *maximum = (*maximum == UINT32_MAX) ? 0 : *maximum;
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Persistence Trigger '" << name 
+                << "' threw exception getting range");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerPersistenceRangeSet(const char* name, 
+        uint minimum, uint maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                PersistenceOdeTrigger);
+            
+            DSL_ODE_TRIGGER_PERSISTENCE_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<PersistenceOdeTrigger>(m_odeTriggers[name]);
+
+            // check for no maximum
+            maximum = (maximum == 0) ? UINT32_MAX : maximum;
+         
+            pOdeTrigger->SetRange(minimum, maximum);
+            
+            LOG_INFO("ODE Persistence Trigger '" << name << "' set new range from mimimum " 
+                << minimum << " to maximum " << maximum << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Persistence Trigger '" << name 
+                << "' threw exception setting range");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerDwellNew(const char* name, const char* source, 
+        uint classId, uint limit, uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_DWELL_NEW(name, 
+                source, classId, limit, threshold);
+            
+            LOG_INFO("New Dwell ODE Trigger '" << name << "' created successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Dwell ODE Trigger '" << name << "' threw exception on create");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerDwellThresholdGet(const char* name, 
+        uint* threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                DwellOdeTrigger);
+            
+            DSL_ODE_TRIGGER_DWELL_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<DwellOdeTrigger>(m_odeTriggers[name]);
+
+            *threshold = pOdeTrigger->GetThreshold();
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Dwell Trigger '" << name 
+                << "' threw exception getting threshold");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerDwellThresholdSet(const char* name, 
+        uint threshold)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                DwellOdeTrigger);
+            
+            DSL_ODE_TRIGGER_DWELL_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<DwellOdeTrigger>(m_odeTriggers[name]);
+
+            pOdeTrigger->SetThreshold(threshold);
+            
+            LOG_INFO("ODE Dwell Trigger '" << name << "' set new threshold " 
+                << threshold << " successfully");
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Dwell Trigger '" << name 
+                << "' threw exception setting threshold");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerDwellOccupancyGet(const char* name, 
+        const char* area, uint* occupancy)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
+                DwellOdeTrigger);
+            DSL_RETURN_IF_ODE_AREA_NAME_NOT_FOUND(m_odeAreas, area);
+            
+            DSL_ODE_TRIGGER_DWELL_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<DwellOdeTrigger>(m_odeTriggers[name]);
+
+            if (!pOdeTrigger->GetOccupancy(m_odeAreas[area], occupancy))
+            {
+                LOG_ERROR("ODE Area '" << area 
+                    << "' is not in use by ODE Dwell Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_AREA_NOT_IN_USE;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Dwell Trigger '" << name 
+                << "' threw exception getting occupancy");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+
+    DslReturnType Services::OdeTriggerVelocityNew(const char* name, 
+        const char* source, uint classId, uint limit, double minimum, double maximum)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            // ensure event name uniqueness 
+            if (m_odeTriggers.find(name) != m_odeTriggers.end())
+            {   
+                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
+                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            }
+            if (minimum < 0 or maximum < 0 or (maximum and minimum > maximum))
             {
-                LOG_ERROR("Invalid parameters - max_trace_points = " << maxFrameCount 
-                    << "must be greater than min_frame_count = " << minFrameCount
-                    << "for ODE Cross Trigger '" << name << "'");
+                LOG_ERROR("Invalid speed range - minimum = " << minimum 
+                    << ", maximum = " << maximum << " for ODE Velocity Trigger '" 
+                    << name << "'");
                 return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
             }
-            DSL_RGBA_COLOR_PTR pColor = std::dynamic_pointer_cast<RgbaColor>
-                (m_intrinsicDisplayTypes[DISPLAY_TYPE_NO_COLOR.c_str()]);
-            
-            m_odeTriggers[name] = DSL_ODE_TRIGGER_CROSS_NEW(name, 
-                source, classId, limit, minFrameCount, maxFrameCount, 
-                testMethod, pColor);
+            m_odeTriggers[name] = DSL_ODE_TRIGGER_VELOCITY_NEW(name, 
+                source, classId, limit, minimum, maximum);
             
-            LOG_INFO("New Cross ODE Trigger '" << name 
-                << "' created successfully");
+            LOG_INFO("New Velocity ODE Trigger '" << name << "' created successfully");
 
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Cross ODE Trigger '" << name 
-                << "' threw exception on create");
+            LOG_ERROR("New Velocity ODE Trigger '" << name << "' threw exception on create");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }
 
-    DslReturnType Services::OdeTriggerCrossTestSettingsGet(const char* name, 
-        uint* minFrameCount, uint* maxFrameCount, uint* testMethod)
+    DslReturnType Services::OdeTriggerVelocitySpeedRangeGet(const char* name, 
+        double* minimum, double* maximum)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -657,29 +1346,25 @@ namespace DSL
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
-                CrossOdeTrigger);
+                VelocityOdeTrigger);
             
-            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+            DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<VelocityOdeTrigger>(m_odeTriggers[name]);
 
-            pOdeTrigger->GetTestSettings(minFrameCount, 
-                maxFrameCount, testMethod);
+            pOdeTrigger->GetSpeedRange(minimum, maximum);
 
-            LOG_INFO("ODE Tracking Trigger '" << name 
-                << "' returned test settings successfully");
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Tracking Trigger '" << name 
-                << "' threw exception getting test settings");
+            LOG_ERROR("ODE Velocity Trigger '" << name 
+                << "' threw exception getting speed range");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }                
     
-    DslReturnType Services::OdeTriggerCrossTestSettingsSet(const char* name, 
-        uint minFrameCount, uint maxFrameCount, uint testMethod)
+    DslReturnType Services::OdeTriggerVelocitySpeedRangeSet(const char* name, 
+        double minimum, double maximum)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -688,42 +1373,34 @@ namespace DSL
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
-                CrossOdeTrigger);
+                VelocityOdeTrigger);
             
-            if (testMethod > DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS)
-            {
-                LOG_ERROR("Invalid test method = " << testMethod 
-                    << " for ODE Tracking Trigger '" << name << "'");
-                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
-            }
-            if (minFrameCount >= maxFrameCount)
+            if (minimum < 0 or maximum < 0 or (maximum and minimum > maximum))
             {
-                LOG_ERROR("Invalid parameters - max_frame_count = " << maxFrameCount
-                    << "must be greater than min_frame_count = " << minFrameCount
-                    << "for ODE Cross Trigger '" << name << "'");
+                LOG_ERROR("Invalid speed range - minimum = " << minimum 
+                    << ", maximum = " << maximum << " for ODE Velocity Trigger '" 
+                    << name << "'");
                 return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
             }
-            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
-
-            pOdeTrigger->SetTestSettings(minFrameCount, 
-                maxFrameCount, testMethod);
+            DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<VelocityOdeTrigger>(m_odeTriggers[name]);
 
-            LOG_INFO("ODE Cross Trigger '" << name 
-                << "' set test settings successfully");
+            pOdeTrigger->SetSpeedRange(minimum, maximum);
             
+            LOG_INFO("ODE Velocity Trigger '" << name << "' set new speed range from mimimum " 
+                << minimum << " to maximum " << maximum << " successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Cross Trigger '" << name 
-                << "' threw exception getting test settings");
+            LOG_ERROR("ODE Velocity Trigger '" << name 
+                << "' threw exception setting speed range");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }                
-    
-    DslReturnType Services::OdeTriggerCrossViewSettingsGet(const char* name, 
-        boolean* enabled, const char** color, uint* lineWidth)
+
+    DslReturnType Services::OdeTriggerVelocityHeadingRangeGet(const char* name, 
+        uint* minimum, uint* maximum)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -732,30 +1409,25 @@ namespace DSL
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
-                CrossOdeTrigger);
+                VelocityOdeTrigger);
             
-            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
+            DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<VelocityOdeTrigger>(m_odeTriggers[name]);
 
-            bool bEnabled;
-            pOdeTrigger->GetViewSettings(&bEnabled, color, lineWidth);
-            *enabled = bEnabled;
+            pOdeTrigger->GetHeadingRange(minimum, maximum);
 
-            LOG_INFO("ODE Tracking Trigger '" << name 
-                << "' returned view settings successfully");
-            
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Tracking Trigger '" << name 
-                << "' threw exception getting view settings");
+            LOG_ERROR("ODE Velocity Trigger '" << name 
+                << "' threw exception getting heading range");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }                
     
-    DslReturnType Services::OdeTriggerCrossViewSettingsSet(const char* name, 
-        boolean enabled, const char* color, uint lineWidth)
+    DslReturnType Services::OdeTriggerVelocityHeadingRangeSet(const char* name, 
+        uint minimum, uint maximum)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -764,64 +1436,34 @@ namespace DSL
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
-                CrossOdeTrigger);
-            DSL_RETURN_IF_DISPLAY_TYPE_NAME_NOT_FOUND(m_displayTypes, color);
-            DSL_RETURN_IF_DISPLAY_TYPE_IS_NOT_COLOR(m_displayTypes, color);
-            
-            DSL_ODE_TRIGGER_CROSS_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<CrossOdeTrigger>(m_odeTriggers[name]);
-                
-            DSL_RGBA_COLOR_PTR pColor = 
-                std::dynamic_pointer_cast<RgbaColor>(m_displayTypes[color]);
-
-            pOdeTrigger->SetViewSettings(enabled, pColor, lineWidth);
-
-            LOG_INFO("ODE Track Trigger '" << name 
-                << "' set view settings successfully");
+                VelocityOdeTrigger);
             
-            return DSL_RESULT_SUCCESS;
-        }
-        catch(...)
-        {
-            LOG_ERROR("ODE Track Trigger '" << name 
-                << "' threw exception setting view settings");
-            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
-        }
-    }                
-
-    DslReturnType Services::OdeTriggerPersistenceNew(const char* name, const char* source, 
-        uint classId, uint limit, uint minimum, uint maximum)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
-        {
-            // ensure event name uniqueness 
-            if (m_odeTriggers.find(name) != m_odeTriggers.end())
-            {   
-                LOG_ERROR("ODE Trigger name '" << name << "' is not unique");
-                return DSL_RESULT_ODE_TRIGGER_NAME_NOT_UNIQUE;
+            if (minimum > 360 or maximum > 360)
+            {
+                LOG_ERROR("Invalid heading range - minimum = " << minimum 
+                    << ", maximum = " << maximum << " for ODE Velocity Trigger '" 
+                    << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
             }
-            // check for no maximum
-            maximum = (maximum == 0) ? UINT32_MAX : maximum;
+            DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<VelocityOdeTrigger>(m_odeTriggers[name]);
 
-            m_odeTriggers[name] = DSL_ODE_TRIGGER_PERSISTENCE_NEW(name, 
-                source, classId, limit, minimum, maximum);
+            pOdeTrigger->SetHeadingRange(minimum, maximum);
             
-            LOG_INFO("New Persistence ODE Trigger '" << name << "' created successfully");
-
+            LOG_INFO("ODE Velocity Trigger '" << name << "' set new heading range from mimimum " 
+                << minimum << " to maximum " << maximum << " successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("New Persistence ODE Trigger '" << name << "' threw exception on create");
+            LOG_ERROR("ODE Velocity Trigger '" << name 
+                << "' threw exception setting heading range");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
-    }
+    }                
 
-    DslReturnType Services::OdeTriggerPersistenceRangeGet(const char* name, 
-        uint* minimum, uint* maximum)
+    DslReturnType Services::OdeTriggerVelocityHomographySet(const char* name, 
+        uint sourceId, const double* homography)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -830,28 +1472,31 @@ namespace DSL
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
-                PersistenceOdeTrigger);
-            
-            DSL_ODE_TRIGGER_PERSISTENCE_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<PersistenceOdeTrigger>(m_odeTriggers[name]);
-
-            pOdeTrigger->GetRange(minimum, maximum);
+                VelocityOdeTrigger);
             
-            // check for no maximum
-            *maximum = (*maximum == UINT32_MAX) ? 0 : *maximum;
+            DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<VelocityOdeTrigger>(m_odeTriggers[name]);
 
+            if (!pOdeTrigger->SetHomography(sourceId, homography))
+            {
+                LOG_ERROR("Invalid homography for source-id " << sourceId 
+                    << " for ODE Velocity Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            LOG_INFO("ODE Velocity Trigger '" << name 
+                << "' set homography for source-id " << sourceId << " successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Persistence Trigger '" << name 
-                << "' threw exception getting range");
+            LOG_ERROR("ODE Velocity Trigger '" << name 
+                << "' threw exception setting homography");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }                
-    
-    DslReturnType Services::OdeTriggerPersistenceRangeSet(const char* name, 
-        uint minimum, uint maximum)
+
+    DslReturnType Services::OdeTriggerVelocityHomographyRemove(const char* name, 
+        uint sourceId)
     {
         LOG_FUNC();
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
@@ -860,24 +1505,25 @@ namespace DSL
         {
             DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
             DSL_RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_odeTriggers, name, 
-                PersistenceOdeTrigger);
+                VelocityOdeTrigger);
             
-            DSL_ODE_TRIGGER_PERSISTENCE_PTR pOdeTrigger = 
-                std::dynamic_pointer_cast<PersistenceOdeTrigger>(m_odeTriggers[name]);
+            DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<VelocityOdeTrigger>(m_odeTriggers[name]);
 
-            // check for no maximum
-            maximum = (maximum == 0) ? UINT32_MAX : maximum;
-         
-            pOdeTrigger->SetRange(minimum, maximum);
-            
-            LOG_INFO("ODE Persistence Trigger '" << name << "' set new range from mimimum " 
-                << minimum << " to maximum " << maximum << " successfully");
+            if (!pOdeTrigger->RemoveHomography(sourceId))
+            {
+                LOG_ERROR("ODE Velocity Trigger '" << name 
+                    << "' has no homography for source-id " << sourceId);
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            LOG_INFO("ODE Velocity Trigger '" << name 
+                << "' removed homography for source-id " << sourceId << " successfully");
             return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("ODE Persistence Trigger '" << name 
-                << "' threw exception setting range");
+            LOG_ERROR("ODE Velocity Trigger '" << name 
+                << "' threw exception removing homography");
             return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
         }
     }                
@@ -1132,6 +1778,61 @@ namespace DSL
         }
     }                
 
+    DslReturnType Services::OdeTriggerMetricsGet(const char* name, 
+        dsl_ode_runtime_metrics* metrics)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetRuntimeMetrics().Get(metrics);
+
+            LOG_INFO("ODE Trigger '" << name 
+                << "' returned runtime metrics successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception getting runtime metrics");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::OdeTriggerMetricsClear(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->GetRuntimeMetrics().Clear();
+
+            LOG_INFO("ODE Trigger '" << name 
+                << "' cleared runtime metrics successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name 
+                << "' threw exception clearing runtime metrics");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }
+
     DslReturnType Services::OdeTriggerEnabledStateChangeListenerAdd(const char* name,
         dsl_ode_enabled_state_change_listener_cb listener, void* clientData)
     {
@@ -1857,6 +2558,65 @@ namespace DSL
         }
     }                
     
+    DslReturnType Services::OdeTriggerPriorityGet(const char* name, uint* priority)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            *priority = pOdeTrigger->GetPriority();
+            
+            LOG_INFO("Trigger '" << name << "' returned Priority = " 
+                << *priority << " successfully");
+            
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception getting Priority");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
+    DslReturnType Services::OdeTriggerPrioritySet(const char* name, uint priority)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+
+        try
+        {
+            DSL_RETURN_IF_ODE_TRIGGER_NAME_NOT_FOUND(m_odeTriggers, name);
+            
+            if (priority > DSL_ODE_TRIGGER_PRIORITY_LOW)
+            {
+                LOG_ERROR("Invalid Priority = " << priority 
+                    << " for ODE Trigger '" << name << "'");
+                return DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID;
+            }
+            
+            DSL_ODE_TRIGGER_PTR pOdeTrigger = 
+                std::dynamic_pointer_cast<OdeTrigger>(m_odeTriggers[name]);
+         
+            pOdeTrigger->SetPriority(priority);
+
+            LOG_INFO("Trigger '" << name << "' set Priority = " 
+                << priority << " successfully");
+
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("ODE Trigger '" << name << "' threw exception setting Priority");
+            return DSL_RESULT_ODE_TRIGGER_THREW_EXCEPTION;
+        }
+    }                
+    
     DslReturnType Services::OdeTriggerActionAdd(const char* name, const char* action)
     {
         LOG_FUNC();
@@ -101,6 +101,21 @@ THE SOFTWARE.
     } \
 }while(0); 
 
+#define DSL_RETURN_IF_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(CrossOdeTrigger)) and  \
+        !components[name]->IsType(typeid(PersistenceOdeTrigger)) and  \
+        !components[name]->IsType(typeid(LatestOdeTrigger)) and  \
+        !components[name]->IsType(typeid(EarliestOdeTrigger)) and  \
+        !components[name]->IsType(typeid(TopKOdeTrigger)) and  \
+        !components[name]->IsType(typeid(DwellOdeTrigger)) and  \
+        !components[name]->IsType(typeid(VelocityOdeTrigger))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Tracking ODE Trigger"); \
+        return DSL_RESULT_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER; \
+    } \
+}while(0); 
+
 #define DSL_RETURN_IF_BRANCH_NAME_NOT_FOUND(branches, name) do \
 { \
     if (branches.find(name) == branches.end()) \
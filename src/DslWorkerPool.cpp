@@ -0,0 +1,163 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "Dsl.h"
+#include "DslWorkerPool.h"
+
+namespace DSL
+{
+    WorkerPool::WorkerPool(const char* name, uint numWorkers)
+        : m_name(name)
+        , m_generation(0)
+        , m_task(NULL)
+        , m_clientData(NULL)
+        , m_taskCount(0)
+        , m_nextTaskIndex(0)
+        , m_activeWorkers(0)
+        , m_stop(false)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_poolMutex);
+        g_cond_init(&m_tasksAvailableCond);
+        g_cond_init(&m_tasksCompleteCond);
+        
+        for (uint i=0; i < numWorkers; i++)
+        {
+            m_workerThreads.push_back(
+                g_thread_new(m_name.c_str(), WorkerPoolThread, this));
+        }
+        LOG_INFO("WorkerPool '" << m_name << "' created with " 
+            << numWorkers << " worker threads");
+    }
+    
+    WorkerPool::~WorkerPool()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            m_stop = true;
+            g_cond_broadcast(&m_tasksAvailableCond);
+        }
+        for (auto &ivec: m_workerThreads)
+        {
+            g_thread_join(ivec);
+        }
+        g_cond_clear(&m_tasksCompleteCond);
+        g_cond_clear(&m_tasksAvailableCond);
+        g_mutex_clear(&m_poolMutex);
+    }
+    
+    uint WorkerPool::GetNumWorkers()
+    {
+        LOG_FUNC();
+        
+        return m_workerThreads.size();
+    }
+    
+    void WorkerPool::Execute(uint count, dsl_worker_pool_task_cb task, 
+        void* clientData)
+    {
+        // Do not log function entry
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            
+            m_task = task;
+            m_clientData = clientData;
+            m_taskCount = count;
+            m_nextTaskIndex = 0;
+            m_activeWorkers = m_workerThreads.size();
+            m_generation++;
+            
+            g_cond_broadcast(&m_tasksAvailableCond);
+        }
+        
+        // The calling thread executes tasks as well
+        executeTasks();
+        
+        // Join - wait for all workers to complete the current set.
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+        while (m_activeWorkers)
+        {
+            g_cond_wait(&m_tasksCompleteCond, &m_poolMutex);
+        }
+    }
+    
+    void WorkerPool::HandleWorkerThread()
+    {
+        uint64_t generation(0);
+        
+        while (true)
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+                
+                while (!m_stop and m_generation == generation)
+                {
+                    g_cond_wait(&m_tasksAvailableCond, &m_poolMutex);
+                }
+                if (m_stop)
+                {
+                    return;
+                }
+                generation = m_generation;
+            }
+            
+            executeTasks();
+            
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_poolMutex);
+            if (--m_activeWorkers == 0)
+            {
+                g_cond_signal(&m_tasksCompleteCond);
+            }
+        }
+    }
+    
+    void WorkerPool::executeTasks()
+    {
+        uint index;
+        while ((index = m_nextTaskIndex++) < m_taskCount)
+        {
+            try
+            {
+                m_task(index, m_clientData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("WorkerPool '" << m_name << "' task " 
+                    << index << " threw exception");
+            }
+        }
+    }
+    
+    static gpointer WorkerPoolThread(gpointer pWorkerPool)
+    {
+        static_cast<WorkerPool*>(pWorkerPool)->HandleWorkerThread();
+        
+        return NULL;
+    }
+}
@@ -0,0 +1,168 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_WORKER_POOL_H
+#define _DSL_WORKER_POOL_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_WORKER_POOL_PTR std::shared_ptr<WorkerPool>
+    #define DSL_WORKER_POOL_NEW(name, numWorkers) \
+        std::shared_ptr<WorkerPool>(new WorkerPool(name, numWorkers))
+
+    /**
+     * @brief callback typedef for a Worker Pool task function.
+     * @param[in] index index of the task to execute, [0..count-1].
+     * @param[in] client_data opaque pointer to the client's data.
+     */
+    typedef void (*dsl_worker_pool_task_cb)(uint index, void* client_data);
+
+    /**
+     * @class WorkerPool
+     * @brief Implements a fixed pool of worker threads used to fan-out a set 
+     * of indexed tasks and join on their completion. The calling thread 
+     * participates in the execution of each set of tasks.
+     */
+    class WorkerPool
+    {
+    public: 
+    
+        /**
+         * @brief ctor for the WorkerPool class
+         * @param[in] name name for the WorkerPool, used for logging only.
+         * @param[in] numWorkers number of worker threads to create.
+         */
+        WorkerPool(const char* name, uint numWorkers);
+        
+        /**
+         * @brief dtor for the WorkerPool class - stops and joins all workers.
+         */
+        ~WorkerPool();
+        
+        /**
+         * @brief Gets the number of worker threads owned by this WorkerPool.
+         * @return number of worker threads.
+         */
+        uint GetNumWorkers();
+        
+        /**
+         * @brief Executes a set of tasks with the calling thread and all workers, 
+         * returning once all tasks have completed. Tasks are claimed in index 
+         * order, but may complete in any order.
+         * @param[in] count number of tasks to execute.
+         * @param[in] task task function to call once for each index [0..count-1].
+         * @param[in] clientData opaque pointer to pass to each task function.
+         */
+        void Execute(uint count, dsl_worker_pool_task_cb task, void* clientData);
+        
+        /**
+         * @brief Worker thread function, called by each worker on creation. 
+         * Returns when the WorkerPool is destroyed.
+         */
+        void HandleWorkerThread();
+        
+    private:
+    
+        /**
+         * @brief Claims and executes tasks from the current set until none remain.
+         */
+        void executeTasks();
+    
+        /**
+         * @brief name for the WorkerPool, used for logging only.
+         */
+        std::string m_name;
+        
+        /**
+         * @brief worker threads owned by this WorkerPool.
+         */
+        std::vector<GThread*> m_workerThreads;
+        
+        /**
+         * @brief mutex to protect the shared state below.
+         */
+        GMutex m_poolMutex;
+        
+        /**
+         * @brief condition signaled to the workers on each new set of tasks
+         * and on stop.
+         */
+        GCond m_tasksAvailableCond;
+        
+        /**
+         * @brief condition signaled by the last worker to complete a set of tasks.
+         */
+        GCond m_tasksCompleteCond;
+        
+        /**
+         * @brief incremented on each call to Execute to identify the current set.
+         */
+        uint64_t m_generation;
+        
+        /**
+         * @brief task function for the current set of tasks.
+         */
+        dsl_worker_pool_task_cb m_task;
+        
+        /**
+         * @brief client data for the current set of tasks.
+         */
+        void* m_clientData;
+        
+        /**
+         * @brief number of tasks in the current set.
+         */
+        uint m_taskCount;
+        
+        /**
+         * @brief index of the next task to be claimed in the current set.
+         */
+        std::atomic<uint> m_nextTaskIndex;
+        
+        /**
+         * @brief number of workers yet to complete the current set.
+         */
+        uint m_activeWorkers;
+        
+        /**
+         * @brief set to true to stop all workers.
+         */
+        bool m_stop;
+    };
+    
+    /**
+     * @brief Thread function for each worker thread owned by a WorkerPool.
+     * @param[in] pWorkerPool pointer to the WorkerPool that owns the thread.
+     * @return NULL on WorkerPool destruction.
+     */
+    static gpointer WorkerPoolThread(gpointer pWorkerPool);
+}
+
+#endif // _DSL_WORKER_POOL_H
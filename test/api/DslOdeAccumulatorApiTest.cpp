@@ -216,6 +216,19 @@ SCENARIO( "The ODE Accumulator API checks for NULL input parameters", "[ode-accu
                     ode_accumulator_name.c_str(), NULL) == 
                         DSL_RESULT_INVALID_INPUT_PARAM );
 
+                REQUIRE( dsl_ode_accumulator_windows_get(
+                    ode_accumulator_name.c_str(), NULL, NULL) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_windows_set(
+                    ode_accumulator_name.c_str(), NULL, 1) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_window_counts_get(
+                    ode_accumulator_name.c_str(), 0, 0, NULL, NULL) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_accumulator_window_threshold_get(
+                    ode_accumulator_name.c_str(), NULL, NULL) == 
+                        DSL_RESULT_INVALID_INPUT_PARAM );
+
                 REQUIRE( dsl_ode_accumulator_delete(NULL) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
 
@@ -224,4 +237,59 @@ SCENARIO( "The ODE Accumulator API checks for NULL input parameters", "[ode-accu
             }
         }
     }
-}
\ No newline at end of file
+}
+
+SCENARIO( "An ODE Accumulator's rolling windows can be set and queried", 
+    "[ode-accumulator-api]" )
+{
+    GIVEN( "A new ODE Accumulator" ) 
+    {
+        std::wstring odeAccumulatorName(L"accumulator");
+
+        REQUIRE( dsl_ode_accumulator_new(
+            odeAccumulatorName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Accumulator's windows are set" ) 
+        {
+            uint lengths[] = {10000, 300000};
+            
+            REQUIRE( dsl_ode_accumulator_windows_set(odeAccumulatorName.c_str(),
+                lengths, 2) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_ode_accumulator_window_threshold_set(
+                odeAccumulatorName.c_str(), 1, 20) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct windows and counts are returned" ) 
+            {
+                const uint* retLengths(NULL);
+                uint numLengths(0);
+                REQUIRE( dsl_ode_accumulator_windows_get(odeAccumulatorName.c_str(),
+                    &retLengths, &numLengths) == DSL_RESULT_SUCCESS );
+                REQUIRE( numLengths == 2 );
+                REQUIRE( retLengths[0] == 10000 );
+                REQUIRE( retLengths[1] == 300000 );
+                
+                const uint64_t* counts(NULL);
+                uint size(0);
+                REQUIRE( dsl_ode_accumulator_window_counts_get(
+                    odeAccumulatorName.c_str(), 0, DSL_ODE_ANY_CLASS, 
+                    &counts, &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( size == 2 );
+                REQUIRE( counts[0] == 0 );
+                REQUIRE( counts[1] == 0 );
+                
+                uint window(0), threshold(0);
+                REQUIRE( dsl_ode_accumulator_window_threshold_get(
+                    odeAccumulatorName.c_str(), &window, &threshold) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( window == 1 );
+                REQUIRE( threshold == 20 );
+                
+                REQUIRE( dsl_ode_accumulator_window_threshold_set(
+                    odeAccumulatorName.c_str(), 2, 20) == 
+                        DSL_RESULT_ODE_ACCUMULATOR_SET_FAILED );
+
+                REQUIRE( dsl_ode_accumulator_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
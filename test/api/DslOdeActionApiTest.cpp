@@ -1304,6 +1304,100 @@ SCENARIO( "A new Print ODE Action can be created and deleted", "[ode-action-api]
     }
 }
 
+SCENARIO( "A Print ODE Action's execution mode can be set and queried", "[ode-action-api]" )
+{
+    GIVEN( "A new Print ODE Action" ) 
+    {
+        std::wstring action_name(L"print-action");
+
+        REQUIRE( dsl_ode_action_print_new(action_name.c_str(), false) == DSL_RESULT_SUCCESS );
+
+        uint mode(99), queue_size(99), overflow_policy(99);
+        REQUIRE( dsl_ode_action_execution_mode_get(action_name.c_str(), 
+            &mode, &queue_size, &overflow_policy) == DSL_RESULT_SUCCESS );
+        REQUIRE( mode == DSL_ODE_ACTION_EXECUTION_MODE_SYNC );
+        
+        WHEN( "The Print Action's execution mode is set to async" ) 
+        {
+            REQUIRE( dsl_ode_action_execution_mode_set(action_name.c_str(), 
+                DSL_ODE_ACTION_EXECUTION_MODE_ASYNC, 100, 
+                DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_NEWEST) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct settings and counters are returned" ) 
+            {
+                REQUIRE( dsl_ode_action_execution_mode_get(action_name.c_str(), 
+                    &mode, &queue_size, &overflow_policy) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_ODE_ACTION_EXECUTION_MODE_ASYNC );
+                REQUIRE( queue_size == 100 );
+                REQUIRE( overflow_policy == DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_NEWEST );
+                
+                uint depth(99), peak_depth(99);
+                uint64_t drops(99);
+                REQUIRE( dsl_ode_action_queue_counters_get(action_name.c_str(), 
+                    &depth, &peak_depth, &drops) == DSL_RESULT_SUCCESS );
+                REQUIRE( depth == 0 );
+                REQUIRE( peak_depth == 0 );
+                REQUIRE( drops == 0 );
+                REQUIRE( dsl_ode_action_queue_counters_clear(action_name.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                    
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+        WHEN( "Invalid execution mode settings are used" ) 
+        {
+            THEN( "The Print Action's execution mode is unchanged" ) 
+            {
+                REQUIRE( dsl_ode_action_execution_mode_set(action_name.c_str(), 
+                    DSL_ODE_ACTION_EXECUTION_MODE_ASYNC+1, 100, 
+                    DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK) == 
+                    DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_action_execution_mode_set(action_name.c_str(), 
+                    DSL_ODE_ACTION_EXECUTION_MODE_ASYNC, 0, 
+                    DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK) == 
+                    DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_action_execution_mode_set(action_name.c_str(), 
+                    DSL_ODE_ACTION_EXECUTION_MODE_ASYNC, 100, 
+                    DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK+1) == 
+                    DSL_RESULT_ODE_ACTION_PARAMETER_INVALID );
+                    
+                REQUIRE( dsl_ode_action_execution_mode_get(action_name.c_str(), 
+                    &mode, &queue_size, &overflow_policy) == DSL_RESULT_SUCCESS );
+                REQUIRE( mode == DSL_ODE_ACTION_EXECUTION_MODE_SYNC );
+                    
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An ODE Action that modifies metadata can not be set to async execution", "[ode-action-api]" )
+{
+    GIVEN( "A new Redact ODE Action" ) 
+    {
+        std::wstring action_name(L"redact-action");
+
+        REQUIRE( dsl_ode_action_redact_new(action_name.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Redact Action's execution mode is set to async" ) 
+        {
+            uint retval = dsl_ode_action_execution_mode_set(action_name.c_str(), 
+                DSL_ODE_ACTION_EXECUTION_MODE_ASYNC, 100, 
+                DSL_ODE_ACTION_QUEUE_OVERFLOW_DROP_OLDEST);
+            
+            THEN( "The service fails with the correct result" ) 
+            {
+                REQUIRE( retval == DSL_RESULT_ODE_ACTION_NOT_THE_CORRECT_TYPE );
+                    
+                REQUIRE( dsl_ode_action_delete(action_name.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_action_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new Redact ODE Action can be created and deleted", "[ode-action-api]" )
 {
     GIVEN( "Attributes for a new Redact ODE Action" ) 
@@ -1997,6 +2091,14 @@ SCENARIO( "The ODE Action API checks for NULL input parameters", "[ode-action-ap
 
                 REQUIRE( dsl_ode_action_enabled_get(NULL, &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_action_enabled_set(NULL, false) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_metrics_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_metrics_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_execution_mode_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_execution_mode_get(action_name.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_execution_mode_set(NULL, 0, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_queue_counters_get(NULL, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_queue_counters_get(action_name.c_str(), NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_action_queue_counters_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_action_delete(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_action_delete_many(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -491,6 +491,43 @@ SCENARIO( "An ODE Trigger's interval can be set/get", "[ode-trigger-api]" )
     }
 }    
 
+SCENARIO( "An ODE Trigger's priority can be set/get", "[ode-trigger-api]" )
+{
+    GIVEN( "An ODE Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"occurrence");
+        
+        uint class_id(9);
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit) == DSL_RESULT_SUCCESS );
+
+        uint ret_priority(99);
+        REQUIRE( dsl_ode_trigger_priority_get(odeTriggerName.c_str(), 
+            &ret_priority) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_priority == DSL_ODE_TRIGGER_PRIORITY_NORMAL );
+
+        WHEN( "When the Trigger's priority is updated" )         
+        {
+            REQUIRE( dsl_ode_trigger_priority_set(odeTriggerName.c_str(), 
+                DSL_ODE_TRIGGER_PRIORITY_LOW) == DSL_RESULT_SUCCESS );
+            
+            // invalid priority must fail
+            REQUIRE( dsl_ode_trigger_priority_set(odeTriggerName.c_str(), 
+                DSL_ODE_TRIGGER_PRIORITY_LOW+1) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+            
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_priority_get(odeTriggerName.c_str(), 
+                    &ret_priority) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_priority == DSL_ODE_TRIGGER_PRIORITY_LOW );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A new Absence Trigger can be created and deleted correctly", 
     "[ode-trigger-api]" )
 {
@@ -765,6 +802,80 @@ SCENARIO( "A new Summation Trigger can be created and deleted correctly",
     }
 }    
 
+SCENARIO( "A new Class Count Trigger can update its class-ids correctly",
+    "[ode-trigger-api]" )
+{
+    GIVEN( "A new Class Count Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"class-count");
+        uint class_ids[] = {2, 0, 2};
+        uint limit(0);
+
+        REQUIRE( dsl_ode_trigger_class_count_new(odeTriggerName.c_str(), 
+            NULL, class_ids, 3, limit) == DSL_RESULT_SUCCESS );
+
+        const uint* ret_class_ids(NULL);
+        uint num_class_ids(0);
+        
+        REQUIRE( dsl_ode_trigger_class_count_class_ids_get(odeTriggerName.c_str(), 
+            &ret_class_ids, &num_class_ids) == DSL_RESULT_SUCCESS );
+        REQUIRE( num_class_ids == 2 );
+        REQUIRE( ret_class_ids[0] == 0 );
+        REQUIRE( ret_class_ids[1] == 2 );
+
+        WHEN( "The Trigger's class-ids are updated" )         
+        {
+            uint new_class_ids[] = {5, 1, 3};
+            
+            REQUIRE( dsl_ode_trigger_class_count_class_ids_set(
+                odeTriggerName.c_str(), new_class_ids, 3) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct class-ids and counts are returned" ) 
+            {
+                REQUIRE( dsl_ode_trigger_class_count_class_ids_get(
+                    odeTriggerName.c_str(), &ret_class_ids, &num_class_ids) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( num_class_ids == 3 );
+                REQUIRE( ret_class_ids[0] == 1 );
+                REQUIRE( ret_class_ids[1] == 3 );
+                REQUIRE( ret_class_ids[2] == 5 );
+                
+                const uint* counts(NULL);
+                uint size(0);
+                REQUIRE( dsl_ode_trigger_class_count_counts_get(
+                    odeTriggerName.c_str(), 0, &counts, &size) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( size == 3 );
+                REQUIRE( counts[0] == 0 );
+                REQUIRE( counts[2] == 0 );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid set of class-ids is used" )         
+        {
+            uint invalid_class_ids[] = {1, DSL_ODE_TRIGGER_CLASS_COUNT_MAX_CLASSES};
+            
+            THEN( "The Trigger fails to update or create" ) 
+            {
+                REQUIRE( dsl_ode_trigger_class_count_class_ids_set(
+                    odeTriggerName.c_str(), invalid_class_ids, 2) == 
+                        DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_class_count_class_ids_set(
+                    odeTriggerName.c_str(), invalid_class_ids, 0) == 
+                        DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_class_count_new(L"invalid", 
+                    NULL, invalid_class_ids, 2, limit) == 
+                        DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A new Intersection Trigger can be created and deleted correctly",
     "[ode-trigger-api]" )
 {
@@ -889,6 +1000,80 @@ SCENARIO( "A new Largest Trigger can be created and deleted correctly",
     }
 }    
 
+SCENARIO( "A new Top-K Trigger can be created and its settings updated correctly",
+    "[ode-trigger-api]" )
+{
+    GIVEN( "Attributes for a new Top-K Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"top-k");
+        uint class_id(0);
+        uint limit(0);
+        uint k(3);
+
+        REQUIRE( dsl_ode_trigger_top_k_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit, k, DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y,
+            DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST) == DSL_RESULT_SUCCESS );
+
+        uint retK(0), retKey(99), retOrder(99);
+        REQUIRE( dsl_ode_trigger_top_k_settings_get(odeTriggerName.c_str(), 
+            &retK, &retKey, &retOrder) == DSL_RESULT_SUCCESS );
+        REQUIRE( retK == k );
+        REQUIRE( retKey == DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y );
+        REQUIRE( retOrder == DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST );
+
+        WHEN( "When the Trigger's settings are updated" )         
+        {
+            uint newK(5);
+            REQUIRE( dsl_ode_trigger_top_k_settings_set(odeTriggerName.c_str(), 
+                newK, DSL_ODE_TRIGGER_TOP_K_KEY_DWELL,
+                DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_top_k_settings_get(odeTriggerName.c_str(), 
+                    &retK, &retKey, &retOrder) == DSL_RESULT_SUCCESS );
+                REQUIRE( retK == newK );
+                REQUIRE( retKey == DSL_ODE_TRIGGER_TOP_K_KEY_DWELL );
+                REQUIRE( retOrder == DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+        WHEN( "When invalid settings are used" )         
+        {
+            THEN( "The updates fail and the settings are unchanged" ) 
+            {
+                REQUIRE( dsl_ode_trigger_top_k_settings_set(odeTriggerName.c_str(), 
+                    0, DSL_ODE_TRIGGER_TOP_K_KEY_AREA,
+                    DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST) == 
+                    DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_top_k_settings_set(odeTriggerName.c_str(), 
+                    k, DSL_ODE_TRIGGER_TOP_K_KEY_DWELL+1,
+                    DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST) == 
+                    DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_top_k_settings_set(odeTriggerName.c_str(), 
+                    k, DSL_ODE_TRIGGER_TOP_K_KEY_AREA,
+                    DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST+1) == 
+                    DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_top_k_new(L"invalid", 
+                    NULL, class_id, limit, 0, DSL_ODE_TRIGGER_TOP_K_KEY_AREA,
+                    DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST) == 
+                    DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_top_k_settings_get(odeTriggerName.c_str(), 
+                    &retK, &retKey, &retOrder) == DSL_RESULT_SUCCESS );
+                REQUIRE( retK == k );
+                REQUIRE( retKey == DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y );
+                REQUIRE( retOrder == DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_list_size() == 0 );
+            }
+        }
+    }
+}    
+
 SCENARIO( "A new Latest Trigger can be created and deleted correctly",
     "[ode-trigger-api]" )
 {
@@ -1016,6 +1201,181 @@ SCENARIO( "A new Persistence Trigger can be created and deleted correctly",
     }
 }    
 
+SCENARIO( "A new Dwell Trigger can be created and its occupancy queried correctly",
+    "[ode-trigger-api]" )
+{
+    GIVEN( "Attributes for a new Dwell Trigger and an ODE Area" ) 
+    {
+        std::wstring odeTriggerName(L"dwell");
+        uint class_id(0);
+        uint limit(0);
+        uint threshold(10);
+        
+        std::wstring areaName(L"area");
+        std::wstring polygonName(L"polygon");
+        dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint num_coordinates(4);
+
+        std::wstring colorName(L"light-white");
+        REQUIRE( dsl_display_type_rgba_color_custom_new(colorName.c_str(), 
+            1.0, 1.0, 1.0, 0.25) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_display_type_rgba_polygon_new(polygonName.c_str(), 
+            coordinates, num_coordinates, 3, colorName.c_str())== DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_area_inclusion_new(areaName.c_str(), 
+            polygonName.c_str(), false, DSL_BBOX_POINT_SOUTH) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_ode_trigger_dwell_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit, threshold) == DSL_RESULT_SUCCESS );
+
+        uint retThreshold(0);
+        REQUIRE( dsl_ode_trigger_dwell_threshold_get(odeTriggerName.c_str(), 
+            &retThreshold) == DSL_RESULT_SUCCESS );
+        REQUIRE( retThreshold == threshold );
+
+        WHEN( "When the Trigger's threshold is updated" )         
+        {
+            uint newThreshold(30);
+            REQUIRE( dsl_ode_trigger_dwell_threshold_set(odeTriggerName.c_str(), 
+                newThreshold) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct value is returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_dwell_threshold_get(odeTriggerName.c_str(), 
+                    &retThreshold) == DSL_RESULT_SUCCESS );
+                REQUIRE( retThreshold == newThreshold );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_area_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When the Area is added to the Trigger" )         
+        {
+            uint occupancy(99);
+            REQUIRE( dsl_ode_trigger_dwell_occupancy_get(odeTriggerName.c_str(), 
+                areaName.c_str(), &occupancy) == DSL_RESULT_ODE_TRIGGER_AREA_NOT_IN_USE );
+                
+            REQUIRE( dsl_ode_trigger_area_add(odeTriggerName.c_str(), 
+                areaName.c_str()) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The Area's occupancy can be queried" ) 
+            {
+                REQUIRE( dsl_ode_trigger_dwell_occupancy_get(odeTriggerName.c_str(), 
+                    areaName.c_str(), &occupancy) == DSL_RESULT_SUCCESS );
+                REQUIRE( occupancy == 0 );
+                REQUIRE( dsl_ode_trigger_dwell_occupancy_get(odeTriggerName.c_str(), 
+                    L"unknown", &occupancy) == DSL_RESULT_ODE_AREA_NAME_NOT_FOUND );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_area_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_display_type_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A new Velocity Trigger's speed and heading ranges can be set/get",
+    "[ode-trigger-api]" )
+{
+    GIVEN( "Attributes for a new Velocity Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"velocity");
+        uint class_id(0);
+        uint limit(0);
+        double minimum(5.0);
+        double maximum(15.0);
+
+        REQUIRE( dsl_ode_trigger_velocity_new(odeTriggerName.c_str(), 
+            NULL, class_id, limit, minimum, maximum) == DSL_RESULT_SUCCESS );
+
+        double ret_minimum(1), ret_maximum(1);
+        REQUIRE( dsl_ode_trigger_velocity_speed_range_get(odeTriggerName.c_str(), 
+            &ret_minimum, &ret_maximum) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_minimum == minimum );
+        REQUIRE( ret_maximum == maximum );
+
+        uint ret_min_heading(1), ret_max_heading(1);
+        REQUIRE( dsl_ode_trigger_velocity_heading_range_get(odeTriggerName.c_str(), 
+            &ret_min_heading, &ret_max_heading) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_min_heading == 0 );
+        REQUIRE( ret_max_heading == 360 );
+
+        WHEN( "When the Trigger's speed and heading ranges are updated" )         
+        {
+            double new_minimum(0), new_maximum(30.0);
+            REQUIRE( dsl_ode_trigger_velocity_speed_range_set(odeTriggerName.c_str(), 
+                new_minimum, new_maximum) == DSL_RESULT_SUCCESS );
+            uint new_min_heading(315), new_max_heading(45);
+            REQUIRE( dsl_ode_trigger_velocity_heading_range_set(odeTriggerName.c_str(), 
+                new_min_heading, new_max_heading) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct values are returned on get" ) 
+            {
+                REQUIRE( dsl_ode_trigger_velocity_speed_range_get(odeTriggerName.c_str(), 
+                    &ret_minimum, &ret_maximum) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_minimum == new_minimum );
+                REQUIRE( ret_maximum == new_maximum );
+                REQUIRE( dsl_ode_trigger_velocity_heading_range_get(odeTriggerName.c_str(), 
+                    &ret_min_heading, &ret_max_heading) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_min_heading == new_min_heading );
+                REQUIRE( ret_max_heading == new_max_heading );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When invalid ranges are set" )         
+        {
+            THEN( "The services fail and the ranges are unchanged" ) 
+            {
+                REQUIRE( dsl_ode_trigger_velocity_speed_range_set(odeTriggerName.c_str(), 
+                    20.0, 10.0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_velocity_speed_range_set(odeTriggerName.c_str(), 
+                    -1.0, 0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                REQUIRE( dsl_ode_trigger_velocity_heading_range_set(odeTriggerName.c_str(), 
+                    0, 361) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+                    
+                REQUIRE( dsl_ode_trigger_velocity_speed_range_get(odeTriggerName.c_str(), 
+                    &ret_minimum, &ret_maximum) == DSL_RESULT_SUCCESS );
+                REQUIRE( ret_minimum == minimum );
+                REQUIRE( ret_maximum == maximum );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When a homography is set for a source" )         
+        {
+            REQUIRE( dsl_ode_trigger_velocity_homography_remove(odeTriggerName.c_str(), 
+                0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+            double homography[9] = {0.05,0,-10, 0,0.05,-5, 0,0.001,1};
+            REQUIRE( dsl_ode_trigger_velocity_homography_set(odeTriggerName.c_str(), 
+                0, homography) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The homography can be removed once only" ) 
+            {
+                REQUIRE( dsl_ode_trigger_velocity_homography_remove(odeTriggerName.c_str(), 
+                    0) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_velocity_homography_remove(odeTriggerName.c_str(), 
+                    0) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When a singular homography is set for a source" )         
+        {
+            double homography[9] = {1,2,3, 2,4,6, 0,0,1};
+            
+            THEN( "The service fails" ) 
+            {
+                REQUIRE( dsl_ode_trigger_velocity_homography_set(odeTriggerName.c_str(), 
+                    0, homography) == DSL_RESULT_ODE_TRIGGER_PARAMETER_INVALID );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "An ODE Persistence Trigger's minimum and maximum can be set/get",
     "[ode-trigger-api]" )
 {
@@ -1312,6 +1672,59 @@ SCENARIO( "A Cross Trigger can update its view settings correctly", "[ode-trigge
     }
 }    
 
+SCENARIO( "A Tracking Trigger can update its miss tolerance correctly", "[ode-trigger-api]" )
+{
+    GIVEN( "A new Persistence Trigger" ) 
+    {
+        std::wstring odeTriggerName(L"persistence");
+        uint ret_miss_tolerance(99);
+        
+        REQUIRE( dsl_ode_trigger_persistence_new(odeTriggerName.c_str(), 
+            NULL, 0, 0, 1, 10) == DSL_RESULT_SUCCESS );
+            
+        REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_get(odeTriggerName.c_str(), 
+            &ret_miss_tolerance) == DSL_RESULT_SUCCESS );
+        REQUIRE( ret_miss_tolerance == 0 );
+
+        WHEN( "When the Trigger's miss tolerance is updated" )
+        {
+            uint new_miss_tolerance(3);
+            
+            REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_set(
+                odeTriggerName.c_str(), new_miss_tolerance) == DSL_RESULT_SUCCESS );
+                
+            THEN( "The correct value is returned on get" )
+            {
+                REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_get(
+                    odeTriggerName.c_str(), &ret_miss_tolerance) == 
+                        DSL_RESULT_SUCCESS );
+                REQUIRE( ret_miss_tolerance == new_miss_tolerance );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "When a non-tracking Trigger is used" )
+        {
+            std::wstring occurrenceTriggerName(L"occurrence");
+            
+            REQUIRE( dsl_ode_trigger_occurrence_new(occurrenceTriggerName.c_str(), 
+                NULL, 0, 0) == DSL_RESULT_SUCCESS );
+                
+            THEN( "The miss tolerance services fail" )
+            {
+                REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_get(
+                    occurrenceTriggerName.c_str(), &ret_miss_tolerance) == 
+                        DSL_RESULT_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER );
+                REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_set(
+                    occurrenceTriggerName.c_str(), 1) == 
+                        DSL_RESULT_ODE_TRIGGER_IS_NOT_TRACK_TRIGGER );
+
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}    
+
 SCENARIO( "The Cross Trigger API checks all parameters correctly ", "[ode-trigger-api]" )
 {
     GIVEN( "Attributes for a new Cross Trigger" ) 
@@ -1694,6 +2107,12 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                     DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_cross_view_settings_set(triggerName.c_str(), 0, NULL, 0) == 
                     DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_get(NULL, NULL) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_get(triggerName.c_str(), 
+                    NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_tracking_miss_tolerance_set(NULL, 0) == 
+                    DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_trigger_custom_new(NULL, NULL, 0, 0, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_custom_new(triggerName.c_str(), NULL, 0, 0, NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
@@ -1727,6 +2146,11 @@ SCENARIO( "The ODE Trigger API checks for NULL input parameters", "[ode-trigger-
                 REQUIRE( dsl_ode_trigger_enabled_set(NULL, enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_enabled_state_change_listener_add(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_enabled_state_change_listener_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_metrics_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_metrics_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_priority_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_priority_get(triggerName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_ode_trigger_priority_set(NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_ode_trigger_class_id_get(NULL, &class_id) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_ode_trigger_class_id_set(NULL, class_id) == DSL_RESULT_INVALID_INPUT_PARAM );
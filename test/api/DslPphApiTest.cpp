@@ -177,6 +177,206 @@ SCENARIO( "A new ODE Handler can Add and Remove multiple ODE Triggers", "[pph-ap
     }
 }
 
+SCENARIO( "A new ODE Handler's worker count can be updated", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with parallel processing disabled by default" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint count(99);
+        REQUIRE( dsl_pph_ode_worker_count_get(odePphName.c_str(), 
+            &count) == DSL_RESULT_SUCCESS );
+        REQUIRE( count == 0 );
+
+        WHEN( "The ODE Handler's worker count is set" ) 
+        {
+            uint newCount(3);
+            REQUIRE( dsl_pph_ode_worker_count_set(odePphName.c_str(), 
+                newCount) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct worker count is returned on get" ) 
+            {
+                REQUIRE( dsl_pph_ode_worker_count_get(odePphName.c_str(), 
+                    &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == newCount );
+
+                // ensure parallel processing can be disabled again
+                REQUIRE( dsl_pph_ode_worker_count_set(odePphName.c_str(), 
+                    0) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_ode_worker_count_get(odePphName.c_str(), 
+                    &count) == DSL_RESULT_SUCCESS );
+                REQUIRE( count == 0 );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new ODE Handler's action batching can be enabled and disabled", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pph_ode_action_batching_enabled_get(odePphName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        WHEN( "The ODE Handler's action batching is enabled" ) 
+        {
+            REQUIRE( dsl_pph_ode_action_batching_enabled_set(odePphName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct setting is returned" ) 
+            {
+                REQUIRE( dsl_pph_ode_action_batching_enabled_get(odePphName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new ODE Handler's runtime metrics can be enabled, queried, and cleared", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler with a child ODE Trigger" ) 
+    {
+        std::wstring odePphName(L"pph");
+        std::wstring odeTriggerName(L"occurrence");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_ode_trigger_occurrence_new(odeTriggerName.c_str(), 
+            NULL, DSL_ODE_ANY_CLASS, DSL_ODE_TRIGGER_LIMIT_NONE) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pph_ode_trigger_add(odePphName.c_str(), 
+            odeTriggerName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pph_ode_metrics_enabled_get(odePphName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        WHEN( "The ODE Handler's metrics are enabled" ) 
+        {
+            REQUIRE( dsl_pph_ode_metrics_enabled_set(odePphName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            
+            THEN( "The correct settings and metrics are returned" ) 
+            {
+                REQUIRE( dsl_pph_ode_metrics_enabled_get(odePphName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                
+                dsl_ode_runtime_metrics metrics{99, 99, 99, 99};
+                REQUIRE( dsl_pph_ode_metrics_get(odePphName.c_str(), 
+                    &metrics) == DSL_RESULT_SUCCESS );
+                REQUIRE( metrics.evaluations == 0 );
+                REQUIRE( metrics.total_time == 0 );
+                
+                metrics = {99, 99, 99, 99};
+                REQUIRE( dsl_ode_trigger_metrics_get(odeTriggerName.c_str(), 
+                    &metrics) == DSL_RESULT_SUCCESS );
+                REQUIRE( metrics.evaluations == 0 );
+                REQUIRE( metrics.occurrences == 0 );
+                
+                REQUIRE( dsl_pph_ode_metrics_clear(odePphName.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_metrics_clear(odeTriggerName.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pph_ode_metrics_print(odePphName.c_str()) 
+                    == DSL_RESULT_SUCCESS );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_ode_trigger_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A new ODE Handler's time budget can be set and queried", "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint budget(99), maxInterval(99);
+        REQUIRE( dsl_pph_ode_time_budget_get(odePphName.c_str(), 
+            &budget, &maxInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( budget == 0 );
+        REQUIRE( maxInterval == 0 );
+
+        WHEN( "The ODE Handler's time budget is set" ) 
+        {
+            REQUIRE( dsl_pph_ode_time_budget_set(odePphName.c_str(), 
+                20000, 8) == DSL_RESULT_SUCCESS );
+            
+            // maximum interval of 1 is invalid
+            REQUIRE( dsl_pph_ode_time_budget_set(odePphName.c_str(), 
+                20000, 1) == DSL_RESULT_PPH_SET_FAILED );
+
+            THEN( "The correct settings are returned on get" ) 
+            {
+                REQUIRE( dsl_pph_ode_time_budget_get(odePphName.c_str(), 
+                    &budget, &maxInterval) == DSL_RESULT_SUCCESS );
+                REQUIRE( budget == 20000 );
+                REQUIRE( maxInterval == 8 );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+static void load_shedding_listener(uint event, uint interval, 
+    uint batch_time, void* client_data)
+{
+    std::cout << "load shedding listener called with event = " << event 
+        << ", interval = " << interval << ", and batch time = " << batch_time 
+        << std::endl;
+}
+
+SCENARIO( "A load-shedding listener can be added to and removed from an ODE Handler", 
+    "[pph-api]" )
+{
+    GIVEN( "A new ODE Handler" ) 
+    {
+        std::wstring odePphName(L"pph");
+
+        REQUIRE( dsl_pph_ode_new(odePphName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A load-shedding listener is added" ) 
+        {
+            REQUIRE( dsl_pph_ode_load_shedding_listener_add(odePphName.c_str(),
+                load_shedding_listener, NULL) == DSL_RESULT_SUCCESS );
+
+            // second call must fail
+            REQUIRE( dsl_pph_ode_load_shedding_listener_add(odePphName.c_str(),
+                load_shedding_listener, NULL) == DSL_RESULT_PPH_CALLBACK_ADD_FAILED );
+
+            THEN( "The same listener can be removed" ) 
+            {
+                REQUIRE( dsl_pph_ode_load_shedding_listener_remove(odePphName.c_str(),
+                    load_shedding_listener) == DSL_RESULT_SUCCESS );
+
+                // second call must fail
+                REQUIRE( dsl_pph_ode_load_shedding_listener_remove(odePphName.c_str(),
+                    load_shedding_listener) == DSL_RESULT_PPH_CALLBACK_REMOVE_FAILED );
+                
+                REQUIRE( dsl_pph_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
 SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-api]" )
 {
     GIVEN( "An empty list of Components" ) 
@@ -204,6 +404,27 @@ SCENARIO( "The Pad Probe Handler API checks for NULL input parameters", "[pph-ap
                 REQUIRE( dsl_pph_ode_trigger_remove_many(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_many(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_ode_trigger_remove_all(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_worker_count_get(NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_worker_count_get(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_worker_count_set(NULL, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_action_batching_enabled_get(NULL, &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_action_batching_enabled_get(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_action_batching_enabled_set(NULL, enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_enabled_get(NULL, &enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_enabled_get(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_enabled_set(NULL, enabled) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_get(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_get(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_clear(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_metrics_print(NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_time_budget_get(NULL, &interval, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_time_budget_get(pphName.c_str(), NULL, &interval) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_time_budget_get(pphName.c_str(), &interval, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_time_budget_set(NULL, 0, 0) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_load_shedding_listener_add(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_load_shedding_listener_add(pphName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_load_shedding_listener_remove(NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
+                REQUIRE( dsl_pph_ode_load_shedding_listener_remove(pphName.c_str(), NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
 
                 REQUIRE( dsl_pph_custom_new(NULL, NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
                 REQUIRE( dsl_pph_custom_new(pphName.c_str(), NULL, NULL) == DSL_RESULT_INVALID_INPUT_PARAM );
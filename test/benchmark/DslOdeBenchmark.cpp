@@ -0,0 +1,385 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2021, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+/**
+ * Offline ODE throughput benchmark. Builds synthetic NvDsBatchMeta with 
+ * a configurable number of frames per batch, objects per frame, class mix
+ * and movement model, and drives OdePadProbeHandler::HandlePadData directly
+ * - no GPU pipeline required. Build with "make benchmark".
+ *
+ * Usage: dsl-ode-benchmark.exe [--batch-size N] [--objects N] [--classes N]
+ *     [--batches N] [--movement static|linear|random] [--workers N]
+ */
+
+#include "Dsl.h"
+#include "DslServices.h"
+#include "DslPadProbeHandler.h"
+#include "DslOdeTrigger.h"
+#include "DslOdeAction.h"
+#include "DslOdeArea.h"
+#include "DslOdeHeatMapper.h"
+
+using namespace DSL;
+
+/**
+ * @brief count of all C++ allocations made by the process.
+ */
+static std::atomic<uint64_t> s_allocationCount(0);
+
+void* operator new(size_t size)
+{
+    s_allocationCount++;
+    void* p = malloc(size ? size : 1);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t size) noexcept
+{
+    free(p);
+}
+
+#define BENCHMARK_FRAME_WIDTH   1920
+#define BENCHMARK_FRAME_HEIGHT  1080
+
+/**
+ * @struct BenchmarkParams
+ * @brief command line parameters for the benchmark.
+ */
+struct BenchmarkParams
+{
+    uint batchSize = 4;
+    uint objectsPerFrame = 50;
+    uint numClasses = 2;
+    uint numBatches = 1000;
+    std::string movement = "linear";
+    uint numWorkers = 0;
+};
+
+/**
+ * @struct BenchmarkObject
+ * @brief synthetic object with a constant velocity in pixels per frame.
+ */
+struct BenchmarkObject
+{
+    NvDsObjectMeta* pObjectMeta;
+    float vx;
+    float vy;
+};
+
+static bool parse_params(int argc, char** argv, BenchmarkParams& params)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg(argv[i]);
+        if (i+1 == argc)
+        {
+            std::cout << "Missing value for '" << arg << "'\n";
+            return false;
+        }
+        std::string value(argv[++i]);
+        
+        if (arg == "--batch-size") params.batchSize = std::stoul(value);
+        else if (arg == "--objects") params.objectsPerFrame = std::stoul(value);
+        else if (arg == "--classes") params.numClasses = std::stoul(value);
+        else if (arg == "--batches") params.numBatches = std::stoul(value);
+        else if (arg == "--movement") params.movement = value;
+        else if (arg == "--workers") params.numWorkers = std::stoul(value);
+        else
+        {
+            std::cout << "Unknown argument '" << arg << "'\n";
+            return false;
+        }
+    }
+    if (params.movement != "static" and params.movement != "linear" and
+        params.movement != "random")
+    {
+        std::cout << "Invalid movement model '" << params.movement << "'\n";
+        return false;
+    }
+    return (params.batchSize and params.numClasses and params.numBatches);
+}
+
+/**
+ * @brief Creates a GstBuffer with synthetic batch meta - one frame per source.
+ * The first class is the most frequent, with each further class half as 
+ * frequent as the previous.
+ */
+static GstBuffer* create_batch(const BenchmarkParams& params, 
+    std::mt19937& generator, std::vector<BenchmarkObject>& objects)
+{
+    GstBuffer* pBuffer = gst_buffer_new();
+    NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(params.batchSize);
+
+    NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL,
+        nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+    pMeta->meta_type = NVDS_BATCH_GST_META;
+    
+    std::uniform_real_distribution<float> x(0, BENCHMARK_FRAME_WIDTH-100);
+    std::uniform_real_distribution<float> y(0, BENCHMARK_FRAME_HEIGHT-200);
+    std::uniform_real_distribution<float> width(30, 100);
+    std::uniform_real_distribution<float> velocity(-4, 4);
+    std::uniform_real_distribution<float> unit(0, 1);
+    
+    for (uint source = 0; source < params.batchSize; source++)
+    {
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        pFrameMeta->source_id = source;
+        pFrameMeta->batch_id = source;
+        pFrameMeta->pad_index = source;
+        pFrameMeta->bInferDone = true;
+        pFrameMeta->source_frame_width = BENCHMARK_FRAME_WIDTH;
+        pFrameMeta->source_frame_height = BENCHMARK_FRAME_HEIGHT;
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        
+        for (uint i = 0; i < params.objectsPerFrame; i++)
+        {
+            NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+            
+            uint classId(0);
+            while (classId+1 < params.numClasses and unit(generator) < 0.5)
+            {
+                classId++;
+            }
+            pObjectMeta->class_id = classId;
+            pObjectMeta->object_id = i;
+            pObjectMeta->confidence = 0.9;
+            pObjectMeta->tracker_confidence = 0.9;
+            pObjectMeta->rect_params.left = x(generator);
+            pObjectMeta->rect_params.top = y(generator);
+            pObjectMeta->rect_params.width = width(generator);
+            pObjectMeta->rect_params.height = pObjectMeta->rect_params.width*2;
+            
+            nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+            
+            objects.push_back({pObjectMeta, velocity(generator), velocity(generator)});
+        }
+    }
+    return pBuffer;
+}
+
+/**
+ * @brief Advances the batch by one frame - moves all objects according to 
+ * the movement model and removes the display meta added by the last frame.
+ */
+static void advance_batch(const BenchmarkParams& params, std::mt19937& generator,
+    GstBuffer* pBuffer, std::vector<BenchmarkObject>& objects, uint frameNum)
+{
+    NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+    
+    for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+        pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+    {
+        NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*) (pFrameMetaList->data);
+        
+        pFrameMeta->frame_num = frameNum;
+        pFrameMeta->buf_pts = (guint64)frameNum * 33333333;
+        pFrameMeta->ntp_timestamp = pFrameMeta->buf_pts;
+
+        if (pFrameMeta->display_meta_list)
+        {
+            nvds_clear_display_meta_list(pFrameMeta, pFrameMeta->display_meta_list);
+        }
+    }
+    if (params.movement == "static")
+    {
+        return;
+    }
+    std::uniform_real_distribution<float> step(-3, 3);
+    
+    for (auto& object: objects)
+    {
+        NvOSD_RectParams& rect = object.pObjectMeta->rect_params;
+        if (params.movement == "random")
+        {
+            object.vx = step(generator);
+            object.vy = step(generator);
+        }
+        rect.left += object.vx;
+        rect.top += object.vy;
+        
+        // bounce off the edges of the frame
+        if (rect.left < 0 or rect.left + rect.width > BENCHMARK_FRAME_WIDTH)
+        {
+            object.vx = -object.vx;
+            rect.left += 2*object.vx;
+        }
+        if (rect.top < 0 or rect.top + rect.height > BENCHMARK_FRAME_HEIGHT)
+        {
+            object.vy = -object.vy;
+            rect.top += 2*object.vy;
+        }
+    }
+}
+
+/**
+ * @brief Creates an ODE Pad Probe Handler with a realistic mix of Triggers,
+ * Areas, Actions and a Heat-Mapper.
+ */
+static DSL_PPH_ODE_PTR create_handler(const BenchmarkParams& params)
+{
+    DSL_PPH_ODE_PTR pHandler = DSL_PPH_ODE_NEW("ode-handler");
+    pHandler->SetWorkerCount(params.numWorkers);
+    
+    DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("color", 1.0, 0.0, 0.0, 0.5);
+
+    // Actions
+    DSL_ODE_ACTION_FORMAT_BBOX_PTR pFormatBBoxAction = 
+        DSL_ODE_ACTION_FORMAT_BBOX_NEW("format-bbox", 2, pColor, false, pColor);
+    DSL_ODE_ACTION_FILL_SURROUNDINGS_PTR pFillAction = 
+        DSL_ODE_ACTION_FILL_SURROUNDINGS_NEW("fill-surroundings", pColor);
+        
+    // Polygon Area
+    dsl_coordinate coordinates[4] = {{400,200},{1500,200},{1500,900},{400,900}};
+    DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW("polygon", 
+        coordinates, 4, 4, pColor);
+    DSL_ODE_AREA_INCLUSION_PTR pArea = DSL_ODE_AREA_INCLUSION_NEW("area",
+        pPolygon, true, DSL_BBOX_POINT_SOUTH);
+        
+    // Heat-Mapper
+    std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColors = 
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+            new std::vector<DSL_RGBA_COLOR_PTR>};
+    for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+        DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+    {
+        pColors->push_back(std::shared_ptr<RgbaColor>(new RgbaColor("", ivec)));
+    }
+    DSL_RGBA_COLOR_PALETTE_PTR pColorPalette = 
+        DSL_RGBA_COLOR_PALETTE_NEW("color-palette", pColors);
+    DSL_ODE_HEAT_MAPPER_PTR pHeatMapper = DSL_ODE_HEAT_MAPPER_NEW("heat-mapper",
+        16, 32, DSL_BBOX_POINT_SOUTH, pColorPalette);
+
+    // Occurrence Trigger for every class, with the heat-mapper
+    for (uint classId = 0; classId < params.numClasses; classId++)
+    {
+        std::string name("occurrence-" + std::to_string(classId));
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(name.c_str(), "", classId, 0);
+        pOccurrenceTrigger->AddAction(pFormatBBoxAction);
+        if (classId == 0)
+        {
+            pOccurrenceTrigger->AddHeatMapper(pHeatMapper);
+        }
+        pHandler->AddChild(pOccurrenceTrigger);
+    }
+
+    // Cross Trigger with the polygon area
+    DSL_ODE_TRIGGER_CROSS_PTR pCrossTrigger = DSL_ODE_TRIGGER_CROSS_NEW("cross",
+        "", 0, 0, 2, DSL_DEFAULT_TRACKING_TRIGGER_MAX_TRACE_POINTS,
+        DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, pColor);
+    pCrossTrigger->AddArea(pArea);
+    pCrossTrigger->AddAction(pFillAction);
+    pHandler->AddChild(pCrossTrigger);
+    
+    // Distance Trigger - class 0 objects closer than 50 pixels
+    DSL_ODE_TRIGGER_DISTANCE_PTR pDistanceTrigger = DSL_ODE_TRIGGER_DISTANCE_NEW(
+        "distance", "", 0, 0, 0, 50, UINT32_MAX, DSL_BBOX_POINT_SOUTH, 
+        DSL_DISTANCE_METHOD_FIXED_PIXELS);
+    pDistanceTrigger->AddAction(pFormatBBoxAction);
+    pHandler->AddChild(pDistanceTrigger);
+    
+    // Persistence Trigger - class 0 objects in the area for 1 to 10 seconds
+    DSL_ODE_TRIGGER_PERSISTENCE_PTR pPersistenceTrigger = 
+        DSL_ODE_TRIGGER_PERSISTENCE_NEW("persistence", "", 0, 0, 1, 10);
+    pPersistenceTrigger->AddArea(pArea);
+    pPersistenceTrigger->AddAction(pFormatBBoxAction);
+    pHandler->AddChild(pPersistenceTrigger);
+    
+    return pHandler;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkParams params;
+    if (!parse_params(argc, argv, params))
+    {
+        std::cout << "Usage: " << argv[0] << " [--batch-size N] [--objects N] "
+            << "[--classes N] [--batches N] [--movement static|linear|random] "
+            << "[--workers N]\n";
+        return EXIT_FAILURE;
+    }
+    
+    // Initialize GStreamer and the DSL logging category.
+    Services::GetServices();
+    
+    std::mt19937 generator(1234);
+    std::vector<BenchmarkObject> objects;
+    
+    GstBuffer* pBuffer = create_batch(params, generator, objects);
+    DSL_PPH_ODE_PTR pHandler = create_handler(params);
+    
+    GstPadProbeInfo info = {(GstPadProbeType)0};
+    info.data = pBuffer;
+    
+    // Warm-up - let all Triggers, tracked objects and pools reach steady state
+    uint frameNum(0);
+    for (uint i = 0; i < 100; i++)
+    {
+        advance_batch(params, generator, pBuffer, objects, frameNum++);
+        pHandler->HandlePadData(&info);
+    }
+
+    uint64_t elapsedNs(0);
+    uint64_t allocationCount(0);
+    
+    for (uint i = 0; i < params.numBatches; i++)
+    {
+        advance_batch(params, generator, pBuffer, objects, frameNum++);
+
+        uint64_t allocationStart = s_allocationCount;
+        auto start = std::chrono::steady_clock::now();
+        
+        pHandler->HandlePadData(&info);
+        
+        elapsedNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        allocationCount += s_allocationCount - allocationStart;
+    }
+    
+    double frames = double(params.numBatches) * params.batchSize;
+    double objectCount = frames * params.objectsPerFrame;
+    
+    std::cout << std::fixed << std::setprecision(1)
+        << "batch-size = " << params.batchSize
+        << ", objects = " << params.objectsPerFrame
+        << ", classes = " << params.numClasses
+        << ", movement = " << params.movement
+        << ", workers = " << params.numWorkers << "\n"
+        << "frames/s          : " << frames*1e9/elapsedNs << "\n"
+        << "ns/object         : " << elapsedNs/objectCount << "\n"
+        << "allocations/frame : " << allocationCount/frames << "\n";
+        
+    gst_buffer_unref(pBuffer);
+    
+    return EXIT_SUCCESS;
+}
@@ -545,3 +545,83 @@ SCENARIO( "A Source Frame Rate Display is constructed correctly", "[DisplayTypes
         }
     }
 }
+
+SCENARIO( "A DisplayMetaData acquires Display Meta on demand", "[DisplayTypes]" )
+{
+    GIVEN( "A new DisplayMetaData with a maximum size of two" )
+    {
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        
+        DisplayMetaData displayMetaData(pBatchMeta, 2);
+        
+        REQUIRE( displayMetaData.IsEnabled() == true );
+        REQUIRE( displayMetaData.GetSize() == 0 );
+
+        WHEN( "No elements are added" )
+        {
+            displayMetaData.AddToFrame(pFrameMeta);
+            
+            THEN( "No Display Meta is added to the frame" )
+            {
+                REQUIRE( g_list_length(pFrameMeta->display_meta_list) == 0 );
+            }
+        }
+        WHEN( "More lines than fit in a single Display Meta are added" )
+        {
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META+1; i++)
+            {
+                NvDsDisplayMeta* pDisplayMeta = 
+                    displayMetaData.Acquire(&NvDsDisplayMeta::num_lines);
+                REQUIRE( pDisplayMeta != NULL );
+                pDisplayMeta->num_lines++;
+            }
+            
+            THEN( "The lines spill over into a second Display Meta" )
+            {
+                REQUIRE( displayMetaData.GetSize() == 2 );
+                
+                // space for rectangles is still available in the first
+                REQUIRE( displayMetaData.Acquire(&NvDsDisplayMeta::num_rects) != NULL );
+                REQUIRE( displayMetaData.GetSize() == 2 );
+                
+                displayMetaData.AddToFrame(pFrameMeta);
+                REQUIRE( g_list_length(pFrameMeta->display_meta_list) == 2 );
+            }
+        }
+        WHEN( "All Display Meta up to the maximum size are full" )
+        {
+            for (uint i = 0; i < MAX_ELEMENTS_IN_DISPLAY_META*2; i++)
+            {
+                displayMetaData.Acquire(&NvDsDisplayMeta::num_labels)->num_labels++;
+            }
+            
+            THEN( "No further Display Meta is acquired" )
+            {
+                REQUIRE( displayMetaData.Acquire(&NvDsDisplayMeta::num_labels) == NULL );
+                REQUIRE( displayMetaData.GetSize() == 2 );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+    GIVEN( "A DisplayMetaData with a maximum size of zero" )
+    {
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        
+        DisplayMetaData displayMetaData(pBatchMeta, 0);
+        
+        WHEN( "Display Meta is requested" )
+        {
+            NvDsDisplayMeta* pDisplayMeta = displayMetaData.Acquire();
+
+            THEN( "No Display Meta is acquired" )
+            {
+                REQUIRE( displayMetaData.IsEnabled() == false );
+                REQUIRE( pDisplayMeta == NULL );
+                REQUIRE( displayMetaData.GetSize() == 0 );
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
@@ -358,3 +358,73 @@ SCENARIO( "A GEOS Polygon can determine if a point is within correctly", "[GeosT
         }
     }
 }
+
+SCENARIO( "A GEOS Prepared Geometry for a Polygon agrees with the GEOS Polygon", "[GeosTypes]" )
+{
+    GIVEN( "A new Polygon Display Type" ) 
+    {
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        std::string colorName  = "my-custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), red, green, blue, alpha);
+        
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+        
+        GeosPolygon testGeosPolygon(*pPolygon);
+        GeosPreparedGeometry testPreparedPolygon(*pPolygon);
+ 
+        WHEN( "Points inside, outside, and on the border are tested" )
+        {
+            GeosPoint outsidePoint(99,99);
+            GeosPoint insidePoint(150,250);
+            GeosPoint borderPoint(105,215);
+            
+            THEN( "The results for Contains and Distance are the same" )
+            {
+                REQUIRE( testPreparedPolygon.Contains(outsidePoint) == 
+                    testGeosPolygon.Contains(outsidePoint) );
+                REQUIRE( testPreparedPolygon.Contains(insidePoint) == 
+                    testGeosPolygon.Contains(insidePoint) );
+                REQUIRE( testPreparedPolygon.Distance(outsidePoint) == 
+                    testGeosPolygon.Distance(outsidePoint) );
+                REQUIRE( testPreparedPolygon.Distance(insidePoint) == 
+                    testGeosPolygon.Distance(insidePoint) );
+                REQUIRE( testPreparedPolygon.Distance(borderPoint) == 
+                    testGeosPolygon.Distance(borderPoint) );
+            }
+        }
+        WHEN( "Points are tested from multiple threads" )
+        {
+            bool results[4] = {false};
+            std::vector<std::thread> threads;
+            for (uint i = 0; i < 4; i++)
+            {
+                threads.push_back(std::thread([&testPreparedPolygon, &results, i]()
+                {
+                    // each thread uses its own GEOS Context Handle
+                    GeosPoint insidePoint(150+i,250);
+                    GeosPoint outsidePoint(99-i,99);
+                    results[i] = (testPreparedPolygon.Contains(insidePoint) and
+                        !testPreparedPolygon.Contains(outsidePoint));
+                }));
+            }
+            for (auto& thread: threads)
+            {
+                thread.join();
+            }
+            THEN( "The results are correct for each thread" )
+            {
+                for (uint i = 0; i < 4; i++)
+                {
+                    REQUIRE( results[i] == true );
+                }
+            }
+        }
+    }
+}
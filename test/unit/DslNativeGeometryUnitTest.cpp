@@ -0,0 +1,196 @@
+/*
+The MIT License
+
+Copyright (c) 2021-2022, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslNativeGeometry.h"
+#include "DslGeosTypes.h"
+
+using namespace DSL;
+
+SCENARIO( "A NativeGeometry supports only small convex Polygons", "[NativeGeometry]" )
+{
+    GIVEN( "A convex, a concave, and a self-intersecting Polygon" ) 
+    {
+        dsl_coordinate convex[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        dsl_coordinate concave[5] = {{0,0},{100,0},{50,20},{100,100},{0,100}};
+        dsl_coordinate bowTie[4] = {{0,0},{100,100},{100,0},{0,100}};
+        
+        dsl_polygon_params convexPolygon{convex, 4, 4};
+        dsl_polygon_params concavePolygon{concave, 5, 4};
+        dsl_polygon_params bowTiePolygon{bowTie, 4, 4};
+        
+        WHEN( "Each Polygon is checked for support" )
+        {
+            THEN( "Only the convex Polygon is supported" )
+            {
+                REQUIRE( NativeGeometry::IsSupported(convexPolygon) == true );
+                REQUIRE( NativeGeometry::IsSupported(concavePolygon) == false );
+                REQUIRE( NativeGeometry::IsSupported(bowTiePolygon) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A NativeGeometry Polygon agrees with a GEOS Polygon", "[NativeGeometry]" )
+{
+    GIVEN( "A new Polygon Display Type" ) 
+    {
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        std::string colorName  = "my-custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), red, green, blue, alpha);
+        
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+        
+        GeosPolygon testGeosPolygon(*pPolygon);
+        NativeGeometry testNativePolygon(*pPolygon);
+ 
+        WHEN( "A grid of points, including the vertices and border, is tested" )
+        {
+            THEN( "The results for Contains and Distance are the same" )
+            {
+                for (uint x = 90; x <= 230; x += 5)
+                {
+                    for (uint y = 90; y <= 340; y += 5)
+                    {
+                        GeosPoint testGeosPoint(x, y);
+                        dsl_coordinate testCoordinate{x, y};
+                        
+                        REQUIRE( testNativePolygon.Contains(testCoordinate) == 
+                            testGeosPolygon.Contains(testGeosPoint) );
+                        REQUIRE( testNativePolygon.Distance(testCoordinate) == 
+                            testGeosPolygon.Distance(testGeosPoint) );
+                    }
+                }
+            }
+        }
+        WHEN( "Rectangles inside, outside, overlapping, and touching are tested" )
+        {
+            NvOSD_RectParams testRectangles[] = {
+                {150, 200, 20, 20}, {0, 0, 50, 50}, {90, 90, 20, 20},
+                {0, 0, 500, 500}, {0, 0, 100, 100}, {215, 100, 100, 100}};
+                
+            THEN( "The results for Overlaps are the same" )
+            {
+                for (auto& testRectangle: testRectangles)
+                {
+                    GeosPolygon testGeosRectangle(testRectangle);
+                    
+                    REQUIRE( testNativePolygon.Overlaps(testRectangle) == 
+                        (testGeosPolygon.Overlaps(testGeosRectangle) or
+                        testGeosPolygon.Contains(testGeosRectangle) or
+                        testGeosRectangle.Contains(testGeosPolygon)) );
+                }
+            }
+        }
+        WHEN( "Many points are tested at once" )
+        {
+            double x[4] = {99, 150, 105, 220};
+            double y[4] = {99, 250, 215, 300};
+            uint8_t results[4] = {0};
+            double distances[4] = {0};
+            
+            testNativePolygon.Contains(x, y, 4, results);
+            testNativePolygon.Distance(x, y, 4, distances);
+            
+            THEN( "The results are the same as testing each point" )
+            {
+                for (uint i = 0; i < 4; i++)
+                {
+                    dsl_coordinate testCoordinate{(uint)x[i], (uint)y[i]};
+                    
+                    REQUIRE( results[i] == 
+                        testNativePolygon.Contains(testCoordinate) );
+                    REQUIRE( (uint)round(distances[i]) == 
+                        testNativePolygon.Distance(testCoordinate) );
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A NativeGeometry Multi-Line agrees with a GEOS Multi-Line", "[NativeGeometry]" )
+{
+    GIVEN( "A new Multi-Line Display Type and a set of Lines" ) 
+    {
+        std::string multiLineName  = "my-multi-line";
+        dsl_coordinate coordinates[4] = {{100,100},{210,110},{220, 300},{110,330}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        std::string colorName  = "my-custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), red, green, blue, alpha);
+        
+        DSL_RGBA_MULTI_LINE_PTR pMultiLine = DSL_RGBA_MULTI_LINE_NEW(multiLineName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+            
+        NvOSD_LineParams testLines[3] = {
+            {100, 100, 200, 200}, {10, 10, 200, 100}, {215, 200, 300, 200}};
+ 
+        GeosMultiLine testGeosMultiLine(*pMultiLine);
+        NativeGeometry testNativeMultiLine(*pMultiLine);
+        
+        WHEN( "Each Line is tested as a two point trace" )
+        {
+            THEN( "The results for Intersects are the same" )
+            {
+                for (auto& testLine: testLines)
+                {
+                    GeosLine testGeosLine(testLine);
+                    dsl_coordinate trace[2] = {
+                        {testLine.x1, testLine.y1}, {testLine.x2, testLine.y2}};
+                    
+                    REQUIRE( testNativeMultiLine.Intersects(trace, 2) == 
+                        testGeosMultiLine.Crosses(testGeosLine) );
+                }
+            }
+        }
+        WHEN( "A grid of points is tested" )
+        {
+            THEN( "The results for Distance are the same" )
+            {
+                for (uint x = 90; x <= 230; x += 10)
+                {
+                    for (uint y = 90; y <= 340; y += 10)
+                    {
+                        GeosPoint testGeosPoint(x, y);
+                        dsl_coordinate testCoordinate{x, y};
+                        
+                        REQUIRE( testNativeMultiLine.Distance(testCoordinate) == 
+                            testGeosMultiLine.Distance(testGeosPoint) );
+                    }
+                }
+            }
+        }
+    }
+}
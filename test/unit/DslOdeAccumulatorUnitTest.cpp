@@ -29,7 +29,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaData displayMetaData;
 
 static void ode_occurrence_handler_cb_1(uint64_t event_id, const wchar_t* name,
     void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
@@ -118,14 +118,142 @@ SCENARIO( "An OdeAccumulator executes its ODE Actions in the correct order ", "[
             {
                 // Note: this requires manual/visual confirmation at this time.
                 pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
-                    NULL, displayMetaData, &frameMeta);
+                    NULL, displayMetaData, &frameMeta, 1);
                 
                 // Remove Action 3 and add back in to change order    
                 REQUIRE( pOdeAccumlator->RemoveAction(pOdeAction3) == true );        
                 REQUIRE( pOdeAccumlator->AddAction(pOdeAction3) == true );        
                 
                 pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
-                    NULL, displayMetaData, &frameMeta);
+                    NULL, displayMetaData, &frameMeta, 1);
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeAccumulator counts occurrences within its rolling windows", "[OdeAccumulator]" )
+{
+    GIVEN( "A new OdeAccumulator with two rolling windows" ) 
+    {
+        std::string odeAccumulatorName("accumulator");
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+        std::string source;
+        
+        DSL_ODE_ACCUMULATOR_PTR pOdeAccumlator = 
+            DSL_ODE_ACCUMULATOR_NEW(odeAccumulatorName.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        uint lengths[] = {1600, 16000};
+        REQUIRE( pOdeAccumlator->SetWindows(lengths, 2) == true );
+        
+        const uint* retLengths(NULL);
+        uint numLengths(0);
+        pOdeAccumlator->GetWindows(&retLengths, &numLengths);
+        REQUIRE( numLengths == 2 );
+        REQUIRE( retLengths[0] == 1600 );
+        REQUIRE( retLengths[1] == 16000 );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 2;
+        
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        
+        const uint64_t* counts(NULL);
+        uint size(0);
+
+        WHEN( "Occurrences are handled over time" )
+        {
+            frameMeta.buf_pts = 0;
+            pOdeAccumlator->HandleObjectOccurrence(&frameMeta, &objectMeta);
+            pOdeAccumlator->HandleObjectOccurrence(&frameMeta, &objectMeta);
+            pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                NULL, displayMetaData, &frameMeta, 2);
+
+            frameMeta.buf_pts = 1000 * GST_MSECOND;
+            pOdeAccumlator->HandleObjectOccurrence(&frameMeta, &objectMeta);
+            pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                NULL, displayMetaData, &frameMeta, 1);
+            
+            THEN( "The counts for each window are correct" )
+            {
+                pOdeAccumlator->GetWindowCounts(2, DSL_ODE_ANY_CLASS, &counts, &size);
+                REQUIRE( size == 2 );
+                REQUIRE( counts[0] == 3 );
+                REQUIRE( counts[1] == 3 );
+                
+                pOdeAccumlator->GetWindowCounts(2, classId, &counts, &size);
+                REQUIRE( counts[0] == 3 );
+                REQUIRE( counts[1] == 3 );
+
+                pOdeAccumlator->GetWindowCounts(1, classId, &counts, &size);
+                REQUIRE( counts[0] == 0 );
+                REQUIRE( counts[1] == 0 );
+
+                // The first frame's occurrences expire from the shorter window
+                frameMeta.buf_pts = 2000 * GST_MSECOND;
+                pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                    NULL, displayMetaData, &frameMeta, 0);
+                
+                pOdeAccumlator->GetWindowCounts(2, DSL_ODE_ANY_CLASS, &counts, &size);
+                REQUIRE( counts[0] == 1 );
+                REQUIRE( counts[1] == 3 );
+                
+                // and all occurrences expire from both windows.
+                frameMeta.buf_pts = 20000 * GST_MSECOND;
+                pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                    NULL, displayMetaData, &frameMeta, 0);
+                
+                pOdeAccumlator->GetWindowCounts(2, DSL_ODE_ANY_CLASS, &counts, &size);
+                REQUIRE( counts[0] == 0 );
+                REQUIRE( counts[1] == 0 );
+            }
+        }
+        WHEN( "The stream's timestamps are reset" )
+        {
+            frameMeta.buf_pts = 10000 * GST_MSECOND;
+            pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                NULL, displayMetaData, &frameMeta, 2);
+
+            frameMeta.buf_pts = 0;
+            pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                NULL, displayMetaData, &frameMeta, 1);
+            
+            THEN( "The windows continue from the last frame time" )
+            {
+                pOdeAccumlator->GetWindowCounts(2, DSL_ODE_ANY_CLASS, &counts, &size);
+                REQUIRE( counts[0] == 3 );
+                REQUIRE( counts[1] == 3 );
+                
+                // All occurrences expire from the shorter window only
+                frameMeta.buf_pts = 2000 * GST_MSECOND;
+                pOdeAccumlator->HandleOccurrences(pOdeTrigger, 
+                    NULL, displayMetaData, &frameMeta, 0);
+                
+                pOdeAccumlator->GetWindowCounts(2, DSL_ODE_ANY_CLASS, &counts, &size);
+                REQUIRE( counts[0] == 0 );
+                REQUIRE( counts[1] == 3 );
+            }
+        }
+        WHEN( "A window threshold is set" )
+        {
+            THEN( "The threshold window index is checked" )
+            {
+                REQUIRE( pOdeAccumlator->SetWindowThreshold(2, 10) == false );
+                REQUIRE( pOdeAccumlator->SetWindowThreshold(1, 10) == true );
+                
+                uint window(0), threshold(0);
+                pOdeAccumlator->GetWindowThreshold(&window, &threshold);
+                REQUIRE( window == 1 );
+                REQUIRE( threshold == 10 );
+                
+                // windows can't be reduced below the threshold window
+                REQUIRE( pOdeAccumlator->SetWindows(lengths, 1) == false );
             }
         }
     }
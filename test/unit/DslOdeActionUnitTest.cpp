@@ -30,7 +30,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaData displayMetaData;
 
 static void ode_occurrence_handler_cb(uint64_t event_id, const wchar_t* name,
     void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
@@ -300,6 +300,12 @@ SCENARIO( "A FormatLabelOdeAction handles an ODE Occurence correctly", "[OdeActi
     }
 }
 
+static void ode_occurrence_counter_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
+{
+    (*(uint*)client_data)++;
+}
+
 SCENARIO( "A new CustomOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new CustomOdeAction" ) 
@@ -362,6 +368,161 @@ SCENARIO( "A CustomOdeAction handles an ODE Occurence correctly", "[OdeAction]"
     }
 }
 
+SCENARIO( "A CustomOdeAction delivers batched ODE Occurrences correctly", "[OdeAction]" )
+{
+    GIVEN( "A new CustomOdeAction" ) 
+    {
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        std::string actionName("ode-action");
+        uint callCount(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CUSTOM_PTR pAction = 
+            DSL_ODE_ACTION_CUSTOM_NEW(actionName.c_str(), 
+                ode_occurrence_counter_cb, &callCount);
+                
+        REQUIRE( pAction->IsBatchable() == true );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 444;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+
+        WHEN( "Two ODE Occurrences are invoked while batching" )
+        {
+            OdeAction::BeginOccurrenceBatch();
+            
+            pAction->InvokeOccurrence(pTrigger, NULL, 
+                displayMetaData, &frameMeta, &objectMeta);
+            pAction->InvokeOccurrence(pTrigger, NULL, 
+                displayMetaData, &frameMeta, &objectMeta);
+            
+            THEN( "Both Occurrences are delivered when the batch ends" )
+            {
+                REQUIRE( callCount == 0 );
+                
+                OdeAction::EndOccurrenceBatch(NULL, displayMetaData, &frameMeta);
+                REQUIRE( callCount == 2 );
+                
+                // ensure that the Action is invoked on occurrence once ended
+                pAction->InvokeOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+                REQUIRE( callCount == 3 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A CustomOdeAction executes queued ODE Occurrences asynchronously", "[OdeAction]" )
+{
+    GIVEN( "A new CustomOdeAction in async execution mode" ) 
+    {
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        std::string actionName("ode-action");
+        uint callCount(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        DSL_ODE_ACTION_CUSTOM_PTR pAction = 
+            DSL_ODE_ACTION_CUSTOM_NEW(actionName.c_str(), 
+                ode_occurrence_counter_cb, &callCount);
+                
+        REQUIRE( pAction->IsAsyncCapable() == true );
+        REQUIRE( pAction->SetExecutionMode(DSL_ODE_ACTION_EXECUTION_MODE_ASYNC,
+            10, DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK) == true );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 444;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+
+        WHEN( "More ODE Occurrences than the queue size are invoked" )
+        {
+            for (uint i = 0; i < 100; i++)
+            {
+                pAction->InvokeOccurrence(pTrigger, NULL, 
+                    displayMetaData, &frameMeta, &objectMeta);
+            }
+            
+            THEN( "All Occurrences are executed without drops" )
+            {
+                // Setting sync mode executes all queued occurrences first
+                REQUIRE( pAction->SetExecutionMode(DSL_ODE_ACTION_EXECUTION_MODE_SYNC,
+                    10, DSL_ODE_ACTION_QUEUE_OVERFLOW_BLOCK) == true );
+                REQUIRE( callCount == 100 );
+                
+                uint depth(99), peakDepth(99);
+                uint64_t drops(99);
+                pAction->GetQueueCounters(&depth, &peakDepth, &drops);
+                REQUIRE( depth == 0 );
+                REQUIRE( drops == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An ODE Occurrence captures the Trigger's criteria by value", "[OdeAction]" )
+{
+    GIVEN( "A new OccurrenceOdeTrigger with criteria" ) 
+    {
+        std::string odeTriggerName("occurence");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+        pTrigger->SetMinConfidence(0.5);
+        pTrigger->SetMinDimensions(10, 20);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+
+        WHEN( "The Trigger's criteria is updated after the Occurrence is captured" )
+        {
+            OdeOccurrence occurrence;
+            OdeAction::CaptureOccurrence(occurrence, pTrigger, &frameMeta, &objectMeta);
+            
+            pTrigger->SetClassId(5);
+            pTrigger->SetMinConfidence(0.9);
+            
+            THEN( "The captured criteria is unchanged" )
+            {
+                REQUIRE( occurrence.criteria.classId == classId );
+                REQUIRE( occurrence.criteria.minConfidence == 0.5f );
+                REQUIRE( occurrence.criteria.minWidth == 10 );
+                REQUIRE( occurrence.criteria.minHeight == 20 );
+                REQUIRE( occurrence.criteria.minFrameCountN == 1 );
+                REQUIRE( occurrence.criteria.minFrameCountD == 1 );
+                
+                OdeAction::CaptureOccurrence(occurrence, pTrigger, &frameMeta, &objectMeta);
+                REQUIRE( occurrence.criteria.classId == 5 );
+                REQUIRE( occurrence.criteria.minConfidence == 0.9f );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MonitorOdeAction is created correctly", "[OdeAction]" )
 {
     GIVEN( "Attributes for a new MonitorOdeAction" ) 
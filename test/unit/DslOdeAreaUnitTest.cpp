@@ -492,6 +492,89 @@ SCENARIO( "A new OdeLineArea can determine DoesTraceCrossLine correctly", "[OdeA
     }
 }
 
+SCENARIO( "A new OdeLineArea can determine DoesSegmentCrossLine incrementally", 
+    "[OdeArea]" )
+{
+    GIVEN( "A new OdeLineArea" ) 
+    {
+        std::string odeLineName("ode-line-area");
+        bool show(true);
+
+        std::string rgbaLineName  = "rgba-line";
+
+        // horizontal line coordinates
+        uint x1(100), y1(100), x2(400), y2(100);
+        uint width(10);
+
+        std::string colorName  = "custom-color";
+        double red(0.12), green(0.34), blue(0.56), alpha(0.78);
+        
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW(colorName.c_str(), 
+            red, green, blue, alpha);
+        DSL_RGBA_LINE_PTR pLine = DSL_RGBA_LINE_NEW(rgbaLineName.c_str(), 
+            x1, y1, x2, y2, width, pColor);
+
+        uint bboxTestPoint(DSL_BBOX_POINT_SOUTH);
+        
+        DSL_ODE_AREA_LINE_PTR pOdeArea = 
+            DSL_ODE_AREA_LINE_NEW(odeLineName.c_str(), pLine, show, bboxTestPoint);
+
+        uint direction(99);
+        TrackedObjectCrossState crossState{pOdeArea.get(), 
+            DSL_AREA_POINT_LOCATION_ON_LINE, false};
+
+        WHEN( "A trace crosses the Line one segment at a time" )
+        {
+            dsl_coordinate traceCoordinates[] = {{150,50},{150,90},{150,120},{175,150}};
+
+            THEN( "The cross is only reported once the end-point is off the line" )
+            {
+                REQUIRE( pOdeArea->DoesSegmentCrossLine(traceCoordinates[0],
+                    traceCoordinates[1], crossState, direction) == false );
+                REQUIRE( crossState.side == DSL_AREA_POINT_LOCATION_OUTSIDE );
+                REQUIRE( crossState.intersected == false );
+                REQUIRE( direction == DSL_AREA_CROSS_DIRECTION_NONE );
+                
+                REQUIRE( pOdeArea->DoesSegmentCrossLine(traceCoordinates[1],
+                    traceCoordinates[2], crossState, direction) == true );
+                REQUIRE( crossState.intersected == true );
+                REQUIRE( direction == DSL_AREA_CROSS_DIRECTION_IN );
+
+                REQUIRE( pOdeArea->DoesSegmentCrossLine(traceCoordinates[2],
+                    traceCoordinates[3], crossState, direction) == true );
+                REQUIRE( direction == DSL_AREA_CROSS_DIRECTION_IN );
+            }
+        }
+        WHEN( "A trace crosses the Line and returns" )
+        {
+            dsl_coordinate traceCoordinates[] = {{150,50},{150,150},{150,60}};
+
+            THEN( "No cross is reported once back on the starting side" )
+            {
+                REQUIRE( pOdeArea->DoesSegmentCrossLine(traceCoordinates[0],
+                    traceCoordinates[1], crossState, direction) == true );
+                REQUIRE( direction == DSL_AREA_CROSS_DIRECTION_IN );
+                
+                REQUIRE( pOdeArea->DoesSegmentCrossLine(traceCoordinates[1],
+                    traceCoordinates[2], crossState, direction) == false );
+                REQUIRE( direction == DSL_AREA_CROSS_DIRECTION_NONE );
+            }
+        }
+        WHEN( "A trace passes beyond the end of the Line" )
+        {
+            dsl_coordinate traceCoordinates[] = {{450,50},{450,150}};
+
+            THEN( "No cross is reported" )
+            {
+                REQUIRE( pOdeArea->DoesSegmentCrossLine(traceCoordinates[0],
+                    traceCoordinates[1], crossState, direction) == false );
+                REQUIRE( crossState.intersected == false );
+                REQUIRE( direction == DSL_AREA_CROSS_DIRECTION_NONE );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MultiLineArea is created correctly", "[OdeArea]" )
 {
     GIVEN( "Attributes for a new OdeMultiLineArea" ) 
@@ -28,7 +28,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaData displayMetaData;
 
 SCENARIO( "A new OdeHeatMapper is created correctly", "[OdeHeatMapper]" )
 {
@@ -333,3 +333,269 @@ SCENARIO( "A new OdeHeatMapper can File metrics correctly", "[OdeHeatMapper]" )
     }
 }
 
+
+SCENARIO( "An OdeHeatMapper keeps separate metrics for each source", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper in memory" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("heat-mapper");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_frame_width = DSL_DEFAULT_STREAMMUX_WIDTH;
+        frameMeta.source_frame_height = DSL_DEFAULT_STREAMMUX_HEIGHT;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        frameMeta.source_id = 0;
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+
+        objectMeta.rect_params.left = DSL_DEFAULT_STREAMMUX_WIDTH - 30;
+        objectMeta.rect_params.top = DSL_DEFAULT_STREAMMUX_HEIGHT - 30;
+        
+        frameMeta.source_id = 3;
+        pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+
+        WHEN( "The OdeHeatMapper is called to Get metrics for each source" )
+        {
+            const uint64_t* outBuffer;
+            uint size;
+            
+            THEN( "The returned buffer values are correct for each source" )
+            {
+                pOdeHeatMapper->GetSourceMetrics(0, &outBuffer, &size);
+                REQUIRE( size == cols*rows );
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[size-1] == 0 );
+
+                pOdeHeatMapper->GetSourceMetrics(3, &outBuffer, &size);
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( outBuffer[size-1] == 1 );
+
+                pOdeHeatMapper->GetSourceMetrics(1, &outBuffer, &size);
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( outBuffer[size-1] == 0 );
+
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[size-1] == 1 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeHeatMapper decays its metrics correctly", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper in memory" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("heat-mapper");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_frame_width = DSL_DEFAULT_STREAMMUX_WIDTH;
+        frameMeta.source_frame_height = DSL_DEFAULT_STREAMMUX_HEIGHT;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        const uint64_t* outBuffer;
+        uint size;
+        
+        WHEN( "The OdeHeatMapper's decay mode is set to exponential" )
+        {
+            REQUIRE( pOdeHeatMapper->SetDecaySettings(
+                DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL, 1000) == true );
+                
+            uint mode(99), period(99);
+            pOdeHeatMapper->GetDecaySettings(&mode, &period);
+            REQUIRE( mode == DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL );
+            REQUIRE( period == 1000 );
+            
+            for (uint i=0; i < 8; i++)
+            {
+                pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+            }
+            
+            THEN( "The metrics are halved after each half-life" )
+            {
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 8 );
+                
+                objectMeta.rect_params.left = DSL_DEFAULT_STREAMMUX_WIDTH - 30;
+                objectMeta.rect_params.top = DSL_DEFAULT_STREAMMUX_HEIGHT - 30;
+
+                frameMeta.buf_pts = 2000 * GST_MSECOND;
+                pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+                
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[size-1] == 1 );
+            }
+        }
+        WHEN( "The OdeHeatMapper's decay mode is set to sliding window" )
+        {
+            REQUIRE( pOdeHeatMapper->SetDecaySettings(
+                DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW, 1000) == true );
+            
+            for (uint i=0; i < 4; i++)
+            {
+                pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+            }
+            
+            THEN( "The metrics expire with the window" )
+            {
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 4 );
+                
+                objectMeta.rect_params.left = DSL_DEFAULT_STREAMMUX_WIDTH - 30;
+                objectMeta.rect_params.top = DSL_DEFAULT_STREAMMUX_HEIGHT - 30;
+
+                // Halfway through the next window, half of the previous 
+                // window's occurrences remain within the sliding window.
+                frameMeta.buf_pts = 1500 * GST_MSECOND;
+                pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+                
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 2 );
+                REQUIRE( outBuffer[size-1] == 1 );
+
+                frameMeta.buf_pts = 3000 * GST_MSECOND;
+                pOdeHeatMapper->HandleOccurrence(&frameMeta, &objectMeta);
+                
+                pOdeHeatMapper->GetMetrics(&outBuffer, &size);
+                REQUIRE( outBuffer[0] == 0 );
+                REQUIRE( outBuffer[size-1] == 1 );
+            }
+        }
+        WHEN( "The OdeHeatMapper's decay settings are invalid" )
+        {
+            THEN( "The settings are rejected" )
+            {
+                REQUIRE( pOdeHeatMapper->SetDecaySettings(
+                    DSL_HEAT_MAP_DECAY_MODE_EXPONENTIAL, 0) == false );
+                REQUIRE( pOdeHeatMapper->SetDecaySettings(
+                    DSL_HEAT_MAP_DECAY_MODE_SLIDING_WINDOW+1, 1000) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeHeatMapper merges adjacent cells of the same color", "[OdeHeatMapper]" )
+{
+    GIVEN( "A new HeatMapper with a 2x2 block of equal occurrences" ) 
+    {
+        std::string colorPaletteName("color-palette");
+        std::string odeHeatMapperName("heat-mapper");
+        uint cols(16), rows(9);
+        
+        std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>> pColorPalette = 
+            std::shared_ptr<std::vector<DSL_RGBA_COLOR_PTR>>{
+                new std::vector<DSL_RGBA_COLOR_PTR>};
+        
+        for (auto const& ivec: RgbaPredefinedColor::s_predefinedColorPalettes[
+            DSL_COLOR_PREDEFINED_PALETTE_SPECTRAL])
+        {
+            pColorPalette->push_back(std::shared_ptr<RgbaColor>
+                (new RgbaColor("", ivec)));
+        }
+        
+        DSL_RGBA_COLOR_PALETTE_PTR pPredefinedColorPalette = 
+            DSL_RGBA_COLOR_PALETTE_NEW(colorPaletteName.c_str(), pColorPalette);
+
+        DSL_ODE_HEAT_MAPPER_PTR pOdeHeatMapper = 
+            DSL_ODE_HEAT_MAPPER_NEW(odeHeatMapperName.c_str(), 
+                cols, rows, DSL_BBOX_POINT_SOUTH, pPredefinedColorPalette);
+
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        pFrameMeta->source_frame_width = DSL_DEFAULT_STREAMMUX_WIDTH;
+        pFrameMeta->source_frame_height = DSL_DEFAULT_STREAMMUX_HEIGHT;
+        pFrameMeta->buf_pts = 0;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        for (uint row=0; row < 2; row++)
+        {
+            for (uint col=0; col < 2; col++)
+            {
+                objectMeta.rect_params.left = 10 + col*120;
+                objectMeta.rect_params.top = 10 + row*120;
+                pOdeHeatMapper->HandleOccurrence(pFrameMeta, &objectMeta);
+            }
+        }
+
+        WHEN( "The OdeHeatMapper adds its display meta to consecutive frames" )
+        {
+            DisplayMetaData displayMetaData(pBatchMeta, 2);
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
+            pOdeHeatMapper->AddDisplayMeta(displayMetaData, pFrameMeta);
+            displayMetaData.AddToFrame(pFrameMeta);
+            
+            THEN( "A single merged rectangle is added for each frame" )
+            {
+                REQUIRE( g_list_length(pFrameMeta->display_meta_list) == 1 );
+                
+                NvDsDisplayMeta* pDisplayMeta = 
+                    (NvDsDisplayMeta*)pFrameMeta->display_meta_list->data;
+                REQUIRE( pDisplayMeta->num_rects == 2 );
+                for (uint i=0; i < 2; i++)
+                {
+                    REQUIRE( pDisplayMeta->rect_params[i].left == 0 );
+                    REQUIRE( pDisplayMeta->rect_params[i].top == 0 );
+                    REQUIRE( pDisplayMeta->rect_params[i].width == 240 );
+                    REQUIRE( pDisplayMeta->rect_params[i].height == 240 );
+                }
+            }
+        }
+        nvds_destroy_batch_meta(pBatchMeta);
+    }
+}
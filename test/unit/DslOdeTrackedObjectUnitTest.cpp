@@ -51,7 +51,7 @@ SCENARIO( "A TrackedObject is created correctly", "[TrackedObject]" )
         WHEN( "A TrackedObject is created" )
         {
             std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
-                (new TrackedObject(objectMeta.object_id, frame_num, 
+                (new TrackedObject(objectMeta.object_id, frame_num, 0,
                     (NvBbox_Coords*)&objectMeta.rect_params, pColor, 
                     DSL_DEFAULT_TRACKING_TRIGGER_MAX_TRACE_POINTS));
                 
@@ -93,7 +93,7 @@ SCENARIO( "A TrackedObject generates the correct trace", "[TrackedObject]" )
         uint maxHistory(10);
         
         std::shared_ptr<TrackedObject> pTrackedObject = std::shared_ptr<TrackedObject>
-            (new TrackedObject(objectMeta.object_id, frame_num, 
+            (new TrackedObject(objectMeta.object_id, frame_num, 0,
                 (NvBbox_Coords*)&objectMeta.rect_params, pColor, maxHistory));
         
         WHEN( "A TrackedObject is updated" )
@@ -103,28 +103,28 @@ SCENARIO( "A TrackedObject generates the correct trace", "[TrackedObject]" )
             objectMeta.rect_params.width = 210;
             objectMeta.rect_params.height = 110;
             
-            pTrackedObject->Update(1, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(1, 40, (NvBbox_Coords*)&objectMeta.rect_params);
 
             objectMeta.rect_params.left = 30;
             objectMeta.rect_params.top = 30;
             objectMeta.rect_params.width = 220;
             objectMeta.rect_params.height = 120;
             
-            pTrackedObject->Update(2, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(2, 80, (NvBbox_Coords*)&objectMeta.rect_params);
 
             objectMeta.rect_params.left = 40;
             objectMeta.rect_params.top = 40;
             objectMeta.rect_params.width = 230;
             objectMeta.rect_params.height = 130;
             
-            pTrackedObject->Update(3, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(3, 120, (NvBbox_Coords*)&objectMeta.rect_params);
 
             objectMeta.rect_params.left = 50;
             objectMeta.rect_params.top = 50;
             objectMeta.rect_params.width = 240;
             objectMeta.rect_params.height = 140;
             
-            pTrackedObject->Update(4, (NvBbox_Coords*)&objectMeta.rect_params);
+            pTrackedObject->Update(4, 160, (NvBbox_Coords*)&objectMeta.rect_params);
 
             THEN( "All attributes are updated correctly" )
             {
@@ -212,7 +212,7 @@ SCENARIO( "A TrackedObjects Container adds a Tracked Object correctly", "[Tracke
                 REQUIRE( pTrackedObjectsPerSource->IsTracked(frameMeta.source_id,
                         objectMeta.object_id) == true );
                         
-                std::shared_ptr<TrackedObject> pTrackedObject = 
+                TrackedObject* pTrackedObject = 
                     pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
                         objectMeta.object_id);
                         
@@ -285,11 +285,11 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Object correctly"
                 frameMeta.source_id = 1;
                 objectMeta.object_id = 1;
                 
-                std::shared_ptr<TrackedObject> pTrackedObject = 
+                TrackedObject* pTrackedObject = 
                     pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
                         objectMeta.object_id);
                         
-                pTrackedObject->Update(newFrameNumber, 
+                pTrackedObject->Update(newFrameNumber, newFrameNumber*40, 
                     (NvBbox_Coords*)&objectMeta.rect_params); 
 
                 frameMeta.source_id = 2;
@@ -298,7 +298,7 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Object correctly"
                 pTrackedObject = pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
                         objectMeta.object_id);
                         
-                pTrackedObject->Update(newFrameNumber, 
+                pTrackedObject->Update(newFrameNumber, newFrameNumber*40, 
                     (NvBbox_Coords*)&objectMeta.rect_params);
                     
                 frameMeta.source_id = 3;
@@ -307,12 +307,14 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Object correctly"
                 pTrackedObject = pTrackedObjectsPerSource->GetObject(frameMeta.source_id,
                     objectMeta.object_id);
                         
-                pTrackedObject->Update(newFrameNumber, 
+                pTrackedObject->Update(newFrameNumber, newFrameNumber*40, 
                     (NvBbox_Coords*)&objectMeta.rect_params);
 
                 // All should still be tracked after purging with the current frame number
                 
-                pTrackedObjectsPerSource->Purge(newFrameNumber);
+                pTrackedObjectsPerSource->Purge(1, newFrameNumber);
+                pTrackedObjectsPerSource->Purge(2, newFrameNumber);
+                pTrackedObjectsPerSource->Purge(3, newFrameNumber);
                 
                 frameMeta.source_id = 1;
                 objectMeta.object_id = 1;
@@ -331,7 +333,9 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Object correctly"
 
                 // All should be purged on the next frame if not uptdate
                 
-                pTrackedObjectsPerSource->Purge(newFrameNumber+1);
+                pTrackedObjectsPerSource->Purge(1, newFrameNumber+1);
+                pTrackedObjectsPerSource->Purge(2, newFrameNumber+1);
+                pTrackedObjectsPerSource->Purge(3, newFrameNumber+1);
                 
                 frameMeta.source_id = 1;
                 objectMeta.object_id = 1;
@@ -352,3 +356,327 @@ SCENARIO( "A TrackedObjects Container manages multiple Tracked Object correctly"
     }
 }
 
+
+SCENARIO( "A TrackedObject maintains its current and previous traces within max-history", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A new TrackedObject with a max-history of 4" ) 
+    {
+        NvBbox_Coords bbox = {0};
+        bbox.left = 10;
+        bbox.top = 10;
+        bbox.width = 100;
+        bbox.height = 100;
+
+        uint maxHistory(4);
+        
+        TrackedObject trackedObject(1234, 1, 40, &bbox, nullptr, maxHistory);
+        
+        WHEN( "The TrackedObject is updated past its max-history" )
+        {
+            for (uint i = 2; i <= 6; i++)
+            {
+                bbox.left = bbox.top = i*10;
+                trackedObject.Update(i, i*40, &bbox);
+            }
+            THEN( "Only the newest bbox coordinates are maintained" )
+            {
+                REQUIRE( trackedObject.BboxTraceSize() == maxHistory );
+                REQUIRE( trackedObject.HasPreviousTrace() == false );
+                
+                std::vector<dsl_coordinate> trace;
+                trackedObject.GetTraceCoordinates(DSL_BBOX_POINT_NORTH_WEST,
+                    DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, trace);
+
+                std::vector<dsl_coordinate> expectedTrace = 
+                    {{30,30},{40,40},{50,50},{60,60}};
+                    
+                REQUIRE( trace.size() == expectedTrace.size() );
+                for (auto i = 0; i < trace.size(); i++)
+                {
+                    REQUIRE( trace[i].x == expectedTrace[i].x );
+                    REQUIRE( trace[i].y == expectedTrace[i].y );
+                }
+                trackedObject.GetTraceCoordinates(DSL_BBOX_POINT_NORTH_WEST,
+                    DSL_OBJECT_TRACE_TEST_METHOD_END_POINTS, trace);
+                REQUIRE( trace.size() == 2 );
+                REQUIRE( trace[0].x == 30 );
+                REQUIRE( trace[1].x == 60 );
+            }
+        }
+        WHEN( "The TrackedObject handles an occurrence and is updated" )
+        {
+            for (uint i = 2; i <= 3; i++)
+            {
+                bbox.left = bbox.top = i*10;
+                trackedObject.Update(i, i*40, &bbox);
+            }
+            trackedObject.HandleOccurrence();
+            
+            for (uint i = 4; i <= 5; i++)
+            {
+                bbox.left = bbox.top = i*10;
+                trackedObject.Update(i, i*40, &bbox);
+            }
+            THEN( "The previous trace is purged first and shares its last point" )
+            {
+                REQUIRE( trackedObject.HasPreviousTrace() == true );
+                
+                DSL_RGBA_MULTI_LINE_PTR pPreviousTrace = 
+                    trackedObject.GetPreviousTrace(DSL_BBOX_POINT_NORTH_WEST,
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 1);
+                DSL_RGBA_MULTI_LINE_PTR pTrace = 
+                    trackedObject.GetTrace(DSL_BBOX_POINT_NORTH_WEST,
+                        DSL_OBJECT_TRACE_TEST_METHOD_ALL_POINTS, 1);
+                        
+                REQUIRE( pPreviousTrace->num_coordinates == 1 );
+                REQUIRE( pPreviousTrace->coordinates[0].x == 30 );
+                
+                REQUIRE( pTrace->num_coordinates == 3 );
+                REQUIRE( pTrace->coordinates[0].x == 30 );
+                REQUIRE( pTrace->coordinates[1].x == 40 );
+                REQUIRE( pTrace->coordinates[2].x == 50 );
+                
+                // next update removes the previous trace altogether
+                bbox.left = bbox.top = 60;
+                trackedObject.Update(6, 240, &bbox);
+                REQUIRE( trackedObject.HasPreviousTrace() == false );
+                REQUIRE( trackedObject.BboxTraceSize() == 4 );
+                REQUIRE( trackedObject.GetFirstCoordinate(
+                    DSL_BBOX_POINT_NORTH_WEST).x == 30 );
+            }
+        }
+        WHEN( "The TrackedObject's max-history is reduced" )
+        {
+            for (uint i = 2; i <= 4; i++)
+            {
+                bbox.left = bbox.top = i*10;
+                trackedObject.Update(i, i*40, &bbox);
+            }
+            trackedObject.SetMaxHistory(2);
+            
+            THEN( "The newest bbox coordinates are kept" )
+            {
+                REQUIRE( trackedObject.BboxTraceSize() == 2 );
+                REQUIRE( trackedObject.GetFirstCoordinate(
+                    DSL_BBOX_POINT_NORTH_WEST).x == 30 );
+                REQUIRE( trackedObject.GetLastCoordinate(
+                    DSL_BBOX_POINT_NORTH_WEST).x == 40 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObjects Container reuses the slots of deleted Tracked Objects", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A TrackedObjects container with many tracked objects" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        frameMeta.source_id = 0;
+        
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 20;
+        objectMeta.rect_params.top = 20;
+        objectMeta.rect_params.width = 210;
+        objectMeta.rect_params.height = 110;
+
+        uint maxTracePoints(10);
+
+        TrackedObjects trackedObjects(maxTracePoints);
+        
+        std::vector<TrackedObject*> trackedObjectPtrs;
+        
+        // more than the initial table size to force the table to grow.
+        for (objectMeta.object_id = 0; objectMeta.object_id < 100; 
+            objectMeta.object_id++)
+        {
+            trackedObjectPtrs.push_back(trackedObjects.Track(&frameMeta,
+                &objectMeta, nullptr));
+            REQUIRE( trackedObjectPtrs.back() != nullptr );
+        }
+        
+        WHEN( "Half the objects are deleted and new objects are tracked" )
+        {
+            for (uint64_t id = 0; id < 100; id += 2)
+            {
+                trackedObjects.DeleteObject(frameMeta.source_id, id);
+            }
+            for (objectMeta.object_id = 100; objectMeta.object_id < 150; 
+                objectMeta.object_id++)
+            {
+                TrackedObject* pTrackedObject = trackedObjects.Track(&frameMeta,
+                    &objectMeta, nullptr);
+                    
+                REQUIRE( std::find(trackedObjectPtrs.begin(), 
+                    trackedObjectPtrs.end(), pTrackedObject) != 
+                        trackedObjectPtrs.end() );
+                REQUIRE( pTrackedObject->trackingId == objectMeta.object_id );
+                REQUIRE( pTrackedObject->BboxTraceSize() == 1 );
+            }
+            THEN( "All remaining objects are found correctly" )
+            {
+                for (uint64_t id = 0; id < 150; id++)
+                {
+                    bool expected = (id >= 100 or id % 2);
+                    REQUIRE( trackedObjects.IsTracked(frameMeta.source_id, 
+                        id) == expected );
+                    if (expected)
+                    {
+                        REQUIRE( trackedObjects.GetObject(frameMeta.source_id, 
+                            id)->trackingId == id );
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObjects Container purges per source within the miss tolerance", 
+    "[TrackedObject]" )
+{
+    GIVEN( "A TrackedObjects container with a miss tolerance of 2" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 20;
+        objectMeta.rect_params.top = 20;
+        objectMeta.rect_params.width = 210;
+        objectMeta.rect_params.height = 110;
+
+        uint maxTracePoints(10);
+        uint missTolerance(2);
+
+        TrackedObjects trackedObjects(maxTracePoints, missTolerance);
+        
+        // Objects 1 and 2 for source 0 at frame 10, object 3 for source 1
+        // at frame 500 - sources have independent frame counters.
+        frameMeta.source_id = 0;
+        frameMeta.frame_num = 10;
+        objectMeta.object_id = 1;
+        REQUIRE( trackedObjects.Track(&frameMeta, &objectMeta, nullptr) != nullptr );
+        objectMeta.object_id = 2;
+        REQUIRE( trackedObjects.Track(&frameMeta, &objectMeta, nullptr) != nullptr );
+        
+        frameMeta.source_id = 1;
+        frameMeta.frame_num = 500;
+        objectMeta.object_id = 3;
+        REQUIRE( trackedObjects.Track(&frameMeta, &objectMeta, nullptr) != nullptr );
+        
+        WHEN( "Only one object for source 0 is updated over several frames" )
+        {
+            for (uint frameNum = 11; frameNum <= 13; frameNum++)
+            {
+                trackedObjects.GetObject(0, 1)->Update(frameNum, frameNum*40, 
+                    (NvBbox_Coords*)&objectMeta.rect_params);
+                trackedObjects.Purge(0, frameNum);
+                
+                // the missed object is kept until the tolerance is exceeded.
+                REQUIRE( trackedObjects.IsTracked(0, 2) == (frameNum <= 12) );
+            }
+            THEN( "The objects for the other source are unaffected" )
+            {
+                REQUIRE( trackedObjects.IsTracked(0, 1) == true );
+                REQUIRE( trackedObjects.IsTracked(1, 3) == true );
+                
+                trackedObjects.Purge(1, 503);
+                REQUIRE( trackedObjects.IsTracked(1, 3) == false );
+            }
+        }
+        WHEN( "The frame number for a source is reset" )
+        {
+            trackedObjects.Purge(0, 0);
+            
+            THEN( "All objects for the source are purged" )
+            {
+                REQUIRE( trackedObjects.IsTracked(0, 1) == false );
+                REQUIRE( trackedObjects.IsTracked(0, 2) == false );
+                REQUIRE( trackedObjects.IsTracked(1, 3) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A TrackedObject's duration is calculated from frame timestamps", 
+    "[TrackedObjects]" )
+{
+    GIVEN( "A new TrackedObjects container and an object tracked at PTS = 1s" ) 
+    {
+        NvDsFrameMeta frameMeta =  {0};
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.rect_params.left = 20;
+        objectMeta.rect_params.top = 20;
+        objectMeta.rect_params.width = 210;
+        objectMeta.rect_params.height = 110;
+
+        uint maxTracePoints(10);
+
+        TrackedObjects trackedObjects(maxTracePoints);
+        
+        frameMeta.frame_num = 1;
+        frameMeta.buf_pts = GST_SECOND;
+        objectMeta.object_id = 1;
+        
+        TrackedObject* pTrackedObject = 
+            trackedObjects.Track(&frameMeta, &objectMeta, nullptr);
+        REQUIRE( pTrackedObject != nullptr );
+        
+        WHEN( "The object is updated with a later frame" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = 3*GST_SECOND + 500*GST_MSECOND;
+            
+            pTrackedObject->Update(frameMeta.frame_num, 
+                trackedObjects.GetFrameTimeMs(&frameMeta),
+                (NvBbox_Coords*)&objectMeta.rect_params);
+            
+            THEN( "The duration is the difference in PTS" )
+            {
+                REQUIRE( pTrackedObject->GetDurationMs() == 2500 );
+            }
+        }
+        WHEN( "The object is updated with an earlier frame - after a seek" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = 0;
+            
+            pTrackedObject->Update(frameMeta.frame_num, 
+                trackedObjects.GetFrameTimeMs(&frameMeta),
+                (NvBbox_Coords*)&objectMeta.rect_params);
+            
+            THEN( "The duration is 0" )
+            {
+                REQUIRE( pTrackedObject->GetDurationMs() == 0 );
+            }
+        }
+        WHEN( "Frames have no valid PTS, but have an NTP timestamp" )
+        {
+            frameMeta.buf_pts = GST_CLOCK_TIME_NONE;
+            frameMeta.ntp_timestamp = 1000*GST_SECOND;
+            
+            THEN( "The NTP timestamp is used" )
+            {
+                REQUIRE( trackedObjects.GetFrameTimeMs(&frameMeta) == 1000000 );
+            }
+        }
+        WHEN( "Frames have no valid PTS or NTP timestamp" )
+        {
+            frameMeta.buf_pts = GST_CLOCK_TIME_NONE;
+            frameMeta.ntp_timestamp = 0;
+            
+            double firstTimeMs = trackedObjects.GetFrameTimeMs(&frameMeta);
+            g_usleep(2000);
+            double secondTimeMs = trackedObjects.GetFrameTimeMs(&frameMeta);
+            
+            frameMeta.frame_num++;
+            double nextTimeMs = trackedObjects.GetFrameTimeMs(&frameMeta);
+            
+            THEN( "The monotonic clock is read once per frame" )
+            {
+                REQUIRE( firstTimeMs == secondTimeMs );
+                REQUIRE( nextTimeMs > firstTimeMs );
+            }
+        }
+    }
+}
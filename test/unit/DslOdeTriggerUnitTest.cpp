@@ -30,7 +30,7 @@ THE SOFTWARE.
 
 using namespace DSL;
 
-static std::vector<NvDsDisplayMeta*> displayMetaData;
+static DisplayMetaData displayMetaData;
 
 static boolean ode_check_for_occurrence_cb(void* buffer,
     void* frame_meta, void* object_meta, void* client_data)
@@ -59,6 +59,12 @@ static void ode_occurrence_handler_cb_3(uint64_t event_id, const wchar_t* name,
     void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
 {
     std::cout << "Custom Action callback 3. called\n";
+}
+
+static void ode_occurrence_counter_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, void* client_data)
+{
+    (*(uint*)client_data)++;
 }    
 
 static void limit_event_listener_1(uint event, uint limit, void* client_data)
@@ -89,6 +95,13 @@ static void enabled_state_change_listener_2(boolean enabled, void* client_data)
         << enabled << "\n";
 }
 
+static uint criteria_change_count(0);
+
+static void criteria_change_listener(void* client_data)
+{
+    criteria_change_count++;
+}
+
 SCENARIO( "A new OdeOccurreceTrigger is created correctly", "[OdeTrigger]" )
 {
     GIVEN( "Attributes for a new DetectionEvent" ) 
@@ -253,6 +266,159 @@ SCENARIO( "An OdeOccurrenceTrigger calls all enabled-state-change-listeners on s
 }
 
 
+SCENARIO( "An OdeOccurrenceTrigger notifies its criteria-change-listeners", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a criteria-change-listener" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        criteria_change_count = 0;
+        
+        REQUIRE( pOdeTrigger->AddCriteriaChangeListener(
+            criteria_change_listener, NULL) == true );
+        REQUIRE( pOdeTrigger->AddCriteriaChangeListener(
+            criteria_change_listener, NULL) == false );
+
+        int sourceId(99);
+        std::vector<uint> classIds;
+        
+        REQUIRE( pOdeTrigger->GetRoutingCriteria(&sourceId, classIds) == true );
+        REQUIRE( sourceId == -1 );
+        REQUIRE( classIds.size() == 1 );
+        REQUIRE( classIds[0] == classId );
+        
+        WHEN( "The ODE Trigger's class-id, source-id and enabled setting are updated" )
+        {
+            pOdeTrigger->SetClassId(DSL_ODE_ANY_CLASS);
+            pOdeTrigger->_setSourceId(3);
+            pOdeTrigger->SetEnabled(false);
+            
+            THEN( "The criteria-change-listener is called for each update" )
+            {
+                REQUIRE( criteria_change_count == 3 );
+                
+                classIds.clear();
+                REQUIRE( pOdeTrigger->GetRoutingCriteria(&sourceId, 
+                    classIds) == false );
+                    
+                pOdeTrigger->SetEnabled(true);
+                REQUIRE( criteria_change_count == 4 );
+                REQUIRE( pOdeTrigger->GetRoutingCriteria(&sourceId, 
+                    classIds) == true );
+                REQUIRE( classIds[0] == DSL_ODE_ANY_CLASS );
+                    
+                REQUIRE( pOdeTrigger->RemoveCriteriaChangeListener(
+                    criteria_change_listener) == true );
+                REQUIRE( pOdeTrigger->RemoveCriteriaChangeListener(
+                    criteria_change_listener) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeOccurrenceTrigger publishes a new criteria snapshot on update", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with default criteria" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+
+        const OdeTriggerCriteria* pInitialCriteria = pOdeTrigger->GetCriteria();
+        
+        REQUIRE( pInitialCriteria->enabled == true );
+        REQUIRE( pInitialCriteria->classId == classId );
+        REQUIRE( pInitialCriteria->minConfidence == 0 );
+        
+        float minConfidence(0.5);
+        
+        WHEN( "The ODE Trigger's minimum confidence is updated between frames" )
+        {
+            pOdeTrigger->SetMinConfidence(minConfidence);
+            
+            THEN( "A new snapshot is published" )
+            {
+                const OdeTriggerCriteria* pNewCriteria = pOdeTrigger->GetCriteria();
+                
+                REQUIRE( pNewCriteria->minConfidence == minConfidence );
+                REQUIRE( pNewCriteria->classId == classId );
+            }
+        }
+        WHEN( "The ODE Trigger's minimum confidence is updated during a frame" )
+        {
+            NvDsFrameMeta frameMeta =  {0};
+            frameMeta.bInferDone = true;  
+            frameMeta.frame_num = 1;
+            frameMeta.source_id = 2;
+            
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+            pOdeTrigger->SetMinConfidence(minConfidence);
+            
+            THEN( "The pinned snapshot is retained until the frame is released" )
+            {
+                REQUIRE( pOdeTrigger->GetCriteria() == pInitialCriteria );
+                REQUIRE( pInitialCriteria->minConfidence == 0 );
+                
+                pOdeTrigger->ReleaseCriteria();
+                
+                const OdeTriggerCriteria* pNewCriteria = pOdeTrigger->GetCriteria();
+                
+                REQUIRE( pNewCriteria != pInitialCriteria );
+                REQUIRE( pNewCriteria->minConfidence == minConfidence );
+                
+                pOdeTrigger->ReclaimCriteria();
+                REQUIRE( pOdeTrigger->GetCriteria() == pNewCriteria );
+            }
+        }
+    }
+}
+
+SCENARIO( "An ABOdeTrigger returns both class-ids as routing criteria", "[OdeTrigger]" )
+{
+    GIVEN( "A new Intersection Trigger with two different class-ids" ) 
+    {
+        std::string odeTriggerName("intersection");
+        uint classIdA(1), classIdB(2);
+        uint limit(0);
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_INTERSECTION_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_INTERSECTION_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classIdA, classIdB, limit);
+
+        WHEN( "The routing criteria is queried" )
+        {
+            int sourceId(99);
+            std::vector<uint> classIds;
+            
+            REQUIRE( pOdeTrigger->GetRoutingCriteria(&sourceId, classIds) == true );
+            
+            THEN( "Both class-ids are returned" )
+            {
+                REQUIRE( sourceId == -1 );
+                REQUIRE( classIds.size() == 2 );
+                REQUIRE( classIds[0] == classIdA );
+                REQUIRE( classIds[1] == classIdB );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeOccurrenceTrigger executes its ODE Actions in the correct order ", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeTrigger and three print actions" ) 
@@ -1116,6 +1282,161 @@ SCENARIO( "An OdeOccurrenceTrigger checks its interval setting ", "[OdeTrigger]"
     }
 }
 
+SCENARIO( "An OdeOccurrenceTrigger checks its load-shedding interval", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger with a non-zero load-shedding interval" ) 
+    {
+        std::string odeTriggerName("occurence");
+        uint classId(1);
+        uint limit(0); // not limit
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        // Frame Meta test data
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 1;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        // Object Meta test data
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; // must match ODE Trigger's classId
+        objectMeta.object_id = INT64_MAX; 
+        objectMeta.rect_params.left = 10;
+        objectMeta.rect_params.top = 10;
+        objectMeta.rect_params.width = 200;
+        objectMeta.rect_params.height = 100;
+        
+        WHEN( "The ODE Trigger's load-shedding interval is set" )
+        {
+            pOdeTrigger->SetShedInterval(2);
+            
+            THEN( "Then ODE occurrence is triggered on every other frame" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+            }
+        }
+        WHEN( "The ODE Trigger's load-shedding interval is set for alternating sources" )
+        {
+            pOdeTrigger->SetShedInterval(2);
+            
+            NvDsFrameMeta otherFrameMeta = frameMeta;
+            otherFrameMeta.source_id = 3;
+            
+            THEN( "Then ODE occurrence is triggered on every other frame per source" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &otherFrameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &otherFrameMeta, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &otherFrameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &otherFrameMeta, &objectMeta) == true );
+            }
+        }
+        WHEN( "The ODE Trigger's load-shedding interval is set to shed all frames" )
+        {
+            pOdeTrigger->SetShedInterval(DSL_ODE_TRIGGER_SHED_INTERVAL_ALL);
+            
+            THEN( "The ODE is NOT triggered" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+            }
+        }
+        WHEN( "The ODE Trigger's load-shedding interval is cleared" )
+        {
+            pOdeTrigger->SetShedInterval(DSL_ODE_TRIGGER_SHED_INTERVAL_ALL);
+            pOdeTrigger->SetShedInterval(0);
+            
+            THEN( "The ODE is triggered on every frame" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdeTrigger is only source-partitionable with reentrant Actions", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeTrigger bound to a single source" ) 
+    {
+        std::string odeTriggerName("occurence");
+        std::string source("source-1");
+        uint classId(1);
+        uint limit(0);
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit);
+                
+        DSL_ODE_ACTION_REDACT_PTR pRedactAction = 
+            DSL_ODE_ACTION_REDACT_NEW("redact");
+        DSL_ODE_ACTION_PRINT_PTR pPrintAction = 
+            DSL_ODE_ACTION_PRINT_NEW("print", false);
+            
+        REQUIRE( pRedactAction->IsReentrant() == true );
+        REQUIRE( pPrintAction->IsReentrant() == false );
+        REQUIRE( pOdeTrigger->IsSourcePartitionable() == true );
+        
+        WHEN( "A reentrant Action is added" )
+        {
+            REQUIRE( pOdeTrigger->AddAction(pRedactAction) == true );
+            
+            THEN( "The Trigger remains source-partitionable" )
+            {
+                REQUIRE( pOdeTrigger->IsSourcePartitionable() == true );
+            }
+        }
+        WHEN( "An Action that is not reentrant is added" )
+        {
+            REQUIRE( pOdeTrigger->AddAction(pRedactAction) == true );
+            REQUIRE( pOdeTrigger->AddAction(pPrintAction) == true );
+            
+            THEN( "The Trigger is not source-partitionable until it's removed" )
+            {
+                REQUIRE( pOdeTrigger->IsSourcePartitionable() == false );
+                
+                REQUIRE( pOdeTrigger->RemoveAction(pPrintAction) == true );
+                REQUIRE( pOdeTrigger->IsSourcePartitionable() == true );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeOccurrenceTrigger checks for Area overlap correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeOccurenceTrigger with criteria" ) 
@@ -1426,6 +1747,54 @@ SCENARIO( "An OdeOccurrenceTrigger checks its Areas in the correct order", "[Ode
     }
 }
 
+SCENARIO( "An OdeAbsenceTrigger does not report absence on shed frames", "[OdeTrigger]" )
+{
+    GIVEN( "A new OdeAbsenceTrigger with a load-shedding interval" ) 
+    {
+        std::string odeTriggerName("absence");
+        uint classId(1);
+        uint limit(0); // not limit
+
+        std::string source;
+
+        DSL_ODE_TRIGGER_ABSENCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_ABSENCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        // Frame Meta test data
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;  
+        frameMeta.frame_num = 1;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        WHEN( "All frames are shed" )
+        {
+            pOdeTrigger->SetShedInterval(DSL_ODE_TRIGGER_SHED_INTERVAL_ALL);
+            
+            THEN( "Absence is NOT reported" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 0 );
+            }
+        }
+        WHEN( "Load-shedding is cleared" )
+        {
+            pOdeTrigger->SetShedInterval(DSL_ODE_TRIGGER_SHED_INTERVAL_ALL);
+            pOdeTrigger->SetShedInterval(0);
+            
+            THEN( "Absence is reported" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, 
+                    displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 1 );
+            }
+        }
+    }
+}
+
 SCENARIO( "An OdeAbsenceTrigger checks for Source Name correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new OdeAbsenceTrigger with default criteria" ) 
@@ -1867,14 +2236,104 @@ SCENARIO( "An InstanceOdeTrigger handles ODE Occurrences correctly", "[OdeTrigge
     }
 }
 
-SCENARIO( "An InstanceOdeTrigger Accumulates ODE Occurrences correctly", "[OdeTrigger]" )
+SCENARIO( "An OdeInstanceTable grows and evicts sources correctly", "[OdeTrigger]" )
 {
-    GIVEN( "A new InstanceOdeTrigger with specific Class Id and Source Id criteria" ) 
+    GIVEN( "A new OdeInstanceTable" ) 
     {
-        std::string odeTriggerName("instance");
-        std::string source("source-1");
-        uint classId(1);
-        uint limit(0);
+        OdeInstanceTable instances;
+        
+        WHEN( "Entries for many source_id-class_id combinations are added" )
+        {
+            for (uint sourceId = 0; sourceId < 16; sourceId++)
+            {
+                for (int classId = -1; classId < 63; classId++)
+                {
+                    instances.Find(sourceId, classId) = sourceId*1000 + classId+1;
+                }
+            }
+            THEN( "All entries are retained and a source can be evicted" )
+            {
+                REQUIRE( instances.GetSize() == 16*64 );
+                REQUIRE( instances.Find(7, -1) == 7000 );
+                REQUIRE( instances.Find(15, 62) == 15063 );
+                
+                instances.EvictSource(7);
+                REQUIRE( instances.GetSize() == 15*64 );
+                REQUIRE( instances.Find(6, 10) == 6011 );
+                REQUIRE( instances.Find(8, 10) == 8011 );
+                
+                // Evicted entries are re-added as new
+                REQUIRE( instances.Find(7, 10) == 0 );
+                
+                instances.Clear();
+                REQUIRE( instances.GetSize() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An InstanceOdeTrigger evicts the instances for a replaced source", "[OdeTrigger]" )
+{
+    GIVEN( "A new InstanceOdeTrigger with specific Class Id and Source Id criteria" ) 
+    {
+        std::string odeTriggerName("instance");
+        std::string source("source-1");
+        uint classId(1);
+        uint limit(0);
+
+        uint sourceId = Services::GetServices()->_sourceNameSet(source.c_str());
+
+        DSL_ODE_TRIGGER_INSTANCE_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_INSTANCE_NEW(odeTriggerName.c_str(), source.c_str(), classId, limit);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.bInferDone = true;
+        frameMeta.frame_num = 444;
+        frameMeta.source_id = sourceId;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId; 
+        objectMeta.object_id = 5; 
+        
+        pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+            displayMetaData, &frameMeta, &objectMeta) == true );
+        
+        WHEN( "The frame number for the source increases" )
+        {
+            frameMeta.frame_num = 445;
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+
+            THEN( "The same instance does not trigger an ODE occurrence" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                Services::GetServices()->_sourceNameErase(source.c_str());
+            }
+        }
+        WHEN( "The frame number for the source restarts" )
+        {
+            frameMeta.frame_num = 0;
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+
+            THEN( "The same instance triggers a new ODE occurrence" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                Services::GetServices()->_sourceNameErase(source.c_str());
+            }
+        }
+    }
+}
+
+SCENARIO( "An InstanceOdeTrigger Accumulates ODE Occurrences correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new InstanceOdeTrigger with specific Class Id and Source Id criteria" ) 
+    {
+        std::string odeTriggerName("instance");
+        std::string source("source-1");
+        uint classId(1);
+        uint limit(0);
 
         std::string odeAccumulatorName("accumulator-name");
         std::string odeActionName("print-action");
@@ -2505,6 +2964,147 @@ SCENARIO( "A CountOdeTrigger handles ODE Occurrence correctly", "[OdeTrigger]" )
     }
 }
 
+SCENARIO( "A ClassCountOdeTrigger counts ODE Occurrences per class correctly", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new ClassCountOdeTrigger with three class-ids" ) 
+    {
+        std::string odeTriggerName("class-count");
+        std::string source;
+        uint classIds[] = {7, 1, 4};
+        uint limit(0);
+
+        std::string odeActionName("event-action");
+
+        DSL_ODE_TRIGGER_CLASS_COUNT_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_CLASS_COUNT_NEW(odeTriggerName.c_str(), source.c_str(), 
+                classIds, 3, limit);
+
+        DSL_ODE_ACTION_PRINT_PTR pOdeAction = 
+            DSL_ODE_ACTION_PRINT_NEW(odeActionName.c_str(), false);
+            
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );        
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = 1;
+        
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = 7;
+        
+        NvDsObjectMeta objectMeta3 = {0};
+        objectMeta3.class_id = 7;
+
+        NvDsObjectMeta objectMeta4 = {0};
+        objectMeta4.class_id = 3; // not in the Trigger's set of class-ids
+        
+        WHEN( "Objects of all classes occur in a frame" )
+        {
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta1) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta2) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta3) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta4) == false );
+            
+            THEN( "The per-class counts are saved for the frame's source" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 3 );
+                
+                const uint* counts(NULL);
+                uint size(0);
+                pOdeTrigger->GetClassCounts(2, &counts, &size);
+                REQUIRE( size == 3 );
+                REQUIRE( counts[0] == 1 ); // class-id 1
+                REQUIRE( counts[1] == 0 ); // class-id 4
+                REQUIRE( counts[2] == 2 ); // class-id 7
+                
+                pOdeTrigger->GetClassCounts(0, &counts, &size);
+                REQUIRE( size == 3 );
+                REQUIRE( counts[2] == 0 );
+                
+                // counts are reset on the next frame
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 0 );
+                pOdeTrigger->GetClassCounts(2, &counts, &size);
+                REQUIRE( counts[2] == 0 );
+            }
+        }
+        WHEN( "The Trigger's class-ids are updated" )
+        {
+            uint newClassIds[] = {3};
+            REQUIRE( pOdeTrigger->SetClassIds(newClassIds, 1) == true );
+            
+            THEN( "Only Objects of the new class-ids are counted" )
+            {
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta1) == false );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta4) == true );
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 1 );
+                    
+                std::vector<uint> routingClassIds;
+                int sourceId(0);
+                REQUIRE( pOdeTrigger->GetRoutingCriteria(&sourceId, 
+                    routingClassIds) == true );
+                REQUIRE( routingClassIds.size() == 1 );
+                REQUIRE( routingClassIds[0] == 3 );
+            }
+        }
+        WHEN( "The Trigger is bound to a source" )
+        {
+            std::string boundSource("source-1");
+            uint boundSourceId = 
+                Services::GetServices()->_sourceNameSet(boundSource.c_str());
+            pOdeTrigger->SetSource(boundSource.c_str());
+            
+            uint callCount(0);
+            DSL_ODE_ACTION_CUSTOM_PTR pCounterAction = 
+                DSL_ODE_ACTION_CUSTOM_NEW("counter", 
+                    ode_occurrence_counter_cb, &callCount);
+            REQUIRE( pOdeTrigger->AddAction(pCounterAction) == true );
+            
+            frameMeta.source_id = boundSourceId;
+            pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &frameMeta);
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta2) == true );
+            pOdeTrigger->PostProcessFrame(NULL, displayMetaData, &frameMeta);
+            REQUIRE( callCount == 1 );
+            
+            THEN( "The frames of other sources are not counted or reported" )
+            {
+                NvDsFrameMeta otherFrameMeta = frameMeta;
+                otherFrameMeta.source_id = boundSourceId+1;
+                
+                pOdeTrigger->PreProcessFrame(NULL, displayMetaData, &otherFrameMeta);
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &otherFrameMeta, &objectMeta2) == false );
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &otherFrameMeta) == 0 );
+                REQUIRE( callCount == 1 );
+                
+                const uint* counts(NULL);
+                uint size(0);
+                pOdeTrigger->GetClassCounts(boundSourceId, &counts, &size);
+                REQUIRE( counts[2] == 1 ); // class-id 7
+                
+                Services::GetServices()->_sourceNameErase(boundSource.c_str());
+            }
+        }
+    }
+}
+
 SCENARIO( "A SmallestOdeTrigger handles an ODE Occurrence correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new SmallestOdeTrigger" ) 
@@ -2613,6 +3213,109 @@ SCENARIO( "A LargestOdeTrigger handles am ODE Occurrence correctly", "[OdeTrigge
     }
 }
 
+SCENARIO( "A TopKOdeTrigger handles ODE Occurrences correctly", "[OdeTrigger]" )
+{
+    GIVEN( "A new TopKOdeTrigger ranking the two largest bottom-y values" ) 
+    {
+        std::string odeTriggerName("top-k");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        uint k(2);
+
+        std::string odeActionName("print-action");
+
+        DSL_ODE_TRIGGER_TOP_K_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_TOP_K_NEW(odeTriggerName.c_str(), source.c_str(), 
+                classId, limit, k, DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y,
+                DSL_ODE_TRIGGER_TOP_K_ORDER_LARGEST);
+
+        DSL_ODE_ACTION_PRINT_PTR pOdeAction = 
+            DSL_ODE_ACTION_PRINT_NEW(odeActionName.c_str(), false);
+            
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );        
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 2;
+
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = classId; // must match ODE Trigger's classId
+        objectMeta1.rect_params.top = 100;
+        objectMeta1.rect_params.width = 100;
+        objectMeta1.rect_params.height = 100;
+
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = classId; // must match ODE Trigger's classId
+        objectMeta2.rect_params.top = 300;
+        objectMeta2.rect_params.width = 100;
+        objectMeta2.rect_params.height = 100;
+
+        NvDsObjectMeta objectMeta3 = {0};
+        objectMeta3.class_id = classId; // must match ODE Trigger's classId
+        objectMeta3.rect_params.top = 0;
+        objectMeta3.rect_params.width = 100;
+        objectMeta3.rect_params.height = 100;
+
+        NvDsObjectMeta objectMeta4 = {0};
+        objectMeta4.class_id = classId; // must match ODE Trigger's classId
+        objectMeta4.rect_params.top = 200;
+        objectMeta4.rect_params.width = 100;
+        objectMeta4.rect_params.height = 100;
+        
+        WHEN( "Four objects occur" )
+        {
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta1) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta2) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta3) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta4) == true );
+            
+            THEN( "Only the top K objects are reported with their key values" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == k );
+                REQUIRE( objectMeta2.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 400 );
+                REQUIRE( objectMeta4.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 300 );
+                REQUIRE( objectMeta1.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 0 );
+                REQUIRE( objectMeta3.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 0 );
+                
+                // The heap must be reset for the next frame
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 0 );
+            }
+        }
+        WHEN( "The settings are updated to the smallest order" )
+        {
+            pOdeTrigger->SetSettings(1, DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y,
+                DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST);
+                
+            uint retK(0), retKey(99), retOrder(99);
+            pOdeTrigger->GetSettings(&retK, &retKey, &retOrder);
+            REQUIRE( retK == 1 );
+            REQUIRE( retKey == DSL_ODE_TRIGGER_TOP_K_KEY_BOTTOM_Y );
+            REQUIRE( retOrder == DSL_ODE_TRIGGER_TOP_K_ORDER_SMALLEST );
+
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta1) == true );
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta3) == true );
+            
+            THEN( "Only the smallest object is reported" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 1 );
+                REQUIRE( objectMeta3.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 100 );
+                REQUIRE( objectMeta1.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A PersistenceOdeTrigger adds/updates tracked objects correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new PersistenceOdeTrigger with criteria" ) 
@@ -2862,6 +3565,276 @@ SCENARIO( "A PersistenceOdeTrigger Post Processes ODE Occurrences correctly", "[
     }
 }
 
+SCENARIO( "A DwellOdeTrigger updates occupancy and triggers on dwell time correctly", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new DwellOdeTrigger with an Inclusion Area" ) 
+    {
+        std::string odeTriggerName("dwell");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        uint threshold(1);
+
+        std::string odeActionName("event-action");
+        std::string odeAreaName("ode-area");
+
+        std::string polygonName  = "my-polygon";
+        dsl_coordinate coordinates[4] = {{100,100},{200,100},{200, 200},{100,200}};
+        uint numCoordinates(4);
+        uint lineWidth(4);
+
+        DSL_RGBA_COLOR_PTR pColor = DSL_RGBA_COLOR_NEW("my-color", 
+            0.12, 0.34, 0.56, 0.78);
+
+        DSL_RGBA_POLYGON_PTR pPolygon = DSL_RGBA_POLYGON_NEW(polygonName.c_str(), 
+            coordinates, numCoordinates, lineWidth, pColor);
+            
+        DSL_ODE_AREA_INCLUSION_PTR pOdeArea =
+            DSL_ODE_AREA_INCLUSION_NEW(odeAreaName.c_str(), pPolygon, 
+                false, DSL_BBOX_POINT_CENTER);
+
+        DSL_ODE_TRIGGER_DWELL_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_DWELL_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit, threshold);
+
+        DSL_ODE_ACTION_PRINT_PTR pOdeAction = 
+            DSL_ODE_ACTION_PRINT_NEW(odeActionName.c_str(), false);
+            
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );        
+        REQUIRE( pOdeTrigger->AddArea(pOdeArea) == true );
+        
+        uint occupancy(99);
+        REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+        REQUIRE( occupancy == 0 );
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        frameMeta.buf_pts = 0;
+        frameMeta.source_id = 1;
+
+        // object inside the Area
+        NvDsObjectMeta objectMeta1 = {0};
+        objectMeta1.class_id = classId;
+        objectMeta1.object_id = 1;
+        objectMeta1.rect_params.left = 140;
+        objectMeta1.rect_params.top = 140;
+        objectMeta1.rect_params.width = 20;
+        objectMeta1.rect_params.height = 20;
+
+        // object outside the Area
+        NvDsObjectMeta objectMeta2 = {0};
+        objectMeta2.class_id = classId;
+        objectMeta2.object_id = 2;
+        objectMeta2.rect_params.left = 300;
+        objectMeta2.rect_params.top = 300;
+        objectMeta2.rect_params.width = 20;
+        objectMeta2.rect_params.height = 20;
+        
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+            displayMetaData, &frameMeta, &objectMeta1) == false );
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+            displayMetaData, &frameMeta, &objectMeta2) == false );
+        REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+        REQUIRE( occupancy == 1 );
+        
+        WHEN( "The objects are tracked for the threshold time" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            
+            THEN( "Only the object inside the Area triggers, once per visit" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta1) == true );
+                REQUIRE( objectMeta1.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 1 );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta2) == false );
+                    
+                frameMeta.frame_num = 3;
+                frameMeta.buf_pts = 2*GST_SECOND;
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta1) == false );
+                REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+                REQUIRE( occupancy == 1 );
+            }
+        }
+        WHEN( "The objects swap places" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            objectMeta1.rect_params.left = objectMeta2.rect_params.left;
+            objectMeta2.rect_params.left = 140;
+            objectMeta2.rect_params.top = 140;
+            
+            THEN( "The occupancy is unchanged and the dwell time restarts" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta1) == false );
+                REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+                REQUIRE( occupancy == 0 );
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta2) == false );
+                REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+                REQUIRE( occupancy == 1 );
+            }
+        }
+        WHEN( "The object inside the Area is no longer detected" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta2) == false );
+            
+            THEN( "The occupancy is decremented when the object is purged" )
+            {
+                REQUIRE( pOdeTrigger->PostProcessFrame(NULL, 
+                    displayMetaData, &frameMeta) == 0 );
+                REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+                REQUIRE( occupancy == 0 );
+            }
+        }
+        WHEN( "The Trigger is reset" )
+        {
+            pOdeTrigger->Reset();
+            
+            THEN( "The occupancy is cleared" )
+            {
+                REQUIRE( pOdeTrigger->GetOccupancy(pOdeArea, &occupancy) == true );
+                REQUIRE( occupancy == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A VelocityOdeTrigger estimates speed and heading correctly", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "A new VelocityOdeTrigger with a minimum speed" ) 
+    {
+        std::string odeTriggerName("velocity");
+        std::string source;
+        uint classId(1);
+        uint limit(0);
+        double minimum(50);
+        double maximum(0);
+
+        std::string odeActionName("event-action");
+
+        DSL_ODE_TRIGGER_VELOCITY_PTR pOdeTrigger = 
+            DSL_ODE_TRIGGER_VELOCITY_NEW(odeTriggerName.c_str(), 
+                source.c_str(), classId, limit, minimum, maximum);
+
+        DSL_ODE_ACTION_PRINT_PTR pOdeAction = 
+            DSL_ODE_ACTION_PRINT_NEW(odeActionName.c_str(), false);
+            
+        REQUIRE( pOdeTrigger->AddAction(pOdeAction) == true );        
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 1;
+        frameMeta.buf_pts = 0;
+        frameMeta.source_id = 1;
+
+        NvDsObjectMeta objectMeta = {0};
+        objectMeta.class_id = classId;
+        objectMeta.object_id = 1;
+        objectMeta.rect_params.left = 100;
+        objectMeta.rect_params.top = 100;
+        objectMeta.rect_params.width = 20;
+        objectMeta.rect_params.height = 20;
+        
+        // velocity is unknown on first detection
+        REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+            displayMetaData, &frameMeta, &objectMeta) == false );
+        
+        WHEN( "The object moves right at 100 pixels per second" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            objectMeta.rect_params.left = 200;
+            
+            THEN( "An occurrence is triggered with the speed and heading" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                REQUIRE( objectMeta.misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] == 
+                    100*DSL_ODE_TRIGGER_VELOCITY_METRIC_SCALE );
+                REQUIRE( objectMeta.misc_obj_info[DSL_OBJECT_INFO_HEADING] == 0 );
+            }
+        }
+        WHEN( "The object moves right slower than the minimum speed" )
+        {
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            objectMeta.rect_params.left = 120;
+            
+            THEN( "An occurrence is not triggered" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+            }
+        }
+        WHEN( "The heading range excludes objects moving right" )
+        {
+            pOdeTrigger->SetHeadingRange(45, 135);
+            
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            objectMeta.rect_params.left = 200;
+            
+            THEN( "Only the object moving down triggers an occurrence" )
+            {
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+
+                frameMeta.frame_num = 3;
+                frameMeta.buf_pts = 2*GST_SECOND;
+                objectMeta.rect_params.top = 400;
+                objectMeta.rect_params.left = 200;
+                
+                // smoothed velocity (50,150) is heading ~72 degrees
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == true );
+                REQUIRE( objectMeta.misc_obj_info[DSL_OBJECT_INFO_HEADING] == 72 );
+            }
+        }
+        WHEN( "A homography is set for the source" )
+        {
+            // scales pixels to world units by 0.1
+            double homography[9] = {0.1,0,0, 0,0.1,0, 0,0,1};
+            REQUIRE( pOdeTrigger->SetHomography(frameMeta.source_id, 
+                homography) == true );
+            
+            // tracked objects are cleared when the homography is set
+            REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                displayMetaData, &frameMeta, &objectMeta) == false );
+            
+            frameMeta.frame_num = 2;
+            frameMeta.buf_pts = GST_SECOND;
+            objectMeta.rect_params.left = 200;
+            
+            THEN( "The speed is measured in world units" )
+            {
+                // 10 units per second is less than the minimum
+                REQUIRE( pOdeTrigger->CheckForOccurrence(NULL, 
+                    displayMetaData, &frameMeta, &objectMeta) == false );
+                REQUIRE( pOdeTrigger->RemoveHomography(frameMeta.source_id) == true );
+                REQUIRE( pOdeTrigger->RemoveHomography(frameMeta.source_id) == false );
+            }
+        }
+        WHEN( "An invalid homography is set for the source" )
+        {
+            double homography[9] = {0,0,0, 0,0,0, 0,0,1};
+            
+            THEN( "The homography is rejected" )
+            {
+                REQUIRE( pOdeTrigger->SetHomography(frameMeta.source_id, 
+                    homography) == false );
+            }
+        }
+    }
+}
+
 SCENARIO( "A LatestOdeTrigger adds/updates tracked objects correctly", "[OdeTrigger]" )
 {
     GIVEN( "A new LatestOdeTrigger with criteria" ) 
@@ -3965,4 +4938,220 @@ SCENARIO( "A new Ralational OdeDistanceTrigger handles occurrence correctly", "[
             }
         }
     }
-}    
\ No newline at end of file
+}    
+static void fill_random_objects(std::vector<NvDsObjectMeta>& objectMetas, 
+    uint count, uint classId, uint seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<float> x(0, 1820), y(0, 980), size(20, 100);
+    
+    objectMetas.assign(count, NvDsObjectMeta{0});
+    for (auto& objectMeta: objectMetas)
+    {
+        objectMeta.class_id = classId;
+        objectMeta.rect_params.left = x(generator);
+        objectMeta.rect_params.top = y(generator);
+        objectMeta.rect_params.width = size(generator);
+        objectMeta.rect_params.height = size(generator);
+    }
+}
+
+static uint post_process_objects(DSL_ODE_TRIGGER_AB_PTR pOdeTrigger, 
+    std::vector<NvDsObjectMeta>& objectMetas, NvDsFrameMeta* pFrameMeta)
+{
+    for (auto& objectMeta: objectMetas)
+    {
+        pOdeTrigger->CheckForOccurrence(NULL, displayMetaData, pFrameMeta, &objectMeta);
+    }
+    return pOdeTrigger->PostProcessFrame(NULL, displayMetaData, pFrameMeta);
+}
+
+static void require_same_primary_metrics(std::vector<NvDsObjectMeta>& objectMetasA,
+    std::vector<NvDsObjectMeta>& objectMetasB)
+{
+    for (uint i = 0; i < objectMetasA.size(); i++)
+    {
+        REQUIRE( objectMetasA[i].misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] ==
+            objectMetasB[i].misc_obj_info[DSL_OBJECT_INFO_PRIMARY_METRIC] );
+    }
+}
+
+SCENARIO( "The broad-phase produces the same occurrences as the brute-force path", 
+    "[OdeTrigger]" )
+{
+    GIVEN( "Two sets of the same 150 randomly placed objects" ) 
+    {
+        std::string source;
+        uint classIdA(1), classIdB(2), limit(0);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.frame_num = 444;
+        frameMeta.ntp_timestamp = INT64_MAX;
+        frameMeta.source_id = 0;
+
+        std::vector<NvDsObjectMeta> bruteForceObjects, broadPhaseObjects;
+        fill_random_objects(bruteForceObjects, 150, classIdA, 1234);
+        fill_random_objects(broadPhaseObjects, 150, classIdA, 1234);
+        
+        // make every third object a Class B object 
+        for (uint i = 0; i < bruteForceObjects.size(); i += 3)
+        {
+            bruteForceObjects[i].class_id = classIdB;
+            broadPhaseObjects[i].class_id = classIdB;
+        }
+        
+        WHEN( "Two Intersection Triggers - A/A - process the objects" )
+        {
+            DSL_ODE_TRIGGER_INTERSECTION_PTR pBruteForceTrigger = 
+                DSL_ODE_TRIGGER_INTERSECTION_NEW("brute-force", 
+                    source.c_str(), classIdA, classIdA, limit);
+            DSL_ODE_TRIGGER_INTERSECTION_PTR pBroadPhaseTrigger = 
+                DSL_ODE_TRIGGER_INTERSECTION_NEW("broad-phase", 
+                    source.c_str(), classIdA, classIdA, limit);
+                
+            pBruteForceTrigger->SetBroadPhaseMinObjects(UINT32_MAX);
+            pBroadPhaseTrigger->SetBroadPhaseMinObjects(0);
+            
+            THEN( "The same occurrences are detected" )
+            {
+                uint occurrences = post_process_objects(pBruteForceTrigger,
+                    bruteForceObjects, &frameMeta);
+                REQUIRE( occurrences > 0 );
+                REQUIRE( post_process_objects(pBroadPhaseTrigger,
+                    broadPhaseObjects, &frameMeta) == occurrences );
+                require_same_primary_metrics(bruteForceObjects, broadPhaseObjects);
+            }
+        }
+        WHEN( "Two Intersection Triggers - A/B - process the objects" )
+        {
+            DSL_ODE_TRIGGER_INTERSECTION_PTR pBruteForceTrigger = 
+                DSL_ODE_TRIGGER_INTERSECTION_NEW("brute-force", 
+                    source.c_str(), classIdA, classIdB, limit);
+            DSL_ODE_TRIGGER_INTERSECTION_PTR pBroadPhaseTrigger = 
+                DSL_ODE_TRIGGER_INTERSECTION_NEW("broad-phase", 
+                    source.c_str(), classIdA, classIdB, limit);
+                
+            pBruteForceTrigger->SetBroadPhaseMinObjects(UINT32_MAX);
+            pBroadPhaseTrigger->SetBroadPhaseMinObjects(0);
+            
+            THEN( "The same occurrences are detected" )
+            {
+                uint occurrences = post_process_objects(pBruteForceTrigger,
+                    bruteForceObjects, &frameMeta);
+                REQUIRE( occurrences > 0 );
+                REQUIRE( post_process_objects(pBroadPhaseTrigger,
+                    broadPhaseObjects, &frameMeta) == occurrences );
+                require_same_primary_metrics(bruteForceObjects, broadPhaseObjects);
+            }
+        }
+        WHEN( "Two Distance Triggers - A/A - process the objects" )
+        {
+            uint minimum(60), maximum(UINT32_MAX);
+
+            DSL_ODE_TRIGGER_DISTANCE_PTR pBruteForceTrigger = 
+                DSL_ODE_TRIGGER_DISTANCE_NEW("brute-force", source.c_str(), 
+                    classIdA, classIdA, limit, minimum, maximum, 
+                    DSL_BBOX_POINT_SOUTH, DSL_DISTANCE_METHOD_FIXED_PIXELS);
+            DSL_ODE_TRIGGER_DISTANCE_PTR pBroadPhaseTrigger = 
+                DSL_ODE_TRIGGER_DISTANCE_NEW("broad-phase", source.c_str(), 
+                    classIdA, classIdA, limit, minimum, maximum, 
+                    DSL_BBOX_POINT_SOUTH, DSL_DISTANCE_METHOD_FIXED_PIXELS);
+                
+            pBruteForceTrigger->SetBroadPhaseMinObjects(UINT32_MAX);
+            pBroadPhaseTrigger->SetBroadPhaseMinObjects(0);
+            
+            THEN( "The same occurrences are detected" )
+            {
+                uint occurrences = post_process_objects(pBruteForceTrigger,
+                    bruteForceObjects, &frameMeta);
+                REQUIRE( occurrences > 0 );
+                REQUIRE( post_process_objects(pBroadPhaseTrigger,
+                    broadPhaseObjects, &frameMeta) == occurrences );
+                require_same_primary_metrics(bruteForceObjects, broadPhaseObjects);
+            }
+        }
+        WHEN( "Two Distance Triggers - A/B - process the objects" )
+        {
+            uint minimum(50), maximum(1000000); // units of percent
+
+            DSL_ODE_TRIGGER_DISTANCE_PTR pBruteForceTrigger = 
+                DSL_ODE_TRIGGER_DISTANCE_NEW("brute-force", source.c_str(), 
+                    classIdA, classIdB, limit, minimum, maximum, 
+                    DSL_BBOX_POINT_ANY, DSL_DISTANCE_METHOD_PERCENT_WIDTH_A);
+            DSL_ODE_TRIGGER_DISTANCE_PTR pBroadPhaseTrigger = 
+                DSL_ODE_TRIGGER_DISTANCE_NEW("broad-phase", source.c_str(), 
+                    classIdA, classIdB, limit, minimum, maximum, 
+                    DSL_BBOX_POINT_ANY, DSL_DISTANCE_METHOD_PERCENT_WIDTH_A);
+                
+            pBruteForceTrigger->SetBroadPhaseMinObjects(UINT32_MAX);
+            pBroadPhaseTrigger->SetBroadPhaseMinObjects(0);
+            
+            THEN( "The same occurrences are detected" )
+            {
+                uint occurrences = post_process_objects(pBruteForceTrigger,
+                    bruteForceObjects, &frameMeta);
+                REQUIRE( occurrences > 0 );
+                REQUIRE( post_process_objects(pBroadPhaseTrigger,
+                    broadPhaseObjects, &frameMeta) == occurrences );
+                require_same_primary_metrics(bruteForceObjects, broadPhaseObjects);
+            }
+        }
+    }
+}
+
+// Benchmark scenario - hidden by default. Run with the "[.benchmark]" tag to 
+// print the brute-force and broad-phase times for an increasing number of 
+// objects per frame, to find the crossover point.
+SCENARIO( "The broad-phase outperforms brute-force above a number of objects", 
+    "[.benchmark]" )
+{
+    GIVEN( "An increasing number of randomly placed objects" ) 
+    {
+        std::string source;
+        uint classId(1), limit(0), frames(100);
+
+        NvDsFrameMeta frameMeta =  {0};
+        frameMeta.source_id = 0;
+
+        WHEN( "Brute-force and broad-phase Intersection Triggers process the objects" )
+        {
+            DSL_ODE_TRIGGER_INTERSECTION_PTR pBruteForceTrigger = 
+                DSL_ODE_TRIGGER_INTERSECTION_NEW("brute-force", 
+                    source.c_str(), classId, classId, limit);
+            DSL_ODE_TRIGGER_INTERSECTION_PTR pBroadPhaseTrigger = 
+                DSL_ODE_TRIGGER_INTERSECTION_NEW("broad-phase", 
+                    source.c_str(), classId, classId, limit);
+                
+            pBruteForceTrigger->SetBroadPhaseMinObjects(UINT32_MAX);
+            pBroadPhaseTrigger->SetBroadPhaseMinObjects(0);
+            
+            THEN( "The time per frame for each is printed" )
+            {
+                for (uint count: {2, 4, 8, 12, 16, 24, 32, 64, 100, 150})
+                {
+                    std::vector<NvDsObjectMeta> objectMetas;
+                    fill_random_objects(objectMetas, count, classId, count);
+                    
+                    auto start = std::chrono::steady_clock::now();
+                    for (uint i = 0; i < frames; i++)
+                    {
+                        post_process_objects(pBruteForceTrigger, objectMetas, &frameMeta);
+                    }
+                    auto middle = std::chrono::steady_clock::now();
+                    for (uint i = 0; i < frames; i++)
+                    {
+                        post_process_objects(pBroadPhaseTrigger, objectMetas, &frameMeta);
+                    }
+                    auto end = std::chrono::steady_clock::now();
+                    
+                    std::cout << "objects = " << count 
+                        << ", brute-force = " << std::chrono::duration_cast
+                            <std::chrono::microseconds>(middle - start).count()/frames 
+                        << "us, broad-phase = " << std::chrono::duration_cast
+                            <std::chrono::microseconds>(end - middle).count()/frames 
+                        << "us per frame\n";
+                }
+            }
+        }
+    }
+}
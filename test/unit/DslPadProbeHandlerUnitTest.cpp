@@ -25,6 +25,8 @@ THE SOFTWARE.
 #include "catch.hpp"
 #include "DslPadProbeHandler.h"
 #include "DslTrackerBintr.h"
+#include "DslOdeAction.h"
+#include "DslServices.h"
 
 using namespace DSL;
 
@@ -115,6 +117,360 @@ SCENARIO( "A OdePadProbeHandler can add and remove an OdeTrigger", "[PadProbeHan
     }
 }
 
+SCENARIO( "OdeRuntimeMetrics accumulate frame and single measurements correctly", "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdeRuntimeMetrics object" ) 
+    {
+        OdeRuntimeMetrics runtimeMetrics;
+        dsl_ode_runtime_metrics metrics{99, 99, 99, 99};
+        
+        runtimeMetrics.Get(&metrics);
+        REQUIRE( metrics.evaluations == 0 );
+        REQUIRE( metrics.occurrences == 0 );
+        REQUIRE( metrics.total_time == 0 );
+        REQUIRE( metrics.max_time == 0 );
+        
+        // Metrics are inactive for this thread by default
+        REQUIRE( OdeRuntimeMetrics::IsActive() == false );
+
+        WHEN( "Two frames and a single measurement are recorded" )
+        {
+            runtimeMetrics.AddToFrame(0, 0, 100);
+            runtimeMetrics.AddToFrame(1, 0, 200);
+            runtimeMetrics.AddToFrame(1, 2, 300);
+            runtimeMetrics.RecordFrame();
+            
+            runtimeMetrics.AddToFrame(1, 1, 50);
+            runtimeMetrics.RecordFrame();
+            
+            runtimeMetrics.Record(1, 1, 400);
+            
+            THEN( "The correct metrics are returned" )
+            {
+                runtimeMetrics.Get(&metrics);
+                REQUIRE( metrics.evaluations == 4 );
+                REQUIRE( metrics.occurrences == 4 );
+                REQUIRE( metrics.total_time == 1050 );
+                REQUIRE( metrics.max_time == 600 );
+                
+                runtimeMetrics.Clear();
+                runtimeMetrics.Get(&metrics);
+                REQUIRE( metrics.evaluations == 0 );
+                REQUIRE( metrics.occurrences == 0 );
+                REQUIRE( metrics.total_time == 0 );
+                REQUIRE( metrics.max_time == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdePadProbeHandler can enable metrics and clear its Triggers' metrics", "[PadProbeHandler]" )
+{
+    GIVEN( "A new OdePadProbeHandler and OdeTrigger" ) 
+    {
+        std::string odeHandlerName = "ode-handler";
+        std::string odeTriggerName = "occurence";
+
+        DSL_PPH_ODE_PTR pPadProbeHandler = 
+            DSL_PPH_ODE_NEW(odeHandlerName.c_str());
+
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW(odeTriggerName.c_str(), "", 
+                DSL_ODE_ANY_CLASS, 0);
+
+        REQUIRE( pPadProbeHandler->AddChild(pOccurrenceTrigger) == true );
+        REQUIRE( pPadProbeHandler->GetMetricsEnabled() == false );
+            
+        pOccurrenceTrigger->GetRuntimeMetrics().Record(1, 1, 100);
+        pPadProbeHandler->GetRuntimeMetrics().Record(1, 1, 100);
+
+        WHEN( "Metrics are enabled and then cleared" )
+        {
+            pPadProbeHandler->SetMetricsEnabled(true);
+            pPadProbeHandler->ClearMetrics();
+            
+            THEN( "The Handler and Trigger metrics are cleared" )
+            {
+                dsl_ode_runtime_metrics metrics{99, 99, 99, 99};
+                
+                REQUIRE( pPadProbeHandler->GetMetricsEnabled() == true );
+                
+                pPadProbeHandler->GetRuntimeMetrics().Get(&metrics);
+                REQUIRE( metrics.evaluations == 0 );
+                REQUIRE( metrics.total_time == 0 );
+                
+                pOccurrenceTrigger->GetRuntimeMetrics().Get(&metrics);
+                REQUIRE( metrics.evaluations == 0 );
+                REQUIRE( metrics.total_time == 0 );
+            }
+        }
+    }
+}
+
+/**
+ * @brief ODE occurrences recorded by trigger name and source id.
+ */
+struct OdeEventRecorder
+{
+    OdeEventRecorder(){g_mutex_init(&mutex);};
+    ~OdeEventRecorder(){g_mutex_clear(&mutex);};
+    
+    GMutex mutex;
+    std::vector<std::pair<std::wstring, uint>> events;
+};
+
+static void ode_event_recorder_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, 
+    void* client_data)
+{
+    OdeEventRecorder* pRecorder = (OdeEventRecorder*)client_data;
+    
+    LOCK_MUTEX_FOR_CURRENT_SCOPE(&pRecorder->mutex);
+    pRecorder->events.push_back(std::make_pair(std::wstring(name), 
+        ((NvDsFrameMeta*)frame_meta)->source_id));
+}
+
+static DSL_PPH_ODE_PTR new_source_bound_handler(const char* name, 
+    uint workerCount, OdeEventRecorder* pRecorder)
+{
+    DSL_PPH_ODE_PTR pHandler = DSL_PPH_ODE_NEW(name);
+    REQUIRE( pHandler->SetWorkerCount(workerCount) == true );
+    
+    DSL_ODE_ACTION_CUSTOM_PTR pAction = 
+        DSL_ODE_ACTION_CUSTOM_NEW("record", ode_event_recorder_cb, pRecorder);
+    
+    // Frame-level Triggers, one bound to each source
+    DSL_ODE_TRIGGER_SUMMATION_PTR pSummationA = 
+        DSL_ODE_TRIGGER_SUMMATION_NEW("summation-a", "source-a", 0, 0);
+    DSL_ODE_TRIGGER_SUMMATION_PTR pSummationB = 
+        DSL_ODE_TRIGGER_SUMMATION_NEW("summation-b", "source-b", 0, 0);
+    DSL_ODE_TRIGGER_NEW_HIGH_PTR pNewHighA = 
+        DSL_ODE_TRIGGER_NEW_HIGH_NEW("new-high-a", "source-a", 0, 0, 0);
+        
+    REQUIRE( pSummationA->AddAction(pAction) == true );
+    REQUIRE( pSummationB->AddAction(pAction) == true );
+    REQUIRE( pNewHighA->AddAction(pAction) == true );
+    REQUIRE( pHandler->AddChild(pSummationA) == true );
+    REQUIRE( pHandler->AddChild(pSummationB) == true );
+    REQUIRE( pHandler->AddChild(pNewHighA) == true );
+    
+    return pHandler;
+}
+
+SCENARIO( "An OdePadProbeHandler produces the same ODE occurrences serially and in parallel", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A serial and a parallel OdePadProbeHandler with source-bound Triggers" ) 
+    {
+        uint sourceIdA = Services::GetServices()->_sourceNameSet("source-a");
+        uint sourceIdB = Services::GetServices()->_sourceNameSet("source-b");
+        
+        OdeEventRecorder serialEvents;
+        OdeEventRecorder parallelEvents;
+        
+        DSL_PPH_ODE_PTR pSerialHandler = 
+            new_source_bound_handler("serial-handler", 0, &serialEvents);
+        DSL_PPH_ODE_PTR pParallelHandler = 
+            new_source_bound_handler("parallel-handler", 2, &parallelEvents);
+        
+        // One frame per source, each with one object
+        GstBuffer* pBuffer = gst_buffer_new();
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(2);
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        
+        for (auto sourceId: {sourceIdA, sourceIdB})
+        {
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = sourceId;
+            pFrameMeta->batch_id = sourceId;
+            pFrameMeta->bInferDone = true;
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+            
+            NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+            pObjectMeta->class_id = 0;
+            pObjectMeta->confidence = 0.9;
+            pObjectMeta->rect_params.width = 100;
+            pObjectMeta->rect_params.height = 100;
+            nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+        }
+        GstPadProbeInfo info = {(GstPadProbeType)0};
+        info.data = pBuffer;
+
+        WHEN( "The same multi-source batch is processed by both Handlers" )
+        {
+            pSerialHandler->HandlePadData(&info);
+            pParallelHandler->HandlePadData(&info);
+            
+            THEN( "Each Trigger only occurs for its own source, in the same order" )
+            {
+                // Custom Actions are not reentrant, so their Triggers are 
+                // processed serially, in batch order, in both modes.
+                std::vector<std::pair<std::wstring, uint>> expectedEvents{
+                    {L"summation-a", sourceIdA},
+                    {L"new-high-a", sourceIdA},
+                    {L"summation-b", sourceIdB}};
+                    
+                REQUIRE( serialEvents.events == expectedEvents );
+                REQUIRE( parallelEvents.events == expectedEvents );
+                
+                gst_buffer_unref(pBuffer);
+                Services::GetServices()->_sourceNameErase("source-a");
+                Services::GetServices()->_sourceNameErase("source-b");
+            }
+        }
+    }
+}
+
+SCENARIO( "An OdePadProbeHandler processes Triggers with reentrant Actions in parallel", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "A parallel OdePadProbeHandler with source-bound Triggers sharing a Redact Action" ) 
+    {
+        uint sourceIdA = Services::GetServices()->_sourceNameSet("source-a");
+        uint sourceIdB = Services::GetServices()->_sourceNameSet("source-b");
+        
+        DSL_PPH_ODE_PTR pHandler = DSL_PPH_ODE_NEW("parallel-handler");
+        REQUIRE( pHandler->SetWorkerCount(2) == true );
+        
+        DSL_ODE_ACTION_REDACT_PTR pAction = DSL_ODE_ACTION_REDACT_NEW("redact");
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceA = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence-a", "source-a", 0, 0);
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceB = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence-b", "source-b", 0, 0);
+            
+        REQUIRE( pOccurrenceA->AddAction(pAction) == true );
+        REQUIRE( pOccurrenceB->AddAction(pAction) == true );
+        REQUIRE( pHandler->AddChild(pOccurrenceA) == true );
+        REQUIRE( pHandler->AddChild(pOccurrenceB) == true );
+        
+        // One frame per source, each with one object
+        GstBuffer* pBuffer = gst_buffer_new();
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(2);
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        
+        std::vector<NvDsObjectMeta*> objects;
+        for (auto sourceId: {sourceIdA, sourceIdB})
+        {
+            NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+            pFrameMeta->source_id = sourceId;
+            pFrameMeta->batch_id = sourceId;
+            pFrameMeta->bInferDone = true;
+            nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+            
+            NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+            pObjectMeta->class_id = 0;
+            pObjectMeta->confidence = 0.9;
+            pObjectMeta->rect_params.width = 100;
+            pObjectMeta->rect_params.height = 100;
+            pObjectMeta->rect_params.has_bg_color = 0;
+            nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+            objects.push_back(pObjectMeta);
+        }
+        GstPadProbeInfo info = {(GstPadProbeType)0};
+        info.data = pBuffer;
+
+        WHEN( "The multi-source batch is processed by the Handler" )
+        {
+            REQUIRE( pOccurrenceA->IsSourcePartitionable() == true );
+            REQUIRE( pOccurrenceB->IsSourcePartitionable() == true );
+            
+            pHandler->HandlePadData(&info);
+            
+            THEN( "The objects of all sources are redacted" )
+            {
+                for (auto pObjectMeta: objects)
+                {
+                    REQUIRE( pObjectMeta->rect_params.has_bg_color == 1 );
+                }
+                gst_buffer_unref(pBuffer);
+                Services::GetServices()->_sourceNameErase("source-a");
+                Services::GetServices()->_sourceNameErase("source-b");
+            }
+        }
+    }
+}
+
+/**
+ * @brief Handler and Trigger to remove from within a Custom Action callback.
+ */
+struct OdeTriggerRemover
+{
+    DSL_PPH_ODE_PTR pHandler;
+    DSL_BASE_PTR pTrigger;
+    bool removed;
+};
+
+static void ode_trigger_remover_cb(uint64_t event_id, const wchar_t* name,
+    void* buffer, void* display_meta, void* frame_meta, void* object_meta, 
+    void* client_data)
+{
+    OdeTriggerRemover* pRemover = (OdeTriggerRemover*)client_data;
+    
+    pRemover->removed = pRemover->pHandler->RemoveChild(pRemover->pTrigger);
+}
+
+SCENARIO( "An OdePadProbeHandler's Trigger can be removed from an Action callback", 
+    "[PadProbeHandler]" )
+{
+    GIVEN( "An OdePadProbeHandler with a Trigger that removes itself on occurrence" ) 
+    {
+        DSL_PPH_ODE_PTR pHandler = DSL_PPH_ODE_NEW("ode-handler");
+        
+        DSL_ODE_TRIGGER_OCCURRENCE_PTR pOccurrenceTrigger = 
+            DSL_ODE_TRIGGER_OCCURRENCE_NEW("occurrence", "", 0, 0);
+
+        OdeTriggerRemover remover{pHandler, pOccurrenceTrigger, false};
+        
+        DSL_ODE_ACTION_CUSTOM_PTR pAction = 
+            DSL_ODE_ACTION_CUSTOM_NEW("remove", ode_trigger_remover_cb, &remover);
+            
+        REQUIRE( pOccurrenceTrigger->AddAction(pAction) == true );
+        REQUIRE( pHandler->AddChild(pOccurrenceTrigger) == true );
+        
+        // One frame with one object
+        GstBuffer* pBuffer = gst_buffer_new();
+        NvDsBatchMeta* pBatchMeta = nvds_create_batch_meta(1);
+        NvDsMeta* pMeta = gst_buffer_add_nvds_meta(pBuffer, pBatchMeta, NULL,
+            nvds_batch_meta_copy_func, nvds_batch_meta_release_func);
+        pMeta->meta_type = NVDS_BATCH_GST_META;
+        
+        NvDsFrameMeta* pFrameMeta = nvds_acquire_frame_meta_from_pool(pBatchMeta);
+        pFrameMeta->bInferDone = true;
+        nvds_add_frame_meta_to_batch(pBatchMeta, pFrameMeta);
+        
+        NvDsObjectMeta* pObjectMeta = nvds_acquire_obj_meta_from_pool(pBatchMeta);
+        pObjectMeta->class_id = 0;
+        pObjectMeta->confidence = 0.9;
+        pObjectMeta->rect_params.width = 100;
+        pObjectMeta->rect_params.height = 100;
+        nvds_add_obj_meta_to_frame(pFrameMeta, pObjectMeta, NULL);
+        GstPadProbeInfo info = {(GstPadProbeType)0};
+        info.data = pBuffer;
+
+        WHEN( "The batch is processed by the Handler" )
+        {
+            pHandler->HandlePadData(&info);
+            
+            THEN( "The Trigger is removed and is not processed on the next batch" )
+            {
+                REQUIRE( remover.removed == true );
+                REQUIRE( pOccurrenceTrigger->IsParent(pHandler) == false );
+                
+                remover.removed = false;
+                pHandler->HandlePadData(&info);
+                REQUIRE( remover.removed == false );
+                
+                gst_buffer_unref(pBuffer);
+            }
+        }
+    }
+}
+
 SCENARIO( "A new MeterPadProbeHandler is created correctly", "[PadProbeHandler]" )
 {
     GIVEN( "Attributes for a new MeterPadProbeHandler" ) 
@@ -0,0 +1,91 @@
+/*
+The MIT License
+
+Copyright (c) 2019-2021, Prominence AI, Inc.
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#include "catch.hpp"
+#include "DslWorkerPool.h"
+
+using namespace DSL;
+
+static void worker_pool_task(uint index, void* client_data)
+{
+    std::vector<std::atomic<uint>>* pCounts = 
+        (std::vector<std::atomic<uint>>*)client_data;
+    (*pCounts)[index]++;
+}
+
+SCENARIO( "A new WorkerPool is created correctly", "[WorkerPool]" )
+{
+    GIVEN( "Attributes for a new WorkerPool" ) 
+    {
+        std::string workerPoolName("worker-pool");
+        uint numWorkers(4);
+
+        WHEN( "A new WorkerPool is created" )
+        {
+            DSL_WORKER_POOL_PTR pWorkerPool = 
+                DSL_WORKER_POOL_NEW(workerPoolName.c_str(), numWorkers);
+
+            THEN( "All attributes are setup correctly" )
+            {
+                REQUIRE( pWorkerPool->GetNumWorkers() == numWorkers );
+            }
+        }
+    }
+}
+
+SCENARIO( "A WorkerPool executes each task exactly once", "[WorkerPool]" )
+{
+    GIVEN( "A new WorkerPool" ) 
+    {
+        std::string workerPoolName("worker-pool");
+        uint numWorkers(3);
+
+        DSL_WORKER_POOL_PTR pWorkerPool = 
+            DSL_WORKER_POOL_NEW(workerPoolName.c_str(), numWorkers);
+
+        std::vector<std::atomic<uint>> counts(16);
+        for (auto &ivec: counts)
+        {
+            ivec = 0;
+        }
+
+        WHEN( "The WorkerPool executes several sets of tasks" )
+        {
+            uint numSets(10);
+            for (uint i=0; i < numSets; i++)
+            {
+                pWorkerPool->Execute(counts.size(), worker_pool_task, &counts);
+            }
+
+            THEN( "Each task is executed once per set" )
+            {
+                for (auto &ivec: counts)
+                {
+                    REQUIRE( ivec == numSets );
+                }
+            }
+        }
+    }
+}